@@ -23,12 +23,15 @@
 
 #include "T3DBound.h"
 #include "T3DAabb.h"
+#include "Misc/T3DObjectPool.h"
 
 
 namespace Tiny3D
 {
     class T3D_ENGINE_API AabbBound : public Bound
     {
+        T3D_DECLARE_POOL_ALLOCATOR(AabbBound);
+
     public:
         static AabbBoundPtr create(uint32_t unID, SGNode *node);
 
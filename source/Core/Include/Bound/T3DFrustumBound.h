@@ -43,6 +43,19 @@ namespace Tiny3D
 
         void setParam(const Plane *plane, size_t planeCount);
 
+        /**
+         * @brief 设置遍历场景时还需要测试的面
+         * @param [in] mask : 面掩码，第i位对应Frustum::Face(i)
+         * @remarks 父结点包围盒已经完全在某个面内侧的，子结点就不用再测试这个面，
+         *      剔除时父结点修改掩码，处理完子结点后恢复
+         */
+        void setPlaneMask(uint32_t mask)    { mPlaneMask = mask; }
+
+        /**
+         * @brief 获取遍历场景时还需要测试的面
+         */
+        uint32_t getPlaneMask() const       { return mPlaneMask; }
+
     protected:
         FrustumBound(uint32_t unID, SGNode *node);
 
@@ -57,6 +70,7 @@ namespace Tiny3D
 
         Frustum     mFrustum;
         SGBoxPtr    mRenderable;
+        uint32_t    mPlaneMask;     /// 当前遍历位置还需要测试的面
     };
 }
 
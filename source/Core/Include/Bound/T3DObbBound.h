@@ -40,6 +40,17 @@ namespace Tiny3D
 
         const Obb &getObb() const   { return mObb; }
 
+        /**
+         * @brief 设置本地空间的有向包围盒
+         * @param [in] center : 中心点
+         * @param [in] axis : 三个互相垂直的单位轴
+         * @param [in] extent : 三个轴上的半长
+         * @return void
+         */
+        void setParams(const Vector3 &center, const Vector3 *axis, const Real *extent);
+
+        const Obb &getOriginalObb() const   { return mOriginalObb; }
+
     protected:
         ObbBound(uint32_t unID, SGNode *node);
 
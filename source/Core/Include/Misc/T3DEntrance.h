@@ -34,16 +34,16 @@ namespace Tiny3D
 
     /**
      * @class Entrance
-     * @brief Tiny3D
+     * @brief Tiny3D入口类
      */
     class T3D_ENGINE_API Entrance : public Singleton<Entrance>
     {
     public:
         /** 
-         * @brief ĬϹ캯
-         * @param [in] appPath : ĳ·һ·Ա·Ϊ
-         * @param [in] isMemoryTracing : Ƿڴй©ܣùܻڳ˳ʱӡй©Ķ
-         * @param [in] config : ļ
+         * @brief 默认构造函数
+         * @param [in] appPath : 传入的程序路径，引擎中一切路径均以本路径作为参照
+         * @param [in] isMemoryTracing : 是否开启跟踪内存泄漏功能，该功能会在程序退出时候打印出泄漏的对象
+         * @param [in] config : 引擎配置文件
          */
         Entrance(const String &appPath, bool isMemoryTracing = false, const String &config = "Tiny3D.cfg");
 
@@ -108,12 +108,12 @@ namespace Tiny3D
             const RenderWindowCreateParamEx &rkCreatedParamEx);
 
         /**
-         * @brief ô¼
+         * @brief 设置窗口事件处理对象
          */
         void setWindowEventHandler(WindowEventHandler *handler);
 
         /**
-         * @brief ȡ¼
+         * @brief 获取窗口事件处理对象
          */
         WindowEventHandler *getWindowEventHandler();
 
@@ -144,60 +144,85 @@ namespace Tiny3D
         SceneManager *getSceneManager() { return mSceneMgr; }
 
         /**
-         * @brief Ӧó·
+         * @brief 返回应用程序路径
          */
         const String &getAppPath() const { return mAppPath; }
 
         /**
-         * @brief Ӧó
+         * @brief 返回应用程序名称
          */
         const String &getAppName() const { return mAppName; }
 
         /**
-         * @brief ز·
+         * @brief 返回插件路径
          */
         const String &getPluginsPath() const { return mPluginsPath; }
 
-        void addBatchCounter() { mBatchCounter++; }
+        void addBatchCounter(uint32_t count = 1) { mBatchCounter += count; }
 
     protected:
         /**
-         * @brief ļԶв
+         * @brief 根据配置文件自动加载所有插件
          */
         void loadPlugins();
 
         /**
-         * @brief жв
+         * @brief 卸载所有插件
          */
         void unloadPlugins();
 
         /**
-         * @brief ־ϵͳԿʼӡ־
+         * @brief 启动日志系统，可以开始打印日志
          */
         void startLogging();
 
         /**
-         * @brief ر־ϵͳ֮޷ӡ־
+         * @brief 关闭日志系统，在之后无法打印日志
          */
         void stopLogging();
 
         /**
-         * @brief ͳʼеṹ
+         * @brief 按配置文件Profiler里的选项设置帧分析器
+         */
+        void startProfiling();
+
+        /**
+         * @brief 结束分析器的一帧，帧耗时超过阈值时导出最近若干帧
+         */
+        void profileFrame();
+
+        /**
+         * @brief 按配置文件Tasks里的选项启动任务调度器
+         */
+        void startTasks();
+
+        /**
+         * @brief 停止任务调度器，之后提交的任务直接在调用线程上执行
+         */
+        void stopTasks();
+
+        /**
+         * @brief 按配置文件Scene里的选项设置场景并行更新
+         */
+        void setupSceneUpdate();
+
+        /**
+         * @brief 创建和初始化所有档案结构对象
          */
         void initArchives();
 
         /**
-         * @brief ʼļָԴ
+         * @brief 初始化配置文件里面指定的资源
          */
         void initResources();
 
         /**
-         * @brief ʼͳϵͳ
+         * @brief 初始化统计系统
          */
         void initStatistics();
 
         /**
-         * @brief ָ
+         * @brief 计算性能指标数据
          */
         void calculatePerformance();
 
@@ -213,6 +238,7 @@ namespace Tiny3D
         System                  *mSystem;
         Logger                  *mLogger;
         MemoryTracer            *mMemoryTracer;
+        TaskScheduler           *mTaskScheduler;
 
         DylibManager            *mDylibMgr;
         ArchiveManager          *mArchiveMgr;
@@ -239,17 +265,22 @@ namespace Tiny3D
 
         SceneManager    *mSceneMgr;
 
-        SGText2DPtr     mFPSText;           /// ʾFPSϢ
-        SGText2DPtr     mSPFText;           /// ʾSPFϢ
-        SGText2DPtr     mDrawText;          /// ʾdraw callϢ
+        SGText2DPtr     mFPSText;           /// 用于显示FPS信息
+        SGText2DPtr     mSPFText;           /// 用于显示SPF信息
+        SGText2DPtr     mDrawText;          /// 用于显示draw call信息
 
         ImageCodec      *mImageCodec;
 
-        Real            mFrameRate;         /// ֡
-        uint64_t        mFrames;            /// ֡
-        uint64_t        mDeltaTime;         /// ֡ʱ
-        uint64_t        mLastTime;          /// ¼һ֡ʱ
-        uint32_t        mBatchCounter;      /// μ
+        Real            mFrameRate;         /// 帧率
+        uint64_t        mFrames;            /// 总帧数
+        uint64_t        mDeltaTime;         /// 帧间隔时间
+        uint64_t        mLastTime;          /// 记录上一帧时刻
+        uint32_t        mBatchCounter;      /// 批次技术
+
+        String          mTracePath;         /// 帧耗时超过阈值时导出的Chrome trace文件路径
+        uint64_t        mSpikeThreshold;    /// 帧耗时阈值，纳秒，0表示不检测
+        uint32_t        mTraceFrames;       /// 每次导出的帧数
+        uint32_t        mLastTraceFrame;    /// 上一次导出时的帧序号
 
         bool            mShutdown;
     };
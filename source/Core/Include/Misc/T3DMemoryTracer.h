@@ -23,14 +23,16 @@
 
 #include "T3DPrerequisites.h"
 #include "Misc/T3DObject.h"
+#include <mutex>
 
 
 namespace Tiny3D
 {
     /**
      * @class MemoryTracer
-     * @brief һڴܹ࣬Objectڴй©
-     * @note ĸٵܴʱһģڶλڴ͹رյ
+     * @brief 一个跟踪内存的类，能够跟踪所有Object其派生类内存泄漏的情况
+     * @note 这里的跟踪当对象数量很大的时候会有一定的性能损耗，建议这里在定位完内存问题就关闭掉跟踪。
+     *      对象的最后一个引用可能在任务线程上释放，对象集合用互斥量保护。
      */
     class T3D_ENGINE_API MemoryTracer : public Singleton<MemoryTracer>
     {
@@ -39,61 +41,67 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~MemoryTracer();
 
         /**
-         * @brief ȡڴǷ
-         * @return ڴ״̬
+         * @brief 获取内存跟踪是否打开
+         * @return 返回内存跟踪器工作状态
          */
         bool isTracingEnabled() const { return mIsEnabled; }
 
         /**
-         * @brief ǰڴϢӦƽ̨Console
+         * @brief 输出当前内存信息到对应平台Console
          * @return void
-         * @note Ӧƽ̨consoleϣϸƽ̨£
-         *  - windowsϣconsoleϣһvsOutput
-         *  - iOSMac OS XϣxcodeConsole
-         *  - Androidϣlogcat
+         * @note 该输出会输出到对应平台的console上，详细平台如下：
+         *  - 在windows上，这个会输出到console上，并且会输出到vs的Output窗口里
+         *  - 在iOS和Mac OS X上，这个会输出到xcode的Console窗口里
+         *  - 在Android上，这个会输出到logcat里
          */
         void dumpMemoryInfo() const;
 
         /**
-         * @brief ǰڴϢļ
-         * @param [in] fs : ļ
+         * @brief 输出当前内存信息到文件流里
+         * @param [in] fs : 文件流
          * @return void
          */
         void dumpMemoryInfo(FileDataStream &fs) const;
 
     protected:
         /**
-         * @brief ĬϹ캯
-         * @param [in] enabled : ǷڴٹܣĬǹرյ
+         * @brief 默认构造函数
+         * @param [in] enabled : 是否开启内存跟踪功能，默认是关闭的
          */
         MemoryTracer(bool enabled = false);
 
         /**
-         * @brief һڴ
+         * @brief 添加一个对象到内存跟踪器里
          */
         void addObject(Object *object)
         {
             if (mIsEnabled)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
                 mObjects.insert(object);
+            }
         }
 
         /**
-         * @brief ڴƳһ
+         * @brief 从内存跟踪器里移除一个对象
          */
         void removeObject(Object *object)
         {
             if (mIsEnabled)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
                 mObjects.erase(object);
+            }
         }
 
         /** 
-         * @brief Ϣ
-         * @param [in] str : Ϣַ
+         * @brief 输出信息
+         * @param [in] str : 信息字符串
          */
         void printInfo(const String &str) const;
 
@@ -102,10 +110,11 @@ namespace Tiny3D
         typedef Objects::const_iterator ObjectsConstItr;
         typedef Objects::value_type     ObjectsValue;
 
-        bool                    mIsEnabled;     /// Ƿڴ
-        Objects                 mObjects;       /// 󼯺
+        bool                    mIsEnabled;     /// 是否开启了内存跟踪
+        Objects                 mObjects;       /// 对象集合
+        mutable std::mutex      mMutex;         /// 保护对象集合，对象可能在多个线程上同时创建和销毁
 
-        mutable FileDataStream  *mStream;       /// ʱdumpMemoryInfoʱ
+        mutable FileDataStream  *mStream;       /// 临时输出对象，用于dumpMemoryInfo的时候
     };
 }
 
@@ -29,84 +29,95 @@ namespace Tiny3D
 {
     /**
      * @class Node
-     * @brief νṹĽ
+     * @brief 树形结构的结点基类
      */
     class T3D_ENGINE_API Node : public Object
     {
     public:
         /**
-         * @brief ID
+         * @brief 结点ID
          */
         enum ID
         {
-            E_NID_AUTOMATIC = -1,       /// ԶID
-            E_NID_INVALID = 0,          /// ЧID
+            E_NID_AUTOMATIC = -1,       /// 自动生成ID
+            E_NID_INVALID = 0,          /// 无效ID
         };
 
         /**
-         * @brief 
+         * @brief 结点类型
          */
         enum Type
         {
-            E_NT_UNKNOWN = 0,           /// δ֪
-
-            E_NT_TRANSFORM,             /// 3D任
-            E_NT_TRANSFORM2D,           /// 2D任
-            E_NT_BONE,                  /// 任
-
-            E_NT_CAMERA,                /// 
-            E_NT_MODEL,                 /// ģͽ
-
-            E_NT_LIGHT,                 /// ƹ
-            E_NT_GEOMETRY,              /// 
-            E_NT_MESH,                  /// 
-            E_NT_SPHERE,                /// 
-            E_NT_BOX,                   /// 
-            E_NT_SKELETON,              /// ȾĹ
-            E_NT_AXIS,                  /// 
-            E_NT_QUAD,                  /// ıν
-            E_NT_SPRITE,                /// 
-            E_NT_TEXT2D,                /// 2Dı
+            E_NT_UNKNOWN = 0,           /// 未知结点类型
+
+            E_NT_TRANSFORM,             /// 3D变换结点
+            E_NT_TRANSFORM2D,           /// 2D变换结点
+            E_NT_BONE,                  /// 骨骼变换结点
+
+            E_NT_CAMERA,                /// 相机结点
+            E_NT_MODEL,                 /// 模型结点
+
+            E_NT_LIGHT,                 /// 灯光结点
+            E_NT_GEOMETRY,              /// 几何物体结点
+            E_NT_MESH,                  /// 网格结点
+            E_NT_SPHERE,                /// 球型物体结点
+            E_NT_BOX,                   /// 立方体结点
+            E_NT_SKELETON,              /// 可渲染的骨骼结点
+            E_NT_AXIS,                  /// 坐标轴结点
+            E_NT_QUAD,                  /// 四边形结点
+            E_NT_SPRITE,                /// 精灵结点
+            E_NT_TEXT2D,                /// 2D文本结点
+            E_NT_STATIC_BATCH,          /// 静态合批结点
+            E_NT_BATCH_CHUNK,           /// 静态合批后的可渲染块结点
+            E_NT_OCCLUDER,              /// 遮挡体结点
         };
 
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~Node();
 
         /**
-         * @brief ؽ
-         * @return ؽ
+         * @brief 返回结点类型
+         * @return 返回结点类型
          * @see enum Type
-         * @note ÿ඼ҪʵֱӿڣԷؾͣʵ֣޷ʵ
+         * @note 每个派生类都要实现本接口，以返回具体的类型，如果不实现，则无法实例化对象了
          */
         virtual Type getNodeType() const = 0;
 
         /**
-         * @brief ؽȫΨһʶID
-         * @return ؽID
+         * @brief 返回结点全局唯一标识ID
+         * @return 返回结点ID
          * @see enum ID
          */
         uint32_t getNodeID() const;
 
         /**
-         * @brief ý
-         * @param [in] name : 
+         * @brief 设置结点名称
+         * @param [in] name : 结点名称
          * @return void
          * @see const String &getName() const
+         * @note 名称同时登记到全局名称表，按名称查找子结点时只比较名称ID
          */
-        void setName(const String &name);
+        virtual void setName(const String &name);
 
         /**
-         * @brief ȡ
-         * @return ؽ
+         * @brief 获取结点名称
+         * @return 返回结点名称
          * @see void setName(const String &name)
          */
         const String &getName() const;
 
         /**
-         * @brief һӽ
-         * @param [in] node : ӽ
+         * @brief 获取结点名称在全局名称表里的ID
+         * @return 返回名称ID，没有名称的返回NameTable::E_INVALID_NAME
+         * @see class NameTable
+         */
+        uint32_t getNameID() const;
+
+        /**
+         * @brief 添加一个子结点
+         * @param [in] node : 子结点对象
          * @return void
          * @see void removeChild(const NodePtr &node, bool cleanup)
          * @see void removeChild(uint32_t nodeID, bool cleanup)
@@ -114,141 +125,173 @@ namespace Tiny3D
         virtual void addChild(const NodePtr &node);
 
         /**
-         * @brief Ƴһӽ
-         * @param [in] node : ӽ
-         * @param [in] cleanup : Ƿɾӽ㣬trueʾɾfalseʾƳɾӽ
+         * @brief 移除一个子结点
+         * @param [in] node : 子结点对象
+         * @param [in] cleanup : 是否删除子结点，true表示删除，false表示仅仅移除而并不删除子结点
          * @return void
          * @see void removeChild(uint32_t nodeID, bool cleanup)
          */
         virtual void removeChild(const NodePtr &node, bool cleanup);
 
         /**
-         8 @brief Ƴһӽ
-         * @param [in] nodeID : ΨһʶID
-         * @param [in] cleanup : Ƿɾӽ㣬trueʾɾfalseʾƳɾӽ
+         8 @brief 移除一个子结点
+         * @param [in] nodeID : 结点唯一标识ID
+         * @param [in] cleanup : 是否删除子结点，true表示删除，false表示仅仅移除而并不删除子结点
          * @return void
          * @see void removeChild(const NodePtr &node, bool cleanup)
          */
         virtual void removeChild(uint32_t nodeID, bool cleanup);
 
         /**
-         * @brief Ƴӽ
-         * @param [in] cleanup : Ƿɾӽ㣬trueʾɾfalseʾƳɾӽ
+         * @brief 移除所有子结点
+         * @param [in] cleanup : 是否删除所有子结点，true表示删除，false表示仅仅移除而并不删除子结点
          * @return void
          */
         virtual void removeAllChildren(bool cleanup);
 
         /**
-         * @brief ӸƳԼ
-         * @param [in] cleanup : ǷɾԼtrueʾɾfalseʾƳɾԼ
+         * @brief 从父结点移除自己
+         * @param [in] cleanup : 是否删除自己，true表示删除，false表示仅仅移除而并不删除自己
          * @return void
-         * @note cleanuptrueú󣬱Ѿͷˣڷκνӿں
+         * @note 当cleanup用true调用后，本身结点已经被释放了，则不能在访问任何结点接口和数据
          */
         void removeFromParent(bool cleanup);
 
         /**
-         * @brief ȡӽ
-         * @return ӽ
+         * @brief 获取所有子结点
+         * @return 返回所有子结点数组，按挂上来的顺序排列
          */
         const Children &getChildren() const;
 
         /**
-         * @brief ָIDӽ
-         * @param [in] unNodeID : ӽID
-         * @return ӽ
+         * @brief 返回指定结点ID的子结点
+         * @param [in] unNodeID : 子结点ID
+         * @return 返回子结点对象
          * @see NodePtr getChild(uint32_t unNodeID)
          */
         const NodePtr &getChild(uint32_t unNodeID) const;
 
         /**
-         * @brief ָIDӽ
-         * @param [in] unNodeID : ӽID
-         * @return ӽ
+         * @brief 返回指定结点ID的子结点
+         * @param [in] unNodeID : 子结点ID
+         * @return 返回子结点对象
          * @see NodePtr getChild(uint32_t unNodeID)
          */
         NodePtr getChild(uint32_t unNodeID);
 
         /**
-         * @brief ָƵӽ
-         * @param [in] name : ӽ
-         * @return ӽ
+         * @brief 返回指定名称的子结点
+         * @param [in] name : 子结点名称
+         * @return 返回子结点对象
          * @see NodePtr getChild(const String &name)
          */
         const NodePtr &getChild(const String &name) const;
 
         /**
-         * @brief ָƵӽ
-         * @param [in] name : ӽ
-         * @return ӽ
+         * @brief 返回指定名称的子结点
+         * @param [in] name : 子结点名称
+         * @return 返回子结点对象
          * @see const NodePtr &getChild(const String &name) const
          */
         NodePtr getChild(const String &name);
 
         /**
-         * @brief ȡ
-         * @return ظ
+         * @brief 返回本结点在父结点子结点数组里的下标
+         * @return 返回下标，没有父结点的时候没有意义
+         */
+        size_t getChildIndex() const;
+
+        /**
+         * @brief 获取父结点
+         * @return 返回父结点对象
          * @see NodePtr getParent()
          */
         const NodePtr &getParent() const;
 
         /**
-         * @brief ȡ
-         * @return ظ
+         * @brief 获取父结点
+         * @return 返回父结点对象
          * @see const NodePtr &getParent() const
          */
         NodePtr getParent();
 
         /**
-         * @brief һ½
-         * @return ½
-         * @note ҪдӿʵĶƲ
+         * @brief 复制一个新结点对象出来
+         * @return 返回新结点对象
+         * @note 派生类需要重写本接口以实现其具体的对象复制操作
          */
         virtual NodePtr clone() const = 0;
 
     protected:
         /**
-         * @brief ĬϹ캯
-         * @param [in] uID : Ψһʶ
+         * @brief 默认构造函数
+         * @param [in] uID : 结点唯一标识
          */
         Node(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief ƽ
-         * @param [in] node : ½
+         * @brief 复制结点的属性数据
+         * @param [in] node : 新结点
          * @return void
-         * @note дcloneһ㶼Ҫдʵ־ݵĸ
+         * @note 重写了clone方法的一般都需要重写本方法以实现具体类属性数据的复制
          */
         virtual void cloneProperties(const NodePtr &node) const;
 
         /**
-         * @brief ҵScene Graphʱص֪ͨ
-         * @param [in] parent : ȥĸ
+         * @brief 结点挂到Scene Graph上时回调通知
+         * @param [in] parent : 挂上去的父结点
          * @return void
          */
         virtual void onAttachParent(const NodePtr &parent);
 
         /**
-         * @brief Scene Graphʱص֪ͨ
-         * @param [in] parent : ĸ
+         * @brief 结点从Scene Graph上拿下来时回调通知
+         * @param [in] parent : 拿下来的父结点
          * @return void
          */
         virtual void onDetachParent(const NodePtr &parent);
 
+        /**
+         * @brief 查找指定结点ID的子结点
+         * @param [in] nodeID : 子结点ID
+         * @return 返回子结点，没有的返回nullptr
+         * @remarks 默认实现遍历子结点，派生类可以重写成查索引
+         */
+        virtual Node *findChild(uint32_t nodeID) const;
+
+        /**
+         * @brief 查找指定名称ID的子结点，有多个同名子结点的时候返回最先挂上来的
+         * @param [in] nameID : 子结点名称ID，NameTable::E_INVALID_NAME表示没有名称
+         * @return 返回子结点，没有的返回nullptr
+         * @remarks 默认实现遍历子结点，派生类可以重写成查索引
+         */
+        virtual Node *findNamedChild(uint32_t nameID) const;
+
     private:
         /**
-         * @brief ȫΨһʶ
-         * @return ȫΨһʶ
+         * @brief 把子结点从本结点上移除
+         * @param [in] itr : 子结点在子结点数组里的位置
+         * @param [in] cleanup : 是否删除子结点
+         * @return void
+         */
+        void detachChild(ChildrenItr itr, bool cleanup);
+
+        /**
+         * @brief 生成全局唯一标识
+         * @return 返回全局唯一标识
          */
         uint32_t makeGlobalID() const;
 
     private:
-        uint32_t    mID;            /// ID
-        String      mName;          /// ý
+        uint32_t    mID;            /// 结点ID
+        String      mName;          /// 给该结点命名
+        uint32_t    mNameID;        /// 结点名称在全局名称表里的ID
 
-        NodePtr     mParent;        /// 
+        NodePtr     mParent;        /// 父结点
+        size_t      mChildIndex;    /// 在父结点子结点数组里的下标
 
     protected:
-        Children    mChildren;      /// ӽ
+        Children    mChildren;      /// 子结点
     };
 }
 
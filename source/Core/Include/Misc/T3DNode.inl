@@ -24,14 +24,14 @@ namespace Tiny3D
         return mID;
     }
 
-    inline void Node::setName(const String &name)
+    inline const String &Node::getName() const
     {
-        mName = name;
+        return mName;
     }
 
-    inline const String &Node::getName() const
+    inline uint32_t Node::getNameID() const
     {
-        return mName;
+        return mNameID;
     }
 
     inline const Children &Node::getChildren() const
@@ -39,6 +39,11 @@ namespace Tiny3D
         return mChildren;
     }
 
+    inline size_t Node::getChildIndex() const
+    {
+        return mChildIndex;
+    }
+
     inline const NodePtr &Node::getParent() const
     {
         return mParent;
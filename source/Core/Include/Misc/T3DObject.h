@@ -22,6 +22,7 @@
 
 
 #include "T3DPrerequisites.h"
+#include <atomic>
 
 
 namespace Tiny3D
@@ -32,16 +33,31 @@ namespace Tiny3D
         Object();
         virtual ~Object();
 
+        /**
+         * @brief 拷贝构造函数，新对象的引用计数从1开始，不拷贝原对象的引用计数
+         */
+        Object(const Object &other);
+
+        /**
+         * @brief 赋值只复制派生类的数据，引用计数保持不变
+         */
+        Object &operator =(const Object &other);
+
         Object *acquire();
+
+        /**
+         * @brief 引用计数减一，减到0时删除对象
+         * @note 用T3D_DECLARE_POOL_ALLOCATOR声明了对象池的类，内存会回到对象池，不回到全局堆
+         */
         void release();
         
         uint32_t referCount() const
         {
-            return mReferCount;
+            return mReferCount.load(std::memory_order_relaxed);
         }
 
     private:
-        uint32_t    mReferCount;
+        std::atomic<uint32_t>   mReferCount;    /// 引用计数，场景并行更新时可能在多个线程上增减
     };
 }
 
@@ -0,0 +1,169 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_OBJECT_POOL_H__
+#define __T3D_OBJECT_POOL_H__
+
+
+#include "T3DPrerequisites.h"
+#include <mutex>
+
+
+namespace Tiny3D
+{
+    /**
+     * @class ObjectPool
+     * @brief 固定大小对象的分页内存池
+     * @remarks 每个页面放若干个同样大小的对象，释放的内存回到所在页面的空闲链表，
+     *      下次分配同类型对象时复用，不再经过全局堆。
+     *      分配时先用完当前页面再换页，连续创建的对象（例如一个模型的所有骨骼）会放在同一个页面里。
+     *      大小和池里对象大小不一样的分配请求（例如没有自己的池的派生类）直接走全局堆。
+     *      可以在多个线程上同时分配和释放。
+     */
+    class T3D_ENGINE_API ObjectPool
+    {
+        T3D_DISABLE_COPY(ObjectPool);
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param [in] name : 池名称，一般是对象类名
+         * @param [in] objectSize : 对象大小
+         * @param [in] objectsPerPage : 每个页面的对象数量
+         */
+        ObjectPool(const char *name, size_t objectSize, size_t objectsPerPage);
+
+        /**
+         * @brief 析构函数
+         * @note 池里的对象必须都已经释放，对象释放时要访问所在的池
+         */
+        ~ObjectPool();
+
+        /**
+         * @brief 分配一个对象的内存
+         * @param [in] size : 要分配的大小
+         * @return 返回内存地址
+         */
+        void *allocate(size_t size);
+
+        /**
+         * @brief 释放allocate()分配的内存
+         * @param [in] ptr : 内存地址，可以是nullptr
+         * @return void
+         * @note 内存前面记录了所在页面，不需要知道是哪个池分配的
+         */
+        static void deallocate(void *ptr);
+
+        const char *getName() const     { return mName; }
+
+        size_t getObjectSize() const    { return mObjectSize; }
+
+        /**
+         * @brief 返回池里分配出去还没释放的对象数量
+         */
+        size_t getObjectCount() const;
+
+        /**
+         * @brief 返回池当前占用的页面数量
+         */
+        size_t getPageCount() const;
+
+    protected:
+        struct Page;
+
+        /**
+         * @brief 每个对象前面的头，记录对象所在页面
+         */
+        union Header
+        {
+            Page        *page;      /// 所在页面，走全局堆的是nullptr
+            long double align;      /// 保证后面的对象按最大对齐
+        };
+
+        /**
+         * @brief 分配一个新页面
+         */
+        Page *createPage();
+
+        /**
+         * @brief 把对象内存放回页面
+         */
+        void freeSlot(Page *page, Header *header);
+
+        /**
+         * @brief 把页面加入还有空位的页面链表
+         */
+        void linkPage(Page *page);
+
+        /**
+         * @brief 把页面从还有空位的页面链表移除
+         */
+        void unlinkPage(Page *page);
+
+    protected:
+        const char          *mName;             /// 池名称
+        size_t              mObjectSize;        /// 对象大小
+        size_t              mSlotSize;          /// 每个对象占用的大小，包括头
+        size_t              mObjectsPerPage;    /// 每个页面的对象数量
+
+        Page                *mCurrent;          /// 正在分配的页面
+        Page                *mPartial;          /// 还有空位的其他页面
+        Page                *mSpare;            /// 留着备用的一个空页面
+
+        size_t              mObjectCount;       /// 分配出去的对象数量
+        size_t              mPageCount;         /// 页面数量
+
+        mutable std::mutex  mMutex;             /// 保护页面和空闲链表
+    };
+
+    /**
+     * @brief 在类声明里声明用对象池分配内存
+     * @note 放在类声明开头，后面要写访问权限
+     */
+    #define T3D_DECLARE_POOL_ALLOCATOR(T)   \
+        public:     \
+            static void *operator new(size_t size); \
+            static void operator delete(void *ptr); \
+            static ObjectPool &getObjectPool();
+
+    /**
+     * @brief 在类实现文件里实现用对象池分配内存
+     * @param [in] T : 类名
+     * @param [in] count : 每个页面的对象数量
+     * @remarks 池在第一次分配时创建，之后不再销毁。
+     *      静态对象析构的顺序无法控制，池销毁后还可能有对象释放，所以池的内存交给进程退出时回收
+     */
+    #define T3D_IMPLEMENT_POOL_ALLOCATOR(T, count)  \
+        ObjectPool &T::getObjectPool()  \
+        {   \
+            static ObjectPool *pool = new ObjectPool(#T, sizeof(T), count); \
+            return *pool;   \
+        }   \
+        void *T::operator new(size_t size)  \
+        {   \
+            return getObjectPool().allocate(size);  \
+        }   \
+        void T::operator delete(void *ptr)  \
+        {   \
+            ObjectPool::deallocate(ptr);    \
+        }
+}
+
+
+#endif  /*__T3D_OBJECT_POOL_H__*/
@@ -54,6 +54,41 @@ namespace Tiny3D
 
         static bool parseBool(const String& val);
     };
+
+
+    /**
+     * @class NameTable
+     * @brief 全局名称表，把名称字符串映射成整数ID
+     * @remarks 同一个名称总是对应同一个ID，按名称查找时只需要比较整数，不用比较字符串。
+     *      可以在多个线程上同时调用。
+     */
+    class T3D_ENGINE_API NameTable
+    {
+    public:
+        enum
+        {
+            E_INVALID_NAME = 0,         /// 空名称的ID
+        };
+
+        /**
+         * @brief 返回名称的ID，名称不在表里的时候加入表里
+         * @param [in] name : 名称
+         * @return 返回名称ID，空名称返回E_INVALID_NAME
+         */
+        static uint32_t intern(const String &name);
+
+        /**
+         * @brief 返回名称的ID，不会往表里加入新名称
+         * @param [in] name : 名称
+         * @return 返回名称ID，空名称或者从来没有用过的名称返回E_INVALID_NAME
+         */
+        static uint32_t find(const String &name);
+
+    private:
+        struct Storage;
+
+        static Storage &getStorage();
+    };
 }
 
 
@@ -0,0 +1,123 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_COMMAND_LIST_H__
+#define __T3D_COMMAND_LIST_H__
+
+
+#include "Misc/T3DObject.h"
+#include "Render/T3DRenderer.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class CommandList
+     * @brief 渲染命令列表，把状态设置、变换和绘制命令录制到一块连续内存里，之后在渲染线程回放
+     * @remarks 
+     *      - 录制时只读写本列表的内存，不调用渲染器，所以多个列表可以在不同线程上同时录制；
+     *      - 命令里引用的材质、顶点、索引数据和灯光只保存裸指针，不改引用计数，
+     *        它们的生命周期由场景树保证，录制到回放之间不能销毁；
+     *      - 回放只能在渲染线程调用，和渲染器无关，任何渲染器都可以回放。
+     */
+    class T3D_ENGINE_API CommandList : public Object
+    {
+    public:
+        /** 命令类型 */
+        enum CommandType
+        {
+            E_CMD_SET_TRANSFORM = 0,        /// 设置变换矩阵
+            E_CMD_PUSH_RENDER_MODE,         /// 保存当前渲染模式并设置新的渲染模式
+            E_CMD_POP_RENDER_MODE,          /// 恢复上一次保存的渲染模式
+            E_CMD_SET_MATERIAL,             /// 设置材质
+            E_CMD_DRAW_VERTEX_LIST,         /// 绘制顶点列表
+            E_CMD_DRAW_INDEX_LIST,          /// 绘制索引列表
+            E_CMD_DRAW_INSTANCED,           /// 实例化绘制索引列表，世界矩阵紧跟在命令后面
+            E_CMD_ADD_LIGHT,                /// 添加动态灯光
+        };
+
+        static CommandListPtr create();
+
+        virtual ~CommandList();
+
+        /**
+         * @brief 清空已录制的命令，保留已分配内存供下一帧复用
+         */
+        void reset();
+
+        /**
+         * @brief 返回已录制的命令数量
+         */
+        size_t getCommandCount() const  { return mCommandCount; }
+
+        /**
+         * @brief 返回已录制的命令占用的字节数
+         */
+        size_t getSize() const          { return mSize; }
+
+        bool isEmpty() const            { return (mCommandCount == 0); }
+
+        void setTransform(Renderer::TransformState state, const Matrix4 &mat);
+
+        void pushRenderMode(Renderer::RenderMode mode);
+
+        void popRenderMode();
+
+        void setMaterial(Material *material);
+
+        void drawVertexList(Renderer::PrimitiveType primitiveType, VertexData *vertices, 
+            uint32_t startIdx, uint32_t primitiveCount);
+
+        void drawIndexList(Renderer::PrimitiveType primitiveType, VertexData *vertices, 
+            IndexData *indices, uint32_t startIdx, uint32_t primitiveCount);
+
+        /**
+         * @brief 录制实例化绘制命令
+         * @return 返回命令后面预留的instanceCount个世界矩阵的地址，由调用者填写。
+         *      地址只在录制下一条命令之前有效。
+         */
+        Matrix4 *drawIndexListInstanced(Renderer::PrimitiveType primitiveType, VertexData *vertices,
+            IndexData *indices, uint32_t startIdx, uint32_t primitiveCount, size_t instanceCount);
+
+        void addDynamicLight(size_t index, SGLight *light);
+
+        /**
+         * @brief 在渲染器上按录制顺序回放所有命令
+         * @return 返回回放的绘制命令数量
+         */
+        size_t execute(const RendererPtr &renderer) const;
+
+    protected:
+        CommandList();
+
+        /**
+         * @brief 在缓冲末尾分配一条命令，命令大小按8字节对齐
+         */
+        uint8_t *allocCommand(CommandType type, size_t size);
+
+        typedef std::vector<uint8_t>    Buffer;
+
+        Buffer  mBuffer;            /// 命令缓冲，只增长不收缩
+        size_t  mSize;              /// 已录制的字节数
+        size_t  mCommandCount;      /// 已录制的命令数量
+    };
+}
+
+
+#endif  /*__T3D_COMMAND_LIST_H__*/
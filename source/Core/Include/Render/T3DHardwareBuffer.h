@@ -32,17 +32,17 @@ namespace Tiny3D
     public:
         enum Usage
         {
-            /// ̬棬ݷԴУھ̬дǺġ
-            /// һڴͲµ
+            /// 静态缓存，数据放置在显存中，对于静态缓存读写数据是很慢的。
+            /// 一般用于创建后就不更新的数据
             E_HBU_STATIC = (1 << 0),
-            /// ̬棬ݴAGPڴУܺܿĸ
+            /// 动态缓存，数据存放在AGP内存中，这种数据能很快的更新
             E_HBU_DYNAMIC = (1 << 1),
-            /// Ӧóֻд档ʺϵڴַΪд档
-            /// עӴõֻжݣ᷵شϢ
+            /// 定应用程序只能写缓存。它允许驱动程序分配最适合的内存地址作为写缓存。
+            /// 注意如果从创建好的这种缓存中读数据，将会返回错误信息。
             E_HBU_WRITE_ONLY = (1 << 2),
-            /// E_HBU_STATICE_HBU_WRITE_ONLY
+            /// 联合E_HBU_STATIC和E_HBU_WRITE_ONLY
             E_HBU_STATIC_WRITE_ONLY = (E_HBU_STATIC | E_HBU_WRITE_ONLY),
-            /// E_HBU_DYNAMICE_HBU_WRITE_ONLY
+            /// 联合E_HBU_DYNAMIC和E_HBU_WRITE_ONLY
             E_HBU_DYNAMIC_WRITE_ONLY = (E_HBU_DYNAMIC | E_HBU_WRITE_ONLY),
         };
 
@@ -81,18 +81,18 @@ namespace Tiny3D
 
         virtual void updateFromShadow();
 
-        size_t  mBufferSize;                /// ӲС
-        size_t  mLockSize;                  /// С
-        size_t  mLockOffset;                /// ʼƫ
+        size_t  mBufferSize;                /// 硬件缓存大小
+        size_t  mLockSize;                  /// 锁缓存大小
+        size_t  mLockOffset;                /// 锁缓存起始偏移
 
-        Usage   mUsage;                     /// 
+        Usage   mUsage;                     /// 缓存类型
 
-        HardwareBufferPtr   mShadowBuffer;  /// Ӱӻ棬߶дЧ
+        HardwareBufferPtr   mShadowBuffer;  /// 影子缓存，提高读写效率
 
-        bool    mSystemMemory;              /// Ƿʹϵͳڴ
-        bool    mUseShadowBuffer;           /// ǷʹӰӻ
-        bool    mIsLocked;                  /// ӲǷ
-        bool    mIsShadowBufferDirty;       /// ӰӻǷҪ
+        bool    mSystemMemory;              /// 是否使用系统内存
+        bool    mUseShadowBuffer;           /// 是否使用影子缓存
+        bool    mIsLocked;                  /// 硬件缓存是否被锁
+        bool    mIsShadowBufferDirty;       /// 影子缓存是否需要更新
     };
 }
 
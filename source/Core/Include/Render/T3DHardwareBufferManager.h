@@ -39,6 +39,16 @@ namespace Tiny3D
         virtual HardwarePixelBufferPtr createPixelBuffer(uint32_t width, uint32_t height, PixelFormat format, HardwareBuffer::Usage usage, bool useShadowBuffer) = 0;
         virtual VertexDeclarationPtr createVertexDeclaration();
 
+        /**
+         * @brief 创建实例缓冲
+         * @param [in] instanceSize : 每个实例数据的字节数
+         * @param [in] instanceCount : 实例数量
+         * @param [in] usage : 缓冲用法，实例数据一般每帧更新，用E_HBU_DYNAMIC_WRITE_ONLY
+         * @note 实例缓冲按实例而不是按顶点步进，默认用顶点缓冲实现，
+         *      渲染器绑定时设置按实例步进的频率
+         */
+        virtual HardwareVertexBufferPtr createInstanceBuffer(size_t instanceSize, size_t instanceCount, HardwareBuffer::Usage usage);
+
     protected:
         HardwareBufferManagerBase();
 
@@ -71,6 +81,7 @@ namespace Tiny3D
         virtual HardwareIndexBufferPtr createIndexBuffer(HardwareIndexBuffer::Type indexType, size_t indexCount, HardwareBuffer::Usage usage, bool useShadowBuffer) override;
         virtual HardwarePixelBufferPtr createPixelBuffer(uint32_t width, uint32_t height, PixelFormat format, HardwareBuffer::Usage usage, bool useShadowBuffer) override;
         virtual VertexDeclarationPtr createVertexDeclaration() override;
+        virtual HardwareVertexBufferPtr createInstanceBuffer(size_t instanceSize, size_t instanceCount, HardwareBuffer::Usage usage) override;
 
     protected:
         HardwareBufferManagerBasePtr   mImpl;
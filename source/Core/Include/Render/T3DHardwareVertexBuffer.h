@@ -107,10 +107,10 @@ namespace Tiny3D
         size_t getSize() const;
 
     protected:
-        Type        mType;          /// Ԫ
-        Semantic    mSemantic;      /// Ԫ
-        size_t      mOffset;        /// Ԫضڶ㻺еʼƫֵ
-        size_t      mStream;        /// ӦĶ㻺
+        Type        mType;          /// 顶点元素数据类型
+        Semantic    mSemantic;      /// 顶点元素语义
+        size_t      mOffset;        /// 这个顶点元素定义的在顶点缓存中的起始点偏移值
+        size_t      mStream;        /// 对应定义的顶点缓存索引
     };
 
     class T3D_ENGINE_API VertexDeclaration : public Object
@@ -0,0 +1,175 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_OCCLUSION_CULLER_H__
+#define __T3D_OCCLUSION_CULLER_H__
+
+
+#include "Misc/T3DObject.h"
+#include "T3DTypedef.h"
+#include "T3DMatrix4.h"
+#include "T3DAabb.h"
+#include "T3DVector4.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class OcclusionCuller
+     * @brief CPU软件遮挡剔除，在视景体剔除之后、加入渲染队列之前拒绝被完全挡住的物体
+     * @remarks 每帧先把指定的遮挡体网格光栅化到一张低分辨率深度缓冲里，
+     *      再从深度缓冲生成层次深度（每一级保存下一级2x2里最远的深度），
+     *      待测物体的包围盒投影到屏幕后，在覆盖范围不超过4x4个texel的那一级上比较：
+     *      包围盒最近的深度比覆盖范围内所有texel都远，就是被完全挡住了。
+     *      - 深度用投影后的z/w，只比较远近，不依赖渲染器的深度范围约定；
+     *      - 遮挡体按近平面裁剪，越过近平面的待测物体总是当作可见；
+     *      - 遮挡体只按像素中心覆盖写深度，遮挡体网格要比可见网格小一点，不能凸出去。
+     */
+    class T3D_ENGINE_API OcclusionCuller : public Object
+    {
+    public:
+        enum
+        {
+            E_DEFAULT_WIDTH = 256,      /// 默认深度缓冲宽度
+            E_DEFAULT_HEIGHT = 128,     /// 默认深度缓冲高度
+            E_MAX_TEST_TEXELS = 4,      /// 测试时每个方向最多比较的texel数量
+        };
+
+        /**
+         * @brief 每帧的统计数据
+         */
+        struct Statistics
+        {
+            uint32_t    occluders;      /// 光栅化的遮挡体数量
+            uint32_t    triangles;      /// 光栅化的三角形数量，包括被近平面裁剪后拆出来的
+            uint32_t    tested;         /// 测试的包围盒数量
+            uint32_t    rejected;       /// 被挡住拒绝掉的包围盒数量
+        };
+
+        /**
+         * @brief 创建遮挡剔除对象
+         * @param [in] width : 深度缓冲宽度，向上对齐到4的倍数
+         * @param [in] height : 深度缓冲高度
+         */
+        static OcclusionCullerPtr create(uint32_t width = E_DEFAULT_WIDTH, uint32_t height = E_DEFAULT_HEIGHT);
+
+        virtual ~OcclusionCuller();
+
+        /**
+         * @brief 开始新的一帧，清空深度缓冲和统计数据
+         * @param [in] viewProj : 投影矩阵乘视图矩阵
+         * @param [in] nearDistance : 相机近平面距离，遮挡体按这个距离裁剪
+         * @return void
+         */
+        void beginFrame(const Matrix4 &viewProj, Real nearDistance);
+
+        /**
+         * @brief 光栅化一个遮挡体网格
+         * @param [in] world : 遮挡体的世界变换
+         * @param [in] vertices : 本地空间顶点
+         * @param [in] vertexCount : 顶点数量
+         * @param [in] indices : 三角形列表索引
+         * @param [in] indexCount : 索引数量
+         * @return void
+         * @note 三角形不分正反面，都写入深度
+         */
+        void rasterizeOccluder(const Matrix4 &world, const Vector3 *vertices,
+            size_t vertexCount, const uint16_t *indices, size_t indexCount);
+
+        /**
+         * @brief 所有遮挡体光栅化完之后生成层次深度
+         */
+        void buildHierarchy();
+
+        /**
+         * @brief 测试世界包围盒是否被完全挡住
+         * @param [in] box : 世界包围盒
+         * @return 被完全挡住返回true
+         * @note 要在buildHierarchy()之后调用，会累计统计数据
+         */
+        bool isOccluded(const Aabb &box);
+
+        uint32_t getWidth() const   { return mLevels[0].width; }
+        uint32_t getHeight() const  { return mLevels[0].height; }
+
+        /**
+         * @brief 返回层次深度的级数，第0级就是深度缓冲
+         */
+        size_t getLevelCount() const    { return mLevels.size(); }
+
+        /**
+         * @brief 返回本帧的统计数据
+         */
+        const Statistics &getStatistics() const { return mStatistics; }
+
+        /**
+         * @brief 把一级深度保存成灰度PGM图片，用于调试
+         * @param [in] path : 文件路径
+         * @param [in] level : 层次深度级别
+         * @return 保存成功返回true
+         * @note 越近越亮，没有遮挡体覆盖的地方是黑色
+         */
+        bool dumpDepth(const String &path, uint32_t level = 0) const;
+
+    protected:
+        OcclusionCuller(uint32_t width, uint32_t height);
+
+        /**
+         * @brief 层次深度的一级
+         */
+        struct Level
+        {
+            uint32_t            width;
+            uint32_t            height;
+            std::vector<float>  depth;
+        };
+
+        typedef std::vector<Level>              Levels;
+        typedef Levels::iterator                LevelsItr;
+        typedef Levels::const_iterator          LevelsConstItr;
+
+        typedef std::vector<Vector4>            ClipVertices;
+
+        /**
+         * @brief 按近平面裁剪三角形，然后投影到屏幕光栅化
+         * @param [in] clip : 三个顶点的裁剪空间坐标
+         */
+        void clipTriangle(const Vector4 *clip);
+
+        /**
+         * @brief 光栅化屏幕空间三角形，x、y是像素坐标，z是深度
+         */
+        void rasterizeTriangle(const Vector3 &v0, const Vector3 &v1, const Vector3 &v2);
+
+        /**
+         * @brief 把裁剪空间坐标转换到屏幕像素坐标和深度
+         */
+        Vector3 toScreen(const Vector4 &clip) const;
+
+    protected:
+        Levels          mLevels;        /// 层次深度，第0级是深度缓冲
+        ClipVertices    mClipVertices;  /// 变换到裁剪空间的遮挡体顶点，每个遮挡体复用
+        Matrix4         mViewProj;      /// 本帧的投影矩阵乘视图矩阵
+        Real            mNearDistance;  /// 本帧的近平面距离
+        Statistics      mStatistics;    /// 本帧的统计数据
+    };
+}
+
+
+#endif  /*__T3D_OCCLUSION_CULLER_H__*/
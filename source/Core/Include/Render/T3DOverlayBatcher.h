@@ -0,0 +1,160 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_OVERLAY_BATCHER_H__
+#define __T3D_OVERLAY_BATCHER_H__
+
+
+#include "Render/T3DRenderQueue.h"
+#include "Render/T3DHardwareBuffer.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 覆盖层合批用的顶点，一个流里放位置、颜色和纹理坐标
+     */
+    struct OverlayVertex
+    {
+        Vector3     position;       /// 顶点位置
+        uint32_t    diffuse;        /// 顶点颜色，A8R8G8B8
+        Vector2     texcoord;       /// 纹理UV坐标
+    };
+
+    typedef std::vector<OverlayVertex>          OverlayVertexArray;
+    typedef OverlayVertexArray::iterator        OverlayVertexArrayItr;
+    typedef OverlayVertexArray::const_iterator  OverlayVertexArrayConstItr;
+
+    /**
+     * @class OverlayBatcher
+     * @brief 把覆盖层的精灵和文字四边形合并到每帧重写的一个动态顶点缓冲里，按材质分批绘制
+     * @remarks 
+     *      - 输入的渲染项是按加入渲染队列的顺序，也就是叠放次序排好的；
+     *      - 每个四边形尽量并入前面相同材质的批次，只要它和中间隔着的批次在屏幕上不重叠，
+     *        这样既能跨过不相干的其他材质合批，又不会改变重叠部分的前后关系；
+     *      - 不能合批的覆盖层渲染对象原样保留，并且后面的四边形不能越过它合批；
+     *      - 索引缓冲是固定的四边形索引，只在容量增长时重建。
+     */
+    class T3D_ENGINE_API OverlayBatcher : public Object
+    {
+    public:
+        static OverlayBatcherPtr create();
+
+        virtual ~OverlayBatcher();
+
+        /**
+         * @brief 合并一段覆盖层渲染项
+         * @param [in, out] items : 渲染项数组，[first, first + count)这一段会被替换成批次渲染项
+         * @param [in] first : 覆盖层渲染项起始位置
+         * @param [in] count : 覆盖层渲染项数量
+         * @param [in] renderables : 渲染对象数组，渲染项通过索引引用
+         * @param [in, out] packets : 渲染包数组，批次的渲染包追加在后面
+         * @note 只能在渲染线程调用，会重写动态顶点缓冲
+         */
+        void build(RenderItemList &items, size_t first, size_t count,
+            const RenderableArray &renderables, RenderPacketArray &packets);
+
+        /**
+         * @brief 返回上一次合批后的批次数量，包括原样保留的渲染项
+         */
+        size_t getBatchCount() const    { return mBatches.size(); }
+
+        /**
+         * @brief 返回上一次合批的四边形数量
+         */
+        size_t getQuadCount() const     { return mQuadCount; }
+
+        /**
+         * @brief 把本地空间的四边形顶点变换到世界空间
+         */
+        static void transformQuads(const OverlayVertex *src, size_t count,
+            const Matrix4 &world, OverlayVertex *dst);
+
+        /**
+         * @brief 用四边形顶点创建单独绘制用的静态顶点和索引缓冲，不合批时使用
+         * @param [in] vertices : 四边形顶点，每4个一组，顺序是左上、左下、右上、右下
+         * @param [out] vertexData : 顶点数据
+         * @param [out] indexData : 索引数据
+         */
+        static bool createQuadBuffers(const OverlayVertexArray &vertices,
+            VertexDataPtr &vertexData, IndexDataPtr &indexData);
+
+    protected:
+        OverlayBatcher();
+
+        /**
+         * @brief 创建覆盖层顶点声明
+         */
+        static VertexDeclarationPtr createDeclaration();
+
+        /**
+         * @brief 创建能放下quadCount个四边形的固定索引缓冲
+         */
+        static HardwareIndexBufferPtr createQuadIndices(size_t quadCount, HardwareBuffer::Usage usage);
+
+        /**
+         * @brief 保证动态缓冲能放下quadCount个四边形，按两倍增长
+         */
+        bool reserve(size_t quadCount);
+
+        /** 一个批次，或者一个原样保留的渲染项 */
+        struct Batch
+        {
+            Material    *material;      /// 材质，原样保留的渲染项为空
+            uint32_t    item;           /// 第一个渲染项在原渲染项数组里的位置
+            uint32_t    firstQuad;      /// 在动态缓冲里的第一个四边形
+            uint32_t    quadCount;      /// 四边形数量，原样保留的渲染项为0
+            Real        left;           /// 已并入的四边形在屏幕上的范围
+            Real        top;
+            Real        right;
+            Real        bottom;
+        };
+
+        /** 一个渲染项的四边形在临时顶点数组里的位置 */
+        struct Entry
+        {
+            uint32_t    batch;          /// 所属批次
+            uint32_t    firstVertex;    /// 在临时顶点数组里的起始顶点
+            uint32_t    quadCount;      /// 四边形数量
+        };
+
+        typedef std::vector<Batch>      BatchArray;
+        typedef std::vector<Entry>      EntryArray;
+
+        enum
+        {
+            E_MAX_LOOKBACK = 16,        /// 往前找相同材质批次最多越过多少个批次
+            E_MIN_CAPACITY = 256,       /// 动态缓冲最少能放的四边形数量
+        };
+
+        BatchArray          mBatches;       /// 本帧批次，按绘制顺序
+        EntryArray          mEntries;       /// 本帧参与合批的渲染项
+        RenderItemList      mBatchItems;    /// 本帧替换进渲染项数组的批次渲染项
+        OverlayVertexArray  mScratch;       /// 按渲染项顺序填写的世界空间顶点
+        OverlayVertexArray  mVertices;      /// 按批次顺序重排后的顶点
+        size_t              mQuadCount;     /// 本帧四边形数量
+
+        size_t              mCapacity;      /// 动态缓冲能放下的四边形数量
+        VertexDataPtr       mVertexData;    /// 动态顶点数据
+        IndexDataPtr        mIndexData;     /// 固定四边形索引数据
+    };
+}
+
+
+#endif  /*__T3D_OVERLAY_BATCHER_H__*/
@@ -22,37 +22,100 @@
 
 #include "Misc/T3DObject.h"
 #include "Render/T3DRenderer.h"
+#include "Render/T3DCommandList.h"
 
 
 namespace Tiny3D
 {
+    /**
+     * @brief 渲染队列里的一个渲染项
+     * @remarks 排序键最高8位是渲染分组，其余位的布局由分组的排序策略决定：
+     *      - 材质优先：| 渲染分组(8) | 材质ID(16) | 顶点缓冲ID(16) | 深度(24) |
+     *      - 从前往后：| 渲染分组(8) | 深度高10位 | 材质ID(16) | 顶点缓冲ID(16) | 深度低14位 |
+     *      - 从后往前：| 渲染分组(8) | 反转深度(24) | 材质ID(16) | 顶点缓冲ID(16) |
+     *      - 提交顺序：| 渲染分组(8) | 提交序号(24) | 材质ID(16) | 顶点缓冲ID(16) |
+     *      深度是量化后的视空间深度，提交序号是本帧加入渲染队列的先后。
+     */
+    struct RenderItem
+    {
+        uint64_t    key;        /// 64位排序键
+        uint32_t    index;      /// 渲染对象在渲染队列渲染对象数组里的索引
+    };
+
+    typedef std::vector<RenderItem>             RenderItemList;
+    typedef RenderItemList::iterator            RenderItemListItr;
+    typedef RenderItemList::const_iterator      RenderItemListConstItr;
+
+    typedef std::vector<SGRenderable *>         RenderableArray;
+    typedef RenderableArray::iterator           RenderableArrayItr;
+    typedef RenderableArray::const_iterator     RenderableArrayConstItr;
+
+    /**
+     * @brief 渲染包，渲染线程上从渲染对象里取出的绘制数据
+     * @remarks 录制命令的工作线程只读渲染包，不调用渲染对象的虚函数，也不拷贝智能指针，
+     *      避免引用计数的原子操作争用和变换的延迟计算。
+     */
+    struct RenderPacket
+    {
+        SGRenderable            *renderable;        /// 渲染对象，灯光分组直接使用
+        Material                *material;          /// 材质
+        VertexData              *vertexData;        /// 顶点数据
+        IndexData               *indexData;         /// 索引数据，不使用索引时为空
+        const Matrix4           *world;             /// 世界变换
+        Renderer::PrimitiveType primitiveType;      /// 渲染元类型
+        uint32_t                primitiveCount;     /// 渲染元数量
+        uint32_t                startIndex;         /// 起始索引，覆盖层批次绘制共享缓冲里的一段
+    };
+
+    typedef std::vector<RenderPacket>           RenderPacketArray;
+    typedef RenderPacketArray::iterator         RenderPacketArrayItr;
+    typedef RenderPacketArray::const_iterator   RenderPacketArrayConstItr;
+
+    /**
+     * @brief 录制时使用的相机矩阵，渲染线程上计算好后传给各录制线程
+     */
+    struct RenderView
+    {
+        Matrix4     view;               /// 视图矩阵
+        Matrix4     projection;         /// 投影矩阵
+        Matrix4     overlayProjection;  /// 覆盖层使用的正交投影矩阵
+    };
+
     class T3D_ENGINE_API RenderGroup : public Object
     {
     public:
-        RenderGroup();
+        RenderGroup(uint32_t groupID);
         virtual ~RenderGroup();
 
-        void addRenderable(const MaterialPtr &material, const SGRenderablePtr &renderable);
+        uint32_t getGroupID() const { return mGroupID; }
 
-        void clear();
+        /**
+         * @brief 把已排好序的一段渲染项录制到命令列表
+         * @param [in] list : 命令列表
+         * @param [in] view : 相机矩阵
+         * @param [in] items : 这一段在排序后渲染项数组里的起始地址
+         * @param [in] count : 这一段渲染项数量
+         * @param [in] packets : 渲染包数组，渲染项通过索引引用
+         * @note 本函数不修改分组自身，同一分组的不同段可以在不同线程上同时录制
+         */
+        void record(CommandList *list, const RenderView &view, const RenderItem *items,
+            size_t count, const RenderPacketArray &packets) const;
 
-        void render(uint32_t groupID, const RendererPtr &renderer);
+        /**
+         * @brief 两个渲染包能否合并成一次实例化绘制
+         */
+        static bool canInstance(const RenderPacket &a, const RenderPacket &b);
 
-    protected:
-        size_t calcPrimitiveCount(Renderer::PrimitiveType priType, size_t indexCount, size_t vertexCount, bool useIndex);
+        static uint32_t calcPrimitiveCount(Renderer::PrimitiveType priType, size_t indexCount, size_t vertexCount, bool useIndex);
 
     protected:
-        typedef std::list<SGRenderablePtr>              RenderableList;
-        typedef RenderableList::iterator                RenderableListItr;
-        typedef RenderableList::const_iterator          RenderableListConstItr;
-
-        typedef std::map<MaterialPtr, RenderableList>   Renderables;
-        typedef Renderables::iterator                   RenderablesItr;
-        typedef Renderables::const_iterator             RenderablesConstItr;
-
-        typedef std::pair<MaterialPtr, RenderableList>  RenderablesValue;
+        enum
+        {
+            E_MIN_INSTANCE_COUNT = 2,   /// 连续多少个相同几何体才合并成一次实例化绘制
+        };
 
-        Renderables     mRenderables;
+    protected:
+        uint32_t    mGroupID;
     };
 
     class T3D_ENGINE_API RenderQueue : public Object
@@ -74,27 +137,246 @@ namespace Tiny3D
             E_GRPID_OVERLAY = 100
         };
 
+        /** 排序键各字段位宽和偏移 */
+        enum SortKeyLayout
+        {
+            E_KEY_DEPTH_BITS = 24,
+            E_KEY_VB_BITS = 16,
+            E_KEY_MATERIAL_BITS = 16,
+            E_KEY_GROUP_BITS = 8,
+
+            E_KEY_DEPTH_SHIFT = 0,
+            E_KEY_VB_SHIFT = E_KEY_DEPTH_SHIFT + E_KEY_DEPTH_BITS,
+            E_KEY_MATERIAL_SHIFT = E_KEY_VB_SHIFT + E_KEY_VB_BITS,
+            E_KEY_GROUP_SHIFT = E_KEY_MATERIAL_SHIFT + E_KEY_MATERIAL_BITS,
+
+            /// 从前往后：深度只用高位做主排序，同一深度段里仍按材质和顶点缓冲聚在一起
+            E_KEY_F2B_COARSE_BITS = 10,
+            E_KEY_F2B_FINE_BITS = E_KEY_DEPTH_BITS - E_KEY_F2B_COARSE_BITS,
+            E_KEY_F2B_FINE_SHIFT = 0,
+            E_KEY_F2B_VB_SHIFT = E_KEY_F2B_FINE_SHIFT + E_KEY_F2B_FINE_BITS,
+            E_KEY_F2B_MATERIAL_SHIFT = E_KEY_F2B_VB_SHIFT + E_KEY_VB_BITS,
+            E_KEY_F2B_COARSE_SHIFT = E_KEY_F2B_MATERIAL_SHIFT + E_KEY_MATERIAL_BITS,
+
+            /// 从后往前：深度完全优先，保证半透明物体混合顺序正确
+            E_KEY_B2F_VB_SHIFT = 0,
+            E_KEY_B2F_MATERIAL_SHIFT = E_KEY_B2F_VB_SHIFT + E_KEY_VB_BITS,
+            E_KEY_B2F_DEPTH_SHIFT = E_KEY_B2F_MATERIAL_SHIFT + E_KEY_MATERIAL_BITS,
+        };
+
+        /** 分组排序策略 */
+        enum SortPolicy
+        {
+            E_SP_MATERIAL_FIRST = 0,    /// 材质优先，最少的状态切换
+            E_SP_FRONT_TO_BACK,         /// 从前往后，减少不透明物体的重复着色
+            E_SP_BACK_TO_FRONT,         /// 从后往前，半透明物体需要
+            E_SP_SUBMISSION_ORDER,      /// 按加入队列的顺序，覆盖层的叠放次序需要
+        };
+
+        enum
+        {
+            E_INVALID_SLOT = 0xFFFFFFFF,    /// 未注册到常驻模式的槽位
+        };
 
         static RenderQueuePtr create();
 
         virtual ~RenderQueue();
 
+        /**
+         * @brief 把渲染对象加入渲染队列
+         * @note 队列只记录渲染对象裸指针，渲染对象生命周期由场景树保证，
+         *      在一帧的裁剪和渲染之间不能把渲染对象从场景树中移除。
+         */
         void addRenderable(GroupID groupID, const SGRenderablePtr &renderable);
 
+        /**
+         * @brief 清空渲染队列，保留已分配内存供下一帧复用
+         */
         void clear();
 
+        /**
+         * @brief 排序并渲染队列里的渲染项
+         * @remarks 排序后的渲染项按分组切成若干段，每段录制到一个命令列表，
+         *      录制交给任务调度器并行执行，渲染线程本身也参与录制，
+         *      全部录制完后在渲染线程上按分组顺序回放。
+         */
         void render(const RendererPtr &renderer);
 
+        /**
+         * @brief 设置常驻模式
+         * @remarks 常驻模式下渲染对象只在进入场景时注册一次，离开场景时反注册，
+         *      每帧裁剪调用addRenderable只是设置可见标记，渲染时把可见的渲染项收集起来排序。
+         *      排序键缓存在槽位里，分组、材质修改戳或者顶点缓冲变化时才重建。
+         *      关闭常驻模式会反注册所有渲染对象。
+         */
+        void setRetainedMode(bool enable);
+
+        bool isRetainedMode() const { return mIsRetained; }
+
+        /**
+         * @brief 注册常驻渲染对象，已经注册的直接返回
+         */
+        void registerRenderable(SGRenderable *renderable);
+
+        /**
+         * @brief 反注册常驻渲染对象
+         */
+        void unregisterRenderable(SGRenderable *renderable);
+
+        /**
+         * @brief 设置分组的排序策略
+         * @remarks 默认半透明分组从后往前，实体分组从前往后，其余分组材质优先。
+         *      从前往后排序会让同一网格的多个实例很少相邻，实例化合并变少，
+         *      需要更多合批的场景可以把实体分组改回材质优先。
+         */
+        void setSortPolicy(GroupID groupID, SortPolicy policy);
+
+        SortPolicy getSortPolicy(uint32_t groupID) const
+        {
+            return (SortPolicy)mSortPolicies[groupID & 0xFF];
+        }
+
+        /**
+         * @brief 设置是否合并覆盖层的精灵和文字
+         * @remarks 默认开启，合批只在覆盖层分组使用提交顺序排序时进行
+         */
+        void setOverlayBatching(bool enable) { mIsOverlayBatching = enable; }
+
+        bool isOverlayBatching() const { return mIsOverlayBatching; }
+
+        /**
+         * @brief 返回覆盖层合批器，可以查询上一帧的批次数量
+         */
+        const OverlayBatcherPtr &getOverlayBatcher() const { return mOverlayBatcher; }
+
+        /**
+         * @brief 从排序键里取出分组ID
+         */
+        static uint32_t getGroupID(uint64_t key)
+        {
+            return uint32_t(key >> E_KEY_GROUP_SHIFT);
+        }
+
     protected:
         RenderQueue();
 
-        typedef std::map<GroupID, RenderGroupPtr>   RenderableGroup;
+        /**
+         * @brief 从渲染对象里取出渲染包，并用当前相机的视图矩阵计算每个渲染项的视空间深度，
+         *      再按分组的排序策略重新组合排序键
+         */
+        void fillDepth(const RendererPtr &renderer);
+
+        /**
+         * @brief 用渲染项的世界平移计算视空间深度，再按分组的排序策略重新组合排序键
+         * @param [in] view : 视图矩阵
+         * @param [in] nearDist, farDist : 近平面和远平面距离
+         * @note 调用前mPosX、mPosY、mPosZ、mDepths的大小要和渲染项数量一致
+         */
+        void buildDepthKeys(const Matrix4 &view, Real nearDist, Real farDist);
+
+        /**
+         * @brief 批量计算视空间深度，并归一化到[0, 1]，近平面是0，远平面是1
+         * @remarks 深度是沿视线方向到相机的距离，也就是视空间z取反
+         * @param [in] x, y, z : 世界矩阵平移部分，按分量分开连续存放
+         * @param [in] count : 数量
+         * @param [in] view : 视图矩阵
+         * @param [in] nearDist, scale : 近平面距离和1/(远平面-近平面)
+         * @param [out] depth : 归一化后的深度
+         * @note 循环里没有分支和函数调用，编译器可以直接向量化
+         */
+        static void computeViewDepth(const Real *x, const Real *y, const Real *z, size_t count,
+            const Matrix4 &view, Real nearDist, Real scale, Real *depth);
+
+        /**
+         * @brief 把排序后的渲染项切成录制任务，同一分组里较多的渲染项会切成多段
+         */
+        void buildJobs();
+
+        /**
+         * @brief 录制一段任务，在任务调度器的线程上调用
+         */
+        static void recordProcedure(void *context, size_t begin, size_t end);
+
+        /**
+         * @brief 对渲染项做基数排序（LSD，每趟8位）
+         */
+        void sort();
+
+        /**
+         * @brief 把排序后覆盖层分组里的精灵和文字合并成批次渲染项
+         */
+        void batchOverlay();
+
+        RenderGroupPtr &getGroup(uint32_t groupID);
+
+        /**
+         * @brief 构造不含深度的排序键
+         */
+        static uint64_t makeKey(uint32_t groupID, SGRenderable *renderable);
+
+        /**
+         * @brief 把本帧可见的常驻渲染对象收集到渲染项里，并清除可见标记
+         */
+        void collectRetained();
+
+        typedef std::map<uint32_t, RenderGroupPtr>  RenderableGroup;
         typedef RenderableGroup::iterator           RenderableGroupItr;
         typedef RenderableGroup::const_iterator     RenderableGroupConstItr;
 
-        typedef std::pair<GroupID, RenderGroupPtr>  RenderableGroupValue;
+        typedef std::pair<uint32_t, RenderGroupPtr> RenderableGroupValue;
+
+        RenderableGroup     mGroups;        /// 各分组渲染器，跨帧复用
+        RenderItemList      mItems;         /// 渲染项
+        RenderItemList      mSortBuffer;    /// 基数排序用的临时缓冲
+        RenderableArray     mRenderables;   /// 本帧加入队列的渲染对象
+
+        typedef std::vector<Real>       RealArray;
+        typedef std::vector<uint32_t>   OrderArray;
+
+        uint8_t             mSortPolicies[256]; /// 各分组的排序策略
+        RealArray           mPosX;              /// 按渲染项顺序存放的世界平移x
+        RealArray           mPosY;              /// 按渲染项顺序存放的世界平移y
+        RealArray           mPosZ;              /// 按渲染项顺序存放的世界平移z
+        RealArray           mDepths;            /// 按渲染项顺序存放的归一化视空间深度
+        OrderArray          mOrders;            /// 按渲染项顺序存放的提交序号
+        uint32_t            mSubmitCount;       /// 本帧已提交的渲染对象数量
+
+        typedef std::vector<uint64_t>       KeyArray;
+        typedef std::vector<uint8_t>        VisibilityArray;
+        typedef std::vector<uint32_t>       StampArray;
+        typedef std::vector<const void *>   BufferArray;
+
+        bool                mIsRetained;        /// 是否常驻模式
+        RenderableArray     mRetainedObjects;   /// 常驻渲染对象，按槽位紧密排列
+        KeyArray            mRetainedKeys;      /// 常驻渲染对象缓存的排序键
+        StampArray          mRetainedStamps;    /// 构造排序键时材质的修改戳，材质替换或者修改后重建排序键
+        BufferArray         mRetainedBuffers;   /// 构造排序键时的顶点缓冲，顶点缓冲重建后重建排序键
+        VisibilityArray     mVisibility;        /// 常驻渲染对象本帧可见标记
+        OrderArray          mRetainedOrders;    /// 常驻渲染对象本帧的提交序号
+
+        enum
+        {
+            E_MIN_RECORD_ITEMS = 256,   /// 每个录制任务至少的渲染项数量
+        };
+
+        /** 一个录制任务，对应排序后某个分组里连续的一段渲染项 */
+        struct RecordJob
+        {
+            RenderGroup *group;
+            size_t      first;
+            size_t      count;
+        };
+
+        typedef std::vector<RecordJob>          RecordJobArray;
+        typedef std::vector<CommandListPtr>     CommandListArray;
+
+        RenderPacketArray   mPackets;           /// 本帧渲染包，前面和mRenderables一一对应，后面是覆盖层批次
+        RenderView          mView;              /// 本帧相机矩阵
+        RecordJobArray      mJobs;              /// 本帧录制任务
+        CommandListArray    mCommandLists;      /// 和录制任务一一对应的命令列表，跨帧复用
 
-        RenderableGroup     mGroups;
+        bool                mIsOverlayBatching; /// 是否合并覆盖层
+        OverlayBatcherPtr   mOverlayBatcher;    /// 覆盖层合批器
     };
 }
 
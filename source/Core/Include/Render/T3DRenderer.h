@@ -41,6 +41,8 @@ namespace Tiny3D
         static const char * const OPENGL3PLUS;
         static const char * const OPENGLES2;
         static const char * const OPENGLES3;
+        static const char * const NULLRENDERER;
+        static const char * const SOFTWARE;
 
         enum Capability
         {
@@ -58,26 +60,26 @@ namespace Tiny3D
 
         enum PrimitiveType
         {
-            E_PT_POINT_LIST,        // бͼԪ
-            E_PT_LINE_LIST,         // бͼԪ
-            E_PT_LINE_STRIP,        // ߴͼԪ
-            E_PT_TRIANGLE_LIST,     // бͼԪ
-            E_PT_TRIANGLE_STRIP,    // ǴͼԪ
-            E_PT_TRIANGLE_FAN,      // ͼԪ
+            E_PT_POINT_LIST,        // 单独点列表图元
+            E_PT_LINE_LIST,         // 单独线列表图元
+            E_PT_LINE_STRIP,        // 线带图元
+            E_PT_TRIANGLE_LIST,     // 三角列表图元
+            E_PT_TRIANGLE_STRIP,    // 三角带图元
+            E_PT_TRIANGLE_FAN,      // 三角扇形图元
         };
 
         enum CullingMode
         {
-            E_CULL_NONE = 1,        // ޳
-            E_CULL_CLOCKWISE,       // ն˳ʱ˳޳
-            E_CULL_ANTICLOCKWISE,   // նʱ˳޳
+            E_CULL_NONE = 1,        // 不做消隐面剔除
+            E_CULL_CLOCKWISE,       // 按照顶点顺时针顺序的消隐面剔除
+            E_CULL_ANTICLOCKWISE,   // 按照顶点逆时针顺序的消隐面剔除
         };
 
         enum RenderMode
         {
-            E_RM_POINT,         // Ⱦ
-            E_RM_WIREFRAME,     // Ⱦ߿
-            E_RM_SOLID,         // Ⱦʵ壬ʵ
+            E_RM_POINT,         // 仅渲染点
+            E_RM_WIREFRAME,     // 渲染线框
+            E_RM_SOLID,         // 渲染实体，带纹理、材质的
         };
 
         Renderer();
@@ -107,8 +109,12 @@ namespace Tiny3D
         virtual bool queryCapability(Capability cap) = 0;
         virtual void enableCapability(Capability cap, bool enabled = true) = 0;
 
-        virtual void setTransform(TransformState state, const Matrix4 &mat) = 0;
-        
+        /**
+         * @brief 设置变换矩阵
+         * @note 和当前缓存的矩阵相同时直接忽略，不会提交到底层渲染器
+         */
+        void setTransform(TransformState state, const Matrix4 &mat);
+
         void setViewTransform(const Matrix4 &mat);
         void setWorldTransform(const Matrix4 &mat);
         void setProjectionTransform(const Matrix4 &mat);
@@ -120,12 +126,15 @@ namespace Tiny3D
 
         virtual void updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount) = 0;
 
-        virtual const Matrix4 &getTransform(TransformState state) const = 0;
+        /**
+         * @brief 获取最后设置的变换矩阵
+         */
+        const Matrix4 &getTransform(TransformState state) const;
 
-        virtual void setCullingMode(CullingMode mode) = 0;
+        void setCullingMode(CullingMode mode);
         virtual CullingMode getCullingMode() const;
 
-        virtual void setRenderMode(RenderMode mode) = 0;
+        void setRenderMode(RenderMode mode);
         virtual RenderMode getRenderMode() const;
 
         virtual void setLightEnabled(bool enable) = 0;
@@ -135,19 +144,95 @@ namespace Tiny3D
         virtual void removeDynamicLight(size_t index) = 0;
         virtual void removeAllDynamicLights() = 0;
 
-        virtual void setMaterial(const MaterialPtr &material) = 0;
+        void setMaterial(const MaterialPtr &material);
 
         virtual void setViewport(const ViewportPtr &viewport) = 0;
         virtual ViewportPtr getViewport();
 
-        virtual void drawVertexList(PrimitiveType primitiveType, 
+        void drawVertexList(PrimitiveType primitiveType, 
             const VertexDataPtr &vertices, uint32_t startIdx, 
-            uint32_t primitiveCount) = 0;
+            uint32_t primitiveCount);
 
-        virtual void drawIndexList(PrimitiveType primitiveType, 
+        void drawIndexList(PrimitiveType primitiveType, 
             const VertexDataPtr &vertices, const IndexDataPtr &indicies, 
+            uint32_t startIdx, uint32_t pritimitiveCount);
+
+        /**
+         * @brief 实例化绘制，同一份顶点、索引数据按每个实例的世界变换各绘制一次
+         * @param [in] worldMatrices : 每个实例的世界变换矩阵数组
+         * @param [in] instanceCount : 实例数量
+         * @note 渲染器支持实例化时，世界矩阵按行主序写入实例缓冲，一次提交；
+         *      不支持时退化成在CPU上逐个设置世界变换后绘制。
+         */
+        void drawIndexListInstanced(PrimitiveType primitiveType,
+            const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+            uint32_t startIdx, uint32_t primitiveCount,
+            const Matrix4 *worldMatrices, size_t instanceCount);
+
+        /**
+         * @brief 是否支持硬件实例化绘制
+         */
+        virtual bool isInstancingSupported() const;
+
+        /**
+         * @brief 让渲染状态缓存失效，下一次设置的状态都会提交到底层渲染器
+         * @note 底层设备状态被外部修改或者设备重置后需要调用
+         */
+        void invalidateStateCache();
+
+        /**
+         * @brief 返回本帧提交到底层渲染器的状态设置次数
+         */
+        uint32_t getSubmittedStateCount() const { return mSubmittedStates; }
+
+        /**
+         * @brief 返回本帧因为和当前状态相同而被过滤掉的状态设置次数
+         */
+        uint32_t getElidedStateCount() const { return mElidedStates; }
+
+        /**
+         * @brief 清零状态设置计数，每帧开始时调用
+         */
+        void resetStateCounters();
+
+    protected:
+        /**
+         * @brief 各渲染器实现的状态设置和绘制接口，由基类过滤掉冗余调用后再调用
+         */
+        virtual void setTransformImpl(TransformState state, const Matrix4 &mat) = 0;
+        virtual void setCullingModeImpl(CullingMode mode) = 0;
+        virtual void setRenderModeImpl(RenderMode mode) = 0;
+        virtual void setMaterialImpl(const MaterialPtr &material) = 0;
+
+        virtual void bindVertexDataImpl(const VertexDataPtr &vertices) = 0;
+        virtual void bindIndexDataImpl(const IndexDataPtr &indices) = 0;
+
+        virtual void drawVertexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertices, uint32_t startIdx,
+            uint32_t primitiveCount) = 0;
+
+        virtual void drawIndexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertices, const IndexDataPtr &indicies,
             uint32_t startIdx, uint32_t pritimitiveCount) = 0;
 
+        /**
+         * @brief 硬件实例化绘制，支持实例化的渲染器需要重写
+         * @param [in] instances : 实例缓冲，每个实例是一个行主序的4x4浮点矩阵
+         * @param [in] instanceCount : 实例数量
+         */
+        virtual void drawIndexListInstancedImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+            const HardwareVertexBufferPtr &instances, size_t instanceCount,
+            uint32_t startIdx, uint32_t primitiveCount);
+
+        void bindVertexData(const VertexDataPtr &vertices);
+        void bindIndexData(const IndexDataPtr &indices);
+
+        /**
+         * @brief 检查状态缓存，返回true表示需要提交到底层渲染器，并更新计数
+         */
+        bool checkStateCache(uint32_t flag, bool isSame);
+
     protected:
         bool fireFrameStarted();
         bool fireFrameEnded();
@@ -177,6 +262,27 @@ namespace Tiny3D
         RenderMode          mRenderMode;
 
         Material            *mMaterial;
+        uint32_t            mMaterialStamp;         /// 设置材质时材质的修改标记
+
+        /** 渲染状态缓存标记，置位表示缓存值和底层设备状态一致 */
+        enum StateCacheFlag
+        {
+            E_SCF_CULLING_MODE = (1 << 0),
+            E_SCF_RENDER_MODE = (1 << 1),
+            E_SCF_MATERIAL = (1 << 2),
+            E_SCF_VERTEX_DATA = (1 << 3),
+            E_SCF_INDEX_DATA = (1 << 4),
+            E_SCF_TRANSFORM = (1 << 5),     /// 后面依次是各个TransformState
+        };
+
+        Matrix4             mTransforms[E_TS_MAX];  /// 缓存的变换矩阵
+        VertexDataPtr       mVertexData;            /// 当前绑定的顶点数据
+        IndexDataPtr        mIndexData;             /// 当前绑定的索引数据
+        HardwareVertexBufferPtr mInstanceBuffer;    /// 实例化绘制用的实例缓冲
+
+        uint32_t            mStateCacheFlags;       /// 状态缓存有效标记
+        uint32_t            mSubmittedStates;       /// 本帧提交的状态设置次数
+        uint32_t            mElidedStates;          /// 本帧过滤掉的状态设置次数
     };
 }
 
@@ -36,7 +36,7 @@ namespace Tiny3D
 
     inline void Renderer::setTextureTransform(int32_t textureIdx, const Matrix4 &mat)
     {
-        TransformState ts = TransformState(textureIdx - (int32_t)E_TS_TEXTURE_0);
+        TransformState ts = TransformState(textureIdx + (int32_t)E_TS_TEXTURE_0);
         setTransform(ts, mat);
     }
 }
@@ -83,7 +83,7 @@ namespace Tiny3D
 
         Color4  mBkgndColor;
 
-        Matrix4 mMatrix;        /// ӿڱ任
+        Matrix4 mMatrix;        /// 视口变换矩阵
     };
 }
 
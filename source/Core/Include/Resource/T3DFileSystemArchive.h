@@ -58,7 +58,7 @@ namespace Tiny3D
 
         enum
         {
-            MAX_FILE_STREAM_CACHE = 10,     /// ļĻ
+            MAX_FILE_STREAM_CACHE = 10,     /// 文件流最大的缓存
         };
 
         typedef std::map<String, FileDataStream*>   FileStreamCache;
@@ -75,10 +75,10 @@ namespace Tiny3D
         typedef FileStreamPool::iterator            FileStreamPoolItr;
         typedef FileStreamPool::const_iterator      FileStreamPoolConstItr;
 
-        FileStreamPool  mFileStreamPool;        /// ļ
+        FileStreamPool  mFileStreamPool;        /// 空闲文件流对象池
 
-        FileIndexCache  mFileIndexCache;        /// ļ棬еһǴʱĶ
-        FileStreamCache mFileStreamCache;       /// ʹеļ
+        FileIndexCache  mFileIndexCache;        /// 文件流索引缓存，其中第一个是存在时间最长的对象
+        FileStreamCache mFileStreamCache;       /// 使用中的文件流缓存
     };
 
 
@@ -45,6 +45,7 @@ namespace Tiny3D
         void setAmbientColor(const Color4 &color)
         {
             mAmbientColor = color;
+            touch();
         }
 
         const Color4 &getAmbientColor() const
@@ -55,6 +56,7 @@ namespace Tiny3D
         void setDiffuseColor(const Color4 &color)
         {
             mDiffuseColor = color;
+            touch();
         }
 
         const Color4 &getDiffuseColor() const
@@ -65,6 +67,7 @@ namespace Tiny3D
         void setSpecularColor(const Color4 &color)
         {
             mSpecularColor = color;
+            touch();
         }
 
         const Color4 &getSpecularColor() const
@@ -75,6 +78,7 @@ namespace Tiny3D
         void setEmissiveColor(const Color4 &color)
         {
             mEmissiveColor = color;
+            touch();
         }
 
         const Color4 &getEmissiveColor() const
@@ -85,6 +89,7 @@ namespace Tiny3D
         void setShininess(Real shininess)
         {
             mShininess = shininess;
+            touch();
         }
 
         Real getShininess() const
@@ -107,6 +112,16 @@ namespace Tiny3D
             return mTextureLayer[layer];
         }
 
+        /**
+         * @brief 返回材质的修改标记
+         * @remarks 材质每次修改都换一个所有材质里都不重复的新值，
+         *      渲染器用它判断缓存的材质状态是否还有效
+         */
+        uint32_t getChangeStamp() const
+        {
+            return mChangeStamp;
+        }
+
     protected:
         enum FileType
         {
@@ -127,6 +142,11 @@ namespace Tiny3D
         bool loadFromXML(MemoryDataStream &stream);
         void parseColorValue(const String &text, Color4 &color);
 
+        /**
+         * @brief 材质修改后换一个新的修改标记
+         */
+        void touch();
+
     private:
         enum
         {
@@ -146,6 +166,8 @@ namespace Tiny3D
         Real    mReflection;
 
         TexturePtr  mTextureLayer[E_MAX_TEXTURE_LAYERS];
+
+        uint32_t    mChangeStamp;   /// 修改标记
     };
 }
 
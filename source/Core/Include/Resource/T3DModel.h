@@ -35,13 +35,13 @@ namespace Tiny3D
     public:
         enum FileType
         {
-            E_FILETYPE_UNKNOWN = 0,     /// δ֪ģļʽ
-            E_FILETYPE_T3B,             /// ģļʽ
-            E_FILETYPE_T3T              /// XMLģļʽ
+            E_FILETYPE_UNKNOWN = 0,     /// 未知模型文件格式
+            E_FILETYPE_T3B,             /// 二进制模型文件格式
+            E_FILETYPE_T3T              /// XML模型文件格式
         };
 
         /**
-         * @brief ģͶʵ.
+         * @brief 创建模型对象实例.
          */
         static ModelPtr create(const String &name);
 
@@ -51,12 +51,12 @@ namespace Tiny3D
         virtual ~Model();
 
         /**
-         * @brief ȡԴö٣Resource̳ķ.
+         * @brief 获取资源类型枚举，从Resource继承下来的方法.
          */
         virtual Type getType() const override;
 
         /**
-         * @brief ȡģ.
+         * @brief 获取模型相关所有数据.
          */
         const ObjectPtr &getModelData() const
         {
@@ -67,27 +67,27 @@ namespace Tiny3D
         Model(const String &name);
 
         /**
-         * @brief ģԴResource̳ķ.
+         * @brief 加载模型资源，从Resource继承下来的方法.
          */
         virtual bool load() override;
 
         /**
-         * @brief жģԴResource̳ķ.
+         * @brief 卸载模型资源，从Resource继承下来的方法.
          */
         virtual void unload() override;
         
         /**
-         * @brief ¡һģԴĿ¡ģȫһ.
+         * @brief 克隆一份模型资源，这里的克隆是做深拷贝，模型数据完全是另外一份.
          */
         virtual ResourcePtr clone() const override;
 
         /**
-         * @brief ģչȡӦģļʽöֵ.
+         * @brief 根据模型扩展名，获取对应的模型文件格式枚举值.
          */
         FileType parseFileType(const String &name) const;
 
     protected:
-        ObjectPtr           mModelData;         /// ģ
+        ObjectPtr           mModelData;         /// 模型相关数据
     };
 }
 
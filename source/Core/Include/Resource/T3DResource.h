@@ -84,6 +84,11 @@ namespace Tiny3D
         virtual void unload();
         virtual ResourcePtr clone() const = 0;
 
+        /**
+         * @brief 生成全局唯一的资源ID，渲染队列用它来构造排序键
+         */
+        static uint32_t makeGlobalID();
+
     protected:
         size_t      mSize;      /** size of this resource */
         int32_t     mID;        /** ID of this resource */
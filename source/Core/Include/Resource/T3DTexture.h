@@ -29,7 +29,7 @@
 namespace Tiny3D
 {
     /**
-     * @brief Դ
+     * @brief 纹理资源
      */
     class T3D_ENGINE_API Texture : public Resource
     {
@@ -44,9 +44,9 @@ namespace Tiny3D
 
         enum TexUsage
         {
-            E_TU_DEFAULT = 0,   /// ͼƬ
-            E_TU_RENDERTARGET,  /// Ⱦ
-            E_TU_BLANK,         /// հ
+            E_TU_DEFAULT = 0,   /// 从图片加载数据填充纹理
+            E_TU_RENDERTARGET,  /// 渲染到纹理
+            E_TU_BLANK,         /// 空白纹理
         };
 
         static TexturePtr create(const String &name, int32_t numMipMaps, int32_t texWidth = -1, 
@@ -81,12 +81,12 @@ namespace Tiny3D
         virtual ResourcePtr clone() const override;
 
         /**
-         * @brief Դݹ
-         * @param [in] texture : Ŀ
-         * @param [in] dstRect : ָĿĬnullptrΪƵ
-         * @param [in] srcRect : ָԴĬnullptrΪ
-         * @return óɹtrue򷵻false
-         * @note ԴĿһ£ԶŴᵼһ½
+         * @brief 从源纹理复制纹理数据过来
+         * @param [in] texture : 目标纹理
+         * @param [in] dstRect : 指定目标纹理区域，默认nullptr为复制到整个纹理上
+         * @param [in] srcRect : 指定源纹理区域，默认nullptr为整个纹理复制
+         * @return 调用成功返回true，否则返回false
+         * @note 如果源纹理区域和目标纹理区域不一致，则会自动做缩放处理，但是这个会导致性能有一定程序的下降
          */
         bool copyTo(TexturePtr texture, Rect *dstRect = nullptr, Rect *srcRect = nullptr);
 
@@ -0,0 +1,141 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_DYNAMIC_AABB_TREE_H__
+#define __T3D_DYNAMIC_AABB_TREE_H__
+
+
+#include "SceneGraph/T3DSpatialIndex.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class DynamicAabbTree
+     * @brief 动态包围盒层次树空间索引
+     * @remarks 每个对象是一个叶子结点，叶子保存放大过的包围盒。
+     *      对象移动后只要新的包围盒还在放大的包围盒里面就不用动树，移出去了才删除重新插入，
+     *      插入时按表面积代价选择兄弟结点，插入和删除后沿父结点往上做旋转保持平衡。
+     *      结点放在数组里，代理ID就是叶子结点在数组里的下标，重新插入不改变。
+     */
+    class T3D_ENGINE_API DynamicAabbTree : public SpatialIndex
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param [in] margin : 叶子包围盒每边放大的比例，相对于包围盒最长边
+         */
+        DynamicAabbTree(Real margin = Real(0.1));
+
+        /**
+         * @brief 析构函数
+         */
+        virtual ~DynamicAabbTree();
+
+        virtual const char *getName() const override;
+
+        virtual uint32_t insert(SGRenderable *renderable, const Aabb &box) override;
+
+        virtual void update(uint32_t proxy, const Aabb &box) override;
+
+        virtual void remove(uint32_t proxy) override;
+
+        virtual void clear() override;
+
+        virtual void query(const Frustum &frustum, Renderables &result) const override;
+
+        virtual void query(const Aabb &box, Renderables &result) const override;
+
+        virtual void collect(Renderables &result) const override;
+
+        virtual size_t getCount() const override    { return mLeafCount; }
+
+        /**
+         * @brief 返回树的高度，叶子的高度是0，空树返回0
+         */
+        int32_t getHeight() const;
+
+    protected:
+        enum
+        {
+            E_NULL_NODE = -1,       /// 空结点
+        };
+
+        /**
+         * @brief 树结点
+         */
+        struct TreeNode
+        {
+            Vector3         minPos;     /// 包围盒最小点，叶子是放大过的包围盒
+            Vector3         maxPos;     /// 包围盒最大点
+            int32_t         parent;     /// 父结点，空闲结点时是空闲链表的下一个
+            int32_t         child1;     /// 左子结点，叶子是E_NULL_NODE
+            int32_t         child2;     /// 右子结点
+            int32_t         height;     /// 高度，叶子是0，空闲结点是-1
+            SGRenderable    *renderable;    /// 叶子对应的对象
+
+            bool isLeaf() const { return child1 == E_NULL_NODE; }
+        };
+
+        typedef std::vector<TreeNode>           TreeNodes;
+        typedef std::vector<int32_t>            NodeStack;
+        typedef std::vector<uint32_t>           MaskStack;
+
+        int32_t allocateNode();
+        void freeNode(int32_t index);
+
+        void insertLeaf(int32_t leaf);
+        void removeLeaf(int32_t leaf);
+
+        /**
+         * @brief 结点不平衡时做一次旋转
+         * @return 返回旋转后占据原来位置的结点
+         */
+        int32_t balance(int32_t index);
+
+        /**
+         * @brief 从结点开始往上重新计算高度和包围盒，并做平衡
+         */
+        void refit(int32_t index);
+
+        /**
+         * @brief 收集子树里的所有叶子，不再做测试
+         */
+        void collectLeaves(int32_t index, Renderables &result) const;
+
+        void setFatBound(TreeNode &node, const Aabb &box) const;
+
+        static Real computeArea(const Vector3 &minPos, const Vector3 &maxPos);
+        static void merge(const TreeNode &a, const TreeNode &b, Vector3 &minPos, Vector3 &maxPos);
+        static bool contains(const TreeNode &node, const Aabb &box);
+
+    protected:
+        TreeNodes   mNodes;         /// 所有结点
+        int32_t     mRoot;          /// 根结点
+        int32_t     mFreeList;      /// 空闲结点链表头
+        size_t      mLeafCount;     /// 叶子数量
+        Real        mMargin;        /// 叶子包围盒放大比例
+
+        mutable NodeStack   mStack;     /// 查询用的结点栈，避免每次查询分配内存
+        mutable MaskStack   mMasks;     /// 和结点栈对应的视景体面掩码
+    };
+}
+
+
+#endif  /*__T3D_DYNAMIC_AABB_TREE_H__*/
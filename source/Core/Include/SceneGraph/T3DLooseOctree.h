@@ -0,0 +1,157 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_LOOSE_OCTREE_H__
+#define __T3D_LOOSE_OCTREE_H__
+
+
+#include "SceneGraph/T3DSpatialIndex.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class LooseOctree
+     * @brief 松散八叉树空间索引
+     * @remarks 每个单元的松散范围是自身边长的两倍，对象按中心点落在哪个单元、
+     *      按大小决定放在哪一层，不会因为跨单元边界被卡在上层。
+     *      对象移动后只要还在原来单元的松散范围里就不用动，移出去了才重新插入。
+     *      对象超出根单元时根单元往对象方向扩大一倍，不需要事先知道场景范围。
+     *      子树里没有对象的单元在对象移除时回收，查询时直接跳过。
+     */
+    class T3D_ENGINE_API LooseOctree : public SpatialIndex
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param [in] minCellSize : 最小单元的边长，单元不会再细分到比这个小
+         */
+        LooseOctree(Real minCellSize = Real(1.0));
+
+        /**
+         * @brief 析构函数
+         */
+        virtual ~LooseOctree();
+
+        virtual const char *getName() const override;
+
+        virtual uint32_t insert(SGRenderable *renderable, const Aabb &box) override;
+
+        virtual void update(uint32_t proxy, const Aabb &box) override;
+
+        virtual void remove(uint32_t proxy) override;
+
+        virtual void clear() override;
+
+        virtual void query(const Frustum &frustum, Renderables &result) const override;
+
+        virtual void query(const Aabb &box, Renderables &result) const override;
+
+        virtual void collect(Renderables &result) const override;
+
+        virtual size_t getCount() const override    { return mCount; }
+
+        /**
+         * @brief 返回正在使用的单元数量
+         */
+        size_t getCellCount() const     { return mCells.size() - mFreeCells.size(); }
+
+    protected:
+        enum
+        {
+            E_NULL_CELL = -1,       /// 空单元
+            E_MAX_CHILDREN = 8,     /// 子单元数量
+        };
+
+        typedef std::vector<uint32_t>           ItemIndices;
+        typedef std::vector<int32_t>            CellIndices;
+
+        /**
+         * @brief 八叉树单元
+         */
+        struct Cell
+        {
+            Vector3     center;         /// 单元中心
+            Real        halfSize;       /// 单元半边长，松散范围是两倍
+            int32_t     parent;         /// 父单元
+            int32_t     children[E_MAX_CHILDREN];   /// 子单元，按x、y、z是否在中心正方向组成下标
+            ItemIndices items;          /// 直接放在本单元的对象
+            size_t      count;          /// 整棵子树里的对象数量
+        };
+
+        /**
+         * @brief 索引里的对象
+         */
+        struct Item
+        {
+            SGRenderable    *renderable;    /// 对象，空闲时为nullptr
+            Vector3         minPos;         /// 世界包围盒最小点
+            Vector3         maxPos;         /// 世界包围盒最大点
+            int32_t         cell;           /// 所在单元
+            uint32_t        slot;           /// 在单元对象列表里的位置
+        };
+
+        typedef std::vector<Cell>               Cells;
+        typedef std::vector<Item>               Items;
+        typedef Items::iterator                 ItemsItr;
+        typedef Items::const_iterator           ItemsConstItr;
+
+        int32_t allocateCell(const Vector3 &center, Real halfSize, int32_t parent);
+
+        /**
+         * @brief 回收整棵子树的单元
+         */
+        void freeCells(int32_t index);
+
+        /**
+         * @brief 判断中心和半径都能放进单元
+         */
+        bool fits(const Cell &cell, const Vector3 &center, Real radius) const;
+
+        /**
+         * @brief 扩大根单元直到能放下对象
+         */
+        void growRoot(const Vector3 &center, Real radius);
+
+        /**
+         * @brief 找到对象应该放的单元，需要的时候创建子单元
+         */
+        int32_t findCell(const Vector3 &center, Real radius);
+
+        void link(uint32_t item, int32_t cell);
+        void unlink(uint32_t item);
+
+        void queryCell(int32_t index, const Frustum &frustum, uint32_t mask, Renderables &result) const;
+        void queryCell(int32_t index, const Vector3 &minPos, const Vector3 &maxPos, Renderables &result) const;
+
+        static void getBox(const Aabb &box, Vector3 &minPos, Vector3 &maxPos, Vector3 &center, Real &radius);
+
+    protected:
+        Cells       mCells;         /// 所有单元
+        CellIndices mFreeCells;     /// 空闲单元
+        Items       mItems;         /// 所有对象，下标就是代理ID
+        ItemIndices mFreeItems;     /// 空闲对象
+        int32_t     mRoot;          /// 根单元
+        size_t      mCount;         /// 对象数量
+        Real        mMinHalfSize;   /// 最小单元的半边长
+    };
+}
+
+
+#endif  /*__T3D_LOOSE_OCTREE_H__*/
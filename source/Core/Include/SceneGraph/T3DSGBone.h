@@ -28,6 +28,8 @@ namespace Tiny3D
 {
     class SGBone : public SGTransformNode
     {
+        T3D_DECLARE_POOL_ALLOCATOR(SGBone);
+
     public:
         virtual ~SGBone();
 
@@ -52,6 +54,7 @@ namespace Tiny3D
     protected:
         ObjectPtr   mBoneData;
         Matrix4     mFinalMatrix;
+        uint32_t    mFinalVersion;  /// 计算最终矩阵时用到的世界变换版本号
     };
 }
 
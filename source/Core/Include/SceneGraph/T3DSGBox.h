@@ -66,6 +66,11 @@ namespace Tiny3D
 
         void updateVertices();
 
+        /**
+         * @brief 按当前顶点重新计算本地包围盒
+         */
+        void updateLocalBound();
+
     protected:
         enum
         {
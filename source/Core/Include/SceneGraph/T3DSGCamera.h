@@ -101,6 +101,8 @@ namespace Tiny3D
 
         mutable bool    mIsViewDirty;
         mutable bool    mIsFrustumDirty;
+
+        uint32_t        mParentWorldVersion;    /// 计算视图矩阵时父结点的世界变换版本号
     };
 }
 
@@ -22,19 +22,80 @@
 
 
 #include "SceneGraph/T3DSGRenderable.h"
+#include "T3DAabb.h"
 
 
 namespace Tiny3D
 {
+    /**
+     * @class SGGeometry
+     * @brief 带几何形状的可渲染结点基类
+     * @note 设置了本地包围盒的，变换变化时重新拟合世界包围盒，用来做视景体剔除。
+     *      没有本地包围盒的，总是提交渲染。
+     */
     class T3D_ENGINE_API SGGeometry : public SGRenderable
     {
     public:
         virtual ~SGGeometry();
 
+        /**
+         * @brief 设置本地空间的包围盒
+         * @param [in] box : 本地包围盒
+         * @return void
+         * @note 下一次更新变换时重新拟合世界包围盒
+         */
+        void setLocalBound(const Aabb &box);
+
+        /**
+         * @brief 去掉本地包围盒，结点不再参与视景体剔除
+         * @return void
+         * @note 用于顶点会在运行时变化、绑定姿势下的包围盒不可靠的几何体，例如蒙皮网格
+         */
+        void removeLocalBound();
+
+        /**
+         * @brief 返回是否有本地包围盒
+         */
+        bool hasLocalBound() const          { return mHasLocalBound; }
+
+        /**
+         * @brief 返回本地包围盒
+         */
+        const Aabb &getLocalBound() const   { return mLocalBound; }
+
+        /**
+         * @brief 返回世界包围盒，只包括本结点，不包括子结点
+         */
+        const Aabb &getWorldBound() const   { return mWorldBound; }
+
+        /**
+         * @brief 从父类继承，有本地包围盒的返回世界包围盒
+         */
+        virtual const Aabb *getSpatialBound() const override;
+
     protected:
         SGGeometry(uint32_t uID = E_NID_AUTOMATIC);
 
+        /**
+         * @brief 从父类继承，先用子树包围盒剔除，再用自己的世界包围盒剔除
+         * @note 场景管理器用空间索引裁剪时，有包围盒的结点自己由空间索引查询，这里只处理子结点
+         */
         virtual void frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue) override;
+
+        /**
+         * @brief 从父类继承，变换变化时重新拟合世界包围盒，再合并子结点的包围盒
+         * @note 重新拟合后通知场景管理器更新空间索引
+         */
+        virtual void updateEnclosingBound() override;
+
+        virtual void cloneProperties(const NodePtr &node) const override;
+
+    protected:
+        Aabb        mLocalBound;        /// 本地包围盒
+        Aabb        mWorldBound;        /// 按世界变换拟合的包围盒
+        uint32_t    mBoundVersion;      /// 拟合世界包围盒时变换结点的世界变换版本
+        bool        mHasLocalBound;     /// 是否有本地包围盒
+        bool        mIsBoundDirty;      /// 本地包围盒变化了，需要重新拟合
     };
 }
 
@@ -22,26 +22,93 @@
 
 
 #include "SceneGraph/T3DSGGeometry.h"
+#include "Misc/T3DObjectPool.h"
 
 
 namespace Tiny3D
 {
     class T3D_ENGINE_API SGMesh : public SGGeometry
     {
+        T3D_DECLARE_POOL_ALLOCATOR(SGMesh);
+
     public:
-        static SGMeshPtr create(VertexDataPtr vertexData, ObjectPtr submeshData, uint32_t uID = E_NID_AUTOMATIC);
+        static SGMeshPtr create(VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr submeshData, uint32_t uID = E_NID_AUTOMATIC);
 
         virtual ~SGMesh();
 
         virtual Type getNodeType() const override;
         virtual NodePtr clone() const override;
 
+        /**
+         * @brief 以本网格为模板创建一个实例
+         * @param [in] vertexData : 实例用的顶点数据
+         * @param [in] uID : 结点唯一标识，默认是自动生成
+         * @return 返回网格实例
+         * @remarks 实例和模板共享网格数据、索引缓冲区和材质，不再重新上传索引数据。
+         *      顶点数据由调用者决定，没有蒙皮的可以直接用模板的顶点数据。
+         */
+        SGMeshPtr createInstance(VertexDataPtr vertexData, uint32_t uID = E_NID_AUTOMATIC) const;
+
         const String &getSubMeshName() const;
 
+        /**
+         * @brief 返回网格数据，里面是系统内存中的顶点数据
+         * @note 硬件顶点缓冲区是只写的，需要在CPU端读取顶点的（比如静态合批）通过这里获取
+         */
+        const ObjectPtr &getMeshData() const    { return mMeshData; }
+
+        /**
+         * @brief 返回子网格数据，里面是系统内存中的索引数据和材质名称
+         */
+        const ObjectPtr &getSubMeshData() const { return mSubMeshData; }
+
+        /**
+         * @brief 返回LOD级数，包括原始网格这一级
+         */
+        size_t getLodCount() const  { return mLodIndexData.size() + 1; }
+
+        /**
+         * @brief 返回当前渲染用的LOD级别，0是原始网格
+         */
+        size_t getLodLevel() const  { return mLodLevel; }
+
     protected:
+        typedef std::vector<IndexDataPtr>       IndexDataList;
+        typedef IndexDataList::iterator         IndexDataListItr;
+        typedef IndexDataList::const_iterator   IndexDataListConstItr;
+
         SGMesh(uint32_t uID = E_NID_AUTOMATIC);
 
-        virtual bool init(VertexDataPtr vertexData, ObjectPtr submeshData);
+        virtual bool init(VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr submeshData);
+
+        /**
+         * @brief 用系统内存中的索引数据创建硬件索引缓冲区
+         */
+        IndexDataPtr createIndexData(bool is16Bits, const std::vector<uint8_t> &indices) const;
+
+        /**
+         * @brief 用本子网格用到的顶点位置计算本地包围盒
+         * @note 没有位置属性的网格不设置包围盒，不参与视景体剔除
+         */
+        void initBound();
+
+        /**
+         * @brief 创建LOD索引缓冲区，并用本地包围盒算出选LOD用的包围球
+         */
+        bool initLod();
+
+        /**
+         * @brief 根据包围球投影到屏幕上的高度选择LOD级别
+         * @remarks 投影高度用相机的fovY算出占视口高度的比例，和转换工具写入的阈值比较。
+         *      切换到粗糙一级要比阈值再小一截，切回精细一级要比阈值再大一截，
+         *      距离在阈值附近来回变化时不会每帧切换。
+         */
+        void selectLod(const SGCameraPtr &camera);
+
+        /**
+         * @brief 从父类继承，加入渲染队列前先选择LOD级别
+         */
+        virtual void addToRenderQueue(const RenderQueuePtr &queue) override;
 
         virtual void updateTransform() override;
 
@@ -54,11 +121,17 @@ namespace Tiny3D
         virtual bool isIndicesUsed() const override;
 
     protected:
+        ObjectPtr   mMeshData;
         ObjectPtr   mSubMeshData;
         MaterialPtr mMaterial;
 
         VertexDataPtr   mVertexData;
         IndexDataPtr    mIndexData;
+
+        IndexDataList   mLodIndexData;  /// LOD索引数据，从精细到粗糙排列，和模板网格共享
+        Vector3         mLodCenter;     /// 选LOD用的本地包围球球心
+        Real            mLodRadius;     /// 选LOD用的本地包围球半径
+        size_t          mLodLevel;      /// 当前LOD级别，0是原始网格
     };
 }
 
@@ -40,9 +40,9 @@ namespace Tiny3D
 
         struct ActionInfo
         {
-            String  mName;          /// 
-            int64_t mDuration;      /// öʱ
-            int32_t mTotalFrames;   /// öܹؼ֡֡
+            String  mName;          /// 动作名称
+            int64_t mDuration;      /// 该动作动画持续时间
+            int32_t mTotalFrames;   /// 该动作动画总共关键帧帧数
         };
 
         typedef std::vector<ActionInfo>     ActionList;
@@ -60,16 +60,16 @@ namespace Tiny3D
         virtual NodePtr clone() const override;
 
         /**
-         * @brief öٸģеĶ
-         * @param [out] actions : б
+         * @brief 枚举该模型所有的动画动作
+         * @param [out] actions : 动画动作列表
          * @return void
          */
         void enumerateActionList(ActionList &actions);
 
         /**
-         * @brief ָж
-         * @param [in] name : 
-         * @return óɹtrue
+         * @brief 按照指定名称运行动画动作
+         * @param [in] name : 动作名称
+         * @return 调用成功，返回true
          */
         bool runAction(const String &name, bool repeat = true, int32_t frame = 0);
 
@@ -83,8 +83,22 @@ namespace Tiny3D
 
         virtual bool init(const String &modelName);
 
+        /**
+         * @brief 以另一个模型为模板初始化实例
+         * @param [in] source : 模板模型
+         * @return 成功返回true
+         * @remarks 共享模板的模型资源、网格数据、索引缓冲区、材质和没有蒙皮的顶点缓冲区，
+         *      只给实例创建自己的变换结点、骨骼和蒙皮顶点流
+         */
+        bool initInstance(const SGModel *source);
+
         virtual void updateTransform() override;
 
+        /**
+         * @brief 从父类继承，重写以在渲染线程上把蒙皮后的顶点写入硬件缓冲区
+         */
+        virtual void postUpdateTransform() override;
+
         void updatePoses();
         void updatePose(int64_t time, ObjectPtr skeleton);
         void updateSkeletons();
@@ -95,6 +109,26 @@ namespace Tiny3D
         bool getVertexElement(ObjectPtr buffer, VertexElement::Semantic semantic, VertexElement &element);
 
         VertexDataPtr createVertexData(ObjectPtr data);
+
+        /**
+         * @brief 创建实例的顶点数据，只有蒙皮顶点流分配新的硬件缓冲区，其他流共享模板的
+         */
+        VertexDataPtr createInstanceVertexData(ObjectPtr data, VertexDataPtr shared);
+
+        HardwareVertexBufferPtr createVertexBuffer(ObjectPtr buffer);
+        bool isSkinnedBuffer(ObjectPtr buffer);
+
+        /**
+         * @brief 创建所有网格，source不为空的时候以source的网格为模板创建实例
+         */
+        void createMeshes(const SGModel *source);
+        SGMeshPtr createMesh(const SGModel *source, size_t index, VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr submeshData);
+
+        /**
+         * @brief 创建变换结点和骨骼，并更新到默认姿势
+         */
+        bool createHierarchy();
+
         bool createSkeletons();
         bool createNodes();
 
@@ -120,6 +154,17 @@ namespace Tiny3D
         typedef NodeList::iterator              NodeListItr;
         typedef NodeList::const_iterator        NodeListConstItr;
 
+        /** 蒙皮后等待写入硬件缓冲区的顶点 */
+        struct SkinUpload
+        {
+            HardwareVertexBufferPtr buffer;     /// 要写入的硬件顶点缓冲区
+            std::vector<uint8_t>    vertices;   /// 蒙皮后的顶点数据
+        };
+
+        typedef std::vector<SkinUpload>         SkinUploadList;
+        typedef SkinUploadList::iterator        SkinUploadListItr;
+        typedef SkinUploadList::const_iterator  SkinUploadListConstItr;
+
         ModelPtr        mModel;
         RenderMode      mRenderMode;
 
@@ -143,6 +188,9 @@ namespace Tiny3D
         bool            mIsLoop;
 
         ObjectPtr       mCurActionData;
+
+        SkinUploadList  mSkinUploads;       /// 蒙皮顶点暂存区，跨帧复用
+        size_t          mSkinUploadCount;   /// 本帧等待写入的暂存区数量
     };
 }
 
@@ -26,6 +26,7 @@
 #include "T3DVector3.h"
 #include "T3DMatrix3.h"
 #include "T3DMatrix4.h"
+#include "T3DAabb.h"
 #include "Misc/T3DSmartPtr.h"
 #include "T3DTypedef.h"
 
@@ -34,37 +35,56 @@ namespace Tiny3D
 {
     /**
      * @class SGNode
-     * @brief Scene GraphеĽ
+     * @brief Scene Graph中的结点基类
      */
     class T3D_ENGINE_API SGNode : public Node
     {
         friend class SceneManager;
 
         /**
-         * @brief ֱֹʹÿ캯ʹcloneӿڴ渴
+         * @brief 禁止直接使用拷贝构造函数拷贝，请使用clone接口代替复制
          */
         T3D_DISABLE_COPY(SGNode);
 
+    public:
+        /**
+         * @brief 子树包围盒的状态
+         */
+        enum BoundState
+        {
+            E_BS_EMPTY = 0,     /// 子树里没有带包围盒的对象，整棵子树都可以剔除
+            E_BS_FINITE,        /// 子树包围盒有效，可以用来剔除整棵子树
+            E_BS_INFINITE,      /// 子树里有范围未知的对象，不能用包围盒剔除
+        };
+
     protected:
         /**
-         * @brief ĬϹ캯
-         * @param [in] unID : ʶΨһIDĬֵԶΨһID
-         * @note ﹹ캯protectedȨޣҪΪ˷ֹⲿֱnew
-         *  ޷ֱӶʹøcreatenew
+         * @brief 默认构造函数
+         * @param [in] unID : 标识结点的唯一ID，默认值是由引擎自动生成唯一ID
+         * @note 这里构造函数是protected访问权限，主要是为了防止外部直接new来构造对象，
+         *  本类是无法构造直接对象，请使用各派生类的create代替new来构造对象
          */
         SGNode(uint32_t unID = E_NID_AUTOMATIC);
 
     public:
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~SGNode();
 
         /**
-         * @brief û
-         * @param [in] data : û
+         * @brief 设置结点名称
+         * @param [in] name : 结点名称
+         * @return void
+         * @note 结点在场景里的时候同时更新场景管理器的名称索引
+         */
+        virtual void setName(const String &name) override;
+
+        /**
+         * @brief 设置用户数据
+         * @param [in] data : 用户数据
          * @return void
-         * @note ݿûõκڴַʹԼͽ
+         * @note 该数据可以是用户设置的任何整型甚至内存地址，具体由使用者自己定义和解析
          * @see long_t getUserData() const
          * @see void setUserData(const ObjectPtr &rkObject)
          * @see const ObjectPtr &getUserObject() const
@@ -73,18 +93,18 @@ namespace Tiny3D
         void setUserData(long_t data);
 
         /**
-         * @brief ȡû
-         * @return û
-         * @note صûͨsetUserDataõݣʹԼͽ
+         * @brief 获取用户数据
+         * @return 返回用户数据
+         * @note 返回的数据是由用户通过setUserData设置的数据，具体由使用者自己定义和解析
          * @see void setUserData(long_t data)
          */
         long_t getUserData() const;
 
         /**
-         * @brief ûݶ
-         * @param [in] rkObject : ָ
+         * @brief 设置用户数据对象
+         * @param [in] rkObject : 对象指针
          * @return void
-         * @note öObjectκָ룬ʹԼͽ
+         * @note 该对象是Object类的任何派生类的指针，具体由使用者自己定义和解析
          * @see void setUserData(long_t data)
          * @see long_t getUserData() const
          * @see const ObjectPtr &getUserObject() const
@@ -93,9 +113,9 @@ namespace Tiny3D
         void setUserObject(const ObjectPtr &rkObject);
 
         /**
-         * @brief ȡûݶ
-         * @return ȡûݶ
-         * @note صݶûͨsetUserObjectõĶ󣬾ʹԼͽ
+         * @brief 获取用户数据对象
+         * @return 获取用户数据对象
+         * @note 返回的数据对象是由用户通过setUserObject设置的对象，具体由使用者自己定义和解析
          * @see void setUserData(long_t data)
          * @see long_t getUserData()
          * @see void setUserObject(const ObjectPtr &rkObject)
@@ -105,9 +125,9 @@ namespace Tiny3D
         const ObjectPtr &getUserObject() const;
 
         /**
-        * @brief ȡûݶ
-        * @return ȡûݶ
-        * @note صݶûͨsetUserObjectõĶ󣬾ʹԼͽ
+        * @brief 获取用户数据对象
+        * @return 获取用户数据对象
+        * @note 返回的数据对象是由用户通过setUserObject设置的对象，具体由使用者自己定义和解析
         * @see void setUserData(long_t data)
         * @see long_t getUserData()
         * @see void setUserObject(const ObjectPtr &rkObject)
@@ -117,71 +137,228 @@ namespace Tiny3D
         ObjectPtr getUserObject();
 
         /**
-         * @brief ýǷҪػ桢¼
-         * @param [in] isDirty : Ƿ˱
-         * @param [in] recursive : ǷҪݹӽڵ㶼ϸñǣĬΪֻñ
+         * @brief 设置结点是否需要重绘、重新计算标记
+         * @param [in] isDirty : 结点数据是否脏了标记
+         * @param [in] recursive : 是否需要递归所有子节点都设置上该标记，默认为只设置本结点
          * @return void
          * @see bool isDirty() const
          */
         virtual void setDirty(bool isDirty, bool recursive = false);
 
         /**
-         * @brief ؽǷ࣬Ҫ»ơȱ
-         * @return ؽ
+         * @brief 返回结点数据是否脏，需要重新绘制、计算等标记
+         * @return 返回结点数据脏标记
          * @see void setDirty(bool isDirty, bool recursive)
          */
         bool isDirty() const;
 
         /**
-         * @brief ýǷɼ
-         * @param [in] visible : ɼ
+         * @brief 设置结点是否可见
+         * @param [in] visible : 可见标记
          * @return void
-         * @note ͨӿ˲ɼֱȾˮƳýԼӽ㣬Ⱦ
+         * @note 通过本接口设置了不可见，则会直接在渲染流水线上移除该结点以及所有子结点，不参与渲染
          * @see bool isVisible() const
          */
         virtual void setVisible(bool visible);
 
         /**
-         * @brief ؽǷɼ
-         * @return ؽɼ
+         * @brief 返回结点是否可见
+         * @return 返回结点可见性
          * @see void setVisible(bool visible)
          */
         bool isVisible() const;
 
+        /**
+         * @brief 获取最近的3D变换祖先结点
+         * @return 返回最近的3D变换祖先结点，没有的返回nullptr
+         * @note 结点挂接关系变化时缓存，不用每次沿父结点链查找
+         */
+        SGTransformNode *getTransformParent() const;
+
+        /**
+         * @brief 获取最近的2D变换祖先结点
+         * @return 返回比最近的3D变换祖先更近的2D变换祖先结点，没有或者3D变换祖先更近的返回nullptr
+         * @note 和getTransformParent()一样在挂接关系变化时缓存
+         */
+        SGTransform2D *getTransform2DParent() const;
+
+        /**
+         * @brief 获取包围整棵子树的世界包围盒
+         * @return 返回世界包围盒，只有getEnclosingBoundState()返回E_BS_FINITE时才有效
+         * @note 每帧更新变换后从叶子往上合并
+         */
+        const Aabb &getEnclosingBound() const;
+
+        /**
+         * @brief 获取子树包围盒的状态
+         * @see BoundState
+         */
+        BoundState getEnclosingBoundState() const;
+
     protected:
         /** 
-         * @brief ±ı任ӽı任
+         * @brief 更新本身的变换和所有子结点的变换
          * @return void
-         * @note дʵ־ı任²
+         * @note 派生类重写本函数以实现具体的变换更新策略。
+         *      场景结点多的时候不同子树会在工作线程上并行更新，本函数里不能创建结点、
+         *      修改其他子树，也不能直接操作渲染器和硬件缓冲区，这类操作通过
+         *      requestPostUpdate()放到postUpdateTransform()里做。
          */
         virtual void updateTransform();
 
         /**
-         * @brief Ӿ޳ݹӽ
-         * @param [in] bound : Ӿ
-         * @param [in] queue : Ⱦ
+         * @brief 场景更新全部结束后在渲染线程上执行的操作
+         * @return void
+         * @remarks 只有调用过requestPostUpdate()的结点才会被调用，
+         *      默认实现什么都不做，派生类重写以写入硬件缓冲区等
+         */
+        virtual void postUpdateTransform();
+
+        /**
+         * @brief 请求在渲染线程上调用postUpdateTransform()
+         * @return void
+         * @remarks 并行更新时登记到场景管理器，所有任务结束后按结点ID顺序调用。
+         *      串行更新时直接调用。
+         */
+        void requestPostUpdate();
+
+        /**
+         * @brief 视景体外物体剔除，递归调用所有子结点
+         * @param [in] bound : 视景体区域
+         * @param [in] queue : 渲染队列
          * @return void
          * @note 
-         *  - Ӿڣӽϵ嶼ᱻ޳Ⱦ
-         *  - Ӿڣݹӽжϣ
-         *  - ǿȾ㣬޷RenderQueueУ
+         *  - 如果本身不在视景体内，则所有子结点上的物体都会被剔除，不参与渲染；
+         *  - 如果本身在视景体内，则会递归调用子结点判断；
+         *  - 如果不是可渲染结点，则无法加入的RenderQueue中；
          */
         virtual void frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue);
 
         /**
-         * @brief ¡
-         * @param [in] node : Ŀ
+         * @brief 对所有子结点做视景体外物体剔除
+         * @param [in] bound : 视景体区域
+         * @param [in] queue : 渲染队列
+         * @return void
+         */
+        void frustumCullingChildren(const BoundPtr &bound, const RenderQueuePtr &queue);
+
+        /**
+         * @brief 更新包围整棵子树的世界包围盒
+         * @return void
+         * @remarks 在updateTransform()里更新完所有子结点后调用，默认实现合并子结点的包围盒，
+         *      带几何形状的派生类重写以加上自己的包围盒
+         */
+        virtual void updateEnclosingBound();
+
+        /**
+         * @brief 把结点的子树包围盒合并到本结点的子树包围盒里
+         * @param [in] node : 要合并的结点
          * @return void
-         * @note ƱԸĿnode
+         */
+        void mergeEnclosingBound(const SGNode *node);
+
+        /**
+         * @brief 用子树包围盒和视景体求交
+         * @param [in] bound : 视景体区域
+         * @param [out] parentMask : 返回求交前视景体上的面掩码，处理完子结点后用来恢复
+         * @return 整棵子树都在视景体外返回false
+         * @remarks 包围盒完全在某个面内侧的，把这个面从视景体的面掩码里去掉，
+         *      子结点就不用再测试这个面。返回true的，调用者处理完子结点后要用parentMask恢复
+         *      场景管理器用空间索引裁剪时，包围盒有限的子树直接返回false。
+         *      开启了遮挡剔除的，在视景体里的子树包围盒被遮挡体完全挡住的也返回false
+         */
+        bool cullEnclosingBound(const BoundPtr &bound, uint32_t &parentMask) const;
+
+        /**
+         * @brief 恢复cullEnclosingBound()修改过的视景体面掩码
+         */
+        void restorePlaneMask(const BoundPtr &bound, uint32_t parentMask) const;
+
+        /**
+         * @brief 克隆结点属性
+         * @param [in] node : 目标结点
+         * @return void
+         * @note 复制本结点所有属性给目标结点node
          */
         virtual void cloneProperties(const NodePtr &node) const;
 
+        /**
+         * @brief 挂到父结点上的通知，如果挂到了场景根结点下，通知整棵子树进入场景
+         */
+        virtual void onAttachParent(const NodePtr &parent) override;
+
+        /**
+         * @brief 从父结点上移除的通知，如果原来在场景根结点下，通知整棵子树离开场景
+         */
+        virtual void onDetachParent(const NodePtr &parent) override;
+
+        /**
+         * @brief 结点进入场景，登记到场景管理器的结点索引，递归调用所有子结点
+         * @note 派生类重写本函数在结点挂到场景根结点下时做注册等操作
+         */
+        virtual void onEnterScene();
+
+        /**
+         * @brief 结点离开场景，从场景管理器的结点索引移除，递归调用所有子结点
+         * @note 派生类重写本函数在结点从场景根结点下移除时做反注册等操作
+         */
+        virtual void onLeaveScene();
+
+        /**
+         * @brief 查找指定结点ID的子结点
+         * @remarks 在场景里的结点直接查场景管理器的结点索引，不在场景里的遍历子结点
+         */
+        virtual Node *findChild(uint32_t nodeID) const override;
+
+        /**
+         * @brief 查找指定名称ID的子结点
+         * @remarks 在场景里的结点查场景管理器的名称索引，不在场景里的或者查找没有名称的子结点时遍历子结点
+         */
+        virtual Node *findNamedChild(uint32_t nameID) const override;
+
+        /**
+         * @brief 判断结点是否挂在场景根结点下
+         * @param [in] node : 要判断的结点
+         * @return 在场景中返回true
+         */
+        static bool isInScene(const Node *node);
+
+        /**
+         * @brief 更新最近的3D和2D变换祖先结点
+         * @param [in] parent : 最近的3D变换祖先结点
+         * @param [in] parent2D : 比parent更近的2D变换祖先结点
+         * @return void
+         * @remarks 默认实现更新自己并传递给子结点，3D变换结点重写后不再往下传递
+         */
+        virtual void updateTransformParent(SGTransformNode *parent, SGTransform2D *parent2D);
+
+        /**
+         * @brief 查找挂到结点下的子结点最近的3D变换祖先结点
+         * @param [in] node : 父结点
+         * @return 父结点本身是3D变换结点的返回父结点，否则返回父结点缓存的3D变换祖先结点
+         */
+        static SGTransformNode *findTransformParent(Node *node);
+
+        /**
+         * @brief 查找挂到结点下的子结点最近的2D变换祖先结点
+         * @param [in] node : 父结点
+         * @return 父结点本身是2D变换结点的返回父结点，是3D变换结点的返回nullptr，
+         *      否则返回父结点缓存的2D变换祖先结点
+         */
+        static SGTransform2D *findTransform2DParent(Node *node);
+
+    protected:
+        SGTransformNode *mTransformParent;  /// 最近的3D变换祖先结点，挂接关系变化时更新
+        SGTransform2D   *mTransform2DParent;/// 比最近的3D变换祖先更近的2D变换祖先结点，挂接关系变化时更新
+        Aabb            mEnclosingBound;    /// 包围整棵子树的世界包围盒
+        BoundState      mBoundState;        /// 子树包围盒的状态
+
     private:
-        long_t      mUserData;      /// û
-        ObjectPtr   mUserObject;    /// ûݶ
+        long_t      mUserData;      /// 保存用户数据
+        ObjectPtr   mUserObject;    /// 保存用户数据对象
 
-        bool        mIsDirty;       /// ǷˣҪػ桢¼
-        bool        mIsVisible;     /// ɼ
+        bool        mIsDirty;       /// 结点数据是否脏了，需要重绘、重新计算等
+        bool        mIsVisible;     /// 结点可见性
     };
 }
 
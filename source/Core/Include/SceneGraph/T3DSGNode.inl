@@ -53,4 +53,24 @@ namespace Tiny3D
     {
         return mIsVisible;
     }
+
+    inline SGTransformNode *SGNode::getTransformParent() const
+    {
+        return mTransformParent;
+    }
+
+    inline SGTransform2D *SGNode::getTransform2DParent() const
+    {
+        return mTransform2DParent;
+    }
+
+    inline const Aabb &SGNode::getEnclosingBound() const
+    {
+        return mEnclosingBound;
+    }
+
+    inline SGNode::BoundState SGNode::getEnclosingBoundState() const
+    {
+        return mBoundState;
+    }
 }
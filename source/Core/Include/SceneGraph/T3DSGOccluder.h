@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SG_OCCLUDER_H__
+#define __T3D_SG_OCCLUDER_H__
+
+
+#include "SceneGraph/T3DSGNode.h"
+#include "T3DAabb.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class SGOccluder
+     * @brief 遮挡体结点，开启遮挡剔除后每帧光栅化到软件深度缓冲，挡住后面的物体
+     * @remarks 遮挡体本身不渲染，只用来剔除。网格要比看得见的物体小、三角形要少，
+     *      一般用墙体、地形、大型建筑内部的简化盒子或者几十个三角形的简化网格。
+     *      跟随最近的3D变换祖先结点移动。
+     */
+    class T3D_ENGINE_API SGOccluder : public SGNode
+    {
+    public:
+        static SGOccluderPtr create(uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual ~SGOccluder();
+
+        virtual Type getNodeType() const override;
+        virtual NodePtr clone() const override;
+
+        /**
+         * @brief 设置本地空间的遮挡网格
+         * @param [in] vertices : 顶点
+         * @param [in] vertexCount : 顶点数量
+         * @param [in] indices : 三角形列表索引
+         * @param [in] indexCount : 索引数量，必须是3的倍数
+         * @return void
+         * @note 不区分正反面，网格不需要封闭
+         */
+        void setMesh(const Vector3 *vertices, size_t vertexCount,
+            const uint16_t *indices, size_t indexCount);
+
+        /**
+         * @brief 用本地空间的立方体作为遮挡网格
+         * @param [in] box : 立方体范围
+         * @return void
+         */
+        void setBox(const Aabb &box);
+
+        /**
+         * @brief 返回遮挡网格的本地包围盒
+         */
+        const Aabb &getLocalBound() const   { return mLocalBound; }
+
+        size_t getVertexCount() const   { return mVertices.size(); }
+        size_t getIndexCount() const    { return mIndices.size(); }
+
+        /**
+         * @brief 返回本地到世界的变换矩阵
+         */
+        const Matrix4 &getWorldMatrix() const;
+
+        /**
+         * @brief 把遮挡网格光栅化到遮挡剔除器
+         * @param [in] culler : 遮挡剔除器
+         * @param [in] frustum : 视景体，遮挡网格在视景体外的直接跳过
+         * @return 光栅化了返回true
+         */
+        bool rasterize(OcclusionCuller *culler, const Frustum &frustum) const;
+
+    protected:
+        SGOccluder(uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual void cloneProperties(const NodePtr &node) const override;
+
+        /**
+         * @brief 从父类继承，登记到场景管理器的遮挡体列表
+         */
+        virtual void onEnterScene() override;
+
+        /**
+         * @brief 从父类继承，从场景管理器的遮挡体列表移除
+         */
+        virtual void onLeaveScene() override;
+
+    protected:
+        typedef std::vector<Vector3>            Vertices;
+        typedef std::vector<uint16_t>           Indices;
+
+        Vertices    mVertices;      /// 本地空间顶点
+        Indices     mIndices;       /// 三角形列表索引
+        Aabb        mLocalBound;    /// 遮挡网格的本地包围盒
+    };
+}
+
+
+#endif  /*__T3D_SG_OCCLUDER_H__*/
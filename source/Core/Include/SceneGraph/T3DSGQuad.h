@@ -32,53 +32,53 @@ namespace Tiny3D
         static SGQuadPtr create(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief һQuad
-         * @param [in] size : ҪQuadĴС
-         * @param [in] uID : ڵIDĬΪԶ
-         * @return һQuadָ
+         * @brief 创建一个Quad对象出来
+         * @param [in] size : 要创建的Quad的大小
+         * @param [in] uID : 这个节点的ID，默认为自动生成
+         * @return 返回一个Quad对象指针
          */
         static SGQuadPtr create(const RealSize &size, uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief һQuad
-         * @param [in] materialName : ´QuadĲ
-         * @param [in] size : ҪQuadĴС
-         * @param [in] uID : ڵIDĬΪԶ
-         * @return һQuadָ
+         * @brief 创建一个Quad对象出来
+         * @param [in] materialName : 用于新创建的Quad的材质名称
+         * @param [in] size : 要创建的Quad的大小
+         * @param [in] uID : 这个节点的ID，默认为自动生成
+         * @return 返回一个Quad对象指针
          */
         static SGQuadPtr create(const String &materialName, const RealSize &size, uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~SGQuad();
 
         /**
-         * @brief ؽڵͣӸķ
-         * @return ؽڵ
+         * @brief 返回节点类型，从父类派生的方法
+         * @return 返回节点类型
          * @see enum Type
          */
         virtual Type getNodeType() const override;
 
         /**
-         * @brief QuadĴС
+         * @brief 设置Quad的大小
          */
         void setSize(const RealSize &size);
 
         /**
-         * @brief QuadĴС
+         * @brief 返回Quad的大小
          */
         const RealSize &getSize() const;
 
         /**
-         * @brief QuadʹõĲ
-         * @param [in] materialName : 
+         * @brief 设置Quad使用的材质
+         * @param [in] materialName : 材质名称
          */
         void setMaterial(const String &materialName);
 
         /**
-         * @brief QuadʹõĲ
-         * @param [in] ʶ
+         * @brief 设置Quad使用的材质
+         * @param [in] 材质对象
          */
         void setMaterial(MaterialPtr material);
 
@@ -94,29 +94,29 @@ namespace Tiny3D
         virtual void cloneProperties(const NodePtr &node) const override;
 
         /**
-         * @brief Ⱦʶ
-         * @note пȾҪдӿԷضӦȾʶ
+         * @brief 返回渲染材质对象。
+         * @note 所有可渲染派生类需要重写本接口以返回对应的渲染材质对象。
          */
         virtual MaterialPtr getMaterial() const override;
 
         /**
-         * @brief ȾԪ
+         * @brief 返回渲染元类型
          * @see Renderer::PrimitiveType
          */
         virtual Renderer::PrimitiveType getPrimitiveType() const override;
 
         /**
-         * @brief ضݶ
+         * @brief 返回顶点数据对象
          */
         virtual VertexDataPtr getVertexData() const override;
 
         /**
-         * @brief ݶ
+         * @brief 返回索引数据对象
          */
         virtual IndexDataPtr getIndexData() const override;
 
         /**
-         * @brief Ƿʹö
+         * @brief 是否使用顶点索引
          */
         virtual bool isIndicesUsed() const override;
 
@@ -30,8 +30,13 @@
 
 namespace Tiny3D
 {
+    struct OverlayVertex;
+
     class T3D_ENGINE_API SGRenderable : public SGNode
     {
+        friend class RenderQueue;
+        friend class SceneManager;
+
     protected:
         SGRenderable(uint32_t unID = E_NID_AUTOMATIC);
 
@@ -42,36 +47,103 @@ namespace Tiny3D
         virtual ~SGRenderable();
 
         /**
-         * @brief Ⱦʶ
-         * @note пȾҪдӿԷضӦȾʶ
+         * @brief 返回渲染材质对象。
+         * @note 所有可渲染派生类需要重写本接口以返回对应的渲染材质对象。
          */
         virtual MaterialPtr getMaterial() const = 0;
 
         /**
-         * @brief صǰȾ仯
+         * @brief 返回当前渲染对象世界变化矩阵
          */
         virtual const Matrix4 &getWorldMatrix() const;
 
         /**
-         * @brief ȾԪ
+         * @brief 返回渲染元类型
          * @see Renderer::PrimitiveType
          */
         virtual Renderer::PrimitiveType getPrimitiveType() const = 0;
 
         /**
-         * @brief ضݶ
+         * @brief 返回顶点数据对象
          */
         virtual VertexDataPtr getVertexData() const = 0;
 
         /**
-         * @brief ݶ
+         * @brief 返回索引数据对象
          */
         virtual IndexDataPtr getIndexData() const = 0;
 
         /**
-         * @brief Ƿʹö
+         * @brief 是否使用顶点索引
          */
         virtual bool isIndicesUsed() const = 0;
+
+        /**
+         * @brief 是否交给覆盖层合批，只对加入覆盖层分组的渲染对象有效
+         * @note 返回true的渲染对象在合批时不会调用getVertexData()和getIndexData()，
+         *      而是通过fillOverlayQuads()提供四边形
+         */
+        virtual bool isOverlayBatchable() const { return false; }
+
+        /**
+         * @brief 返回覆盖层合批用的四边形数量
+         */
+        virtual size_t getOverlayQuadCount() const { return 0; }
+
+        /**
+         * @brief 把四边形变换到世界空间后写到合批顶点数组里
+         * @param [out] vertices : 能放下getOverlayQuadCount() * 4个顶点的数组
+         */
+        virtual void fillOverlayQuads(OverlayVertex *vertices) const {}
+
+        /**
+         * @brief 返回加入场景空间索引用的世界包围盒
+         * @return 返回nullptr表示范围未知，不放进空间索引，只能通过遍历场景树裁剪
+         * @note 有包围盒的派生类重写本函数，包围盒变化后调用notifySpatialBoundChanged()
+         */
+        virtual const Aabb *getSpatialBound() const { return nullptr; }
+
+    protected:
+        /**
+         * @brief 通过了视景体剔除，加入渲染队列
+         * @param [in] queue : 渲染队列
+         * @return void
+         * @note 遍历场景树和查询空间索引两种裁剪方式都通过本函数加入渲染队列，
+         *      默认加入实体分组，派生类重写以在加入前做细节层次选择等操作
+         */
+        virtual void addToRenderQueue(const RenderQueuePtr &queue);
+
+        /**
+         * @brief 通知场景管理器空间索引里的包围盒要更新
+         * @return void
+         * @remarks 场景管理器没有空间索引时什么都不做，可以在工作线程上调用
+         */
+        void notifySpatialBoundChanged();
+
+        /**
+         * @brief 返回是否已经加入了场景空间索引
+         */
+        bool isInSpatialIndex() const;
+
+        /**
+         * @brief 进入场景时注册到常驻模式渲染队列，并在下一次裁剪前加入空间索引
+         */
+        virtual void onEnterScene() override;
+
+        /**
+         * @brief 离开场景时从常驻模式渲染队列和空间索引反注册
+         */
+        virtual void onLeaveScene() override;
+
+        /**
+         * @brief 默认不知道可渲染对象的范围，子树包围盒标记为无限大，总是通过剔除
+         * @note 有包围盒的派生类重写本函数
+         */
+        virtual void updateEnclosingBound() override;
+
+    private:
+        uint32_t    mQueueSlot;     /// 在常驻模式渲染队列里的槽位，未注册时为RenderQueue::E_INVALID_SLOT
+        uint32_t    mSpatialProxy;  /// 在场景空间索引里的代理ID，不在索引里时为SpatialIndex::INVALID_PROXY
     };
 }
 
@@ -53,6 +53,8 @@ namespace Tiny3D
 
         virtual void updateTransform() override;
 
+        virtual void postUpdateTransform() override;
+
         virtual void cloneProperties(const NodePtr &node) const override;
 
         virtual MaterialPtr getMaterial() const override;
@@ -66,6 +68,8 @@ namespace Tiny3D
     protected:
         SGBonePtr       mSkeleton;
         VertexDataPtr   mVertexData;
+
+        std::vector<BoneVertex> mVertices;  /// 本帧重新生成的骨骼顶点，等待写入硬件缓冲区
     };
 }
 
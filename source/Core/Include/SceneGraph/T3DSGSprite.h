@@ -22,156 +22,205 @@
 
 
 #include "SceneGraph/T3DSGRenderable.h"
+#include "Render/T3DOverlayBatcher.h"
 
 
 namespace Tiny3D
 {
+    /**
+     * @class SGSprite
+     * @brief 用于显示2D图片的渲染对象，一个精灵是一个带纹理的四边形
+     */
     class T3D_ENGINE_API SGSprite : public SGRenderable
     {
     public:
         /**
-         * @brief sprite
-         * @param [in] uID : ΨһʶĬΪԶ
+         * @brief 创建sprite结点对象
+         * @param [in] uID : 结点唯一标识，默认为引擎自动生成
          */
         static SGSpritePtr create(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~SGSprite();
 
         /**
-         * @brief Ӹ̳УдضӦĽ
-         * @return ؽ
+         * @brief 从父类继承，重写返回对应的结点类型
+         * @return 返回结点类型
          * @see enum Type
          */
         virtual Type getNodeType() const override;
 
         /**
-         * @brief Ӹ̳Уд¡ʵֱĸƲ
-         * @return һµ3D任
+         * @brief 从父类继承，重写父类克隆方法，以实现本类对象的复制操作
+         * @return 返回一个新的3D变换结点对象
          */
         virtual NodePtr clone() const override;
 
         /**
-         * @brief UV
-         * @param [in] index : 
-         * @param [in] uv : 
+         * @brief 设置材质
+         * @param [in] material : 精灵使用的材质，纹理取第0层
+         * @return void
+         */
+        void setMaterial(const MaterialPtr &material);
+
+        /**
+         * @brief 设置纹理UV坐标
+         * @param [in] index : 顶点索引，0到3依次是左上、左下、右上、右下
+         * @param [in] uv : 纹理坐标
          * @return void
          */
         void setTextureUV(size_t index, const Vector2 &uv);
 
         /**
-         * @brief 
-         * @param [in] rect : 
+         * @brief 设置纹理矩形区域
+         * @param [in] rect : 纹理区域，单位是纹理像素
          * @return void
-         * @note ʹñӿֱUV
+         * @note 可以使用本接口直接设置纹理UV
          */
         void setTextureUV(const Rect &rect);
 
         /**
-         * @brief ĳɫĬ϶ǰɫ
-         * @param [in] index : 
-         * @param [in] color : ɫ
+         * @brief 设置某个顶点颜色，默认都是白色
+         * @param [in] index : 顶点索引
+         * @param [in] color : 顶点颜色
          * @return void
          */
         void setVertexColor(size_t index, const Color4 &color);
 
         /**
-         * @brief жɫĬ϶ǰɫ
-         * @param [in] color : ɫ
+         * @brief 设置所有顶点颜色，默认都是白色
+         * @param [in] color : 顶点颜色
          * @return void
          */
         void setVerticesColor(const Color4 &color);
 
         /**
-         * @brief êλھλ
-         * @param [in] pos : êλãλǰٷֱȣֵ01֮
+         * @brief 设置锚点位于精灵区域的相对位置
+         * @param [in] pos : 锚点位置，单位是百分比，数值介于0到1之间
          * @return void
          */
         void setAnchorPos(const Vector2 &pos);
 
         /**
-         * @brief ȡêλ
-         * @return êλãصǰٷֱȣǾֵֵ01֮
+         * @brief 获取锚点位置
+         * @return 返回锚点位置，返回的是百分比，不是绝对值，数值介于0到1之间
          */
         const Vector2 &getAnchorPos() const;
 
         /**
-         * @brief þС
-         * @param [in] size : Сֵ
+         * @brief 设置精灵大小
+         * @param [in] size : 大小值
          * @return void
-         * @note СֱŻĴСʵĻϵشС
+         * @note 这个大小不是直接缩放回来的大小，而是实际屏幕上的像素大小
          */
         void setSize(const Size &size);
 
         /**
-         * @brief ȡС
-         * @return ؾС
-         * @note СֱŻĴСʵĻϵشС
+         * @brief 获取精灵大小
+         * @return 返回精灵大小
+         * @note 这个大小不是直接缩放回来的大小，而是实际屏幕上的像素大小
          */
         const Size &getSize() const;
 
+        /**
+         * @brief 从父类继承，精灵可以和其他覆盖层对象合批
+         */
+        virtual bool isOverlayBatchable() const override;
+
+        /**
+         * @brief 从父类继承，精灵只有一个四边形
+         */
+        virtual size_t getOverlayQuadCount() const override;
+
+        /**
+         * @brief 从父类继承，填写世界空间的精灵四边形顶点
+         */
+        virtual void fillOverlayQuads(OverlayVertex *vertices) const override;
+
     protected:
         /**
-         * @brief ĬϹ캯
+         * @brief 默认构造函数
          */
         SGSprite(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief ʼ
-         * @return ʼɹtrueʧܷfalse
+         * @brief 初始化
+         * @return 初始化成功返回true，失败返回false
          */
         bool init();
 
         /**
-         * @brief Ӹ̳УдʵӾ޳
-         * @param [in] bound : Ӿ
-         * @param [in] queue : Ⱦ
+         * @brief 从父类继承，重写以在渲染线程上重新生成四边形
+         */
+        virtual void updateTransform() override;
+
+        /**
+         * @brief 从父类继承，重写以在渲染线程上重新生成四边形
+         */
+        virtual void postUpdateTransform() override;
+
+        /**
+         * @brief 根据大小、锚点、UV和颜色更新本地空间的四边形顶点
+         */
+        void updateVertices();
+
+        /**
+         * @brief 四边形变化后重新生成不合批时使用的顶点和索引缓冲
+         */
+        void updateBuffers() const;
+
+        /**
+         * @brief 从父类继承，重写以实现物体视景体外的剔除
+         * @param [in] bound : 视景体区域
+         * @param [in] queue : 渲染队列
          * @return void
          */
         virtual void frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue) override;
 
         /**
-         * @brief Ӹ̳УزʶȾ
+         * @brief 从父类继承，返回材质对象给渲染器
          */
         virtual MaterialPtr getMaterial() const override;
 
         /**
-         * @brief Ӹ̳УȾͼԪ͸Ⱦ
+         * @brief 从父类继承，返回渲染图元类型给渲染器
          */
         virtual Renderer::PrimitiveType getPrimitiveType() const override;
 
         /**
-         * @brief Ӹ̳УضݸȾ
+         * @brief 从父类继承，返回顶点数据给渲染器
          */
         virtual VertexDataPtr getVertexData() const override;
 
         /**
-         * @brief Ӹ̳УضݸȾ
+         * @brief 从父类继承，返回顶点索引数据给渲染器
          */
         virtual IndexDataPtr getIndexData() const override;
 
         /**
-         * @brief Ӹ̳УǷʹö
+         * @brief 从父类继承，返回是否使用顶点索引缓冲
          */
         virtual bool isIndicesUsed() const override;
 
     protected:
-        /**
-         * @brief ʹõĶṹ
-         */
-        struct Vertex
+        enum
         {
-            Vector3     position;       /// λ
-            Vector2     texcoord;       /// UV
-            Color4      color;          /// ɫ
+            E_VERTEX_COUNT = 4,             /// 四边形顶点数量
         };
 
-        VertexDataPtr       mVertexData;    /// 
-        MaterialPtr         mMaterial;      /// 
-        Vector2             mAnchorPos;     /// êλ
-        Size                mSize;
+        OverlayVertexArray  mQuad;          /// 本地空间的四边形顶点
+        mutable VertexDataPtr   mVertexData;    /// 不合批时使用的顶点数据
+        mutable IndexDataPtr    mIndexData;     /// 不合批时使用的索引数据
+        mutable bool        mIsBufferDirty; /// 四边形变化后缓冲是否需要重新生成
+        MaterialPtr         mMaterial;      /// 材质数据
+        Vector2             mAnchorPos;     /// 锚点位置
+        Size                mSize;          /// 屏幕上的像素大小
+        Vector2             mUVs[E_VERTEX_COUNT];       /// 各顶点纹理UV坐标
+        uint32_t            mColors[E_VERTEX_COUNT];    /// 各顶点颜色，A8R8G8B8
+        Rect                mTexRect;       /// 按纹理像素设置的纹理区域
+        bool                mIsRectUV;      /// UV是否由纹理区域换算
     };
 }
 
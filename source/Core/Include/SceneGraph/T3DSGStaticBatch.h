@@ -0,0 +1,185 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SG_STATIC_BATCH_H__
+#define __T3D_SG_STATIC_BATCH_H__
+
+
+#include "SceneGraph/T3DSGRenderable.h"
+#include "T3DAabb.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class SGBatchChunk
+     * @brief 静态合批后的一个可渲染块，顶点已经烘焙到世界空间
+     * @note 每个块只有一个材质，顶点数不超过65536个，使用16位索引
+     */
+    class T3D_ENGINE_API SGBatchChunk : public SGRenderable
+    {
+    public:
+        /**
+         * @brief 创建一个合批块对象
+         * @param [in] materialName : 块使用的材质名称
+         * @param [in] vertexData : 合并后的顶点数据
+         * @param [in] indexData : 合并后的16位索引数据
+         * @param [in] bound : 块在世界空间的包围盒
+         * @param [in] uID : 这个节点的ID，默认为自动生成
+         */
+        static SGBatchChunkPtr create(const String &materialName, const VertexDataPtr &vertexData, const IndexDataPtr &indexData, const Aabb &bound, uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual ~SGBatchChunk();
+
+        virtual Type getNodeType() const override;
+        virtual NodePtr clone() const override;
+
+        /**
+         * @brief 返回块在世界空间的包围盒
+         */
+        const Aabb &getAlignAxisBox() const { return mBound; }
+
+        /**
+         * @brief 顶点已经是世界坐标，直接返回单位矩阵
+         */
+        virtual const Matrix4 &getWorldMatrix() const override;
+
+        /**
+         * @brief 块不能移动，加入场景时按烘焙的包围盒放进空间索引
+         */
+        virtual const Aabb *getSpatialBound() const override;
+
+    protected:
+        SGBatchChunk(uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual bool init(const String &materialName, const VertexDataPtr &vertexData, const IndexDataPtr &indexData, const Aabb &bound);
+
+        virtual void frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue) override;
+
+        /**
+         * @brief 块不能移动，子树包围盒就是烘焙时的世界包围盒
+         */
+        virtual void updateEnclosingBound() override;
+
+        virtual void cloneProperties(const NodePtr &node) const override;
+
+        virtual MaterialPtr getMaterial() const override;
+        virtual Renderer::PrimitiveType getPrimitiveType() const override;
+        virtual VertexDataPtr getVertexData() const override;
+        virtual IndexDataPtr getIndexData() const override;
+        virtual bool isIndicesUsed() const override;
+
+    protected:
+        MaterialPtr     mMaterial;      /// 块的材质
+        VertexDataPtr   mVertexData;    /// 合并后的顶点数据
+        IndexDataPtr    mIndexData;     /// 合并后的索引数据
+        Aabb            mBound;         /// 世界空间包围盒
+    };
+
+    /**
+     * @class SGStaticBatch
+     * @brief 静态合批结点，把一棵子树里面所有静态网格按材质和顶点声明合并成少量大块
+     * @note
+     *  - 合并时把网格的世界变换烘焙到顶点里，所以合并后的块不能再移动；
+     *  - 只合并三角形列表图元，其他图元的网格会被忽略；
+     *  - 超过16位索引范围时自动拆成新块，每个块保留自己的包围盒用于视景体剔除；
+     *  - 合并完成后，源子树可以从场景中移除。
+     */
+    class T3D_ENGINE_API SGStaticBatch : public SGNode
+    {
+    public:
+        enum
+        {
+            E_MAX_CHUNK_VERTICES = 0x10000,     /// 每个块最多的顶点数，受16位索引限制
+        };
+
+        static SGStaticBatchPtr create(uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual ~SGStaticBatch();
+
+        virtual Type getNodeType() const override;
+        virtual NodePtr clone() const override;
+
+        /**
+         * @brief 合并子树下的所有网格
+         * @param [in] node : 要合并的子树根结点
+         * @return 成功生成至少一个块返回true
+         * @note 调用前需要先更新过子树的变换，否则烘焙的是旧的世界变换。重复调用会丢弃之前生成的块。
+         */
+        bool build(const SGNodePtr &node);
+
+        /**
+         * @brief 清除所有合并生成的块
+         */
+        void clear();
+
+        /**
+         * @brief 返回合并生成的块数量
+         */
+        size_t getChunkCount() const;
+
+    protected:
+        /**
+         * @brief 合并中的一批几何数据，材质和顶点声明相同
+         */
+        struct Batch
+        {
+            Batch()
+                : vertexSize(0)
+                , minPos(Real(0.0), Real(0.0), Real(0.0))
+                , maxPos(Real(0.0), Real(0.0), Real(0.0))
+            {
+            }
+
+            String                  materialName;   /// 材质名称
+            VertexDeclarationPtr    declaration;    /// 合并后的顶点声明，所有属性交错在一个顶点流里
+            size_t                  vertexSize;     /// 合并后每个顶点的大小
+            std::vector<uint8_t>    vertices;       /// 世界空间的顶点数据
+            std::vector<uint16_t>   indices;        /// 16位索引
+            Vector3                 minPos;         /// 包围盒最小点
+            Vector3                 maxPos;         /// 包围盒最大点
+        };
+
+        typedef std::map<String, Batch>     Batches;
+        typedef Batches::iterator           BatchesItr;
+        typedef Batches::const_iterator     BatchesConstItr;
+
+        SGStaticBatch(uint32_t uID = E_NID_AUTOMATIC);
+
+        virtual void cloneProperties(const NodePtr &node) const override;
+
+        /**
+         * @brief 递归收集子树下的网格并追加到对应的批次
+         */
+        void collect(const NodePtr &node, Batches &batches);
+
+        /**
+         * @brief 把一个网格烘焙世界变换后追加到对应的批次
+         */
+        void appendMesh(const SGMeshPtr &mesh, Batches &batches);
+
+        /**
+         * @brief 把批次里的数据生成一个块挂到本结点下，并清空批次数据
+         */
+        bool flush(Batch &batch);
+    };
+}
+
+
+#endif  /*__T3D_SG_STATIC_BATCH_H__*/
@@ -23,25 +23,26 @@
 
 #include "SceneGraph/T3DSGRenderable.h"
 #include "Resource/T3DFont.h"
+#include "Render/T3DOverlayBatcher.h"
 
 
 namespace Tiny3D
 {
     /**
      * @class SGText2D
-     * @brief ʾ2DıȾ
+     * @brief 用于显示2D文本的渲染对象
      */
     class T3D_ENGINE_API SGText2D : public SGRenderable
     {
     public:
         /**
-         * @brief 2DıȾ
-         * @param [in] text : ıַĬϿմ
-         * @param [in] fontSize : СĬ10
-         * @param [in] textColor : ıɫĬϰɫ
-         * @param [in] fontName : ֿƣĬFontManagerõ
-         * @param [in] uID : ΨһʶĬΪԶ
-         * @return ɹһ¶󣬴ʧ򷵻nullptr
+         * @brief 创建2D文本渲染结点对象
+         * @param [in] text : 文本字符串，默认空串
+         * @param [in] fontSize : 字体大小，默认10号
+         * @param [in] textColor : 文本颜色，默认白色
+         * @param [in] fontName : 字体字库名称，默认用FontManager里面设置的
+         * @param [in] uID : 结点唯一标识，默认为引擎自动生成
+         * @return 创建成功返回一个新对象，创建失败则返回nullptr
          * @see void FontManager::setDefaultFontName(const String &fontName)
          */
         static SGText2DPtr create(const String &text = "", size_t fontSize = 10, 
@@ -49,92 +50,107 @@ namespace Tiny3D
             uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~SGText2D();
 
         /**
-         * @brief Ӹ̳УдضӦĽ
-         * @return ؽ
+         * @brief 从父类继承，重写返回对应的结点类型
+         * @return 返回结点类型
          * @see enum Type
          */
         virtual Type getNodeType() const override;
 
         /**
-         * @brief Ӹ̳Уд¡ʵֱĸƲ
-         * @return һµ3D任
+         * @brief 从父类继承，重写父类克隆方法，以实现本类对象的复制操作
+         * @return 返回一个新的3D变换结点对象
          */
         virtual NodePtr clone() const override;
 
         /**
-         * @brief ı
-         * @param [in] text : ıַ
+         * @brief 设置文本
+         * @param [in] text : 文本字符串
          * @return void
          * @see const String &getText() const
          */
         void setText(const String &text);
 
         /**
-         * @brief ȡı
-         * @return ıַ
+         * @brief 获取文本
+         * @return 返回文本字符串
          * @see void setText(const String &text)
          */
         const String &getText() const { return mText; }
 
         /**
-         * @brief ıɫ
-         * @param [in] color : ıɫ
+         * @brief 设置文本颜色
+         * @param [in] color : 文本颜色
          * @return void
          * @see const Color4 &getTextColor() const
          */
         void setTextColor(const Color4 &color);
 
         /**
-         * @brief ȡıɫ
-         * @return ıɫ
+         * @brief 获取文本颜色
+         * @return 返回文本颜色
          * @see void setTextColor(const Color4 &color)
          */
         const Color4 &getTextColor() const;
 
         /**
-         * @brief êλıλ
-         * @param [in] pos : êλãλǰٷֱȣֵ01֮
+         * @brief 设置锚点位于文本区域的相对位置
+         * @param [in] pos : 锚点位置，单位是百分比，数值介于0到1之间
          * @return void
          * @see const Vector2 &getAnchorPos() const
          */
         void setAnchorPos(const Vector2 &pos);
 
         /**
-         * @brief ȡêλ
-         * @return êλãصǰٷֱȣǾֵֵ01֮
+         * @brief 获取锚点位置
+         * @return 返回锚点位置，返回的是百分比，不是绝对值，数值介于0到1之间
          * @see void setAnchorPos(const Vector2 &pos)
          */
         const Vector2 &getAnchorPos() const;
 
         /**
-         * @brief ȡıܿ
+         * @brief 获取文本总宽度
          */
         int32_t getWidth() const;
 
         /**
-         * @brief ȡıܸ߶
+         * @brief 获取文本总高度
          */
         int32_t getHeight() const;
 
         /**
-         * @brief ȡıС
+         * @brief 获取文本大小
          */
         const Size &getSize() const;
 
+        /**
+         * @brief 从父类继承，文字可以和其他覆盖层对象合批
+         */
+        virtual bool isOverlayBatchable() const override;
+
+        /**
+         * @brief 从父类继承，返回文字四边形数量，每个字符一个
+         */
+        virtual size_t getOverlayQuadCount() const override;
+
+        /**
+         * @brief 从父类继承，填写世界空间的文字四边形顶点
+         */
+        virtual void fillOverlayQuads(OverlayVertex *vertices) const override;
+
     protected:
         /**
-         * @brief ĬϹ캯
+         * @brief 默认构造函数
          */
         SGText2D(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief ʼ
-         * @return ʼɹtrueʧܷfalse
+         * @brief 初始化
+         * @return 初始化成功返回true，失败返回false
          */
         bool init(const String &text, size_t fontSize, const Color4 &texColor, const String &fontName);
 
@@ -143,73 +159,79 @@ namespace Tiny3D
         virtual void updateTransform() override;
 
         /**
-         * @brief Ӹ̳УдʵӾ޳
-         * @param [in] bound : Ӿ
-         * @param [in] queue : Ⱦ
+         * @brief 从父类继承，重写以在渲染线程上重新生成文字顶点
+         */
+        virtual void postUpdateTransform() override;
+
+        /**
+         * @brief 从父类继承，重写以实现物体视景体外的剔除
+         * @param [in] bound : 视景体区域
+         * @param [in] queue : 渲染队列
          * @return void
          */
         virtual void frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue) override;
 
         /**
-         * @brief Ӹ̳УزʶȾ
+         * @brief 从父类继承，返回材质对象给渲染器
          */
         virtual MaterialPtr getMaterial() const override;
 
         /**
-         * @brief Ӹ̳УȾͼԪ͸Ⱦ
+         * @brief 从父类继承，返回渲染图元类型给渲染器
          */
         virtual Renderer::PrimitiveType getPrimitiveType() const override;
 
         /**
-         * @brief Ӹ̳УضݸȾ
+         * @brief 从父类继承，返回顶点数据给渲染器
          */
         virtual VertexDataPtr getVertexData() const override;
 
         /**
-         * @brief Ӹ̳УضݸȾ
+         * @brief 从父类继承，返回顶点索引数据给渲染器
          */
         virtual IndexDataPtr getIndexData() const override;
 
         /**
-         * @brief Ӹ̳УǷʹö
+         * @brief 从父类继承，返回是否使用顶点索引缓冲
          */
         virtual bool isIndicesUsed() const override;
 
         /**
-         * @brief ı¶ȸַȾϢ
-         * @return ³ɹtrue򷵻false
+         * @brief 根据文本更新顶点等各种字符渲染相关信息
+         * @return 更新成功返回true，否则返回false
          */
         bool updateVertices();
 
         /**
-         * @brief UV꣬ΪܵײUV
-         * @return ³ɹtrue򷵻false
-         * @note UV꣬ıκζϢ
+         * @brief 更新纹理UV坐标，因为可能底层纹理伸缩导致UV坐标变了
+         * @return 更新成功返回true，否则返回false
+         * @note 这里仅仅更新UV坐标，并不会改变其他任何顶点信息
          */
         bool updateTexcoord();
 
+        /**
+         * @brief 根据字符在纹理里的区域填写四边形的纹理UV坐标
+         */
+        void fillTexcoords();
+
+        /**
+         * @brief 四边形变化后重新生成不合批时使用的顶点和索引缓冲
+         */
+        void updateBuffers() const;
+
     protected:
-        struct Vertex
-        {
-            Vector3     position;
-            uint32_t    diffuse;
-        };
-
-        struct Texcoord
-        {
-            Vector2     texcoord;
-        };
-
-        VertexDataPtr       mVertexData;    /// 
-        IndexDataPtr        mIndexData;     /// 
-        MaterialPtr         mMaterial;      /// 
-        FontPtr             mFont;          /// ıӦ
-        Vector2             mAnchorPos;     /// êλ
-        Size                mSize;          /// ַȾĴС
-        String              mText;          /// ıַ
-        Font::CharSet       mCharSet;       /// ַӦַ
-        int32_t             mTexWidth;      /// Ŀǰʹõ
-        int32_t             mTexHeight;     /// Ŀǰʹõ߶
+        OverlayVertexArray  mQuads;         /// 本地空间的文字四边形顶点
+        mutable VertexDataPtr   mVertexData;    /// 不合批时使用的顶点数据
+        mutable IndexDataPtr    mIndexData;     /// 不合批时使用的索引数据
+        mutable bool        mIsBufferDirty; /// 四边形变化后缓冲是否需要重新生成
+        MaterialPtr         mMaterial;      /// 材质
+        FontPtr             mFont;          /// 文本对应的字体
+        Vector2             mAnchorPos;     /// 锚点位置
+        Size                mSize;          /// 字符串渲染区域的大小
+        String              mText;          /// 文本字符串
+        Font::CharSet       mCharSet;       /// 字符串对应的字符集
+        int32_t             mTexWidth;      /// 目前字体使用的纹理宽度
+        int32_t             mTexHeight;     /// 目前字体使用的纹理高度
     };
 }
 
@@ -22,287 +22,322 @@
 
 
 #include "SceneGraph/T3DSGNode.h"
+#include "SceneGraph/T3DSGTransform2DStore.h"
 #include "T3DMath.h"
 #include "T3DVector2.h"
-#include "T3DTransform.h"
+#include "T3DAffine2.h"
 
 
 namespace Tiny3D
 {
     /**
-     * @brief  Scene Graph 2DʹõĿռ任
+     * @brief 在 Scene Graph 中2D物体使用的空间变换结点
+     * @remarks 局部变换和世界变换都是2x3仿射矩阵，存放在2D变换数据仓库里，
+     *      每帧开始时按层级一次算完，结点本身只保存局部的位置、朝向和缩放。
      */
     class T3D_ENGINE_API SGTransform2D : public SGNode
     {
+        friend class SGTransform2DStore;
+
     public:
         /**
-         * @brief 
-         * @param [in] unID : ΨһʶĬԶ
-         * @return һ2D任
+         * @brief 创建对象
+         * @param [in] unID : 结点唯一标识，默认是自动生成
+         * @return 返回一个2D变换结点对象
          */
         static SGTransform2DPtr create(uint32_t uID = E_NID_AUTOMATIC);
 
         /**
-         * @brief 
+         * @brief 析构函数
          */
         virtual ~SGTransform2D();
 
         /**
-         * @brief Ӹ̳дӿڣȡ
-         * @return ؽ
+         * @brief 从父类继承来重写接口，获取结点类型
+         * @return 返回结点类型
          */
         virtual Type getNodeType() const override;
 
         /**
-         * @brief ڸڵռϵλ
-         * @param [in] rkPos : ڸڵռϵµλ
+         * @brief 设置在父节点空间坐标系下位置
+         * @param [in] rkPos : 在父节点空间坐标系下的位置
          */
         void setPosition(const Vector2 &rkPos);
 
         /**
-         * @brief ڸڵռϵλ
-         * @param [in] x : ڵռϵµx
-         * @param [in] y : ڵռϵµy
+         * @brief 设置在父节点空间坐标系下位置
+         * @param [in] x : 父节点空间坐标系下的x坐标
+         * @param [in] y : 父节点空间坐标系下的y坐标
          */
         void setPosition(Real x, Real y);
 
         /**
-         * @brief ڸڵռϵµλ
-         * @return صλ
+         * @brief 返回在父节点空间坐标系下的位置
+         * @return 返回的位置
          */
         const Vector2 &getPosition() const;
 
         /**
-         * @brief ڸռϵµĳ
-         * @param [in] rkQ : Ԫ
+         * @brief 设置在父结点空间坐标系下的朝向
+         * @param [in] rkQ : 方向四元素
          * @return void
-         * @note Ȼ2Dռı任ȻתʵֱַXYZת
-         *  Ԫرʾת
+         * @note 虽然是2D空间的变换，然后旋转可以实现分别绕X、Y、Z三个轴的旋转，
+         *  因此在这里继续用四元素表示旋转。绕X、Y轴的旋转按正交投影压到屏幕平面上，
+         *  只影响仿射矩阵的线性部分
          * @see void setOrientation(Real w, Real x, Real y, Real z)
          */
         void setOrientation(const Quaternion &rkQ);
 
         /**
-         * @brief ڸռϵµĳ
-         * @param [in] w : Ԫصw
-         * @param [in] x : Ԫصx
-         * @param [in] y : Ԫصy
-         * @param [in] z : Ԫصz
+         * @brief 设置在父结点空间坐标系下的朝向
+         * @param [in] w : 四元素的w分量
+         * @param [in] x : 四元素的x分量
+         * @param [in] y : 四元素的y分量
+         * @param [in] z : 四元素的z分量
          * @return void
          * @see void setOrientation(const Quaternion &rkQ)
          */
         void setOrientation(Real w, Real x, Real y, Real z);
 
         /**
-         * @brief ڸռϵµĳ
-         * @param [in] radian : ת
-         * @param [in] axis : ռµת
+         * @brief 设置在父结点空间坐标系下的朝向
+         * @param [in] radian : 旋转弧度
+         * @param [in] axis : 父结点空间下的旋转轴
          * @return void
          * @see void setOrientation(const Quaternion &rkQ)
          */
         void setOrientation(const Radian &radian, const Vector3 &axis);
 
         /**
-         * @brief ȡڸռϵµĳ
-         * @return һʾԪض
+         * @brief 获取在父结点空间坐标系下的朝向
+         * @return 返回一个表示朝向的四元素对象
          */
         const Quaternion &getOrientation() const;
 
         /**
-         * @brief ڸռϵµ
-         * @param [in] rkScale : ֵ
+         * @brief 设置在父结点空间坐标系下的缩放
+         * @param [in] rkScale : 缩放值
          * @return void
          * @see void setScale(Real x, Real y)
          */
         void setScale(const Vector2 &rkScale);
 
         /**
-         * @brief ڸռϵµ
-         * @param [in] x : Xֵ
-         * @param [in] y : Yֵ
+         * @brief 设置在父结点空间坐标系下的缩放
+         * @param [in] x : X轴缩放值
+         * @param [in] y : Y轴缩放值
          * @return void
          * @see void setScale(const Vector2 &rkScale)
          */
         void setScale(Real x, Real y);
 
         /**
-         * @brief ȡڸռϵµֵ
-         * @return һʾֵÿʾһֵ
+         * @brief 获取在父结点空间坐标系下的缩放值
+         * @return 返回一个表示三个周缩放值的向量，每个分量表示一个轴的缩放值
          */
         const Vector2 &getScale() const;
 
         /**
-         * @brief ƽһƫֵ
-         * @param [in] rkOffset : ϵƫֵ
+         * @brief 平移一个偏移值
+         * @param [in] rkOffset : 三个坐标轴上的偏移值
          * @return void
          */
         void translate(const Vector2 &rkOffset);
 
         /**
-         * @brief ƽһƫֵ
-         * @param [in] x : Xƫֵ
-         * @param [in] y : Yƫֵ
+         * @brief 平移一个偏移值
+         * @param [in] x : X轴上偏移值
+         * @param [in] y : Y轴上偏移值
          * @return void
          */
         void translate(Real x, Real y);
 
         /**
-         * @brief һָƶĳһ
-         * @param [in] rkOrientation : 
-         * @param [in] step : ƶ
+         * @brief 朝一个向量所指方向移动某一个步长
+         * @param [in] rkOrientation : 方向向量
+         * @param [in] step : 移动步长
          * @return void
          */
         void translate(const Vector2 &rkOrientation, Real step);
 
         /**
-         * @brief ڵǰתһԪرʾת任
-         * @param [in] rkQ : ʾת任Ԫ
+         * @brief 在当前方向上旋转一个四元素表示的旋转变换
+         * @param [in] rkQ : 表示旋转变换的四元素
          * @return void
          */
         void rotate(const Quaternion &rkQ);
 
         /**
-         * @brief ڵǰתһתƸתǱʾת任
-         * @param [in] axis : ת
-         * @param [in] radians : תǣλ
+         * @brief 在当前方向上旋转一个给定旋转轴和绕该轴的旋转角表示的旋转变换
+         * @param [in] axis : 旋转轴
+         * @param [in] radians : 旋转角，单位：弧度
          * @return void
          * @see void rotate(const Vector3 &axis, const Degree &degrees)
          */
         void rotate(const Vector3 &axis, const Radian &radians);
 
         /**
-         * @brief ڵǰתһתƸתǱʾת任
-         * @param [in] axis : ת
-         * @param [in] degrees : תǣλǶ
+         * @brief 在当前方向上旋转一个给定旋转轴和绕该轴的旋转角表示的旋转变换
+         * @param [in] axis : 旋转轴
+         * @param [in] degrees : 旋转角，单位：角度
          * @return void
          * @see void rotate(const Vector3 &axis, const Radian &radians)
          */
         void rotate(const Vector3 &axis, const Degree &degrees);
 
         /**
-         * @brief ڵǰXתб
-         * @param [in] degrees : бǣλǶ
+         * @brief 在当前方向上绕X轴旋转，倾斜角
+         * @param [in] degrees : 倾斜角，单位：角度
          * @return void
          * @see void pitch(const Radian &radians)
          */
         void pitch(const Degree &degrees);
 
         /**
-         * @brief ڵǰYת
-         * @param [in] degrees : ǣλǶ
+         * @brief 在当前方向上绕Y轴旋转，航向角
+         * @param [in] degrees : 航向角，单位：角度
          * @return void
          * @see void yaw(const Radian &radians)
          */
         void yaw(const Degree &degrees);
 
         /**
-         * @brief ڵǰZת
-         * @param [in] degrees : ǣλǶ
+         * @brief 在当前方向上绕Z周旋转，翻滚角
+         * @param [in] degrees : 翻滚角，单位：角度
          * @return void
          * @see void roll(const Radian &radians)
          */
         void roll(const Degree &degrees);
 
         /**
-         * @brief ڵǰXתб
-         * @param [in] degrees : бǣλ
+         * @brief 在当前方向上绕X轴旋转，倾斜角
+         * @param [in] degrees : 倾斜角，单位：弧度
          * @return void
          * @see void pitch(const Degree &degrees)
          */
         void pitch(const Radian &radians);
 
         /**
-         * @brief ڵǰYת
-         * @param [in] degrees : ǣλ
+         * @brief 在当前方向上绕Y轴旋转，航向角
+         * @param [in] degrees : 航向角，单位：弧度
          * @return void
          * @see void yaw(const Degree &degrees)
          */
         void yaw(const Radian &radians);
 
         /**
-         * @brief ڵǰZת
-         * @param [in] degrees : ǣλ
+         * @brief 在当前方向上绕Z周旋转，翻滚角
+         * @param [in] degrees : 翻滚角，单位：弧度
          * @return void
          * @see void roll(const Degree &degrees)
          */
         void roll(const Radian &radians);
 
         /**
-         * @brief ڵǰС
-         * @param [in] rkScale : ֵ
+         * @brief 在当前大小下缩放
+         * @param [in] rkScale : 缩放值
          * @return void
          * @see void scale(Real x, Real y)
          */
         void scale(const Vector2 &rkScale);
 
         /**
-         * @brief ڵǰС
-         * @param [in] x : Xֵ
-         * @param [in] y : Yֵ
-         * @param [in] z : Zֵ
+         * @brief 在当前大小下缩放
+         * @param [in] x : X轴缩放值
+         * @param [in] y : Y轴缩放值
+         * @param [in] z : Z轴缩放值
          * @return void
          * @see void scale(const Vector2 &rkScale)
          */
         void scale(Real x, Real y);
 
         /**
-         * @brief ȡֲı任
-         * @return һֲı任
+         * @brief 获取局部到世界的变换
+         * @return 返回一个局部到世界的2D仿射变换
+         * @note 本帧修改过变换的，会先把2D变换数据仓库重新算一遍，只能在渲染线程调用
+         */
+        virtual Affine2 getLocalToWorldTransform();
+
+        /**
+         * @brief 获取局部到世界的变换矩阵
+         * @return 返回展开成4x4的世界矩阵，给渲染对象使用
+         * @note 只在2D变换数据仓库重新计算后才重新展开
          */
-        virtual const Transform &getLocalToWorldTransform();
+        const Matrix4 &getWorldMatrix();
 
         /**
-         * @brief ȡֲ任
-         * @return һֲ任
+         * @brief 获取局部变换
+         * @return 返回一个局部变换对象，平移已经换算到覆盖层坐标
          */
-        Transform getLocalTransform() const;
+        Affine2 getLocalTransform() const;
 
         /**
-         * @brief Ӹ̳Уд¡ʵֱĸƲ
-         * @return һµ3D任
+         * @brief 获取在2D变换数据仓库里的槽位索引
+         */
+        uint32_t getTransformIndex() const  { return mTransformIndex; }
+
+        /**
+         * @brief 从父类继承，重写父类克隆方法，以实现本类对象的复制操作
+         * @return 返回一个新的3D变换结点对象
          */
         virtual NodePtr clone() const override;
         
     protected:
         /**
-         * @brief Ӹ̳УдӦҵ֪ͨ¼
-         * @param [in] parent : 
+         * @brief 从父类继承，重写以响应结点挂到父结点的通知事件
+         * @param [in] parent : 父结点对象
          * @return void
          */
         virtual void onAttachParent(const NodePtr &parent) override;
 
         /**
-         * @brief Ӹ̳УдӦӸߵ֪ͨ¼
-         * @param [in] parent : 
+         * @brief 从父类继承，重写以响应结点从父结点拿走的通知事件
+         * @param [in] parent : 父结点对象
          * @return void
          */
         virtual void onDetachParent(const NodePtr &parent) override;
 
         /**
-         * @brief Ӹ̳Удʵָ±任
+         * @brief 从父类继承，重写以在挂接关系变化时让2D变换数据仓库重新排列
+         * @param [in] parent : 最近的3D变换祖先结点
+         * @param [in] parent2D : 比parent更近的2D变换祖先结点
+         * @return void
+         */
+        virtual void updateTransformParent(SGTransformNode *parent, SGTransform2D *parent2D) override;
+
+        /**
+         * @brief 把局部的位置、朝向和缩放换算成仿射矩阵写到2D变换数据仓库
+         * @return void
+         */
+        void updateLocal();
+
+        /**
+         * @brief 从父类继承，重写实现更新变换操作
          * @return void
          */
         virtual void updateTransform() override;
 
         /**
-         * @brief Ӹ̳Удʵ3D任ݵĸ
-         * @param [in] node : µĽ
+         * @brief 从父类继承，重写实现3D变换对象属性数据的复制
+         * @param [in] node : 新的结点对象
          * @return void
          */
         virtual void cloneProperties(const NodePtr &node) const override;
 
     protected:
         /**
-         * @brief ĬϹ캯
-         * @param [in] unID : ΨһʶĬԶ
+         * @brief 默认构造函数
+         * @param [in] unID : 结点唯一标识，默认是自动生成
          */
         SGTransform2D(uint32_t uID = E_NID_AUTOMATIC);
 
-        Vector2     mPosition;          /// ڵϵµľֲλ
-        Quaternion  mOrientation;       /// ڵϵµľֲ
-        Vector2     mScale;             /// ڵϵµľֲС
+        Vector2     mPosition;          /// 父节点坐标系下的局部位置
+        Quaternion  mOrientation;       /// 父节点坐标系下的局部朝向
+        Vector2     mScale;             /// 父节点坐标系下的局部大小
 
-        Transform   mWorldTransform;    /// Ӿֲı任
+        uint32_t    mTransformIndex;    /// 在2D变换数据仓库里的槽位索引
+        uint32_t    mMatrixUpdate;      /// 展开世界矩阵时仓库的更新次数
+        Matrix4     mWorldMatrix;       /// 展开成4x4的世界矩阵
     };
 }
 
@@ -25,7 +25,7 @@ namespace Tiny3D
         if (rkPos != mPosition)
         {
             mPosition = rkPos;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -45,7 +45,7 @@ namespace Tiny3D
         if (rkQ != mOrientation)
         {
             mOrientation = rkQ;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -71,7 +71,7 @@ namespace Tiny3D
         if (rkScale != mScale)
         {
             mScale = rkScale;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -91,7 +91,7 @@ namespace Tiny3D
         if (rkOffset != Vector2::ZERO)
         {
             mPosition += rkOffset;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -111,7 +111,7 @@ namespace Tiny3D
         if (rkQ != Quaternion::IDENTITY)
         {
             mOrientation *= rkQ;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -162,7 +162,7 @@ namespace Tiny3D
         if (rkScale != Vector3::ZERO)
         {
             mScale *= rkScale;
-            setDirty(true, true);
+            updateLocal();
         }
     }
 
@@ -172,8 +172,8 @@ namespace Tiny3D
         scale(s);
     }
 
-    inline Transform SGTransform2D::getLocalTransform() const
+    inline Affine2 SGTransform2D::getLocalTransform() const
     {
-        return Transform(Vector3(mPosition.x(), mPosition.y(), Real(0.0)), Vector3(mScale.x(), mScale.y(), Real(1.0)), mOrientation);
+        return T3D_TRANSFORM2D_STORE.getLocal(mTransformIndex);
     }
 }
@@ -0,0 +1,204 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SG_TRANSFORM_2D_STORE_H__
+#define __T3D_SG_TRANSFORM_2D_STORE_H__
+
+
+#include "T3DPrerequisites.h"
+#include "T3DTypedef.h"
+#include "T3DAffine2.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class SGTransform2DStore
+     * @brief 2D变换结点的变换数据仓库
+     * @remarks 2D变换只需要2x3仿射矩阵，每个分量单独一个数组存放：
+     *      - 局部变换存放线性部分和以像素为单位的位置，位置乘上视口缩放才是局部平移，
+     *        视口缩放每帧只在渲染线程上设置一次；
+     *      - 数组按层级排列，同一层的槽位连续存放，父槽位一定在上一层，
+     *        同一层的计算互不依赖，循环里没有分支和函数调用，编译器可以直接向量化；
+     *      - 任何局部变换或者视口缩放变化后，下一次更新把所有槽位重新算一遍，
+     *        UI里成千上万个结点全部重算也比逐个判断脏标记、沿父结点递归快。
+     */
+    class T3D_ENGINE_API SGTransform2DStore : public Singleton<SGTransform2DStore>
+    {
+        T3D_DISABLE_COPY(SGTransform2DStore);
+
+    public:
+        static const uint32_t INVALID_INDEX;    /// 无效索引，表示没有父变换
+
+        /** 仿射矩阵各分量在分量数组里的下标 */
+        enum Component
+        {
+            E_M00 = 0,
+            E_M01,
+            E_TX,
+            E_M10,
+            E_M11,
+            E_TY,
+            E_MAX_COMPONENTS
+        };
+
+        /**
+         * @brief 构造函数
+         */
+        SGTransform2DStore();
+
+        /**
+         * @brief 析构函数
+         */
+        virtual ~SGTransform2DStore();
+
+        /**
+         * @brief 给2D变换结点分配一个变换数据槽位
+         * @param [in] node : 2D变换结点
+         * @return 返回槽位索引
+         * @note 新分配的槽位是单位变换
+         */
+        uint32_t acquire(SGTransform2D *node);
+
+        /**
+         * @brief 释放2D变换结点的变换数据槽位
+         * @param [in] index : 槽位索引
+         * @return void
+         */
+        void release(uint32_t index);
+
+        /**
+         * @brief 设置槽位的局部变换
+         * @param [in] index : 槽位索引
+         * @param [in] linear : 局部变换的线性部分，包括旋转和缩放
+         * @param [in] position : 父结点坐标系下以像素为单位的位置
+         * @return void
+         */
+        void setLocal(uint32_t index, const Matrix2 &linear, const Vector2 &position);
+
+        /**
+         * @brief 标记挂接关系变化了，下一次更新前重新排列数组
+         * @return void
+         */
+        void markHierarchyChanged()
+        {
+            mIsHierarchyDirty = true;
+            ++mEpoch;
+        }
+
+        /**
+         * @brief 设置视口缩放，把像素位置换算到覆盖层坐标
+         * @param [in] scaleX : 水平缩放，宽高比除以视口宽度
+         * @param [in] scaleY : 垂直缩放，1除以视口高度
+         * @return void
+         * @note 每帧在渲染线程上设置一次，没有变化的不会引起重算
+         */
+        void setViewportScale(Real scaleX, Real scaleY);
+
+        /**
+         * @brief 获取槽位的最新世界变换
+         * @param [in] index : 槽位索引
+         * @return 返回世界变换
+         * @remarks 上一次更新后有变化的，先更新一次。只能在渲染线程上调用
+         */
+        Affine2 resolve(uint32_t index);
+
+        /**
+         * @brief 按层级计算所有槽位的世界变换
+         * @return void
+         * @remarks 上一次更新后没有任何变化的，直接返回。
+         */
+        void update();
+
+        /**
+         * @brief 获取更新次数，每次重新计算世界变换后递增
+         * @remarks 结点用它判断自己缓存的4x4世界矩阵是否过期
+         */
+        uint32_t getUpdateCount() const { return mUpdateCount; }
+
+        /**
+         * @brief 获取槽位数量，包括空闲的槽位
+         */
+        size_t getCount() const     { return mNodes.size(); }
+
+        /**
+         * @brief 获取槽位的局部变换，平移已经乘上视口缩放
+         */
+        Affine2 getLocal(uint32_t index) const;
+
+        /**
+         * @brief 获取槽位上一次计算出来的世界变换
+         */
+        Affine2 getWorld(uint32_t index) const;
+
+        uint32_t getParent(uint32_t index) const    { return mParents[index]; }
+
+        SGTransform2D *getNode(uint32_t index) const    { return mNodes[index]; }
+
+        /**
+         * @brief 计算同一层槽位的世界变换
+         * @param [in] parents : 父槽位数组
+         * @param [in] local : 局部变换各分量数组，平移分量是像素位置
+         * @param [in, out] world : 世界变换各分量数组
+         * @param [in] begin, end : 这一层槽位范围
+         * @param [in] scaleX, scaleY : 视口缩放
+         * @note 父槽位都在[begin, end)之前，循环迭代之间没有依赖
+         */
+        static void concatenate(const uint32_t *parents, const Real *const *local,
+            Real *const *world, size_t begin, size_t end, Real scaleX, Real scaleY);
+
+        /**
+         * @brief 计算没有父槽位的槽位的世界变换
+         */
+        static void computeRoots(const Real *const *local, Real *const *world,
+            size_t begin, size_t end, Real scaleX, Real scaleY);
+
+    protected:
+        /**
+         * @brief 按层级重新排列数组
+         * @remarks 重新排列后空闲槽位被压缩掉，结点的索引也回写成新的索引
+         */
+        void rebuild();
+
+        typedef std::vector<Real>               RealArray;
+        typedef std::vector<uint32_t>           IndexArray;
+        typedef std::vector<SGTransform2D *>    NodeArray;
+
+        RealArray       mLocal[E_MAX_COMPONENTS];   /// 局部变换各分量
+        RealArray       mWorld[E_MAX_COMPONENTS];   /// 世界变换各分量
+        IndexArray      mParents;           /// 最近的2D变换祖先结点的槽位
+        IndexArray      mLevels;            /// 每一层在数组里的起始位置，最后一个是结束位置
+
+        NodeArray       mNodes;             /// 槽位对应的结点，空闲槽位为空
+        IndexArray      mFreeSlots;         /// 空闲槽位
+
+        Real            mScaleX;            /// 视口水平缩放
+        Real            mScaleY;            /// 视口垂直缩放
+
+        uint32_t        mEpoch;             /// 修改批次，任何变化都会递增
+        uint32_t        mUpdatedEpoch;      /// 上一次更新时的修改批次
+        uint32_t        mUpdateCount;       /// 重新计算世界变换的次数
+        bool            mIsHierarchyDirty;  /// 数组顺序是否需要重新排列
+    };
+
+    #define T3D_TRANSFORM2D_STORE   SGTransform2DStore::getInstance()
+}
+
+
+#endif  /*__T3D_SG_TRANSFORM_2D_STORE_H__*/
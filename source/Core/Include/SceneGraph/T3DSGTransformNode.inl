@@ -21,10 +21,12 @@ namespace Tiny3D
 {
     inline void SGTransformNode::setPosition(const Vector3 &rkPos)
     {
-        if (rkPos != mPosition)
+        Vector3 &pos = T3D_TRANSFORM_STORE.getPosition(mTransformIndex);
+
+        if (rkPos != pos)
         {
-            mPosition = rkPos;
-            setDirty(true, true);
+            pos = rkPos;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -36,15 +38,17 @@ namespace Tiny3D
 
     inline const Vector3 &SGTransformNode::getPosition() const
     {
-        return mPosition;
+        return T3D_TRANSFORM_STORE.getPosition(mTransformIndex);
     }
 
     inline void SGTransformNode::setOrientation(const Quaternion &rkQ)
     {
-        if (rkQ != mOrientation)
+        Quaternion &orientation = T3D_TRANSFORM_STORE.getOrientation(mTransformIndex);
+
+        if (rkQ != orientation)
         {
-            mOrientation = rkQ;
-            setDirty(true, true);
+            orientation = rkQ;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -62,15 +66,17 @@ namespace Tiny3D
 
     inline const Quaternion &SGTransformNode::getOrientation() const
     {
-        return mOrientation;
+        return T3D_TRANSFORM_STORE.getOrientation(mTransformIndex);
     }
 
     inline void SGTransformNode::setScale(const Vector3 &rkScale)
     {
-        if (rkScale != mScale)
+        Vector3 &scale = T3D_TRANSFORM_STORE.getScale(mTransformIndex);
+
+        if (rkScale != scale)
         {
-            mScale = rkScale;
-            setDirty(true, true);
+            scale = rkScale;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -82,15 +88,15 @@ namespace Tiny3D
 
     inline const Vector3 &SGTransformNode::getScale() const
     {
-        return mScale;
+        return T3D_TRANSFORM_STORE.getScale(mTransformIndex);
     }
 
     inline void SGTransformNode::translate(const Vector3 &rkOffset)
     {
         if (rkOffset != Vector3::ZERO)
         {
-            mPosition += rkOffset;
-            setDirty(true, true);
+            T3D_TRANSFORM_STORE.getPosition(mTransformIndex) += rkOffset;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -109,8 +115,8 @@ namespace Tiny3D
     {
         if (rkQ != Quaternion::IDENTITY)
         {
-            mOrientation *= rkQ;
-            setDirty(true, true);
+            T3D_TRANSFORM_STORE.getOrientation(mTransformIndex) *= rkQ;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -160,8 +166,8 @@ namespace Tiny3D
     {
         if (rkScale != Vector3::ZERO)
         {
-            mScale *= rkScale;
-            setDirty(true, true);
+            T3D_TRANSFORM_STORE.getScale(mTransformIndex) *= rkScale;
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
         }
     }
 
@@ -173,6 +179,9 @@ namespace Tiny3D
 
     inline Transform SGTransformNode::getLocalTransform() const
     {
-        return Transform(mPosition, mScale, mOrientation);
+        const SGTransformStore &store = T3D_TRANSFORM_STORE;
+        return Transform(store.getPosition(mTransformIndex),
+            store.getScale(mTransformIndex),
+            store.getOrientation(mTransformIndex));
     }
 }
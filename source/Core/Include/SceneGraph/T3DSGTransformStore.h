@@ -0,0 +1,204 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SG_TRANSFORM_STORE_H__
+#define __T3D_SG_TRANSFORM_STORE_H__
+
+
+#include "T3DPrerequisites.h"
+#include "T3DTypedef.h"
+#include "T3DVector3.h"
+#include "T3DQuaternion.h"
+#include "T3DTransform.h"
+#include <atomic>
+
+
+namespace Tiny3D
+{
+    /**
+     * @class SGTransformStore
+     * @brief 3D变换结点的变换数据仓库
+     * @remarks 所有3D变换结点的局部位置、朝向、缩放和局部到世界的变换按数组连续存放，
+     *      结点本身只保存自己在数组里的索引。数组按父结点在前、子结点在后的顺序排列，
+     *      每帧只需要从头到尾线性扫一遍就能算出所有变化了的结点的世界变换，
+     *      不用再沿着子结点链表递归。
+     *      每个槽位有局部版本号和世界版本号，修改局部变换只递增自己的局部版本号，
+     *      子槽位记录计算时用到的父槽位世界版本号，只有自己的局部版本号或者父槽位的
+     *      世界版本号变了才重新计算，不需要递归设置整棵子树的脏标记。
+     */
+    class T3D_ENGINE_API SGTransformStore : public Singleton<SGTransformStore>
+    {
+        T3D_DISABLE_COPY(SGTransformStore);
+
+    public:
+        static const uint32_t INVALID_INDEX;    /// 无效索引，表示没有父变换
+
+        /**
+         * @brief 构造函数
+         */
+        SGTransformStore();
+
+        /**
+         * @brief 析构函数
+         */
+        virtual ~SGTransformStore();
+
+        /**
+         * @brief 给3D变换结点分配一个变换数据槽位
+         * @param [in] node : 3D变换结点
+         * @return 返回槽位索引
+         * @note 新分配的槽位是单位变换，没有父槽位
+         */
+        uint32_t acquire(SGTransformNode *node);
+
+        /**
+         * @brief 释放3D变换结点的变换数据槽位
+         * @param [in] index : 槽位索引
+         * @return void
+         */
+        void release(uint32_t index);
+
+        /**
+         * @brief 设置槽位的父槽位
+         * @param [in] index : 槽位索引
+         * @param [in] parent : 父槽位索引，没有父变换的时候是INVALID_INDEX
+         * @return void
+         * @remarks 父槽位排在后面的，下一次更新前重新排列数组
+         */
+        void setParent(uint32_t index, uint32_t parent);
+
+        /**
+         * @brief 标记一个槽位的局部变换发生了变化
+         * @param [in] index : 槽位索引
+         * @return void
+         */
+        void markLocalChanged(uint32_t index)
+        {
+            ++mLocalVersions[index];
+            mEpoch.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 冻结一个槽位，场景并行更新期间把它当作已经是最新的
+         * @param [in] index : 槽位索引
+         * @return void
+         * @remarks 并行更新前，各个子树任务共同的祖先槽位先在渲染线程上算好再冻结，
+         *      任务里沿父槽位检查版本号时就不会写这些共享的槽位。
+         *      冻结期间不能修改这些槽位的局部变换。
+         */
+        void freeze(uint32_t index)     { mCheckedEpochs[index] = FROZEN_EPOCH; }
+
+        /**
+         * @brief 解除槽位的冻结
+         * @param [in] index : 槽位索引
+         * @return void
+         */
+        void unfreeze(uint32_t index)   { mCheckedEpochs[index] = 0; }
+
+        /**
+         * @brief 获取槽位的最新世界变换
+         * @param [in] index : 槽位索引
+         * @return 返回世界变换
+         * @remarks 上一次线性更新之后没有任何局部变换变化的，直接返回。
+         *      否则沿父槽位往上检查版本号，只重新计算版本号变了的槽位，
+         *      每个槽位在同一批修改之后只检查一次。
+         */
+        const Transform &resolve(uint32_t index);
+
+        /**
+         * @brief 按数组顺序线性计算所有变化了的槽位的世界变换
+         * @return void
+         * @remarks 父槽位一定在子槽位前面，扫到子槽位时父槽位的世界版本号已经是最新的。
+         *      上一次更新后没有任何局部变换变化的，直接返回。
+         */
+        void update();
+
+        /**
+         * @brief 获取槽位数量，包括空闲的槽位
+         */
+        size_t getCount() const     { return mNodes.size(); }
+
+        Vector3 &getPosition(uint32_t index)                { return mPositions[index]; }
+        const Vector3 &getPosition(uint32_t index) const    { return mPositions[index]; }
+
+        Quaternion &getOrientation(uint32_t index)              { return mOrientations[index]; }
+        const Quaternion &getOrientation(uint32_t index) const  { return mOrientations[index]; }
+
+        Vector3 &getScale(uint32_t index)               { return mScales[index]; }
+        const Vector3 &getScale(uint32_t index) const   { return mScales[index]; }
+
+        Transform &getWorldTransform(uint32_t index)                { return mWorldTransforms[index]; }
+        const Transform &getWorldTransform(uint32_t index) const    { return mWorldTransforms[index]; }
+
+        uint32_t getLocalVersion(uint32_t index) const  { return mLocalVersions[index]; }
+        uint32_t getWorldVersion(uint32_t index) const  { return mWorldVersions[index]; }
+
+        uint32_t getParent(uint32_t index) const    { return mParents[index]; }
+
+        SGTransformNode *getNode(uint32_t index) const  { return mNodes[index]; }
+
+    protected:
+        /**
+         * @brief 用父槽位的世界变换和自己的局部变换计算世界变换，并递增世界版本号
+         * @param [in] index : 槽位索引
+         * @param [in] parentVersion : 计算时父槽位的世界版本号，没有父槽位的时候是0
+         * @return void
+         */
+        void computeWorld(uint32_t index, uint32_t parentVersion);
+
+        /**
+         * @brief 按父在前子在后的深度优先顺序重新排列数组
+         * @remarks 重新排列后空闲槽位被压缩掉，结点的索引也回写成新的索引
+         */
+        void rebuild();
+
+        typedef std::vector<Vector3>            Vector3Array;
+        typedef std::vector<Quaternion>         QuaternionArray;
+        typedef std::vector<Transform>          TransformArray;
+        typedef std::vector<uint32_t>           IndexArray;
+        typedef std::vector<uint32_t>           VersionArray;
+        typedef std::vector<SGTransformNode *>  NodeArray;
+
+        Vector3Array    mPositions;         /// 父结点坐标系下的局部位置
+        QuaternionArray mOrientations;      /// 父结点坐标系下的局部朝向
+        Vector3Array    mScales;            /// 父结点坐标系下的局部大小
+        TransformArray  mWorldTransforms;   /// 从局部到世界的变换
+        IndexArray      mParents;           /// 最近的3D变换祖先结点的槽位
+
+        VersionArray    mLocalVersions;     /// 局部变换版本号，修改局部变换时递增
+        VersionArray    mWorldVersions;     /// 世界变换版本号，重新计算世界变换时递增
+        VersionArray    mSeenLocalVersions; /// 上一次计算世界变换时的局部版本号
+        VersionArray    mSeenParentVersions;/// 上一次计算世界变换时父槽位的世界版本号
+        VersionArray    mCheckedEpochs;     /// 槽位最后一次检查版本号时的修改批次
+
+        NodeArray       mNodes;             /// 槽位对应的结点，空闲槽位为空
+        IndexArray      mFreeSlots;         /// 空闲槽位
+
+        static const uint32_t FROZEN_EPOCH;     /// 冻结槽位的检查批次
+
+        std::atomic<uint32_t>   mEpoch;     /// 修改批次，任何局部变换变化都会递增
+        uint32_t        mUpdatedEpoch;      /// 上一次线性更新时的修改批次
+        bool            mIsHierarchyDirty;  /// 数组顺序是否需要重新排列
+    };
+
+    #define T3D_TRANSFORM_STORE     SGTransformStore::getInstance()
+}
+
+
+#endif  /*__T3D_SG_TRANSFORM_STORE_H__*/
@@ -23,6 +23,9 @@
 
 #include "Misc/T3DObject.h"
 #include "T3DTypedef.h"
+#include "SceneGraph/T3DSpatialIndex.h"
+#include <mutex>
+#include <unordered_map>
 
 
 namespace Tiny3D
@@ -30,6 +33,15 @@ namespace Tiny3D
     class T3D_ENGINE_API SceneManager : public Singleton<SceneManager>
     {
     public:
+        /**
+         * @brief 内置的空间索引类型
+         */
+        enum SpatialIndexType
+        {
+            E_SIT_NONE = 0,             /// 不用空间索引，遍历场景树裁剪
+            E_SIT_DYNAMIC_AABB_TREE,    /// 动态包围盒层次树
+            E_SIT_LOOSE_OCTREE,         /// 松散八叉树
+        };
 
         SceneManager();
         virtual ~SceneManager();
@@ -42,6 +54,264 @@ namespace Tiny3D
 
         void setRenderer(Renderer *renderer)    { mRenderer = renderer; }
 
+        const RenderQueuePtr &getRenderQueue() const { return mRenderQueue; }
+
+        /**
+         * @brief 设置渲染队列是否使用常驻模式
+         * @param [in] enable : 常驻模式开关
+         * @remarks 常驻模式下渲染对象挂到根结点下时注册到渲染队列，移除时反注册，
+         *      每帧裁剪只设置可见标记，不再重建渲染队列。适合大部分物体静止的场景。
+         */
+        void setRetainedMode(bool enable);
+
+        bool isRetainedMode() const;
+
+        /**
+         * @brief 设置并行更新的结点数量阈值
+         * @param [in] count : 3D变换结点数量达到这个值才拆成子树任务并行更新
+         * @remarks 子树任务交给任务调度器执行，渲染线程本身也参与更新
+         */
+        void setParallelUpdateThreshold(size_t count)   { mParallelThreshold = count; }
+
+        size_t getParallelUpdateThreshold() const   { return mParallelThreshold; }
+
+        /**
+         * @brief 当前是否正在并行更新场景
+         */
+        bool isUpdatingInParallel() const   { return mIsUpdatingInParallel; }
+
+        /**
+         * @brief 登记一个并行更新结束后要在渲染线程上调用postUpdateTransform()的结点
+         * @param [in] node : 场景结点
+         * @return void
+         * @note 由SGNode::requestPostUpdate()调用，可以在工作线程上调用
+         */
+        void addPostUpdateNode(SGNode *node);
+
+        /**
+         * @brief 使用内置的空间索引裁剪
+         * @param [in] type : 空间索引类型
+         * @return void
+         * @see void setSpatialIndex(SpatialIndex *index)
+         */
+        void setSpatialIndexType(SpatialIndexType type);
+
+        /**
+         * @brief 设置场景的空间索引
+         * @param [in] index : 空间索引对象，由场景管理器负责删除，nullptr表示不用空间索引
+         * @return void
+         * @remarks 有空间索引的时候，有包围盒的可渲染对象放在索引里，视景体裁剪只遍历
+         *      包围盒无限大的子树，其余对象通过查询索引得到，开销和可见对象数量相关，
+         *      和场景大小关系不大。对象移动后在裁剪前统一更新索引。
+         *      切换时场景里的对象全部重新加入新的索引，可以在同一个场景上对比不同实现。
+         */
+        void setSpatialIndex(SpatialIndex *index);
+
+        SpatialIndex *getSpatialIndex() const   { return mSpatialIndex; }
+
+        /**
+         * @brief 当前是否正在用空间索引做视景体裁剪
+         */
+        bool isCullingByIndex() const   { return mIsCullingByIndex; }
+
+        /**
+         * @brief 查找世界包围盒和指定范围相交的可渲染对象
+         * @param [in] box : 查询范围
+         * @param [out] renderables : 结果追加在后面
+         * @return 返回找到的对象数量，没有空间索引的返回0
+         * @note 结果包括不可见的对象，索引是上一次渲染时的状态
+         */
+        size_t queryRenderables(const Aabb &box, SpatialIndex::Renderables &renderables) const;
+
+        /**
+         * @brief 登记一个包围盒变化了的可渲染对象，裁剪前更新到空间索引
+         * @param [in] renderable : 可渲染对象
+         * @return void
+         * @note 由SGRenderable::notifySpatialBoundChanged()调用，可以在工作线程上调用
+         */
+        void addMovedRenderable(SGRenderable *renderable);
+
+        /**
+         * @brief 把可渲染对象从空间索引移除
+         * @param [in] renderable : 可渲染对象
+         * @return void
+         * @note 由SGRenderable::onLeaveScene()调用
+         */
+        void removeSpatialProxy(SGRenderable *renderable);
+
+        /**
+         * @brief 开关遮挡剔除
+         * @param [in] enable : 遮挡剔除开关
+         * @param [in] width : 软件深度缓冲的宽度
+         * @param [in] height : 软件深度缓冲的高度
+         * @return void
+         * @remarks 开启后每帧在视景体剔除前把视景体里的遮挡体（SGOccluder）光栅化到
+         *      低分辨率深度缓冲，视景体剔除时子树包围盒或者对象包围盒被完全挡住的不再加入渲染队列。
+         *      场景里没有遮挡体的时候没有额外开销。
+         * @see class SGOccluder
+         */
+        void setOcclusionCulling(bool enable, uint32_t width = 256, uint32_t height = 128);
+
+        bool isOcclusionCulling() const     { return mOcclusionCuller != nullptr; }
+
+        /**
+         * @brief 返回遮挡剔除器，用来读取统计数据和导出深度缓冲
+         * @return 没有开启遮挡剔除的返回nullptr
+         */
+        const OcclusionCullerPtr &getOcclusionCuller() const    { return mOcclusionCuller; }
+
+        /**
+         * @brief 返回本帧视景体剔除用的遮挡剔除器
+         * @return 只有在视景体剔除过程中、并且本帧光栅化了遮挡体时才返回有效对象
+         */
+        OcclusionCuller *getFrameOcclusionCuller() const    { return mFrameOcclusionCuller; }
+
+        /**
+         * @brief 登记遮挡体
+         * @param [in] occluder : 遮挡体结点
+         * @return void
+         * @note 由SGOccluder::onEnterScene()调用，重复登记同一个遮挡体没有影响
+         */
+        void registerOccluder(SGOccluder *occluder);
+
+        /**
+         * @brief 移除遮挡体
+         * @param [in] occluder : 遮挡体结点
+         * @return void
+         * @note 由SGOccluder::onLeaveScene()调用
+         */
+        void unregisterOccluder(SGOccluder *occluder);
+
+        typedef std::vector<SGNodePtr>          SGNodeArray;
+
+        /**
+         * @brief 返回场景里指定结点ID的结点
+         * @param [in] nodeID : 结点ID
+         * @return 返回结点对象，不在场景里的返回nullptr
+         */
+        SGNodePtr getNode(uint32_t nodeID) const;
+
+        /**
+         * @brief 返回场景里指定名称的结点
+         * @param [in] name : 结点名称
+         * @return 返回结点对象，有多个同名结点的时候返回其中任意一个，没有的返回nullptr
+         */
+        SGNodePtr getNode(const String &name) const;
+
+        /**
+         * @brief 获取场景里所有指定名称的结点
+         * @param [in] name : 结点名称
+         * @param [out] nodes : 返回的结点数组，结果追加在后面
+         * @return 返回找到的结点数量
+         */
+        size_t getNodes(const String &name, SGNodeArray &nodes) const;
+
+        /**
+         * @brief 返回场景里的结点数量，包括根结点
+         */
+        size_t getNodeCount() const     { return mNodes.size(); }
+
+        /**
+         * @brief 查找场景里指定结点ID的结点，不增加引用计数
+         * @param [in] nodeID : 结点ID
+         * @return 返回结点，不在场景里的返回nullptr
+         */
+        SGNode *findNode(uint32_t nodeID) const;
+
+        /**
+         * @brief 用名称索引查找场景里结点的子结点
+         * @param [in] parent : 父结点
+         * @param [in] nameID : 子结点名称ID
+         * @return 返回子结点，有多个同名子结点的时候返回最先挂上来的，没有的返回nullptr
+         * @note 由SGNode查找子结点时调用，开销只和场景里同名结点的数量有关
+         */
+        SGNode *findNamedChild(const SGNode *parent, uint32_t nameID) const;
+
+        /**
+         * @brief 把结点登记到结点索引
+         * @param [in] node : 场景结点
+         * @return void
+         * @note 由SGNode::onEnterScene()调用，重复登记同一个结点没有影响。
+         *      索引没有加锁，只能在渲染线程上挂接和移除结点。
+         */
+        void registerNode(SGNode *node);
+
+        /**
+         * @brief 把结点从结点索引移除
+         * @param [in] node : 场景结点
+         * @return void
+         * @note 由SGNode::onLeaveScene()调用
+         */
+        void unregisterNode(SGNode *node);
+
+        /**
+         * @brief 结点改名后更新名称索引
+         * @param [in] node : 场景结点
+         * @param [in] oldNameID : 改名前的名称ID
+         * @return void
+         * @note 由SGNode::setName()调用，结点不在场景里的时候什么都不做
+         */
+        void renameNode(SGNode *node, uint32_t oldNameID);
+
+    protected:
+        enum
+        {
+            E_MAX_SPLIT_DEPTH = 4,          /// 拆分子树任务时最多往下展开的层数
+            E_DEFAULT_PARALLEL_THRESHOLD = 4096,    /// 默认并行更新的结点数量阈值
+        };
+
+        /**
+         * @brief 更新整个场景，结点数量达到阈值时按子树拆成任务并行更新
+         * @remarks 所有任务结束后才返回，然后按结点ID顺序在渲染线程上执行登记的后续操作，
+         *      所以视景体裁剪看到的总是完整更新过的场景
+         */
+        void updateScene();
+
+        /**
+         * @brief 从结点开始拆分子树任务
+         * @remarks 只展开没有其他更新逻辑的3D变换结点，展开的结点在渲染线程上先算好世界变换并冻结，
+         *      其他结点连同整棵子树作为一个任务
+         */
+        void splitUpdateTasks(SGNode *node, uint32_t depth);
+
+        /**
+         * @brief 执行一段子树任务，在任务调度器的线程上调用
+         */
+        static void updateProcedure(void *context, size_t begin, size_t end);
+
+        /**
+         * @brief 把登记的包围盒变化更新到空间索引
+         * @remarks 按结点ID顺序处理，和并行更新时哪个线程先登记无关
+         */
+        void syncSpatialIndex();
+
+        /**
+         * @brief 用空间索引做视景体裁剪
+         * @remarks 先遍历场景树处理包围盒无限大的子树，再查询空间索引，
+         *      查询到的对象还要检查所有祖先结点是否可见
+         */
+        void cullByIndex(const BoundPtr &bound);
+
+        /**
+         * @brief 把视景体里的遮挡体光栅化到遮挡剔除器，生成本帧的层次深度
+         */
+        void rasterizeOccluders(const BoundPtr &bound);
+
+        /**
+         * @brief 判断结点和所有祖先结点是否可见
+         */
+        static bool isVisibleInScene(const SGNode *node);
+
+        /**
+         * @brief 按结点ID排序后续操作结点
+         */
+        static bool lessNodeID(SGNode *a, SGNode *b);
+
+        /**
+         * @brief 把结点从名称索引移除
+         */
+        void removeName(SGNode *node, uint32_t nameID);
+
     protected:
         SGNodePtr   mRoot;
         SGCameraPtr mCurCamera;
@@ -49,6 +319,46 @@ namespace Tiny3D
         Renderer    *mRenderer;
 
         RenderQueuePtr  mRenderQueue;
+
+        SGTransformStore    *mTransformStore;   /// 所有3D变换结点的变换数据
+        SGTransform2DStore  *mTransform2DStore; /// 所有2D变换结点的变换数据
+
+        typedef std::vector<SGNode *>           UpdateTaskArray;
+        typedef std::vector<SGTransformNode *>  TransformNodeArray;
+
+        UpdateTaskArray     mUpdateTasks;       /// 本帧子树任务
+        TransformNodeArray  mFrozenNodes;       /// 本帧拆分任务时展开并冻结的3D变换结点
+        UpdateTaskArray     mPostUpdateNodes;   /// 本帧登记的后续操作结点
+        std::mutex          mPostUpdateMutex;   /// 保护mPostUpdateNodes
+
+        typedef std::vector<SGRenderable *>     RenderableArray;
+
+        SpatialIndex        *mSpatialIndex;     /// 空间索引，nullptr表示遍历场景树裁剪
+        RenderableArray     mMovedRenderables;  /// 本帧包围盒变化了的可渲染对象
+        std::mutex          mMovedMutex;        /// 保护mMovedRenderables
+        SpatialIndex::Renderables   mVisibleRenderables;    /// 空间索引查询结果，每帧复用
+        bool                mIsCullingByIndex;  /// 是否正在用空间索引裁剪
+
+        typedef std::vector<SGOccluder *>       OccluderArray;
+        typedef OccluderArray::iterator         OccluderArrayItr;
+        typedef OccluderArray::const_iterator   OccluderArrayConstItr;
+
+        OcclusionCullerPtr  mOcclusionCuller;   /// 遮挡剔除器，nullptr表示不做遮挡剔除
+        OcclusionCuller     *mFrameOcclusionCuller; /// 本帧视景体剔除用的遮挡剔除器
+        OccluderArray       mOccluders;         /// 场景里的遮挡体
+
+        typedef std::unordered_map<uint32_t, SGNode *>      NodeMap;
+        typedef NodeMap::iterator                           NodeMapItr;
+        typedef NodeMap::const_iterator                     NodeMapConstItr;
+
+        typedef std::unordered_multimap<uint32_t, SGNode *> NameMap;
+        typedef NameMap::iterator                           NameMapItr;
+        typedef NameMap::const_iterator                     NameMapConstItr;
+
+        NodeMap             mNodes;             /// 场景里的所有结点，按结点ID索引
+        NameMap             mNamedNodes;        /// 场景里有名称的结点，按名称ID索引
+        size_t              mParallelThreshold; /// 并行更新的结点数量阈值
+        bool                mIsUpdatingInParallel;  /// 是否正在并行更新
     };
 
     #define T3D_SCENE_MGR           SceneManager::getInstance()
@@ -0,0 +1,147 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SPATIAL_INDEX_H__
+#define __T3D_SPATIAL_INDEX_H__
+
+
+#include "T3DPrerequisites.h"
+#include "T3DTypedef.h"
+#include "T3DVector3.h"
+#include "T3DAabb.h"
+#include "T3DFrustum.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @class SpatialIndex
+     * @brief 场景空间索引接口，按世界包围盒组织可渲染对象，用于视景体剔除和范围查询
+     * @remarks 场景管理器只通过这个接口使用空间索引，具体的组织方式由派生类实现，
+     *      可以在同一个场景上切换不同的实现做对比。
+     *      索引不持有对象的引用，对象离开场景时必须从索引移除。
+     */
+    class T3D_ENGINE_API SpatialIndex
+    {
+        T3D_DISABLE_COPY(SpatialIndex);
+
+    public:
+        static const uint32_t INVALID_PROXY;    /// 无效代理ID，表示对象不在索引里
+
+        typedef std::vector<SGRenderable *>     Renderables;
+        typedef Renderables::iterator           RenderablesItr;
+        typedef Renderables::const_iterator     RenderablesConstItr;
+
+        /**
+         * @brief 析构函数
+         */
+        virtual ~SpatialIndex();
+
+        /**
+         * @brief 返回实现的名称，用于统计输出
+         */
+        virtual const char *getName() const = 0;
+
+        /**
+         * @brief 把对象加入索引
+         * @param [in] renderable : 可渲染对象
+         * @param [in] box : 对象的世界包围盒
+         * @return 返回代理ID，后续更新和移除都用这个ID
+         */
+        virtual uint32_t insert(SGRenderable *renderable, const Aabb &box) = 0;
+
+        /**
+         * @brief 更新对象的世界包围盒
+         * @param [in] proxy : insert()返回的代理ID
+         * @param [in] box : 新的世界包围盒
+         * @return void
+         * @remarks 实现可以只在对象移出原来的位置时才重新插入，代理ID保持不变
+         */
+        virtual void update(uint32_t proxy, const Aabb &box) = 0;
+
+        /**
+         * @brief 把对象从索引移除
+         * @param [in] proxy : insert()返回的代理ID
+         * @return void
+         */
+        virtual void remove(uint32_t proxy) = 0;
+
+        /**
+         * @brief 清空索引
+         */
+        virtual void clear() = 0;
+
+        /**
+         * @brief 查找和视景体相交的所有对象
+         * @param [in] frustum : 视景体
+         * @param [out] result : 结果追加在后面
+         * @return void
+         * @remarks 整个单元完全在视景体内的，直接收集里面所有对象，不再逐个测试
+         */
+        virtual void query(const Frustum &frustum, Renderables &result) const = 0;
+
+        /**
+         * @brief 查找和包围盒相交的所有对象
+         * @param [in] box : 查询范围
+         * @param [out] result : 结果追加在后面
+         * @return void
+         */
+        virtual void query(const Aabb &box, Renderables &result) const = 0;
+
+        /**
+         * @brief 获取索引里的所有对象
+         * @param [out] result : 结果追加在后面
+         * @return void
+         */
+        virtual void collect(Renderables &result) const = 0;
+
+        /**
+         * @brief 返回索引里的对象数量
+         */
+        virtual size_t getCount() const = 0;
+
+        /**
+         * @brief 返回上一次查询访问过的内部结点数量，用于对比不同实现
+         */
+        size_t getVisitedCount() const  { return mVisitedCount; }
+
+    protected:
+        SpatialIndex();
+
+        /**
+         * @brief 按中心和半长测试包围盒和视景体的面
+         * @param [in] minPos : 包围盒最小点
+         * @param [in] maxPos : 包围盒最大点
+         * @param [in] frustum : 视景体
+         * @param [in][out] mask : 要测试的面，完全在内侧的面从掩码里去掉
+         * @return 完全在某个面外侧的返回false
+         */
+        static bool testFrustum(const Vector3 &minPos, const Vector3 &maxPos, const Frustum &frustum, uint32_t &mask);
+
+        /**
+         * @brief 测试两个包围盒是否相交
+         */
+        static bool testOverlap(const Vector3 &minPos0, const Vector3 &maxPos0, const Vector3 &minPos1, const Vector3 &maxPos1);
+
+        mutable size_t  mVisitedCount;  /// 上一次查询访问过的内部结点数量
+    };
+}
+
+
+#endif  /*__T3D_SPATIAL_INDEX_H__*/
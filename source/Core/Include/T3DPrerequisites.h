@@ -47,6 +47,7 @@
 #include "T3DMatrix2.h"
 #include "T3DMatrix3.h"
 #include "T3DMatrix4.h"
+#include "T3DAffine2.h"
 #include "T3DQuaternion.h"
 #include "T3DVector2.h"
 #include "T3DVector3.h"
@@ -71,6 +72,8 @@ namespace Tiny3D
     class Timer;
     class TimerObserver;
     class System;
+    class TaskScheduler;
+    class TaskGroup;
 
     /// Log
     class Logger;
@@ -160,6 +163,11 @@ namespace Tiny3D
     class SceneManager;
     class SGNode;
     class SGTransformNode;
+    class SGTransformStore;
+    class SGTransform2DStore;
+    class SpatialIndex;
+    class DynamicAabbTree;
+    class LooseOctree;
     class SGTransform2D;
     class SGBone;
     class SGCamera;
@@ -175,12 +183,18 @@ namespace Tiny3D
     class SGQuad;
     class SGSprite;
     class SGText2D;
+    class SGStaticBatch;
+    class SGBatchChunk;
+    class SGOccluder;
 
     class VertexData;
     class IndexData;
 
     class RenderGroup;
     class RenderQueue;
+    class CommandList;
+    class OverlayBatcher;
+    class OcclusionCuller;
 
     class Variant;
 
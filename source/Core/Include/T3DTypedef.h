@@ -56,6 +56,9 @@ namespace Tiny3D
     T3D_DECLARE_SMART_PTR(SGQuad);
     T3D_DECLARE_SMART_PTR(SGSprite);
     T3D_DECLARE_SMART_PTR(SGText2D);
+    T3D_DECLARE_SMART_PTR(SGStaticBatch);
+    T3D_DECLARE_SMART_PTR(SGBatchChunk);
+    T3D_DECLARE_SMART_PTR(SGOccluder);
 
     T3D_DECLARE_SMART_PTR(Bound);
     T3D_DECLARE_SMART_PTR(SphereBound);
@@ -83,6 +86,9 @@ namespace Tiny3D
 
     T3D_DECLARE_SMART_PTR(RenderGroup);
     T3D_DECLARE_SMART_PTR(RenderQueue);
+    T3D_DECLARE_SMART_PTR(CommandList);
+    T3D_DECLARE_SMART_PTR(OverlayBatcher);
+    T3D_DECLARE_SMART_PTR(OcclusionCuller);
     T3D_DECLARE_SMART_PTR(RenderWindow);
 
     T3D_DECLARE_SMART_PTR(TouchDevice);
@@ -106,7 +112,7 @@ namespace Tiny3D
 
     typedef VariantMap Settings;
 
-    typedef std::list<NodePtr>              Children;
+    typedef std::vector<NodePtr>            Children;
     typedef Children::iterator              ChildrenItr;
     typedef Children::const_iterator        ChildrenConstItr;
 
@@ -50,6 +50,9 @@
 #include "Render/T3DHardwareVertexBuffer.h"
 #include "Render/T3DHardwarePixelBuffer.h"
 #include "Render/T3DRenderQueue.h"
+#include "Render/T3DCommandList.h"
+#include "Render/T3DOverlayBatcher.h"
+#include "Render/T3DOcclusionCuller.h"
 
 #include "Render/T3DIndexData.h"
 #include "Render/T3DVertexData.h"
@@ -78,6 +81,7 @@
 #include "SceneGraph/T3DSGRenderable.h"
 #include "SceneGraph/T3DSGGeometry.h"
 #include "SceneGraph/T3DSGMesh.h"
+#include "SceneGraph/T3DSGStaticBatch.h"
 #include "SceneGraph/T3DSGBox.h"
 #include "SceneGraph/T3DSGSphere.h"
 #include "SceneGraph/T3DSGLight.h"
@@ -85,6 +89,7 @@
 #include "SceneGraph/T3DSGSprite.h"
 #include "SceneGraph/T3DSGQuad.h"
 #include "SceneGraph/T3DSGText2D.h"
+#include "SceneGraph/T3DSGOccluder.h"
 #include "SceneGraph/T3DSceneManager.h"
 
 
@@ -29,6 +29,8 @@
 
 namespace Tiny3D
 {
+    T3D_IMPLEMENT_POOL_ALLOCATOR(AabbBound, 64);
+
     AabbBoundPtr AabbBound::create(uint32_t unID, SGNode *node)
     {
         AabbBoundPtr bound = new AabbBound(unID, node);
@@ -102,139 +104,16 @@ namespace Tiny3D
 
     void AabbBound::updateBound(const Transform &transform)
     {
-        // ﲻôͳı任8㣬ȻȽϻȡx,y,zAABB
-        // ʹÿٱ任ķپ任Ŀԭ£
-        // 
-        // ײ8һΪP任һΪP'任ΪMɵã
-        //      P' = M * P
-        // 
-        //      P' = (x' y' z' 1)
-        //
-        //      P = (x y z 1)
+        // 这里不用传统的变换8个顶点，然后逐个比较获取最大x,y,z来重新设置AABB，
+        // 而是用中心点和半长变换，原理如下：
         //
-        //          | m00 m01 m02 tx|
-        //      M = | m10 m11 m12 ty|
-        //          | m20 m21 m22 tz|
-        //          | 0   0   0   1 |
-        // 
-        //      p'x' = px * m00 + py * m01 + pz * m02 + tx
-        //      p'y' = px * m10 + py * m11 + pz * m12 + ty
-        //      p'z' = px * m20 + py * m21 + pz * m22 + tz
-        // ֻҪp'x'p'y'p'z'ͿԵóСֵˡ
-        // 
-        //       m00 > 0ʱpx = min_xʱpx * m00С
-        //       m00 < 0ʱpx = max_xʱpx * m00С
-        //  ͬԸСֵ㷽ֵƣp'y'p'z'
-
-        const Vector3 &translate = transform.getTranslate();
+        // 碰撞盒中心为C，半长为E，变换矩阵为M（只取3x3部分为R，平移为T），则
+        //      C' = R * C + T
+        //      E' = |R| * E
+        // 其中|R|是R每个元素取绝对值。E'每个分量就是碰撞盒在对应坐标轴上投影的最大半长，
+        // 没有分支，批量变换时也可以直接向量化（见BoundBatch::transformAabbs）。
         const Matrix4 &M = transform.getAffineMatrix();
-
-        Vector3 vMin = translate;
-        Vector3 vMax = translate;
-
-        // Calculate min x & max x
-        if (M[0][0] > Real(0.0))
-        {
-            vMin.x() += M[0][0] * mOriginalAabb.getMinX();
-            vMax.x() += M[0][0] * mOriginalAabb.getMaxX();
-        }
-        else
-        {
-            vMin.x() += M[0][0] * mOriginalAabb.getMaxX();
-            vMax.x() += M[0][0] * mOriginalAabb.getMinX();
-        }
-
-        if (M[0][1] > Real(0.0))
-        {
-            vMin.x() += M[0][1] * mOriginalAabb.getMinY();
-            vMax.x() += M[0][1] * mOriginalAabb.getMaxY();
-        }
-        else
-        {
-            vMin.x() += M[0][1] * mOriginalAabb.getMaxY();
-            vMax.x() += M[0][1] * mOriginalAabb.getMinY();
-        }
-
-        if (M[0][2] > Real(0.0))
-        {
-            vMin.x() += M[0][2] * mOriginalAabb.getMinZ();
-            vMax.x() += M[0][2] * mOriginalAabb.getMaxZ();
-        }
-        else
-        {
-            vMin.x() += M[0][2] * mOriginalAabb.getMaxZ();
-            vMax.x() += M[0][2] * mOriginalAabb.getMinZ();
-        }
-
-        // Calculate min y & max y
-        if (M[1][0] > Real(0.0))
-        {
-            vMin.y() += M[1][0] * mOriginalAabb.getMinX();
-            vMax.y() += M[1][0] * mOriginalAabb.getMaxX();
-        }
-        else
-        {
-            vMin.y() += M[1][0] * mOriginalAabb.getMaxX();
-            vMax.y() += M[1][0] * mOriginalAabb.getMinX();
-        }
-
-        if (M[1][1] > Real(0.0))
-        {
-            vMin.y() += M[1][1] * mOriginalAabb.getMinY();
-            vMax.y() += M[1][1] * mOriginalAabb.getMaxY();
-        }
-        else
-        {
-            vMin.y() += M[1][1] * mOriginalAabb.getMaxY();
-            vMax.y() += M[1][1] * mOriginalAabb.getMinY();
-        }
-
-        if (M[1][2] > Real(0.0))
-        {
-            vMin.y() += M[1][2] * mOriginalAabb.getMinZ();
-            vMax.y() += M[1][2] * mOriginalAabb.getMaxZ();
-        }
-        else
-        {
-            vMin.y() += M[1][2] * mOriginalAabb.getMaxZ();
-            vMax.y() += M[1][2] * mOriginalAabb.getMinZ();
-        }
-
-        // Calculate min z & max z
-        if (M[2][0] > Real(0.0))
-        {
-            vMin.z() += M[2][0] * mOriginalAabb.getMinX();
-            vMax.z() += M[2][0] * mOriginalAabb.getMaxX();
-        }
-        else
-        {
-            vMin.z() += M[2][0] * mOriginalAabb.getMaxX();
-            vMax.z() += M[2][0] * mOriginalAabb.getMinX();
-        }
-
-        if (M[2][1] > Real(0.0))
-        {
-            vMin.z() += M[2][1] * mOriginalAabb.getMinY();
-            vMax.z() += M[2][1] * mOriginalAabb.getMaxY();
-        }
-        else
-        {
-            vMin.z() += M[2][1] * mOriginalAabb.getMaxY();
-            vMax.z() += M[2][1] * mOriginalAabb.getMinY();
-        }
-
-        if (M[2][2] > Real(0.0))
-        {
-            vMin.z() += M[2][2] * mOriginalAabb.getMinZ();
-            vMax.z() += M[2][2] * mOriginalAabb.getMaxZ();
-        }
-        else
-        {
-            vMin.z() += M[2][2] * mOriginalAabb.getMaxZ();
-            vMax.z() += M[2][2] * mOriginalAabb.getMinZ();
-        }
-
-        mAabb.setParam(vMin, vMax);
+        mOriginalAabb.transform(M, mAabb);
     }
 }
 
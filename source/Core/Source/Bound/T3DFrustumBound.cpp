@@ -38,6 +38,7 @@ namespace Tiny3D
     FrustumBound::FrustumBound(uint32_t unID, SGNode *node)
         : Bound(unID, node)
         , mRenderable(nullptr)
+        , mPlaneMask(Frustum::E_FACE_MASK_ALL)
     {
 
     }
@@ -49,7 +50,7 @@ namespace Tiny3D
 
     Bound::Type FrustumBound::getType() const
     {
-        return E_BT_OBB;
+        return E_BT_FRUSTUM;
     }
 
     SGRenderablePtr FrustumBound::getRenderable()
@@ -91,7 +92,7 @@ namespace Tiny3D
 
     bool FrustumBound::testFrustum(const FrustumBoundPtr &bound) const
     {
-        return false;//Math::intersects(mFrustum, bound->getFrustum());
+        return Math::intersects(mFrustum, bound->getFrustum());
     }
 
     void FrustumBound::updateBound(const Transform &transform)
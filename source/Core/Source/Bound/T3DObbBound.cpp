@@ -24,6 +24,7 @@
 #include "T3DMath.h"
 #include "SceneGraph/T3DSGNode.h"
 #include "SceneGraph/T3DSGBox.h"
+#include "T3DTransform.h"
 
 namespace Tiny3D
 {
@@ -45,6 +46,12 @@ namespace Tiny3D
 
     }
 
+    void ObbBound::setParams(const Vector3 &center, const Vector3 *axis, const Real *extent)
+    {
+        mOriginalObb = Obb(center, axis, extent);
+        mObb = mOriginalObb;
+    }
+
     Bound::Type ObbBound::getType() const
     {
         return E_BT_OBB;
@@ -85,7 +92,26 @@ namespace Tiny3D
 
     void ObbBound::updateBound(const Transform &transform)
     {
-
+        // 中心点直接变换，每个轴乘上矩阵的3x3部分后，长度就是这个轴上的缩放，
+        // 归一化后作为新的轴，半长乘上缩放。
+        // 非等比缩放并且盒子的轴和缩放方向不一致时，变换后已经不是长方体，这里不处理。
+        const Matrix4 &M = transform.getAffineMatrix();
+        Matrix3 R;
+        M.extractMatrix(R);
+
+        Vector3 axis[3];
+        Real extent[3];
+
+        int32_t i = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            Vector3 v = R * mOriginalObb.getAxis(i);
+            Real scale = v.length();
+            axis[i] = (scale > Real(0.0) ? v / scale : v);
+            extent[i] = mOriginalObb.getExtent(i) * scale;
+        }
+
+        mObb = Obb(M * mOriginalObb.getCenter(), axis, extent);
     }
 
     void ObbBound::cloneProperties(const BoundPtr &bound) const
@@ -107,7 +107,7 @@ namespace Tiny3D
 
     void SphereBound::updateBound(const Transform &transform)
     {
-        // ±任ײ
+        // 更新变换后用于碰撞检测的球体
         const Matrix4 &M = transform.getAffineMatrix();
         Vector3 center = M * mOriginalSphere.getCenter();
 
@@ -118,7 +118,7 @@ namespace Tiny3D
         mSphere.setCenter(center);
         mSphere.setRadius(radius);
 
-        // ԭʼ壬ֻλã°뾶С
+        // 原始球体，只更新球心位置，不更新半径大小
         center = M * mOriginalSphere.getCenter();
         mOriginalSphere.setCenter(center);
     }
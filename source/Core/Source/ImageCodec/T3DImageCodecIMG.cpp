@@ -218,12 +218,12 @@ namespace Tiny3D
                     FIBITMAP *newBitmap = nullptr;
                     if (FreeImage_IsTransparent(dib))
                     {
-                        // Ѵ͸ͨת32λ
+                        // 把带透明通道，转成32位
                         newBitmap = FreeImage_ConvertTo32Bits(dib);
                     }
                     else
                     {
-                        // ͸ֱͨת24λ
+                        // 不带透明通道，直接转成24位
                         newBitmap = FreeImage_ConvertTo24Bits(dib);
                     }
 
@@ -288,7 +288,7 @@ namespace Tiny3D
 
             if (eFileType == E_FT_DDS)
             {
-                // DDSҪתһΣΪDDSԭϽ
+                // DDS要翻转一次，因为DDS原点在左上角
                 for (y = 0; y < height; ++y)
                 {
                     uint8_t *pSrc = src + (height - y - 1) * srcPitch;
@@ -14,30 +14,30 @@
 namespace Tiny3D
 {
     /**
-     * @brief ؼ֡
+     * @brief 关键帧数据
      */
     class KeyFrameData : public Object
     {
     public:
         /**
-         * @brief ؼ֡
+         * @brief 关键帧类型
          */
         enum Type
         {
             E_TYPE_UNKNOWN = 0,
-            E_TYPE_TRANSLATION,     /// ƽƱ任
-            E_TYPE_ROTATION,        /// ת任
-            E_TYPE_SCALING,         /// ű任
+            E_TYPE_TRANSLATION,     /// 平移变换
+            E_TYPE_ROTATION,        /// 旋转变换
+            E_TYPE_SCALING,         /// 缩放变换
         };
 
         /**
-         * @brief عؼ֡
-         * @note ʵַؾ
+         * @brief 返回关键帧类型
+         * @note 子类实现返回具体类型
          */
         virtual Type getType() const = 0;
 
     protected:
-        /** 캯 */
+        /** 构造函数 */
         KeyFrameData(int64_t timestamp);
 
     private:
@@ -45,11 +45,11 @@ namespace Tiny3D
         KeyFrameData &operator =(const KeyFrameData &);
 
     public:
-        int64_t     mTimestamp;     /// ǰؼ֡ʱ
+        int64_t     mTimestamp;     /// 当前关键帧时间戳
     };
 
     /**
-     * @brief ƽƹؼ֡
+     * @brief 平移关键帧数据
      */
     class KeyFrameDataT : public KeyFrameData
     {
@@ -70,7 +70,7 @@ namespace Tiny3D
     };
 
     /**
-     * @brief תؼ֡
+     * @brief 旋转关键帧数据
      */
     class KeyFrameDataR : public KeyFrameData
     {
@@ -91,7 +91,7 @@ namespace Tiny3D
     };
 
     /**
-     * @brief Źؼ֡
+     * @brief 缩放关键帧数据
      */
     class KeyFrameDataS : public KeyFrameData
     {
@@ -112,7 +112,7 @@ namespace Tiny3D
     };
 
     /**
-     * @brief 
+     * @brief 动作数据
      */
     class ActionData : public Object
     {
@@ -134,11 +134,11 @@ namespace Tiny3D
         typedef Bones::const_iterator           BonesConstItr;
         typedef std::pair<String, KeyFrames>    BonesValue;
 
-        String      mName;                  /// 
-        int32_t     mDuration;              /// ʱλ
-        Bones       mBonesTranslation;      /// عƽƱ任ؼ֡
-        Bones       mBonesRotation;         /// عת任ؼ֡
-        Bones       mBonesScaling;          /// عű任ؼ֡
+        String      mName;                  /// 动作名称
+        int32_t     mDuration;              /// 动作时长，单位：毫秒
+        Bones       mBonesTranslation;      /// 动作相关骨骼的平移变换关键帧数据
+        Bones       mBonesRotation;         /// 动作相关骨骼的旋转变换关键帧数据
+        Bones       mBonesScaling;          /// 动作相关骨骼的缩放变换关键帧数据
     };
 }
 
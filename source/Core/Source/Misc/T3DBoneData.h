@@ -12,14 +12,14 @@
 namespace Tiny3D
 {
     /**
-     * @brief 
+     * @brief 骨骼数据
      */
     class BoneData : public NodeData
     {
     public:
         static BoneDataPtr create(const String &name);
 
-        Matrix4     mOffsetMatrix;          /// ƫƾ
+        Matrix4     mOffsetMatrix;          /// 骨骼偏移矩阵
 
     protected:
         BoneData(const String &name);
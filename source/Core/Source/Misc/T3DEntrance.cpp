@@ -25,6 +25,7 @@
 #include "Misc/T3DString.h"
 #include "SceneGraph/T3DSGTransform2D.h"
 #include "SceneGraph/T3DSGText2D.h"
+#include "SceneGraph/T3DSceneManager.h"
 #include "Render/T3DRenderer.h"
 #include "Render/T3DRenderWindow.h"
 #include "Resource/T3DDylibManager.h"
@@ -51,6 +52,7 @@ namespace Tiny3D
         : mSystem(new System())
         , mLogger(new Logger())
         , mMemoryTracer(new MemoryTracer(isMemoryTracing))
+        , mTaskScheduler(new TaskScheduler())
         , mDylibMgr(new DylibManager())
         , mArchiveMgr(new ArchiveManager())
         , mMaterialMgr(new MaterialManager())
@@ -62,12 +64,18 @@ namespace Tiny3D
         , mAppListener(nullptr)
         , mSceneMgr(nullptr)
         , mImageCodec(new ImageCodec())
+        , mTracePath("trace.json")
+        , mSpikeThreshold(0)
+        , mTraceFrames(60)
+        , mLastTraceFrame(0)
     {
         StringUtil::split(appPath, mAppPath, mAppName);
 
         ConfigFile file(mAppPath + config);
         file.loadXML(mSettings);
         startLogging();
+        startProfiling();
+        startTasks();
 
         initArchives();
         initResources();
@@ -75,15 +83,27 @@ namespace Tiny3D
 
         mImageCodec->startup();
 
-        RendererListItr itr = mRendererList.begin();
-        while (itr != mRendererList.end())
+        // 配置文件里没有指定渲染器的时候默认用Direct3D9，
+        // 指定的渲染器没有加载成功就用第一个加载成功的渲染器
+        String rendererName = Renderer::DIRECT3D9;
+        Settings renderSettings = mSettings["Render"].mapValue();
+        String s("Renderer");
+        Variant key(s);
+        Settings::const_iterator i = renderSettings.find(key);
+        if (i != renderSettings.end())
         {
-            if ((*itr)->getName() == Renderer::DIRECT3D9)
-            {
-                setActiveRenderer(*itr);
-                break;
-            }
-            ++itr;
+            rendererName = i->second.stringValue();
+        }
+
+        Renderer *renderer = getRenderer(rendererName);
+        if (renderer == nullptr && !mRendererList.empty())
+        {
+            renderer = mRendererList.front();
+        }
+
+        if (renderer != nullptr)
+        {
+            setActiveRenderer(renderer);
         }
     }
 
@@ -100,6 +120,9 @@ namespace Tiny3D
 
         T3D_SAFE_DELETE(mSceneMgr);
 
+        stopTasks();
+        T3D_SAFE_DELETE(mTaskScheduler);
+
         T3D_SAFE_DELETE(mFontMgr);
         T3D_SAFE_DELETE(mModelMgr);
         T3D_SAFE_DELETE(mMaterialMgr);
@@ -146,7 +169,7 @@ namespace Tiny3D
         bool ret = false;
         DylibPtr lib = DylibManager::getInstance().loadDylib(name);
 
-        if (lib->getType() == Resource::E_TYPE_DYLIB)
+        if (lib != nullptr && lib->getType() == Resource::E_TYPE_DYLIB)
         {
             mDylibList.push_back(lib);
 
@@ -154,6 +177,7 @@ namespace Tiny3D
             if (pFunc != nullptr)
             {
                 pFunc();
+                ret = true;
             }
         }
 
@@ -242,6 +266,94 @@ namespace Tiny3D
         T3D_LOG_SHUTDOWN();
     }
 
+    void Entrance::startProfiling()
+    {
+        Settings profilerSettings = mSettings["Profiler"].mapValue();
+
+        Settings::const_iterator itr = profilerSettings.find(Variant("Enabled"));
+        if (itr != profilerSettings.end())
+        {
+            T3D_PROFILER.setEnabled(itr->second.boolValue());
+        }
+
+        itr = profilerSettings.find(Variant("Frames"));
+        if (itr != profilerSettings.end())
+        {
+            mTraceFrames = std::min(itr->second.uint32Value(), T3D_PROFILER.getMaxFrames());
+        }
+
+        itr = profilerSettings.find(Variant("SpikeThreshold"));
+        if (itr != profilerSettings.end())
+        {
+            // 配置里的单位是毫秒
+            mSpikeThreshold = uint64_t(itr->second.uint32Value()) * 1000000;
+        }
+
+        itr = profilerSettings.find(Variant("TracePath"));
+        if (itr != profilerSettings.end())
+        {
+            mTracePath = itr->second.stringValue();
+        }
+    }
+
+    void Entrance::startTasks()
+    {
+        Settings taskSettings = mSettings["Tasks"].mapValue();
+
+        // 小于0时按CPU核数创建工作线程
+        int32_t workers = -1;
+
+        Settings::const_iterator itr = taskSettings.find(Variant("WorkerThreads"));
+        if (itr != taskSettings.end())
+        {
+            workers = itr->second.int32Value();
+        }
+
+        mTaskScheduler->startup(workers);
+
+        T3D_LOG_INFO("Task scheduler started with %u threads", mTaskScheduler->getThreadCount());
+    }
+
+    void Entrance::stopTasks()
+    {
+        mTaskScheduler->shutdown();
+    }
+
+    void Entrance::setupSceneUpdate()
+    {
+        Settings sceneSettings = mSettings["Scene"].mapValue();
+
+        Settings::const_iterator itr = sceneSettings.find(Variant("ParallelThreshold"));
+        if (itr != sceneSettings.end())
+        {
+            mSceneMgr->setParallelUpdateThreshold(itr->second.uint32Value());
+        }
+    }
+
+    void Entrance::profileFrame()
+    {
+        uint64_t frameTime = T3D_PROFILER.endFrame();
+        uint32_t frameIndex = T3D_PROFILER.getFrameIndex();
+
+        // 连续的尖峰只导出一次，下一次导出的帧不和这一次重叠
+        if (mSpikeThreshold > 0 && frameTime > mSpikeThreshold
+            && (mLastTraceFrame == 0 || frameIndex - mLastTraceFrame >= mTraceFrames))
+        {
+            mLastTraceFrame = frameIndex;
+
+            if (T3D_PROFILER.dumpChromeTrace(mTracePath, mTraceFrames))
+            {
+                T3D_LOG_WARNING("Frame %u took %.3f ms, dump last %u frames to %s",
+                    frameIndex, double(frameTime) / 1000000.0, mTraceFrames, mTracePath.c_str());
+            }
+            else
+            {
+                T3D_LOG_ERROR("Frame %u took %.3f ms, dump trace to %s failed !",
+                    frameIndex, double(frameTime) / 1000000.0, mTracePath.c_str());
+            }
+        }
+    }
+
     void Entrance::initArchives()
     {
         FileSystemArchiveCreator *creator = new FileSystemArchiveCreator();
@@ -268,7 +380,7 @@ namespace Tiny3D
             ++i;
         }
 
-        // Ĭ
+        // 设置默认字体
         itr = resSettings.find("DefaultFont");
         if (itr != resSettings.end())
         {
@@ -300,7 +412,7 @@ namespace Tiny3D
 
         size_t fontSize = 40;
 
-        // ʾFPS
+        // 显示FPS
         SGTransform2DPtr node = SGTransform2D::create();
         root->addChild(node);
         mFPSText = SGText2D::create("00.000", fontSize);
@@ -311,7 +423,7 @@ namespace Tiny3D
         y = -halfH + textSize.height + lineSpace;
         node->setPosition(x, y);
 
-        // ʾSPF
+        // 显示SPF
         node = SGTransform2D::create();
         root->addChild(node);
         mSPFText = SGText2D::create("0.000", fontSize);
@@ -322,7 +434,7 @@ namespace Tiny3D
         y = y + textSize.height + lineSpace;
         node->setPosition(x, y);
 
-        // ʾdraw call
+        // 显示draw call
         node = SGTransform2D::create();
         root->addChild(node);
         mDrawText = SGText2D::create("000", fontSize);
@@ -371,6 +483,7 @@ namespace Tiny3D
 
         mSceneMgr = new SceneManager();
         mSceneMgr->setRenderer(mActiveRenderer);
+        setupSceneUpdate();
 
         if (autoCreateWindow)
         {
@@ -511,6 +624,13 @@ namespace Tiny3D
             ret = mActiveRenderer->renderOneFrame();
         }
 
+        // 其他线程提交的只能在主线程执行的任务
+        mTaskScheduler->executeMainThreadTasks();
+
+#if defined (T3D_ENABLE_PROFILER)
+        profileFrame();
+#endif
+
 //         calculatePerformance();
 
         return ret;
@@ -340,7 +340,7 @@ namespace Tiny3D
         {
             if (isEmpty())
             {
-                // ͼ񣬸ͼ񴴽Ҹ
+                // 空图像，给空图像创建并且复制数据
                 mData = new uint8_t[image.mDataSize];
                 mDataSize = image.mDataSize;
                 memcpy(mData, image.mData, image.mDataSize);
@@ -356,9 +356,9 @@ namespace Tiny3D
             }
             else
             {
-                // ǿͼе鷳ˣֻӲͷƤ
+                // 非空图像，这个有点麻烦了，只能硬头皮来
 
-                // ظʽһ£ֱӷأȵconvertӿתһ¸ʽͼ
+                // 如果像素格式不一致，直接返回，请先调用convert接口来转换成一致格式的图像
                 if (image.getFormat() != mFormat)
                 {
                     T3D_LOG_ERROR("Source image and destination image are different !");
@@ -385,11 +385,11 @@ namespace Tiny3D
                     rtSrc = *srcRect;
                 }
 
-                // Ч
+                // 检验区域有效性
                 if (rtSrc.left < 0 || rtSrc.right >= mWidth 
                     || rtSrc.top < 0 || rtSrc.bottom >= mHeight)
                 {
-                    // ԴͼΧ
+                    // 超出源图像范围了
                     T3D_LOG_ERROR("Source image rectangle is out of bound !");
                     break;
                 }
@@ -397,20 +397,20 @@ namespace Tiny3D
                 if (rtDst.left < 0 || rtDst.right >= image.getWidth()
                     || rtDst.top < 0 || rtDst.bottom >= image.getHeight())
                 {
-                    // ĿͼΧ
+                    // 超出目标图像范围了
                     T3D_LOG_ERROR("Destination image rectangle is out of bound !");
                     break;
                 }
 
                 if (image.getWidth() == mWidth && image.getHeight() == mHeight && rtDst == rtSrc)
                 {
-                    // ԴĿȫֱͬӵ
+                    // 源和目标区域完全相同，直接点吧
                     T3D_ASSERT(image.mDataSize == mDataSize);
                     memcpy(mData, image.mData, mDataSize);
                 }
                 else if(rtSrc.width() == rtDst.width() && rtSrc.height() == rtDst.height())
                 {
-                    // ԴĿСһ£Լ
+                    // 源和目标区域大小一致，啃下来，自己来复制
                     uint8_t *srcData = image.mData + rtSrc.top * image.mPitch + rtSrc.left * image.getBytesPerPixel();
                     uint8_t *dstData = mData + rtDst.top * mPitch + rtDst.left * getBytesPerPixel();
                     uint8_t *src = srcData;
@@ -428,11 +428,11 @@ namespace Tiny3D
                 }
                 else
                 {
-                    // û취Լͼ㷨ãҲȥоFreeImageæ
+                    // 没办法，自己图像处理算法烂，也懒得去研究，先用FreeImage帮忙吧
                     uint32_t redMask, greenMask, blueMask, alphaMask;
                     image.getColorMask(redMask, greenMask, blueMask, alphaMask);
 
-                    // ԴݶFreeImage棬FreeImage
+                    // 把源数据读到FreeImage里面，让FreeImage来处理
                     dib = FreeImage_ConvertFromRawBitsEx(FALSE, mData, FIT_BITMAP, 
                         image.getWidth(), image.getWidth(), image.getPitch(), image.getBPP(), 
                         redMask, greenMask, blueMask, TRUE);
@@ -443,7 +443,7 @@ namespace Tiny3D
                         break;
                     }
 
-                    // 
+                    // 缩放
                     newdib = FreeImage_Rescale(dib, rtDst.width(), rtDst.height(), (FREE_IMAGE_FILTER)filter);
                     if (newdib == nullptr)
                     {
@@ -451,7 +451,7 @@ namespace Tiny3D
                         break;
                     }
 
-                    // תõݸƵĿͼ
+                    // 把转好的数据复制到目标图像上
                     int32_t srcBPP = FreeImage_GetBPP(newdib);
                     T3D_ASSERT(srcBPP == image.getBPP());
 
@@ -472,7 +472,7 @@ namespace Tiny3D
                         src += srcPitch;
                     }
 
-                    // ͷFreeImage
+                    // 释放FreeImage对象
                     FreeImage_Unload(newdib);
                     newdib = nullptr;
 
@@ -44,6 +44,7 @@ namespace Tiny3D
         {
             printInfo("Dump memory leak =================================>\n");
 
+            std::lock_guard<std::mutex> lock(mMutex);
             std::stringstream ss;
 
             for (auto itr = mObjects.begin(); itr != mObjects.end(); ++itr)
@@ -15,7 +15,7 @@
 namespace Tiny3D
 {
     /**
-     * @brief 㻺
+     * @brief 顶点缓冲区
      */
     class VertexBuffer : public Object
     {
@@ -30,10 +30,10 @@ namespace Tiny3D
 
         static VertexBufferPtr create();
 
-        String                  mName;          /// 
-        Attributes              mAttributes;    /// ж
-        Vertices                mVertices;      /// 
-        size_t                  mVertexSize;    /// ÿĴСλֽ
+        String                  mName;          /// 缓冲区名称
+        Attributes              mAttributes;    /// 缓冲区中顶点属性
+        Vertices                mVertices;      /// 缓冲区顶点数据
+        size_t                  mVertexSize;    /// 每个顶点的大小，单位：字节
 
     protected:
         VertexBuffer();
@@ -44,7 +44,7 @@ namespace Tiny3D
     };
 
     /**
-     * @brief 
+     * @brief 网格数据
      */
     class MeshData : public Object
     {
@@ -59,9 +59,9 @@ namespace Tiny3D
 
         static MeshDataPtr create();
 
-        String              mName;              /// 
-        VertexBuffers       mBuffers;           /// ӵеĶ㻺б
-        SubMeshDataList     mSubMeshes;         /// б
+        String              mName;              /// 网格名称
+        VertexBuffers       mBuffers;           /// 网格拥有的顶点缓冲区列表
+        SubMeshDataList     mSubMeshes;         /// 子网格列表
 
     protected:
         MeshData();
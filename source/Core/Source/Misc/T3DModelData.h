@@ -17,7 +17,7 @@
 namespace Tiny3D
 {
     /**
-     * @brief ģ
+     * @brief 模型数据
      */
     class ModelData : public Object
     {
@@ -41,11 +41,11 @@ namespace Tiny3D
 
         static ModelDataPtr create();
 
-        bool            mIsVertexShared;        /// Ƿ㻺
-        MeshDataList    mMeshes;                /// б
-        BoneDataList    mBones;                 /// б
-        AnimationData   mAnimations;            /// б
-        NodeDataList    mNodes;                 /// 任б
+        bool            mIsVertexShared;        /// 所有网格是否共享顶点缓存
+        MeshDataList    mMeshes;                /// 网格数据列表
+        BoneDataList    mBones;                 /// 骨骼数据列表
+        AnimationData   mAnimations;            /// 动画数据列表
+        NodeDataList    mNodes;                 /// 变换结点数据列表
 
     protected:
         ModelData();
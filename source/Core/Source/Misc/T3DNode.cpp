@@ -18,6 +18,7 @@
  ******************************************************************************/
 
 #include "Misc/T3DNode.h"
+#include "Misc/T3DString.h"
 
 
 namespace Tiny3D
@@ -25,7 +26,9 @@ namespace Tiny3D
     Node::Node(uint32_t uID /* = E_NID_AUTOMATIC */)
         : mID(E_NID_INVALID)
         , mName("")
+        , mNameID(NameTable::E_INVALID_NAME)
         , mParent(nullptr)
+        , mChildIndex(0)
     {
         if (E_NID_AUTOMATIC == uID)
         {
@@ -45,6 +48,7 @@ namespace Tiny3D
     void Node::addChild(const NodePtr &node)
     {
         T3D_ASSERT(node->getParent() == nullptr);
+        node->mChildIndex = mChildren.size();
         mChildren.push_back(node);
         node->mParent = this;
         node->onAttachParent(this);
@@ -52,62 +56,54 @@ namespace Tiny3D
 
     void Node::removeChild(const NodePtr &node, bool cleanup)
     {
-        if (node != nullptr)
+        // 子结点记着自己的下标，不用再遍历子结点数组
+        if (node != nullptr && node->mParent == this)
         {
-            auto itr = mChildren.begin();
-
-            while (itr != mChildren.end())
-            {
-                NodePtr &child = *itr;
-
-                if (child == node)
-                {
-                    if (cleanup)
-                    {
-                        child->removeAllChildren(cleanup);
-                    }
-
-                    child->onDetachParent(this);
-                    child->mParent = nullptr;
-                    mChildren.erase(itr);
-                    break;
-                }
-
-                ++itr;
-            }
+            detachChild(mChildren.begin() + node->mChildIndex, cleanup);
         }
     }
 
     void Node::removeChild(uint32_t nodeID, bool cleanup)
     {
-        auto itr = mChildren.begin();
+        Node *node = findChild(nodeID);
 
-        while (itr != mChildren.end())
+        if (node != nullptr)
         {
-            NodePtr &child = *itr;
+            detachChild(mChildren.begin() + node->mChildIndex, cleanup);
+        }
+    }
 
-            if (child != nullptr && child->getNodeID() == nodeID)
-            {
-                if (cleanup)
-                {
-                    child->removeAllChildren(cleanup);
-                }
-
-                child->onDetachParent(this);
-                child->mParent = nullptr;
-                mChildren.erase(itr);
-                break;
-            }
+    void Node::detachChild(ChildrenItr itr, bool cleanup)
+    {
+        NodePtr &child = *itr;
 
+        if (cleanup)
+        {
+            child->removeAllChildren(cleanup);
+        }
+
+        child->onDetachParent(this);
+        child->mParent = nullptr;
+
+        // 删除中间元素要移动后面的元素，保持子结点原来的顺序，后面子结点的下标跟着前移
+        itr = mChildren.erase(itr);
+
+        while (itr != mChildren.end())
+        {
+            --(*itr)->mChildIndex;
             ++itr;
         }
     }
 
     void Node::removeAllChildren(bool cleanup)
     {
-        auto itr = mChildren.begin();
+        // 先把子结点数组换出来，通知回调里访问本结点时看到的是已经清空的状态
+        Children children;
+        children.swap(mChildren);
 
-        while (itr != mChildren.end())
+        auto itr = children.begin();
+
+        while (itr != children.end())
         {
             NodePtr &child = *itr;
 
@@ -118,11 +114,10 @@ namespace Tiny3D
 
             child->onDetachParent(this);
             child->mParent = nullptr;
+            child->mChildIndex = 0;
 
             ++itr;
         }
-
-        mChildren.clear();
     }
 
     void Node::removeFromParent(bool cleanup)
@@ -133,93 +128,94 @@ namespace Tiny3D
         }
     }
 
+    void Node::setName(const String &name)
+    {
+        mName = name;
+        mNameID = NameTable::intern(name);
+    }
+
     const NodePtr &Node::getChild(uint32_t nodeID) const
     {
-        auto itr = mChildren.begin();
+        Node *node = findChild(nodeID);
+        return (node != nullptr ? mChildren[node->mChildIndex] : NodePtr::NULL_PTR);
+    }
 
-        while (itr != mChildren.end())
+    NodePtr Node::getChild(uint32_t nodeID)
+    {
+        const Node *self = this;
+        return self->getChild(nodeID);
+    }
+
+    const NodePtr &Node::getChild(const String &name) const
+    {
+        // 名称表里没有的名称不可能是任何结点的名称，不用再遍历子结点
+        uint32_t nameID = NameTable::find(name);
+
+        if (nameID == NameTable::E_INVALID_NAME && !name.empty())
         {
-            const NodePtr &node = *itr;
-            if (node->getNodeID() == nodeID)
-            {
-                return node;
-                break;
-            }
-            ++itr;
+            return NodePtr::NULL_PTR;
         }
 
-        return NodePtr::NULL_PTR;
+        Node *node = findNamedChild(nameID);
+        return (node != nullptr ? mChildren[node->mChildIndex] : NodePtr::NULL_PTR);
     }
 
-    NodePtr Node::getChild(uint32_t nodeID)
+    NodePtr Node::getChild(const String &name)
     {
-        NodePtr child;
-        auto itr = mChildren.begin();
+        const Node *self = this;
+        return self->getChild(name);
+    }
 
-        while (itr != mChildren.end())
+    void Node::cloneProperties(const NodePtr &node) const
+    {
+        node->mName = mName;
+        node->mNameID = mNameID;
+
+        // 按下标遍历，新加的子结点会让数组重新分配
+        size_t i = 0;
+        size_t count = node->mChildren.size();
+        while (i < count)
         {
-            NodePtr &node = *itr;
-            if (node->getNodeID() == nodeID)
-            {
-                child = node;
-                break;
-            }
-            ++itr;
+            NodePtr child = node->mChildren[i];
+            NodePtr newChild = child->clone();
+            newChild->cloneProperties(child);
+            node->addChild(newChild);
+            ++i;
         }
-
-        return child;
     }
 
-    const NodePtr &Node::getChild(const String &name) const
+    Node *Node::findChild(uint32_t nodeID) const
     {
         auto itr = mChildren.begin();
 
         while (itr != mChildren.end())
         {
-            const NodePtr &node = *itr;
-            if (node->getName() == name)
+            Node *node = *itr;
+            if (node != nullptr && node->getNodeID() == nodeID)
             {
                 return node;
-                break;
             }
             ++itr;
         }
 
-        return NodePtr::NULL_PTR;
+        return nullptr;
     }
 
-    NodePtr Node::getChild(const String &name)
+    Node *Node::findNamedChild(uint32_t nameID) const
     {
-        NodePtr child;
         auto itr = mChildren.begin();
 
         while (itr != mChildren.end())
         {
-            NodePtr &node = *itr;
-            if (node->getName() == name)
+            Node *node = *itr;
+            if (node->getNameID() == nameID)
             {
-                child = node;
-                break;
+                return node;
             }
             ++itr;
         }
 
-        return child;
-    }
-
-    void Node::cloneProperties(const NodePtr &node) const
-    {
-        node->mName = mName;
-
-        auto itr = node->mChildren.begin();
-        while (itr != node->mChildren.end())
-        {
-            NodePtr &child = *itr;
-            NodePtr newChild = child->clone();
-            newChild->cloneProperties(child);
-            node->addChild(newChild);
-            ++itr;
-        }
+        return nullptr;
     }
 
     void Node::onAttachParent(const NodePtr &parent)
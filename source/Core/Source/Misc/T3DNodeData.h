@@ -16,13 +16,13 @@ namespace Tiny3D
     public:
         static NodeDataPtr create(const String &name);
 
-        String      mName;              /// 
-        uint16_t    mParent;            /// ڵ
-        Matrix4     mLocalMatrix;       /// 㱾ر任
+        String      mName;              /// 结点名称
+        uint16_t    mParent;            /// 父节点索引
+        Matrix4     mLocalMatrix;       /// 结点本地变换
 
-        bool        mHasLink;           /// ǷйȾ
-        String      mLinkMesh;          /// ¹ҽӵ
-        String      mLinkSubMesh;       /// ¹ҽӵ
+        bool        mHasLink;           /// 是否有挂渲染网格
+        String      mLinkMesh;          /// 本结点下挂接的网格
+        String      mLinkSubMesh;       /// 网格下挂接的子网格
 
     protected:
         NodeData(const String &name);
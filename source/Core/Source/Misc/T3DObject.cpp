@@ -29,6 +29,17 @@ namespace Tiny3D
         MemoryTracer::getInstance().addObject(this);
     }
 
+    Object::Object(const Object &other)
+        : mReferCount(1)
+    {
+        MemoryTracer::getInstance().addObject(this);
+    }
+
+    Object &Object::operator =(const Object &other)
+    {
+        return *this;
+    }
+
     Object::~Object()
     {
         MemoryTracer::getInstance().removeObject(this);
@@ -36,13 +47,13 @@ namespace Tiny3D
 
     Object *Object::acquire()
     {
-        ++mReferCount;
+        mReferCount.fetch_add(1, std::memory_order_relaxed);
         return this;
     }
 
     void Object::release()
     {
-        if (--mReferCount == 0)
+        if (mReferCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
         {
             delete this;
         }
@@ -0,0 +1,257 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Misc/T3DObjectPool.h"
+#include <stdlib.h>
+#include <new>
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 页面头，后面紧跟着所有对象
+     */
+    struct ObjectPool::Page
+    {
+        ObjectPool  *pool;      /// 所属的池
+        Page        *prev;      /// 还有空位的页面链表
+        Page        *next;      /// 还有空位的页面链表
+        Header      *freeList;  /// 页面里的空闲对象，链表指针放在对象的内存里
+        size_t      used;       /// 页面里分配出去的对象数量
+    };
+
+    /// 空闲对象的下一个空闲对象，放在头后面对象的内存里
+    #define T3D_POOL_NEXT_FREE(header)  (*(ObjectPool::Header **)((header) + 1))
+
+    ObjectPool::ObjectPool(const char *name, size_t objectSize, size_t objectsPerPage)
+        : mName(name)
+        , mObjectSize(objectSize)
+        , mSlotSize(0)
+        , mObjectsPerPage(objectsPerPage > 0 ? objectsPerPage : 1)
+        , mCurrent(nullptr)
+        , mPartial(nullptr)
+        , mSpare(nullptr)
+        , mObjectCount(0)
+        , mPageCount(0)
+    {
+        // 每个对象连同头都按头的大小对齐，空闲时对象内存里至少要放得下一个指针
+        size_t size = (objectSize > sizeof(Header *) ? objectSize : sizeof(Header *));
+        size = (size + sizeof(Header) - 1) / sizeof(Header) * sizeof(Header);
+        mSlotSize = sizeof(Header) + size;
+    }
+
+    ObjectPool::~ObjectPool()
+    {
+        // 还有对象的话，对象释放时会访问已经销毁的池
+        T3D_ASSERT(mObjectCount == 0);
+
+        if (mSpare != nullptr)
+        {
+            free(mSpare);
+            mSpare = nullptr;
+        }
+
+        if (mCurrent != nullptr && mCurrent->used == 0)
+        {
+            free(mCurrent);
+            mCurrent = nullptr;
+        }
+    }
+
+    ObjectPool::Page *ObjectPool::createPage()
+    {
+        size_t headSize = (sizeof(Page) + sizeof(Header) - 1) / sizeof(Header) * sizeof(Header);
+        uint8_t *data = (uint8_t *)malloc(headSize + mSlotSize * mObjectsPerPage);
+
+        if (data == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        Page *page = (Page *)data;
+        page->pool = this;
+        page->prev = nullptr;
+        page->next = nullptr;
+        page->freeList = nullptr;
+        page->used = 0;
+
+        // 从后往前串起来，分配的时候按地址从低到高
+        size_t i = mObjectsPerPage;
+        while (i > 0)
+        {
+            --i;
+            Header *header = (Header *)(data + headSize + mSlotSize * i);
+            header->page = page;
+            T3D_POOL_NEXT_FREE(header) = page->freeList;
+            page->freeList = header;
+        }
+
+        ++mPageCount;
+        return page;
+    }
+
+    void *ObjectPool::allocate(size_t size)
+    {
+        Header *header = nullptr;
+
+        if (size != mObjectSize)
+        {
+            // 派生类对象大小不一样，直接走全局堆，头里不记录页面
+            header = (Header *)malloc(sizeof(Header) + size);
+
+            if (header == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+
+            header->page = nullptr;
+            return header + 1;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mCurrent == nullptr || mCurrent->freeList == nullptr)
+        {
+            // 当前页面用完了，先用其他还有空位的页面，再用备用的空页面，最后才分配新页面
+            if (mPartial != nullptr)
+            {
+                mCurrent = mPartial;
+                unlinkPage(mCurrent);
+            }
+            else if (mSpare != nullptr)
+            {
+                mCurrent = mSpare;
+                mSpare = nullptr;
+            }
+            else
+            {
+                mCurrent = createPage();
+            }
+        }
+
+        header = mCurrent->freeList;
+        mCurrent->freeList = T3D_POOL_NEXT_FREE(header);
+        ++mCurrent->used;
+        ++mObjectCount;
+
+        return header + 1;
+    }
+
+    void ObjectPool::deallocate(void *ptr)
+    {
+        if (ptr == nullptr)
+            return;
+
+        Header *header = (Header *)ptr - 1;
+        Page *page = header->page;
+
+        if (page == nullptr)
+        {
+            free(header);
+        }
+        else
+        {
+            page->pool->freeSlot(page, header);
+        }
+    }
+
+    void ObjectPool::freeSlot(Page *page, Header *header)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        T3D_POOL_NEXT_FREE(header) = page->freeList;
+        page->freeList = header;
+        --page->used;
+        --mObjectCount;
+
+        if (page == mCurrent)
+            return;
+
+        // 不是当前页面的，释放前没满的就在还有空位的页面链表里
+        bool wasPartial = (page->used + 1 < mObjectsPerPage);
+
+        if (page->used == 0)
+        {
+            if (wasPartial)
+            {
+                unlinkPage(page);
+            }
+
+            // 留一个空页面备用，反复创建销毁对象的时候不用反复分配页面
+            if (mSpare == nullptr)
+            {
+                mSpare = page;
+            }
+            else
+            {
+                free(page);
+                --mPageCount;
+            }
+        }
+        else if (!wasPartial)
+        {
+            linkPage(page);
+        }
+    }
+
+    void ObjectPool::linkPage(Page *page)
+    {
+        page->prev = nullptr;
+        page->next = mPartial;
+
+        if (mPartial != nullptr)
+        {
+            mPartial->prev = page;
+        }
+
+        mPartial = page;
+    }
+
+    void ObjectPool::unlinkPage(Page *page)
+    {
+        if (page->prev != nullptr)
+        {
+            page->prev->next = page->next;
+        }
+        else
+        {
+            mPartial = page->next;
+        }
+
+        if (page->next != nullptr)
+        {
+            page->next->prev = page->prev;
+        }
+
+        page->prev = nullptr;
+        page->next = nullptr;
+    }
+
+    size_t ObjectPool::getObjectCount() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mObjectCount;
+    }
+
+    size_t ObjectPool::getPageCount() const
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mPageCount;
+    }
+}
@@ -19,6 +19,8 @@
 
 #include "Misc/T3DString.h"
 #include <sstream>
+#include <unordered_map>
+#include <mutex>
 
 
 namespace Tiny3D
@@ -178,4 +180,44 @@ namespace Tiny3D
         return (StringUtil::startsWith(val, "true") || StringUtil::startsWith(val, "yes")
             || StringUtil::startsWith(val, "1"));
     }
-}
\ No newline at end of file
+
+    struct NameTable::Storage
+    {
+        typedef std::unordered_map<String, uint32_t>    Names;
+
+        std::mutex  mutex;      /// 保护名称表
+        Names       names;      /// 名称到ID的映射
+    };
+
+    NameTable::Storage &NameTable::getStorage()
+    {
+        static Storage storage;
+        return storage;
+    }
+
+    uint32_t NameTable::intern(const String &name)
+    {
+        if (name.empty())
+            return E_INVALID_NAME;
+
+        Storage &storage = getStorage();
+        std::lock_guard<std::mutex> lock(storage.mutex);
+
+        // 新名称的ID就是加入后的表大小，从1开始连续分配
+        uint32_t id = uint32_t(storage.names.size() + 1);
+        auto ret = storage.names.insert(Storage::Names::value_type(name, id));
+        return ret.first->second;
+    }
+
+    uint32_t NameTable::find(const String &name)
+    {
+        if (name.empty())
+            return E_INVALID_NAME;
+
+        Storage &storage = getStorage();
+        std::lock_guard<std::mutex> lock(storage.mutex);
+
+        auto itr = storage.names.find(name);
+        return (itr != storage.names.end() ? itr->second : E_INVALID_NAME);
+    }
+}
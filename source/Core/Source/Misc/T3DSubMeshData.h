@@ -19,6 +19,20 @@ namespace Tiny3D
         typedef Indices::iterator               IndicesItr;
         typedef Indices::const_iterator         IndicesConstItr;
 
+        /**
+         * @brief 一级LOD的索引数据，和原始索引共用同一份顶点
+         */
+        struct LodData
+        {
+            Real        mScreenSize;    /// 包围球投影高度占视口高度的比例低于这个值时切换到这一级
+            bool        mIs16Bits;      /// 是否16位索引
+            Indices     mIndices;       /// 索引数据
+        };
+
+        typedef std::vector<LodData>            LodList;
+        typedef LodList::iterator               LodListItr;
+        typedef LodList::const_iterator         LodListConstItr;
+
         static SubMeshDataPtr create(const String &name, const String &materialName, Renderer::PrimitiveType priType, bool is16Bits, size_t indexCount);
 
         String                  mName;
@@ -26,6 +40,7 @@ namespace Tiny3D
         Renderer::PrimitiveType mPrimitiveType;
         bool                    mIs16Bits;
         Indices                 mIndices;
+        LodList                 mLods;          /// 从精细到粗糙排列的LOD，没有LOD时为空
 
     protected:
         SubMeshData(const String &name, const String &materialName, Renderer::PrimitiveType priType, bool is16Bits, size_t indexCount);
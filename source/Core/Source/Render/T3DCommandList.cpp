@@ -0,0 +1,294 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Render/T3DCommandList.h"
+#include "Render/T3DVertexData.h"
+#include "Render/T3DIndexData.h"
+#include "Resource/T3DMaterial.h"
+#include "SceneGraph/T3DSGLight.h"
+
+
+namespace Tiny3D
+{
+    /// 所有命令的公共头，size是包括头在内整条命令按8字节对齐后的大小
+    struct CommandHeader
+    {
+        uint32_t    type;
+        uint32_t    size;
+    };
+
+    struct CmdSetTransform
+    {
+        CommandHeader   header;
+        uint32_t        state;
+        Matrix4         mat;
+    };
+
+    struct CmdRenderMode
+    {
+        CommandHeader   header;
+        uint32_t        mode;
+    };
+
+    struct CmdSetMaterial
+    {
+        CommandHeader   header;
+        Material        *material;
+    };
+
+    struct CmdDraw
+    {
+        CommandHeader   header;
+        VertexData      *vertices;
+        IndexData       *indices;
+        uint32_t        primitiveType;
+        uint32_t        startIdx;
+        uint32_t        primitiveCount;
+        uint32_t        instanceCount;  /// 只有实例化绘制使用，矩阵紧跟在命令后面
+    };
+
+    struct CmdAddLight
+    {
+        CommandHeader   header;
+        SGLight         *light;
+        size_t          index;
+    };
+
+    enum
+    {
+        E_COMMAND_ALIGN = 8,
+    };
+
+    static inline size_t alignCommandSize(size_t size)
+    {
+        return (size + E_COMMAND_ALIGN - 1) & ~size_t(E_COMMAND_ALIGN - 1);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    CommandListPtr CommandList::create()
+    {
+        CommandListPtr list = new CommandList();
+        list->release();
+        return list;
+    }
+
+    CommandList::CommandList()
+        : mSize(0)
+        , mCommandCount(0)
+    {
+
+    }
+
+    CommandList::~CommandList()
+    {
+
+    }
+
+    void CommandList::reset()
+    {
+        mSize = 0;
+        mCommandCount = 0;
+    }
+
+    uint8_t *CommandList::allocCommand(CommandType type, size_t size)
+    {
+        size = alignCommandSize(size);
+
+        if (mSize + size > mBuffer.size())
+        {
+            /// 按倍数增长，稳定之后每帧不再分配内存
+            size_t capacity = (mBuffer.empty() ? 4096 : mBuffer.size() * 2);
+            while (capacity < mSize + size)
+            {
+                capacity *= 2;
+            }
+            mBuffer.resize(capacity);
+        }
+
+        uint8_t *cmd = &mBuffer[mSize];
+        CommandHeader *header = (CommandHeader *)cmd;
+        header->type = type;
+        header->size = (uint32_t)size;
+
+        mSize += size;
+        ++mCommandCount;
+
+        return cmd;
+    }
+
+    void CommandList::setTransform(Renderer::TransformState state, const Matrix4 &mat)
+    {
+        CmdSetTransform *cmd = (CmdSetTransform *)allocCommand(E_CMD_SET_TRANSFORM, sizeof(CmdSetTransform));
+        cmd->state = state;
+        cmd->mat = mat;
+    }
+
+    void CommandList::pushRenderMode(Renderer::RenderMode mode)
+    {
+        CmdRenderMode *cmd = (CmdRenderMode *)allocCommand(E_CMD_PUSH_RENDER_MODE, sizeof(CmdRenderMode));
+        cmd->mode = mode;
+    }
+
+    void CommandList::popRenderMode()
+    {
+        allocCommand(E_CMD_POP_RENDER_MODE, sizeof(CommandHeader));
+    }
+
+    void CommandList::setMaterial(Material *material)
+    {
+        CmdSetMaterial *cmd = (CmdSetMaterial *)allocCommand(E_CMD_SET_MATERIAL, sizeof(CmdSetMaterial));
+        cmd->material = material;
+    }
+
+    void CommandList::drawVertexList(Renderer::PrimitiveType primitiveType, VertexData *vertices,
+        uint32_t startIdx, uint32_t primitiveCount)
+    {
+        CmdDraw *cmd = (CmdDraw *)allocCommand(E_CMD_DRAW_VERTEX_LIST, sizeof(CmdDraw));
+        cmd->vertices = vertices;
+        cmd->indices = nullptr;
+        cmd->primitiveType = primitiveType;
+        cmd->startIdx = startIdx;
+        cmd->primitiveCount = primitiveCount;
+        cmd->instanceCount = 0;
+    }
+
+    void CommandList::drawIndexList(Renderer::PrimitiveType primitiveType, VertexData *vertices,
+        IndexData *indices, uint32_t startIdx, uint32_t primitiveCount)
+    {
+        CmdDraw *cmd = (CmdDraw *)allocCommand(E_CMD_DRAW_INDEX_LIST, sizeof(CmdDraw));
+        cmd->vertices = vertices;
+        cmd->indices = indices;
+        cmd->primitiveType = primitiveType;
+        cmd->startIdx = startIdx;
+        cmd->primitiveCount = primitiveCount;
+        cmd->instanceCount = 0;
+    }
+
+    Matrix4 *CommandList::drawIndexListInstanced(Renderer::PrimitiveType primitiveType, VertexData *vertices,
+        IndexData *indices, uint32_t startIdx, uint32_t primitiveCount, size_t instanceCount)
+    {
+        size_t headSize = alignCommandSize(sizeof(CmdDraw));
+        uint8_t *data = allocCommand(E_CMD_DRAW_INSTANCED, headSize + sizeof(Matrix4) * instanceCount);
+
+        CmdDraw *cmd = (CmdDraw *)data;
+        cmd->vertices = vertices;
+        cmd->indices = indices;
+        cmd->primitiveType = primitiveType;
+        cmd->startIdx = startIdx;
+        cmd->primitiveCount = primitiveCount;
+        cmd->instanceCount = (uint32_t)instanceCount;
+
+        return (Matrix4 *)(data + headSize);
+    }
+
+    void CommandList::addDynamicLight(size_t index, SGLight *light)
+    {
+        CmdAddLight *cmd = (CmdAddLight *)allocCommand(E_CMD_ADD_LIGHT, sizeof(CmdAddLight));
+        cmd->light = light;
+        cmd->index = index;
+    }
+
+    size_t CommandList::execute(const RendererPtr &renderer) const
+    {
+        const size_t MAX_RENDER_MODE_DEPTH = 8;
+        Renderer::RenderMode modeStack[MAX_RENDER_MODE_DEPTH];
+        size_t modeDepth = 0;
+        size_t drawCount = 0;
+
+        size_t offset = 0;
+
+        while (offset < mSize)
+        {
+            const uint8_t *data = &mBuffer[offset];
+            const CommandHeader *header = (const CommandHeader *)data;
+
+            switch (header->type)
+            {
+            case E_CMD_SET_TRANSFORM:
+                {
+                    const CmdSetTransform *cmd = (const CmdSetTransform *)data;
+                    renderer->setTransform((Renderer::TransformState)cmd->state, cmd->mat);
+                }
+                break;
+            case E_CMD_PUSH_RENDER_MODE:
+                {
+                    const CmdRenderMode *cmd = (const CmdRenderMode *)data;
+                    T3D_ASSERT(modeDepth < MAX_RENDER_MODE_DEPTH);
+                    modeStack[modeDepth++] = renderer->getRenderMode();
+                    renderer->setRenderMode((Renderer::RenderMode)cmd->mode);
+                }
+                break;
+            case E_CMD_POP_RENDER_MODE:
+                {
+                    T3D_ASSERT(modeDepth > 0);
+                    renderer->setRenderMode(modeStack[--modeDepth]);
+                }
+                break;
+            case E_CMD_SET_MATERIAL:
+                {
+                    const CmdSetMaterial *cmd = (const CmdSetMaterial *)data;
+                    renderer->setMaterial(cmd->material);
+                }
+                break;
+            case E_CMD_DRAW_VERTEX_LIST:
+                {
+                    const CmdDraw *cmd = (const CmdDraw *)data;
+                    renderer->drawVertexList((Renderer::PrimitiveType)cmd->primitiveType,
+                        cmd->vertices, cmd->startIdx, cmd->primitiveCount);
+                    ++drawCount;
+                }
+                break;
+            case E_CMD_DRAW_INDEX_LIST:
+                {
+                    const CmdDraw *cmd = (const CmdDraw *)data;
+                    renderer->drawIndexList((Renderer::PrimitiveType)cmd->primitiveType,
+                        cmd->vertices, cmd->indices, cmd->startIdx, cmd->primitiveCount);
+                    ++drawCount;
+                }
+                break;
+            case E_CMD_DRAW_INSTANCED:
+                {
+                    const CmdDraw *cmd = (const CmdDraw *)data;
+                    const Matrix4 *matrices = (const Matrix4 *)(data + alignCommandSize(sizeof(CmdDraw)));
+                    renderer->drawIndexListInstanced((Renderer::PrimitiveType)cmd->primitiveType,
+                        cmd->vertices, cmd->indices, cmd->startIdx, cmd->primitiveCount,
+                        matrices, cmd->instanceCount);
+                    ++drawCount;
+                }
+                break;
+            case E_CMD_ADD_LIGHT:
+                {
+                    const CmdAddLight *cmd = (const CmdAddLight *)data;
+                    renderer->addDynamicLight(cmd->index, cmd->light);
+                }
+                break;
+            default:
+                {
+                    T3D_ASSERT(0);
+                }
+                break;
+            }
+
+            offset += header->size;
+        }
+
+        return drawCount;
+    }
+}
@@ -56,13 +56,13 @@ namespace Tiny3D
 
         if ((offset + size) > mBufferSize)
         {
-            // Խ :(
+            // 越界了 :(
         }
         else if (mUseShadowBuffer)
         {
             if (options != E_HBL_READ_ONLY)
             {
-                // ֻǾͿܻᱻı䣬ȻʱӰbufferӲbuffer
+                // 不是只读，那就可能会被改变，等会解锁时用影子buffer更新硬件buffer
                 mIsShadowBufferDirty = true;
             }
 
@@ -70,7 +70,7 @@ namespace Tiny3D
         }
         else
         {
-            // ûӰbufferʵӿ
+            // 没有影子buffer，调用实际锁接口
             buffer = lockImpl(offset, size, options);
             if (buffer != nullptr)
             {
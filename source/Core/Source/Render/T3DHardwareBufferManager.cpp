@@ -40,6 +40,11 @@ namespace Tiny3D
         return decl;
     }
 
+    HardwareVertexBufferPtr HardwareBufferManagerBase::createInstanceBuffer(size_t instanceSize, size_t instanceCount, HardwareBuffer::Usage usage)
+    {
+        return createVertexBuffer(instanceSize, instanceCount, usage, false);
+    }
+
     T3D_INIT_SINGLETON(HardwareBufferManager);
 
     HardwareBufferManager::HardwareBufferManager(HardwareBufferManagerBase *impl)
@@ -72,4 +77,9 @@ namespace Tiny3D
     {
         return mImpl->createVertexDeclaration();
     }
+
+    HardwareVertexBufferPtr HardwareBufferManager::createInstanceBuffer(size_t instanceSize, size_t instanceCount, HardwareBuffer::Usage usage)
+    {
+        return mImpl->createInstanceBuffer(instanceSize, instanceCount, usage);
+    }
 }
@@ -49,13 +49,13 @@ namespace Tiny3D
         if (rect.left < 0 || rect.right >= mWidth 
             || rect.top < 0 || rect.bottom >= mHeight)
         {
-            // Խ :(
+            // 越界了 :(
         }
         else if (mUseShadowBuffer)
         {
             if (options != E_HBL_READ_ONLY)
             {
-                // ֻǾͿܻᱻı䣬ȻʱӰbufferӲbuffer
+                // 不是只读，那就可能会被改变，等会解锁时用影子buffer更新硬件buffer
                 mIsShadowBufferDirty = true;
             }
 
@@ -63,7 +63,7 @@ namespace Tiny3D
         }
         else
         {
-            // ûӰbufferʵӿ
+            // 没有影子buffer，调用实际锁接口
             buffer = lockImpl(rect, options, lockedPitch);
             if (buffer != nullptr)
             {
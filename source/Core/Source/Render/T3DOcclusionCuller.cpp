@@ -0,0 +1,444 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Render/T3DOcclusionCuller.h"
+#include <float.h>
+#include <math.h>
+
+#if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define T3D_OCCLUSION_SSE2
+    #include <emmintrin.h>
+#endif
+
+
+namespace Tiny3D
+{
+    OcclusionCullerPtr OcclusionCuller::create(uint32_t width /* = E_DEFAULT_WIDTH */,
+        uint32_t height /* = E_DEFAULT_HEIGHT */)
+    {
+        OcclusionCuller *culler = new OcclusionCuller(width, height);
+        OcclusionCullerPtr ptr(culler);
+        culler->release();
+        return ptr;
+    }
+
+    OcclusionCuller::OcclusionCuller(uint32_t width, uint32_t height)
+        : mViewProj(Matrix4::IDENTITY)
+        , mNearDistance(Real(0.0))
+    {
+        // 光栅化时每行按4个像素一组处理
+        width = (std::max(width, uint32_t(4)) + 3) & ~uint32_t(3);
+        height = std::max(height, uint32_t(1));
+
+        while (true)
+        {
+            Level level;
+            level.width = width;
+            level.height = height;
+            level.depth.resize(width * height, FLT_MAX);
+            mLevels.push_back(level);
+
+            if (width == 1 && height == 1)
+                break;
+
+            width = (width + 1) / 2;
+            height = (height + 1) / 2;
+        }
+
+        memset(&mStatistics, 0, sizeof(mStatistics));
+    }
+
+    OcclusionCuller::~OcclusionCuller()
+    {
+
+    }
+
+    void OcclusionCuller::beginFrame(const Matrix4 &viewProj, Real nearDistance)
+    {
+        mViewProj = viewProj;
+        mNearDistance = nearDistance;
+
+        Level &target = mLevels[0];
+        std::fill(target.depth.begin(), target.depth.end(), FLT_MAX);
+
+        memset(&mStatistics, 0, sizeof(mStatistics));
+    }
+
+    void OcclusionCuller::rasterizeOccluder(const Matrix4 &world, const Vector3 *vertices,
+        size_t vertexCount, const uint16_t *indices, size_t indexCount)
+    {
+        Matrix4 M = mViewProj * world;
+
+        // 共享的顶点只变换一次
+        mClipVertices.resize(vertexCount);
+
+        size_t i = 0;
+        for (i = 0; i < vertexCount; ++i)
+        {
+            const Vector3 &v = vertices[i];
+            mClipVertices[i] = M * Vector4(v.x(), v.y(), v.z(), Real(1.0));
+        }
+
+        Vector4 clip[3];
+
+        for (i = 0; i + 2 < indexCount; i += 3)
+        {
+            T3D_ASSERT(indices[i] < vertexCount && indices[i + 1] < vertexCount
+                && indices[i + 2] < vertexCount);
+            clip[0] = mClipVertices[indices[i]];
+            clip[1] = mClipVertices[indices[i + 1]];
+            clip[2] = mClipVertices[indices[i + 2]];
+            clipTriangle(clip);
+        }
+
+        ++mStatistics.occluders;
+    }
+
+    void OcclusionCuller::clipTriangle(const Vector4 *clip)
+    {
+        bool in0 = (clip[0].w() >= mNearDistance);
+        bool in1 = (clip[1].w() >= mNearDistance);
+        bool in2 = (clip[2].w() >= mNearDistance);
+
+        if (in0 && in1 && in2)
+        {
+            rasterizeTriangle(toScreen(clip[0]), toScreen(clip[1]), toScreen(clip[2]));
+            return;
+        }
+
+        if (!in0 && !in1 && !in2)
+            return;
+
+        // 只和近平面（w = 近平面距离）裁剪，一个三角形最多裁出4个顶点
+        Vector4 polygon[4];
+        size_t count = 0;
+
+        size_t i = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            const Vector4 &a = clip[i];
+            const Vector4 &b = clip[(i + 1) % 3];
+            Real da = a.w() - mNearDistance;
+            Real db = b.w() - mNearDistance;
+
+            if (da >= Real(0.0))
+            {
+                polygon[count++] = a;
+            }
+
+            if ((da >= Real(0.0)) != (db >= Real(0.0)))
+            {
+                polygon[count++] = a + (b - a) * (da / (da - db));
+            }
+        }
+
+        Vector3 first = toScreen(polygon[0]);
+        Vector3 prev = toScreen(polygon[1]);
+
+        for (i = 2; i < count; ++i)
+        {
+            Vector3 cur = toScreen(polygon[i]);
+            rasterizeTriangle(first, prev, cur);
+            prev = cur;
+        }
+    }
+
+    Vector3 OcclusionCuller::toScreen(const Vector4 &clip) const
+    {
+        const Level &target = mLevels[0];
+        Real invW = Real(1.0) / clip.w();
+
+        // 屏幕第0行在上面
+        Real x = (clip.x() * invW * Real(0.5) + Real(0.5)) * Real(target.width);
+        Real y = (Real(0.5) - clip.y() * invW * Real(0.5)) * Real(target.height);
+        return Vector3(x, y, clip.z() * invW);
+    }
+
+    void OcclusionCuller::rasterizeTriangle(const Vector3 &v0, const Vector3 &v1, const Vector3 &v2)
+    {
+        Level &target = mLevels[0];
+        const int32_t width = int32_t(target.width);
+        const int32_t height = int32_t(target.height);
+
+        Vector3 a = v0, b = v1, c = v2;
+        Real area = (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+
+        if (Math::Abs(area) <= Real(1e-6))
+            return;
+
+        // 不分正反面，统一成逆时针
+        if (area < Real(0.0))
+        {
+            std::swap(b, c);
+            area = -area;
+        }
+
+        Real fMinX = std::min(a.x(), std::min(b.x(), c.x()));
+        Real fMaxX = std::max(a.x(), std::max(b.x(), c.x()));
+        Real fMinY = std::min(a.y(), std::min(b.y(), c.y()));
+        Real fMaxY = std::max(a.y(), std::max(b.y(), c.y()));
+
+        if (fMaxX < Real(0.0) || fMaxY < Real(0.0)
+            || fMinX >= Real(width) || fMinY >= Real(height))
+            return;
+
+        int32_t minX = std::max(int32_t(floor(fMinX)), 0);
+        int32_t maxX = std::min(int32_t(ceil(std::min(fMaxX, Real(width)))), width - 1);
+        int32_t minY = std::max(int32_t(floor(fMinY)), 0);
+        int32_t maxY = std::min(int32_t(ceil(std::min(fMaxY, Real(height)))), height - 1);
+
+        ++mStatistics.triangles;
+
+        // 三条边的边函数，像素中心在三条边内侧时都不小于0。
+        // 对边b->c的边函数除以面积就是a的重心坐标，其余类推，深度按重心坐标线性插值
+        Real invArea = Real(1.0) / area;
+        Real dx0 = b.y() - c.y(), dy0 = c.x() - b.x();
+        Real dx1 = c.y() - a.y(), dy1 = a.x() - c.x();
+        Real dx2 = a.y() - b.y(), dy2 = b.x() - a.x();
+        Real dzdx = ((b.z() - a.z()) * dx1 + (c.z() - a.z()) * dx2) * invArea;
+        Real dzdy = ((b.z() - a.z()) * dy1 + (c.z() - a.z()) * dy2) * invArea;
+
+        // 从4对齐的列开始，每组4个像素都在缓冲区里
+        int32_t startX = minX & ~3;
+        Real px = Real(startX) + Real(0.5);
+        Real py = Real(minY) + Real(0.5);
+
+        Real e0Row = dy0 * (py - b.y()) + dx0 * (px - b.x());
+        Real e1Row = dy1 * (py - c.y()) + dx1 * (px - c.x());
+        Real e2Row = dy2 * (py - a.y()) + dx2 * (px - a.x());
+        Real zRow = a.z() + ((b.z() - a.z()) * e1Row + (c.z() - a.z()) * e2Row) * invArea;
+
+        int32_t x = 0, y = 0;
+
+#if defined (T3D_OCCLUSION_SSE2)
+        const __m128 offsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 stepE0 = _mm_set1_ps(float(dx0 * 4));
+        const __m128 stepE1 = _mm_set1_ps(float(dx1 * 4));
+        const __m128 stepE2 = _mm_set1_ps(float(dx2 * 4));
+        const __m128 stepZ = _mm_set1_ps(float(dzdx * 4));
+        const __m128 dx0v = _mm_mul_ps(offsets, _mm_set1_ps(float(dx0)));
+        const __m128 dx1v = _mm_mul_ps(offsets, _mm_set1_ps(float(dx1)));
+        const __m128 dx2v = _mm_mul_ps(offsets, _mm_set1_ps(float(dx2)));
+        const __m128 dzv = _mm_mul_ps(offsets, _mm_set1_ps(float(dzdx)));
+
+        for (y = minY; y <= maxY; ++y)
+        {
+            float *row = &target.depth[y * width];
+            __m128 e0 = _mm_add_ps(_mm_set1_ps(float(e0Row)), dx0v);
+            __m128 e1 = _mm_add_ps(_mm_set1_ps(float(e1Row)), dx1v);
+            __m128 e2 = _mm_add_ps(_mm_set1_ps(float(e2Row)), dx2v);
+            __m128 z = _mm_add_ps(_mm_set1_ps(float(zRow)), dzv);
+
+            for (x = startX; x <= maxX; x += 4)
+            {
+                __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero),
+                    _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+
+                if (_mm_movemask_ps(inside) != 0)
+                {
+                    __m128 depth = _mm_loadu_ps(row + x);
+                    __m128 closer = _mm_and_ps(inside, _mm_cmplt_ps(z, depth));
+                    _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(closer, z),
+                        _mm_andnot_ps(closer, depth)));
+                }
+
+                e0 = _mm_add_ps(e0, stepE0);
+                e1 = _mm_add_ps(e1, stepE1);
+                e2 = _mm_add_ps(e2, stepE2);
+                z = _mm_add_ps(z, stepZ);
+            }
+
+            e0Row += dy0;
+            e1Row += dy1;
+            e2Row += dy2;
+            zRow += dzdy;
+        }
+#else
+        for (y = minY; y <= maxY; ++y)
+        {
+            float *row = &target.depth[y * width];
+            Real e0 = e0Row, e1 = e1Row, e2 = e2Row, z = zRow;
+
+            for (x = startX; x <= maxX; ++x)
+            {
+                if (e0 >= Real(0.0) && e1 >= Real(0.0) && e2 >= Real(0.0) && z < row[x])
+                {
+                    row[x] = float(z);
+                }
+
+                e0 += dx0;
+                e1 += dx1;
+                e2 += dx2;
+                z += dzdx;
+            }
+
+            e0Row += dy0;
+            e1Row += dy1;
+            e2Row += dy2;
+            zRow += dzdy;
+        }
+#endif
+    }
+
+    void OcclusionCuller::buildHierarchy()
+    {
+        // 每一级保存上一级2x2里最远的深度，奇数边长的最后一列、一行只取到边上
+        size_t i = 0;
+        for (i = 1; i < mLevels.size(); ++i)
+        {
+            const Level &src = mLevels[i - 1];
+            Level &dst = mLevels[i];
+
+            uint32_t x = 0, y = 0;
+            for (y = 0; y < dst.height; ++y)
+            {
+                const float *row0 = &src.depth[(y * 2) * src.width];
+                const float *row1 = &src.depth[std::min(y * 2 + 1, src.height - 1) * src.width];
+                float *out = &dst.depth[y * dst.width];
+
+                for (x = 0; x < dst.width; ++x)
+                {
+                    uint32_t x0 = x * 2;
+                    uint32_t x1 = std::min(x0 + 1, src.width - 1);
+                    out[x] = std::max(std::max(row0[x0], row0[x1]), std::max(row1[x0], row1[x1]));
+                }
+            }
+        }
+    }
+
+    bool OcclusionCuller::isOccluded(const Aabb &box)
+    {
+        ++mStatistics.tested;
+
+        const Level &base = mLevels[0];
+        Real minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+        Real maxX = -FLT_MAX, maxY = -FLT_MAX;
+
+        uint32_t i = 0;
+        for (i = 0; i < 8; ++i)
+        {
+            Vector4 corner((i & 1) ? box.getMaxX() : box.getMinX(),
+                (i & 2) ? box.getMaxY() : box.getMinY(),
+                (i & 4) ? box.getMaxZ() : box.getMinZ(), Real(1.0));
+            Vector4 clip = mViewProj * corner;
+
+            // 越过近平面的投影不可靠，当作可见
+            if (clip.w() < mNearDistance)
+                return false;
+
+            Vector3 pos = toScreen(clip);
+            minX = std::min(minX, pos.x());
+            maxX = std::max(maxX, pos.x());
+            minY = std::min(minY, pos.y());
+            maxY = std::max(maxY, pos.y());
+            minZ = std::min(minZ, pos.z());
+        }
+
+        // 在屏幕外的交给视景体剔除
+        if (maxX < Real(0.0) || maxY < Real(0.0)
+            || minX >= Real(base.width) || minY >= Real(base.height))
+            return false;
+
+        int32_t x0 = int32_t(std::max(minX, Real(0.0)));
+        int32_t y0 = int32_t(std::max(minY, Real(0.0)));
+        int32_t x1 = int32_t(std::min(maxX, Real(base.width - 1)));
+        int32_t y1 = int32_t(std::min(maxY, Real(base.height - 1)));
+
+        // 找覆盖范围不超过E_MAX_TEST_TEXELS x E_MAX_TEST_TEXELS的那一级
+        uint32_t level = 0;
+        while (level + 1 < mLevels.size()
+            && ((x1 >> level) - (x0 >> level) >= E_MAX_TEST_TEXELS
+            || (y1 >> level) - (y0 >> level) >= E_MAX_TEST_TEXELS))
+        {
+            ++level;
+        }
+
+        const Level &hiz = mLevels[level];
+        int32_t tx = 0, ty = 0;
+
+        for (ty = (y0 >> level); ty <= (y1 >> level); ++ty)
+        {
+            const float *row = &hiz.depth[ty * hiz.width];
+
+            for (tx = (x0 >> level); tx <= (x1 >> level); ++tx)
+            {
+                // 有一个texel比包围盒最近的地方还远，就可能看得见
+                if (row[tx] >= minZ)
+                    return false;
+            }
+        }
+
+        ++mStatistics.rejected;
+        return true;
+    }
+
+    bool OcclusionCuller::dumpDepth(const String &path, uint32_t level /* = 0 */) const
+    {
+        if (level >= mLevels.size())
+            return false;
+
+        const Level &src = mLevels[level];
+        float nearest = FLT_MAX, farthest = -FLT_MAX;
+
+        std::vector<float>::const_iterator itr = src.depth.begin();
+        while (itr != src.depth.end())
+        {
+            if (*itr < FLT_MAX)
+            {
+                nearest = std::min(nearest, *itr);
+                farthest = std::max(farthest, *itr);
+            }
+
+            ++itr;
+        }
+
+        // 有遮挡体覆盖的映射到1~255，越近越亮
+        std::vector<uint8_t> pixels(src.depth.size(), 0);
+        float range = farthest - nearest;
+        size_t i = 0;
+
+        for (i = 0; i < src.depth.size(); ++i)
+        {
+            float d = src.depth[i];
+
+            if (d < FLT_MAX)
+            {
+                float t = (range > 0.0f ? (d - nearest) / range : 0.0f);
+                pixels[i] = uint8_t(255.0f - t * 254.0f);
+            }
+        }
+
+        FileDataStream fs;
+
+        if (!fs.open(path.c_str(), FileDataStream::E_MODE_WRITE_ONLY))
+        {
+            T3D_LOG_ERROR("Open file %s failed when dumping occlusion depth !", path.c_str());
+            return false;
+        }
+
+        char header[64];
+        int len = snprintf(header, sizeof(header), "P5\n%u %u\n255\n", src.width, src.height);
+        fs.write(header, size_t(len));
+        fs.write(&pixels[0], pixels.size());
+        fs.close();
+
+        return true;
+    }
+}
@@ -0,0 +1,373 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Render/T3DOverlayBatcher.h"
+#include "Render/T3DVertexData.h"
+#include "Render/T3DIndexData.h"
+#include "Render/T3DHardwareVertexBuffer.h"
+#include "Render/T3DHardwareIndexBuffer.h"
+#include "Render/T3DHardwareBufferManager.h"
+#include "Resource/T3DMaterial.h"
+#include "SceneGraph/T3DSGRenderable.h"
+
+
+namespace Tiny3D
+{
+    OverlayBatcherPtr OverlayBatcher::create()
+    {
+        OverlayBatcher *batcher = new OverlayBatcher();
+        OverlayBatcherPtr ptr(batcher);
+        batcher->release();
+        return ptr;
+    }
+
+    OverlayBatcher::OverlayBatcher()
+        : mQuadCount(0)
+        , mCapacity(0)
+    {
+
+    }
+
+    OverlayBatcher::~OverlayBatcher()
+    {
+
+    }
+
+    void OverlayBatcher::transformQuads(const OverlayVertex *src, size_t count,
+        const Matrix4 &world, OverlayVertex *dst)
+    {
+        size_t i = 0;
+        while (i < count)
+        {
+            dst[i].position = world.transformAffine(src[i].position);
+            dst[i].diffuse = src[i].diffuse;
+            dst[i].texcoord = src[i].texcoord;
+            ++i;
+        }
+    }
+
+    VertexDeclarationPtr OverlayBatcher::createDeclaration()
+    {
+        VertexDeclarationPtr decl = T3D_HARDWARE_BUFFER_MGR.createVertexDeclaration();
+        size_t offset = 0;
+        const VertexElement &posElem = decl->addElement(0, offset, VertexElement::E_VET_FLOAT3, VertexElement::E_VES_POSITION);
+        offset += posElem.getSize();
+        const VertexElement &colorElem = decl->addElement(0, offset, VertexElement::E_VET_COLOR, VertexElement::E_VES_DIFFUSE);
+        offset += colorElem.getSize();
+        decl->addElement(0, offset, VertexElement::E_VET_FLOAT2, VertexElement::E_VES_TEXCOORD);
+        return decl;
+    }
+
+    HardwareIndexBufferPtr OverlayBatcher::createQuadIndices(size_t quadCount, HardwareBuffer::Usage usage)
+    {
+        size_t indexCount = quadCount * 6;
+        bool is16Bits = (quadCount * 4 <= 0x10000);
+        HardwareIndexBufferPtr indexBuffer = T3D_HARDWARE_BUFFER_MGR.createIndexBuffer(
+            is16Bits ? HardwareIndexBuffer::E_IT_16BITS : HardwareIndexBuffer::E_IT_32BITS,
+            indexCount, usage, false);
+
+        if (indexBuffer == nullptr)
+            return nullptr;
+
+        /// 每个四边形两个三角形：左上、左下、右上和左下、右下、右上
+        static const uint32_t pattern[6] = { 0, 1, 2, 1, 3, 2 };
+        bool ret = false;
+
+        if (is16Bits)
+        {
+            std::vector<uint16_t> indices(indexCount);
+            size_t i = 0;
+            while (i < indexCount)
+            {
+                indices[i] = uint16_t((i / 6) * 4 + pattern[i % 6]);
+                ++i;
+            }
+            ret = indexBuffer->writeData(0, indexCount * sizeof(uint16_t), &indices[0]);
+        }
+        else
+        {
+            std::vector<uint32_t> indices(indexCount);
+            size_t i = 0;
+            while (i < indexCount)
+            {
+                indices[i] = uint32_t((i / 6) * 4 + pattern[i % 6]);
+                ++i;
+            }
+            ret = indexBuffer->writeData(0, indexCount * sizeof(uint32_t), &indices[0]);
+        }
+
+        return (ret ? indexBuffer : nullptr);
+    }
+
+    bool OverlayBatcher::createQuadBuffers(const OverlayVertexArray &vertices,
+        VertexDataPtr &vertexData, IndexDataPtr &indexData)
+    {
+        vertexData = nullptr;
+        indexData = nullptr;
+
+        size_t vertexCount = vertices.size();
+        if (vertexCount < 4)
+            return false;
+
+        HardwareVertexBufferPtr vb = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(sizeof(OverlayVertex),
+            vertexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
+        if (vb == nullptr || !vb->writeData(0, vertexCount * sizeof(OverlayVertex), &vertices[0]))
+            return false;
+
+        HardwareIndexBufferPtr ib = createQuadIndices(vertexCount / 4, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY);
+        if (ib == nullptr)
+            return false;
+
+        vertexData = VertexData::create(createDeclaration());
+        vertexData->addVertexBuffer(vb);
+        indexData = IndexData::create(ib);
+        return true;
+    }
+
+    bool OverlayBatcher::reserve(size_t quadCount)
+    {
+        if (quadCount <= mCapacity && mVertexData != nullptr)
+            return true;
+
+        size_t capacity = (mCapacity > 0 ? mCapacity : E_MIN_CAPACITY);
+        while (capacity < quadCount)
+        {
+            capacity *= 2;
+        }
+
+        HardwareVertexBufferPtr vb = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(sizeof(OverlayVertex),
+            capacity * 4, HardwareBuffer::E_HBU_DYNAMIC_WRITE_ONLY, false);
+        HardwareIndexBufferPtr ib = createQuadIndices(capacity, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY);
+
+        if (vb == nullptr || ib == nullptr)
+        {
+            T3D_LOG_ERROR("Create overlay batch buffers for %u quads failed !", uint32_t(capacity));
+            return false;
+        }
+
+        mVertexData = VertexData::create(createDeclaration());
+        mVertexData->addVertexBuffer(vb);
+        mIndexData = IndexData::create(ib);
+        mCapacity = capacity;
+        return true;
+    }
+
+    void OverlayBatcher::build(RenderItemList &items, size_t first, size_t count,
+        const RenderableArray &renderables, RenderPacketArray &packets)
+    {
+        mBatches.clear();
+        mEntries.clear();
+        mBatchItems.clear();
+        mQuadCount = 0;
+
+        if (count == 0)
+            return;
+
+        const uint64_t groupKey = items[first].key & ~((1ULL << RenderQueue::E_KEY_GROUP_SHIFT) - 1);
+
+        /// 第一遍：按叠放次序填写世界空间顶点，并把每个渲染项分到批次里
+        size_t searchStart = 0;
+        size_t vertexCount = 0;
+        size_t i = 0;
+
+        for (i = 0; i < count; ++i)
+        {
+            const RenderItem &item = items[first + i];
+            SGRenderable *renderable = renderables[item.index];
+
+            if (!renderable->isOverlayBatchable())
+            {
+                /// 不知道它在屏幕上的范围，当成遮住全部，后面的四边形不能越过它
+                Batch batch;
+                batch.material = nullptr;
+                batch.item = uint32_t(first + i);
+                batch.firstQuad = 0;
+                batch.quadCount = 0;
+                batch.left = batch.top = batch.right = batch.bottom = Real(0.0);
+                mBatches.push_back(batch);
+                searchStart = mBatches.size();
+                continue;
+            }
+
+            size_t quadCount = renderable->getOverlayQuadCount();
+            MaterialPtr material = renderable->getMaterial();
+
+            if (quadCount == 0 || material == nullptr)
+                continue;
+
+            mScratch.resize(vertexCount + quadCount * 4);
+            OverlayVertex *vertices = &mScratch[vertexCount];
+            renderable->fillOverlayQuads(vertices);
+
+            Real left = vertices[0].position.x();
+            Real right = left;
+            Real bottom = vertices[0].position.y();
+            Real top = bottom;
+            size_t k = 1;
+            while (k < quadCount * 4)
+            {
+                const Vector3 &pos = vertices[k].position;
+                left = std::min(left, pos.x());
+                right = std::max(right, pos.x());
+                bottom = std::min(bottom, pos.y());
+                top = std::max(top, pos.y());
+                ++k;
+            }
+
+            /// 往前找相同材质的批次，中间隔着的批次都不能和它重叠
+            size_t target = mBatches.size();
+            size_t b = mBatches.size();
+            size_t stop = std::max(searchStart,
+                (mBatches.size() > E_MAX_LOOKBACK ? mBatches.size() - E_MAX_LOOKBACK : size_t(0)));
+
+            while (b > stop)
+            {
+                const Batch &batch = mBatches[b - 1];
+
+                if (batch.material == (Material *)material)
+                {
+                    target = b - 1;
+                    break;
+                }
+
+                if (batch.left <= right && left <= batch.right
+                    && batch.bottom <= top && bottom <= batch.top)
+                {
+                    break;
+                }
+
+                --b;
+            }
+
+            if (target == mBatches.size())
+            {
+                Batch batch;
+                batch.material = material;
+                batch.item = uint32_t(first + i);
+                batch.firstQuad = 0;
+                batch.quadCount = 0;
+                batch.left = left;
+                batch.top = top;
+                batch.right = right;
+                batch.bottom = bottom;
+                mBatches.push_back(batch);
+            }
+            else
+            {
+                Batch &batch = mBatches[target];
+                batch.left = std::min(batch.left, left);
+                batch.top = std::max(batch.top, top);
+                batch.right = std::max(batch.right, right);
+                batch.bottom = std::min(batch.bottom, bottom);
+            }
+
+            mBatches[target].quadCount += uint32_t(quadCount);
+
+            Entry entry;
+            entry.batch = uint32_t(target);
+            entry.firstVertex = uint32_t(vertexCount);
+            entry.quadCount = uint32_t(quadCount);
+            mEntries.push_back(entry);
+
+            vertexCount += quadCount * 4;
+            mQuadCount += quadCount;
+        }
+
+        if (mQuadCount > 0 && !reserve(mQuadCount))
+        {
+            /// 没有缓冲可用，只保留不合批的渲染项
+            mQuadCount = 0;
+        }
+
+        /// 第二遍：按批次顺序给每个批次分配缓冲位置，再把顶点重排到批次里
+        uint32_t quad = 0;
+        BatchArray::iterator itr = mBatches.begin();
+        while (itr != mBatches.end())
+        {
+            itr->firstQuad = quad;
+            quad += itr->quadCount;
+            ++itr;
+        }
+
+        if (mQuadCount > 0)
+        {
+            mVertices.resize(mQuadCount * 4);
+
+            /// firstQuad作为写入游标，写完再还原
+            EntryArray::const_iterator e = mEntries.begin();
+            while (e != mEntries.end())
+            {
+                Batch &batch = mBatches[e->batch];
+                memcpy(&mVertices[batch.firstQuad * 4], &mScratch[e->firstVertex],
+                    e->quadCount * 4 * sizeof(OverlayVertex));
+                batch.firstQuad += e->quadCount;
+                ++e;
+            }
+
+            itr = mBatches.begin();
+            while (itr != mBatches.end())
+            {
+                itr->firstQuad -= itr->quadCount;
+                ++itr;
+            }
+
+            HardwareVertexBufferPtr &vb = mVertexData->getVertexBuffer(0);
+            vb->writeData(0, mQuadCount * 4 * sizeof(OverlayVertex), &mVertices[0], true);
+        }
+
+        /// 第三遍：生成批次的渲染包和渲染项，替换原来的覆盖层渲染项
+        itr = mBatches.begin();
+        while (itr != mBatches.end())
+        {
+            const Batch &batch = *itr;
+            ++itr;
+
+            if (batch.material == nullptr)
+            {
+                /// 原样保留的渲染项
+                mBatchItems.push_back(items[batch.item]);
+                continue;
+            }
+
+            if (mQuadCount == 0 || batch.quadCount == 0)
+                continue;
+
+            RenderPacket packet;
+            packet.renderable = renderables[items[batch.item].index];
+            packet.material = batch.material;
+            packet.vertexData = mVertexData;
+            packet.indexData = mIndexData;
+            packet.world = &Matrix4::IDENTITY;
+            packet.primitiveType = Renderer::E_PT_TRIANGLE_LIST;
+            packet.primitiveCount = batch.quadCount * 2;
+            packet.startIndex = batch.firstQuad * 6;
+
+            RenderItem item;
+            item.key = groupKey;
+            item.index = uint32_t(packets.size());
+            packets.push_back(packet);
+            mBatchItems.push_back(item);
+        }
+
+        /// 覆盖层渲染项换成批次渲染项
+        RenderItemListItr begin = items.begin() + first;
+        items.erase(begin, begin + count);
+        items.insert(items.begin() + first, mBatchItems.begin(), mBatchItems.end());
+    }
+}
@@ -19,6 +19,7 @@
 
 #include "Render/T3DRenderQueue.h"
 #include "Render/T3DRenderer.h"
+#include "Render/T3DOverlayBatcher.h"
 #include "Resource/T3DMaterial.h"
 #include "SceneGraph/T3DSGRenderable.h"
 #include "SceneGraph/T3DSGCamera.h"
@@ -28,7 +29,8 @@
 
 namespace Tiny3D
 {
-    RenderGroup::RenderGroup()
+    RenderGroup::RenderGroup(uint32_t groupID)
+        : mGroupID(groupID)
     {
 
     }
@@ -38,127 +40,108 @@ namespace Tiny3D
 
     }
 
-    void RenderGroup::addRenderable(const MaterialPtr &material, const SGRenderablePtr &renderable)
+    void RenderGroup::record(CommandList *list, const RenderView &view, const RenderItem *items,
+        size_t count, const RenderPacketArray &packets) const
     {
-        RenderablesItr itr = mRenderables.find(material);
-
-        if (itr != mRenderables.end())
+        if (RenderQueue::E_GRPID_OVERLAY == mGroupID)
         {
-            /// ͬʵģŵͬȾб
-            RenderableList &renderables = itr->second;
-            renderables.push_back(renderable);
+            list->setTransform(Renderer::E_TS_VIEW, Matrix4::IDENTITY);
+            list->setTransform(Renderer::E_TS_PROJECTION, view.overlayProjection);
         }
         else
         {
-            /// ûͬʵģ¼һȾб
-            RenderableList renderables(1, renderable);
-            mRenderables.insert(RenderablesValue(material, renderables));
-        }
-    }
-
-    void RenderGroup::clear()
-    {
-        mRenderables.clear();
-    }
-
-    void RenderGroup::render(uint32_t groupID, const RendererPtr &renderer)
-    {
-        Renderer::RenderMode renderMode;
-        if (RenderQueue::E_GRPID_OVERLAY == groupID)
-        {
-            renderer->getViewport()->getCamera()->setProjectionType(SGCamera::E_PT_ORTHOGRAPHIC);
-            renderer->setViewTransform(Matrix4::IDENTITY);
-            renderer->getViewport()->getCamera()->getProjectionMatrix();
-        }
-        else
-        {
-            if (RenderQueue::E_GRPID_INDICATOR == groupID)
+            if (RenderQueue::E_GRPID_INDICATOR == mGroupID)
             {
-                renderMode = renderer->getRenderMode();
-                renderer->setRenderMode(Renderer::E_RM_WIREFRAME);
+                list->pushRenderMode(Renderer::E_RM_WIREFRAME);
             }
 
-            renderer->getViewport()->getCamera()->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
-            renderer->getViewport()->getCamera()->getViewMatrix();
-            renderer->getViewport()->getCamera()->getProjectionMatrix();
+            /// 重复设置的矩阵在回放时由渲染器状态缓存过滤
+            list->setTransform(Renderer::E_TS_VIEW, view.view);
+            list->setTransform(Renderer::E_TS_PROJECTION, view.projection);
         }
 
-        if (RenderQueue::E_GRPID_LIGHT != groupID)
+        if (RenderQueue::E_GRPID_LIGHT != mGroupID)
         {
-            RenderablesItr itr = mRenderables.begin();
+            size_t i = 0;
 
-            while (itr != mRenderables.end())
+            while (i < count)
             {
-                MaterialPtr material = itr->first;
-                renderer->setMaterial(material);
+                const RenderPacket &packet = packets[items[i].index];
 
-                RenderableList &renderables = itr->second;
+                /// 排序后相同材质的渲染对象相邻，重复的材质设置由渲染器过滤
+                list->setMaterial(packet.material);
 
-                RenderableListItr i = renderables.begin();
+                /// 找出后面连续使用相同顶点、索引数据和材质的渲染对象
+                size_t last = i + 1;
 
-                while (i != renderables.end())
+                if (packet.indexData != nullptr)
                 {
-                    SGRenderablePtr &renderable = *i;
-                    const Matrix4 &m = renderable->getWorldMatrix();
-                    renderer->setWorldTransform(m);
-
-                    VertexDataPtr vertexData =renderable->getVertexData();
-                    IndexDataPtr indexData = renderable->getIndexData();
+                    while (last < count && canInstance(packet, packets[items[last].index]))
+                    {
+                        ++last;
+                    }
+                }
 
-                    Renderer::PrimitiveType priType = renderable->getPrimitiveType();
-                    bool useIndices = renderable->isIndicesUsed();
+                if (last - i >= E_MIN_INSTANCE_COUNT)
+                {
+                    Matrix4 *matrices = list->drawIndexListInstanced(packet.primitiveType,
+                        packet.vertexData, packet.indexData, packet.startIndex, packet.primitiveCount, last - i);
 
-                    size_t primitiveCount = calcPrimitiveCount(priType, 
-                        useIndices ? indexData->getIndexBuffer()->getIndexCount() : 0, 
-                        vertexData->getVertexBuffer(0)->getVertexCount(),
-                        useIndices);
+                    size_t k = i;
+                    while (k < last)
+                    {
+                        *matrices++ = *packets[items[k].index].world;
+                        ++k;
+                    }
+                }
+                else
+                {
+                    list->setTransform(Renderer::E_TS_WORLD, *packet.world);
 
-                    if (useIndices)
+                    if (packet.indexData != nullptr)
                     {
-                        renderer->drawIndexList(priType, vertexData, indexData, 0, primitiveCount);
+                        list->drawIndexList(packet.primitiveType, packet.vertexData, 
+                            packet.indexData, packet.startIndex, packet.primitiveCount);
                     }
                     else
                     {
-                        renderer->drawVertexList(priType, vertexData, 0, primitiveCount);
+                        list->drawVertexList(packet.primitiveType, packet.vertexData, 
+                            0, packet.primitiveCount);
                     }
-
-                    T3D_ENTRANCE.addBatchCounter();
-                    ++i;
                 }
 
-                ++itr;
+                i = last;
             }
         }
         else
         {
-            size_t index = 0;
-            RenderablesItr itr = mRenderables.begin();
+            size_t i = 0;
 
-            while (itr != mRenderables.end())
+            while (i < count)
             {
-                RenderableList &renderables = itr->second;
-
-                RenderableListItr i = renderables.begin();
-
-                while (i != renderables.end())
-                {
-                    SGLightPtr light = smart_pointer_cast<SGLight>(*i);
-                    renderer->addDynamicLight(index, light);
-                    ++index;
-                    ++i;
-                }
-                
-                ++itr;
+                SGLight *light = (SGLight *)packets[items[i].index].renderable;
+                list->addDynamicLight(i, light);
+                ++i;
             }
         }
 
-        if (RenderQueue::E_GRPID_INDICATOR == groupID)
+        if (RenderQueue::E_GRPID_INDICATOR == mGroupID)
         {
-            renderer->setRenderMode(renderMode);
+            list->popRenderMode();
         }
     }
 
-    size_t RenderGroup::calcPrimitiveCount(Renderer::PrimitiveType priType, size_t indexCount, size_t vertexCount, bool useIndex)
+    bool RenderGroup::canInstance(const RenderPacket &a, const RenderPacket &b)
+    {
+        return (a.indexData != nullptr
+            && a.vertexData == b.vertexData
+            && a.indexData == b.indexData
+            && a.startIndex == b.startIndex
+            && a.material == b.material
+            && a.primitiveType == b.primitiveType);
+    }
+
+    uint32_t RenderGroup::calcPrimitiveCount(Renderer::PrimitiveType priType, size_t indexCount, size_t vertexCount, bool useIndex)
     {
         size_t primCount = 0;
         switch (priType)
@@ -188,7 +171,7 @@ namespace Tiny3D
             break;
         }
 
-        return primCount;
+        return (uint32_t)primCount;
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -202,51 +185,581 @@ namespace Tiny3D
     }
 
     RenderQueue::RenderQueue()
+        : mSubmitCount(0)
+        , mIsRetained(false)
+        , mIsOverlayBatching(true)
+        , mOverlayBatcher(OverlayBatcher::create())
     {
+        memset(mSortPolicies, E_SP_MATERIAL_FIRST, sizeof(mSortPolicies));
+        mSortPolicies[E_GRPID_SOLID] = E_SP_FRONT_TO_BACK;
+        mSortPolicies[E_GRPID_TRANSPARENT] = E_SP_BACK_TO_FRONT;
+        mSortPolicies[E_GRPID_TRANSPARENT_EFFECT] = E_SP_BACK_TO_FRONT;
+        mSortPolicies[E_GRPID_OVERLAY] = E_SP_SUBMISSION_ORDER;
+    }
 
+    void RenderQueue::setSortPolicy(GroupID groupID, SortPolicy policy)
+    {
+        mSortPolicies[groupID & 0xFF] = (uint8_t)policy;
     }
 
     RenderQueue::~RenderQueue()
     {
+        setRetainedMode(false);
+    }
+
+    uint64_t RenderQueue::makeKey(uint32_t groupID, SGRenderable *renderable)
+    {
+        uint64_t materialID = 0;
+        uint64_t vbID = 0;
 
+        if (E_GRPID_LIGHT != groupID)
+        {
+            MaterialPtr material = renderable->getMaterial();
+            if (material != nullptr)
+            {
+                materialID = material->getID();
+            }
+
+            /// 顶点缓冲没有ID，用缓冲地址散列出来，只用于让相同缓冲的渲染对象排在一起
+            VertexDataPtr vertexData = renderable->getVertexData();
+            if (vertexData != nullptr && vertexData->getVertexBufferCount() > 0)
+            {
+                uintptr_t addr = (uintptr_t)(HardwareVertexBuffer *)vertexData->getVertexBuffer(0);
+                vbID = uint64_t((addr >> 4) ^ (addr >> 20));
+            }
+        }
+
+        return (uint64_t(groupID) << E_KEY_GROUP_SHIFT)
+            | ((materialID & ((1ULL << E_KEY_MATERIAL_BITS) - 1)) << E_KEY_MATERIAL_SHIFT)
+            | ((vbID & ((1ULL << E_KEY_VB_BITS) - 1)) << E_KEY_VB_SHIFT);
     }
 
     void RenderQueue::addRenderable(GroupID groupID, const SGRenderablePtr &renderable)
     {
-        RenderableGroupItr itr = mGroups.find(groupID);
+        uint32_t slot = renderable->mQueueSlot;
 
-        if (itr != mGroups.end())
+        if (slot != E_INVALID_SLOT)
         {
-            /// ѾȾ
-            RenderGroupPtr &group = itr->second;
-            group->addRenderable(renderable->getMaterial(), renderable);
+            /// 常驻渲染对象，只在分组、材质或者顶点缓冲变化时重建排序键，其余只设置可见标记
+            uint32_t stamp = 0;
+            const void *buffer = nullptr;
+
+            if (E_GRPID_LIGHT != groupID)
+            {
+                MaterialPtr material = renderable->getMaterial();
+                if (material != nullptr)
+                {
+                    stamp = material->getChangeStamp();
+                }
+
+                VertexDataPtr vertexData = renderable->getVertexData();
+                if (vertexData != nullptr && vertexData->getVertexBufferCount() > 0)
+                {
+                    buffer = (HardwareVertexBuffer *)vertexData->getVertexBuffer(0);
+                }
+            }
+
+            uint64_t &key = mRetainedKeys[slot];
+            if (key == 0 || getGroupID(key) != uint32_t(groupID)
+                || mRetainedStamps[slot] != stamp || mRetainedBuffers[slot] != buffer)
+            {
+                key = makeKey(groupID, renderable);
+                mRetainedStamps[slot] = stamp;
+                mRetainedBuffers[slot] = buffer;
+            }
+
+            mVisibility[slot] = 1;
+            mRetainedOrders[slot] = mSubmitCount++;
+            return;
         }
-        else
+
+        RenderItem item;
+        item.key = makeKey(groupID, renderable);
+        item.index = (uint32_t)mRenderables.size();
+
+        mRenderables.push_back(renderable);
+        mItems.push_back(item);
+        mOrders.push_back(mSubmitCount++);
+    }
+
+    void RenderQueue::setRetainedMode(bool enable)
+    {
+        if (enable == mIsRetained)
+            return;
+
+        mIsRetained = enable;
+
+        if (!enable)
         {
-            /// Ⱦ
-            RenderGroup *group = new RenderGroup();
+            RenderableArrayItr itr = mRetainedObjects.begin();
+
+            while (itr != mRetainedObjects.end())
+            {
+                (*itr)->mQueueSlot = E_INVALID_SLOT;
+                ++itr;
+            }
+
+            mRetainedObjects.clear();
+            mRetainedKeys.clear();
+            mRetainedStamps.clear();
+            mRetainedBuffers.clear();
+            mVisibility.clear();
+            mRetainedOrders.clear();
+        }
+    }
+
+    void RenderQueue::registerRenderable(SGRenderable *renderable)
+    {
+        if (!mIsRetained || renderable->mQueueSlot != E_INVALID_SLOT)
+            return;
+
+        renderable->mQueueSlot = (uint32_t)mRetainedObjects.size();
+        mRetainedObjects.push_back(renderable);
+        /// 排序键在第一次被裁剪加入队列时才构造，这时才知道分组
+        mRetainedKeys.push_back(0);
+        mRetainedStamps.push_back(0);
+        mRetainedBuffers.push_back(nullptr);
+        mVisibility.push_back(0);
+        mRetainedOrders.push_back(0);
+    }
+
+    void RenderQueue::unregisterRenderable(SGRenderable *renderable)
+    {
+        uint32_t slot = renderable->mQueueSlot;
+
+        if (slot == E_INVALID_SLOT)
+            return;
+
+        T3D_ASSERT(slot < mRetainedObjects.size() && mRetainedObjects[slot] == renderable);
+
+        /// 用最后一个填补空位，保持数组紧密
+        uint32_t last = (uint32_t)mRetainedObjects.size() - 1;
+        if (slot != last)
+        {
+            SGRenderable *moved = mRetainedObjects[last];
+            mRetainedObjects[slot] = moved;
+            mRetainedKeys[slot] = mRetainedKeys[last];
+            mRetainedStamps[slot] = mRetainedStamps[last];
+            mRetainedBuffers[slot] = mRetainedBuffers[last];
+            mVisibility[slot] = mVisibility[last];
+            mRetainedOrders[slot] = mRetainedOrders[last];
+            moved->mQueueSlot = slot;
+        }
+
+        mRetainedObjects.pop_back();
+        mRetainedKeys.pop_back();
+        mRetainedStamps.pop_back();
+        mRetainedBuffers.pop_back();
+        mVisibility.pop_back();
+        mRetainedOrders.pop_back();
+
+        renderable->mQueueSlot = E_INVALID_SLOT;
+    }
+
+    void RenderQueue::collectRetained()
+    {
+        const size_t count = mRetainedObjects.size();
+        size_t i = 0;
+
+        while (i < count)
+        {
+            if (mVisibility[i])
+            {
+                RenderItem item;
+                item.key = mRetainedKeys[i];
+                item.index = (uint32_t)mRenderables.size();
+                mRenderables.push_back(mRetainedObjects[i]);
+                mItems.push_back(item);
+                mOrders.push_back(mRetainedOrders[i]);
+                mVisibility[i] = 0;
+            }
+
+            ++i;
+        }
+    }
+
+    void RenderQueue::clear()
+    {
+        /// 只清空内容，保留容量，下一帧不再重新分配内存
+        mItems.clear();
+        mRenderables.clear();
+        mOrders.clear();
+        mSubmitCount = 0;
+    }
+
+    void RenderQueue::computeViewDepth(const Real *x, const Real *y, const Real *z, size_t count,
+        const Matrix4 &view, Real nearDist, Real scale, Real *depth)
+    {
+        /// 右手坐标系，相机看向-z，看得见的点视空间z是负的，取反得到到相机的距离
+        const Real m0 = -view[2][0];
+        const Real m1 = -view[2][1];
+        const Real m2 = -view[2][2];
+        const Real m3 = -view[2][3] - nearDist;
+        const Real zero = Real(0.0);
+        const Real one = Real(1.0);
+
+        size_t i = 0;
+        for (i = 0; i < count; ++i)
+        {
+            Real d = (m0 * x[i] + m1 * y[i] + m2 * z[i] + m3) * scale;
+            d = (d < zero ? zero : d);
+            depth[i] = (d > one ? one : d);
+        }
+    }
+
+    void RenderQueue::fillDepth(const RendererPtr &renderer)
+    {
+        const size_t count = mItems.size();
+
+        mPackets.resize(mRenderables.size());
+        mPosX.resize(count);
+        mPosY.resize(count);
+        mPosZ.resize(count);
+        mDepths.resize(count);
+
+        /// 覆盖层合批只在按提交顺序排序时进行，其他顺序无法保证叠放次序
+        const bool isBatching = (mIsOverlayBatching
+            && mSortPolicies[E_GRPID_OVERLAY] == E_SP_SUBMISSION_ORDER);
+
+        /// 第一遍：取出渲染包和世界平移。渲染对象的虚函数和智能指针都只在渲染线程上访问，录制线程只读渲染包
+        size_t i = 0;
+        for (i = 0; i < count; ++i)
+        {
+            const RenderItem &item = mItems[i];
+            SGRenderable *renderable = mRenderables[item.index];
+            RenderPacket &packet = mPackets[item.index];
+            packet.renderable = renderable;
+            packet.startIndex = 0;
+
+            uint32_t groupID = getGroupID(item.key);
+
+            if (E_GRPID_OVERLAY == groupID && isBatching && renderable->isOverlayBatchable())
+            {
+                /// 合批的精灵和文字在排序后由合批器生成渲染包，这里不取它们的缓冲
+                packet.material = renderable->getMaterial();
+                packet.vertexData = nullptr;
+                packet.indexData = nullptr;
+                packet.world = &Matrix4::IDENTITY;
+                packet.primitiveType = Renderer::E_PT_TRIANGLE_LIST;
+                packet.primitiveCount = 0;
+                mPosX[i] = mPosY[i] = mPosZ[i] = Real(0.0);
+            }
+            else if (E_GRPID_LIGHT != groupID)
+            {
+                VertexDataPtr vertexData = renderable->getVertexData();
+                IndexDataPtr indexData = renderable->getIndexData();
+                bool useIndices = renderable->isIndicesUsed();
+
+                packet.material = renderable->getMaterial();
+                packet.vertexData = vertexData;
+                packet.indexData = (useIndices ? (IndexData *)indexData : nullptr);
+                packet.world = &renderable->getWorldMatrix();
+                packet.primitiveType = renderable->getPrimitiveType();
+                packet.primitiveCount = RenderGroup::calcPrimitiveCount(packet.primitiveType,
+                    useIndices ? indexData->getIndexBuffer()->getIndexCount() : 0,
+                    vertexData->getVertexBuffer(0)->getVertexCount(),
+                    useIndices);
+
+                /// 只取世界矩阵平移部分计算深度
+                const Matrix4 &m = *packet.world;
+                mPosX[i] = m[0][3];
+                mPosY[i] = m[1][3];
+                mPosZ[i] = m[2][3];
+            }
+            else
+            {
+                mPosX[i] = mPosY[i] = mPosZ[i] = Real(0.0);
+            }
+        }
+
+        SGCameraPtr camera = renderer->getViewport()->getCamera();
+        buildDepthKeys(camera->getViewMatrix(), camera->getNearPlaneDistance(), camera->getFarPlaneDistance());
+    }
+
+    void RenderQueue::buildDepthKeys(const Matrix4 &view, Real nearDist, Real farDist)
+    {
+        const size_t count = mItems.size();
+
+        Real range = farDist - nearDist;
+        Real scale = (range > Real(0.0) ? Real(1.0) / range : Real(0.0));
+
+        /// 第二遍：批量计算视空间深度
+        if (count > 0)
+        {
+            computeViewDepth(&mPosX[0], &mPosY[0], &mPosZ[0], count, view, nearDist, scale, &mDepths[0]);
+        }
+
+        /// 第三遍：按分组的排序策略重新组合排序键
+        const uint64_t maxDepth = (1ULL << E_KEY_DEPTH_BITS) - 1;
+        const uint64_t materialMask = (1ULL << E_KEY_MATERIAL_BITS) - 1;
+        const uint64_t vbMask = (1ULL << E_KEY_VB_BITS) - 1;
+        const uint64_t fineMask = (1ULL << E_KEY_F2B_FINE_BITS) - 1;
+
+        size_t i = 0;
+        for (i = 0; i < count; ++i)
+        {
+            RenderItem &item = mItems[i];
+
+            uint32_t groupID = getGroupID(item.key);
+            uint64_t materialID = (item.key >> E_KEY_MATERIAL_SHIFT) & materialMask;
+            uint64_t vbID = (item.key >> E_KEY_VB_SHIFT) & vbMask;
+            uint64_t depth = 0;
+
+            if (E_GRPID_LIGHT != groupID && E_GRPID_OVERLAY != groupID)
+            {
+                depth = uint64_t(mDepths[i] * Real(maxDepth));
+            }
+
+            uint64_t key = uint64_t(groupID) << E_KEY_GROUP_SHIFT;
+
+            switch (mSortPolicies[groupID & 0xFF])
+            {
+            case E_SP_FRONT_TO_BACK:
+                key |= ((depth >> E_KEY_F2B_FINE_BITS) << E_KEY_F2B_COARSE_SHIFT)
+                    | (materialID << E_KEY_F2B_MATERIAL_SHIFT)
+                    | (vbID << E_KEY_F2B_VB_SHIFT)
+                    | ((depth & fineMask) << E_KEY_F2B_FINE_SHIFT);
+                break;
+            case E_SP_BACK_TO_FRONT:
+                key |= ((maxDepth - depth) << E_KEY_B2F_DEPTH_SHIFT)
+                    | (materialID << E_KEY_B2F_MATERIAL_SHIFT)
+                    | (vbID << E_KEY_B2F_VB_SHIFT);
+                break;
+            case E_SP_SUBMISSION_ORDER:
+                key |= ((uint64_t(mOrders[i]) & maxDepth) << E_KEY_B2F_DEPTH_SHIFT)
+                    | (materialID << E_KEY_B2F_MATERIAL_SHIFT)
+                    | (vbID << E_KEY_B2F_VB_SHIFT);
+                break;
+            default:
+                key |= (materialID << E_KEY_MATERIAL_SHIFT)
+                    | (vbID << E_KEY_VB_SHIFT)
+                    | (depth << E_KEY_DEPTH_SHIFT);
+                break;
+            }
+
+            item.key = key;
+        }
+    }
+
+    void RenderQueue::sort()
+    {
+        const size_t count = mItems.size();
+
+        if (count < 2)
+            return;
+
+        mSortBuffer.resize(count);
+
+        RenderItem *src = &mItems[0];
+        RenderItem *dst = &mSortBuffer[0];
+
+        /// 先一次性统计所有8趟的直方图
+        size_t histogram[8][256];
+        memset(histogram, 0, sizeof(histogram));
+
+        size_t i = 0;
+        while (i < count)
+        {
+            uint64_t key = src[i].key;
+            size_t pass = 0;
+            while (pass < 8)
+            {
+                ++histogram[pass][(key >> (pass * 8)) & 0xFF];
+                ++pass;
+            }
+            ++i;
+        }
+
+        size_t pass = 0;
+        while (pass < 8)
+        {
+            size_t *counts = histogram[pass];
+            uint32_t shift = uint32_t(pass * 8);
+
+            /// 所有键在这一字节上都相同，这一趟不需要做
+            if (counts[(src[0].key >> shift) & 0xFF] == count)
+            {
+                ++pass;
+                continue;
+            }
+
+            size_t offset = 0;
+            size_t b = 0;
+            while (b < 256)
+            {
+                size_t c = counts[b];
+                counts[b] = offset;
+                offset += c;
+                ++b;
+            }
+
+            i = 0;
+            while (i < count)
+            {
+                const RenderItem &item = src[i];
+                dst[counts[(item.key >> shift) & 0xFF]++] = item;
+                ++i;
+            }
+
+            std::swap(src, dst);
+            ++pass;
+        }
+
+        if (src != &mItems[0])
+        {
+            mItems.swap(mSortBuffer);
+        }
+    }
+
+    void RenderQueue::batchOverlay()
+    {
+        if (!mIsOverlayBatching || mSortPolicies[E_GRPID_OVERLAY] != E_SP_SUBMISSION_ORDER)
+            return;
+
+        /// 覆盖层分组ID最大，排序后在最后面
+        const size_t count = mItems.size();
+        size_t first = count;
+
+        while (first > 0 && getGroupID(mItems[first - 1].key) == E_GRPID_OVERLAY)
+        {
+            --first;
+        }
+
+        if (first == count)
+            return;
+
+        mOverlayBatcher->build(mItems, first, count - first, mRenderables, mPackets);
+    }
+
+    RenderGroupPtr &RenderQueue::getGroup(uint32_t groupID)
+    {
+        RenderableGroupItr itr = mGroups.find(groupID);
+
+        if (itr == mGroups.end())
+        {
+            RenderGroup *group = new RenderGroup(groupID);
             RenderGroupPtr ptr(group);
             group->release();
 
-            group->addRenderable(renderable->getMaterial(), renderable);
-            mGroups.insert(RenderableGroupValue(groupID, group));
+            itr = mGroups.insert(RenderableGroupValue(groupID, ptr)).first;
         }
+
+        return itr->second;
     }
 
-    void RenderQueue::clear()
+    void RenderQueue::buildJobs()
     {
-        mGroups.clear();
+        mJobs.clear();
+
+        const size_t count = mItems.size();
+        size_t first = 0;
+
+        while (first < count)
+        {
+            /// 排序后同一分组是连续的一段
+            uint32_t groupID = getGroupID(mItems[first].key);
+            size_t end = first + 1;
+
+            while (end < count && getGroupID(mItems[end].key) == groupID)
+            {
+                ++end;
+            }
+
+            RenderGroup *group = getGroup(groupID);
+
+            /// 渲染项多的分组切成多段，切分点不落在可以实例化合并的一串渲染对象中间，
+            /// 灯光分组按索引设置灯光，不切分
+            while (first < end)
+            {
+                size_t last = end;
+
+                if (E_GRPID_LIGHT != groupID && end - first > 2 * E_MIN_RECORD_ITEMS)
+                {
+                    last = first + E_MIN_RECORD_ITEMS;
+
+                    while (last < end && RenderGroup::canInstance(
+                        mPackets[mItems[last - 1].index], mPackets[mItems[last].index]))
+                    {
+                        ++last;
+                    }
+                }
+
+                RecordJob job;
+                job.group = group;
+                job.first = first;
+                job.count = last - first;
+                mJobs.push_back(job);
+
+                first = last;
+            }
+        }
+
+        while (mCommandLists.size() < mJobs.size())
+        {
+            mCommandLists.push_back(CommandList::create());
+        }
+    }
+
+    void RenderQueue::recordProcedure(void *context, size_t begin, size_t end)
+    {
+        T3D_PROFILE_ZONE("RenderQueue::recordProcedure");
+
+        RenderQueue *queue = (RenderQueue *)context;
+
+        while (begin < end)
+        {
+            const RecordJob &job = queue->mJobs[begin];
+            CommandList *list = queue->mCommandLists[begin];
+            list->reset();
+            job.group->record(list, queue->mView, &queue->mItems[job.first], job.count, queue->mPackets);
+            ++begin;
+        }
     }
 
     void RenderQueue::render(const RendererPtr &renderer)
     {
-        RenderableGroupItr itr = mGroups.begin();
+        if (mIsRetained)
+        {
+            collectRetained();
+        }
+
+        fillDepth(renderer);
+        sort();
+        batchOverlay();
+
+        /// 相机矩阵在渲染线程上取出，相机只在参数变化时重新计算
+        SGCameraPtr camera = renderer->getViewport()->getCamera();
+        mView.view = camera->getViewMatrix();
+        mView.projection = camera->getProjectionMatrix();
+        renderer->makeProjectionMatrix(camera->getFovY(), camera->getAspectRatio(),
+            camera->getNearPlaneDistance(), camera->getFarPlaneDistance(), true, mView.overlayProjection);
 
-        while (itr != mGroups.end())
+        buildJobs();
+
+        if (!mJobs.empty())
         {
-            itr->second->render(itr->first, renderer);
-            itr->second->clear();
-            ++itr;
+            /// 渲染线程也参与录制，全部录制完才返回
+            TaskScheduler *scheduler = TaskScheduler::getInstancePtr();
+
+            if (scheduler != nullptr)
+            {
+                scheduler->parallelFor(mJobs.size(), 1, RenderQueue::recordProcedure, this);
+            }
+            else
+            {
+                recordProcedure(this, 0, mJobs.size());
+            }
+
+            /// 按分组顺序回放
+            size_t i = 0;
+            while (i < mJobs.size())
+            {
+                size_t drawCount = mCommandLists[i]->execute(renderer);
+                T3D_ENTRANCE.addBatchCounter((uint32_t)drawCount);
+                ++i;
+            }
         }
+
+        clear();
     }
 }
@@ -20,6 +20,10 @@
 #include "Render/T3DRenderer.h"
 #include "Render/T3DRenderTarget.h"
 #include "Listener/T3DFrameListener.h"
+#include "Render/T3DVertexData.h"
+#include "Render/T3DIndexData.h"
+#include "Render/T3DHardwareBufferManager.h"
+#include "Resource/T3DMaterial.h"
 #include <T3DPlatform.h>
 
 
@@ -30,8 +34,20 @@ namespace Tiny3D
     const char * const Renderer::OPENGL3PLUS = "OpenGL 3+";
     const char * const Renderer::OPENGLES2 = "OpenGL ES 2";
     const char * const Renderer::OPENGLES3 = "OpenGL ES 3";
+    const char * const Renderer::NULLRENDERER = "Null";
+    const char * const Renderer::SOFTWARE = "Software";
 
     Renderer::Renderer()
+        : mLastStartTime(0)
+        , mLastEndTime(0)
+        , mMaterial(nullptr)
+        , mMaterialStamp(0)
+        , mVertexData(nullptr)
+        , mIndexData(nullptr)
+        , mInstanceBuffer(nullptr)
+        , mStateCacheFlags(0)
+        , mSubmittedStates(0)
+        , mElidedStates(0)
     {
         mCullingMode = E_CULL_CLOCKWISE;
         mRenderMode = E_RM_SOLID;
@@ -47,6 +63,8 @@ namespace Tiny3D
         if (!fireFrameStarted())
             return false;
 
+        resetStateCounters();
+
         RenderTargetListItr itr = mRenderTargets.begin();
         while (itr != mRenderTargets.end())
         {
@@ -98,7 +116,7 @@ namespace Tiny3D
 
     bool Renderer::fireFrameStarted()
     {
-        /// ÿ֡Ⱦʼõײƽ̨һ
+        /// 每帧渲染开始，先让底层平台层更新一遍
         T3D_SYSTEM.process();
 
         uint64_t timestamp = DateTime::currentMSecsSinceEpoch();
@@ -171,4 +189,201 @@ namespace Tiny3D
     {
         return mRenderMode;
     }
+
+    bool Renderer::checkStateCache(uint32_t flag, bool isSame)
+    {
+        if ((mStateCacheFlags & flag) && isSame)
+        {
+            ++mElidedStates;
+            return false;
+        }
+
+        mStateCacheFlags |= flag;
+        ++mSubmittedStates;
+        return true;
+    }
+
+    void Renderer::setTransform(TransformState state, const Matrix4 &mat)
+    {
+        if (state < 0 || state >= E_TS_MAX)
+            return;
+
+        uint32_t flag = (E_SCF_TRANSFORM << state);
+        if (checkStateCache(flag, mTransforms[state] == mat))
+        {
+            mTransforms[state] = mat;
+            setTransformImpl(state, mat);
+        }
+    }
+
+    const Matrix4 &Renderer::getTransform(TransformState state) const
+    {
+        if (state < 0 || state >= E_TS_MAX)
+            return Matrix4::IDENTITY;
+
+        return mTransforms[state];
+    }
+
+    void Renderer::setCullingMode(CullingMode mode)
+    {
+        if (checkStateCache(E_SCF_CULLING_MODE, mCullingMode == mode))
+        {
+            mCullingMode = mode;
+            setCullingModeImpl(mode);
+        }
+    }
+
+    void Renderer::setRenderMode(RenderMode mode)
+    {
+        if (checkStateCache(E_SCF_RENDER_MODE, mRenderMode == mode))
+        {
+            if (mRenderMode != mode)
+            {
+                /// 渲染器设置材质时会根据渲染模式决定是否设置纹理，模式变了需要重新设置材质
+                mStateCacheFlags &= ~E_SCF_MATERIAL;
+            }
+
+            mRenderMode = mode;
+            setRenderModeImpl(mode);
+        }
+    }
+
+    void Renderer::setMaterial(const MaterialPtr &material)
+    {
+        /// 同一个材质修改过也要重新设置，修改标记变了就当作不同的材质
+        uint32_t stamp = (material != nullptr ? material->getChangeStamp() : 0);
+
+        if (checkStateCache(E_SCF_MATERIAL, mMaterial == material && mMaterialStamp == stamp))
+        {
+            setMaterialImpl(material);
+            mMaterial = material;
+            mMaterialStamp = stamp;
+        }
+    }
+
+    void Renderer::bindVertexData(const VertexDataPtr &vertices)
+    {
+        if (checkStateCache(E_SCF_VERTEX_DATA, mVertexData == vertices))
+        {
+            mVertexData = vertices;
+            bindVertexDataImpl(vertices);
+        }
+    }
+
+    void Renderer::bindIndexData(const IndexDataPtr &indices)
+    {
+        if (checkStateCache(E_SCF_INDEX_DATA, mIndexData == indices))
+        {
+            mIndexData = indices;
+            bindIndexDataImpl(indices);
+        }
+    }
+
+    void Renderer::drawVertexList(PrimitiveType primitiveType,
+        const VertexDataPtr &vertices, uint32_t startIdx,
+        uint32_t primitiveCount)
+    {
+        bindVertexData(vertices);
+        drawVertexListImpl(primitiveType, vertices, startIdx, primitiveCount);
+    }
+
+    void Renderer::drawIndexList(PrimitiveType primitiveType,
+        const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+        uint32_t startIdx, uint32_t pritimitiveCount)
+    {
+        bindVertexData(vertices);
+        bindIndexData(indicies);
+        drawIndexListImpl(primitiveType, vertices, indicies, startIdx, pritimitiveCount);
+    }
+
+    void Renderer::drawIndexListInstanced(PrimitiveType primitiveType,
+        const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+        uint32_t startIdx, uint32_t primitiveCount,
+        const Matrix4 *worldMatrices, size_t instanceCount)
+    {
+        if (instanceCount == 0)
+            return;
+
+        bindVertexData(vertices);
+        bindIndexData(indicies);
+
+        if (instanceCount > 1 && isInstancingSupported())
+        {
+            const size_t instanceSize = sizeof(float) * 16;
+
+            if (mInstanceBuffer == nullptr || mInstanceBuffer->getVertexCount() < instanceCount)
+            {
+                /// 按两倍增长，避免实例数量小幅波动时反复创建缓冲
+                size_t capacity = (mInstanceBuffer != nullptr ? mInstanceBuffer->getVertexCount() * 2 : 64);
+                if (capacity < instanceCount)
+                    capacity = instanceCount;
+
+                mInstanceBuffer = T3D_HARDWARE_BUFFER_MGR.createInstanceBuffer(
+                    instanceSize, capacity, HardwareBuffer::E_HBU_DYNAMIC_WRITE_ONLY);
+            }
+
+            float *dst = (float *)mInstanceBuffer->lock(0, instanceSize * instanceCount, HardwareBuffer::E_HBL_DISCARD);
+
+            if (dst != nullptr)
+            {
+                size_t i = 0;
+                while (i < instanceCount)
+                {
+                    const Real *src = worldMatrices[i];
+                    size_t k = 0;
+                    while (k < 16)
+                    {
+                        dst[k] = float(src[k]);
+                        ++k;
+                    }
+                    dst += 16;
+                    ++i;
+                }
+
+                mInstanceBuffer->unlock();
+
+                drawIndexListInstancedImpl(primitiveType, vertices, indicies,
+                    mInstanceBuffer, instanceCount, startIdx, primitiveCount);
+                return;
+            }
+        }
+
+        /// 不支持实例化，逐个实例设置世界变换后绘制
+        size_t i = 0;
+        while (i < instanceCount)
+        {
+            setTransform(E_TS_WORLD, worldMatrices[i]);
+            drawIndexListImpl(primitiveType, vertices, indicies, startIdx, primitiveCount);
+            ++i;
+        }
+    }
+
+    bool Renderer::isInstancingSupported() const
+    {
+        return false;
+    }
+
+    void Renderer::drawIndexListInstancedImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+        const HardwareVertexBufferPtr &instances, size_t instanceCount,
+        uint32_t startIdx, uint32_t primitiveCount)
+    {
+        /// 支持实例化的渲染器必须重写本接口
+        T3D_ASSERT(0);
+    }
+
+    void Renderer::invalidateStateCache()
+    {
+        mStateCacheFlags = 0;
+        mMaterial = nullptr;
+        mMaterialStamp = 0;
+        mVertexData = nullptr;
+        mIndexData = nullptr;
+    }
+
+    void Renderer::resetStateCounters()
+    {
+        mSubmittedStates = 0;
+        mElidedStates = 0;
+    }
 }
@@ -31,6 +31,7 @@
 // struct HINSTANCE__;
 // typedef struct HINSTANCE__* HINSTANCE;
 #elif defined (T3D_OS_LINUX) || defined (T3D_OS_MACOSX) || defined (T3D_OS_ANDROID) || defined (T3D_OS_IOS)
+    #include <dlfcn.h>
     #define DYLIB_HANDLE           void*
     #define DYLIB_LOAD(a)          dlopen(a, RTLD_NOW)
     #define DYLIB_GETSYM(a, b)     dlsym(a, b)
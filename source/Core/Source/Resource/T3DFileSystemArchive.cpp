@@ -174,7 +174,7 @@ namespace Tiny3D
         {
             if (mFileStreamCache.size() >= MAX_FILE_STREAM_CACHE)
             {
-                // ڿɻļҪɾϵһ´򿪵ļ
+                // 大于可缓存最大文件流数，需要删掉最老的一个，来存放最新打开的文件流
                 auto itr = mFileIndexCache.begin();
 
                 auto i = mFileStreamCache.find(itr->second);
@@ -196,7 +196,7 @@ namespace Tiny3D
             }
             else
             {
-                // ûдڻ棬ӿлȡж
+                // 没有大于缓存，从空闲缓存链表获取空闲对象
                 FileDataStream *fs = mFileStreamPool.front();
                 mFileStreamPool.pop_front();
                 stream = fs;
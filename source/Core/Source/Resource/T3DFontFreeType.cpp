@@ -103,14 +103,14 @@ namespace Tiny3D
 
         do 
         {
-            // ʼfreetype
+            // 初始化freetype
             if (FT_Init_FreeType(&mFTLibrary))
             {
                 T3D_LOG_ERROR("Could not init FreeType library !");
                 break;
             }
 
-            // һ
+            // 加载一个字体
             FT_Face face;
             uint8_t *data;
             size_t size = stream.read(data);
@@ -122,14 +122,14 @@ namespace Tiny3D
                 break;
             }
 
-            // ѡһַǰѡUNICODE
+            // 选择一个字符表，当前选择UNICODE
             if (error = FT_Select_Charmap(face, FT_ENCODING_UNICODE))
             {
                 T3D_LOG_ERROR("Select charmap failed !");
                 break;
             }
 
-            // ַС26.6趨
+            // 设置字符大小，基于26.6规则设定
             FT_F26Dot6 ftSize = (FT_F26Dot6)(mFontSize << 6);
             int32_t dpi = 72;
             if (error = FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
@@ -138,16 +138,16 @@ namespace Tiny3D
                 break;
             }
 
-            // ַ
+            // 设置字体中最大字符宽度
             mFontWidth = (face->size->metrics.max_advance >> 6);
 
-            // ַ߶
+            // 设置字体中最大字符高度
             mFontHeight = (face->size->metrics.height >> 6);
 
-            // 
+            // 设置字体基线
             mFontBaseline = (face->size->metrics.ascender >> 6);
 
-            // 
+            // 设置字体外观
             mFTFace = face;
 
             ret = true;
@@ -169,7 +169,7 @@ namespace Tiny3D
             }
             else
             {
-                // ûУ鷳ˣֻͨfreetypeȥ
+                // 缓存中没有，这就麻烦了，只能通过freetype库去计算了
                 FT_Error ftError = FT_Load_Char(mFTFace, code, FT_LOAD_RENDER);
                 if (ftError == 0)
                 {
@@ -194,7 +194,7 @@ namespace Tiny3D
             }
             else
             {
-                // ûУ鷳ˣֻͨfreetypeȥ
+                // 缓存中没有，这就麻烦了，只能通过freetype库去计算了
                 FT_Error ftError = FT_Load_Char(mFTFace, code, FT_LOAD_RENDER);
                 if (ftError == 0)
                 {
@@ -302,8 +302,8 @@ namespace Tiny3D
 
                         if (x >= startX && x < endX)
                         {
-                            // ڸƷΧڣַλͼݣѻҶͼֵalphaͨУ
-                            // ֹıɫʧ˻ҶֵҪ½freetypeһ
+                            // 在复制范围内，复制字符位图数据，把灰度图值存放在alpha通道中，
+                            // 防止后面改变字体颜色后丢失了灰度值，需要重新解析freetype，进一步提高性能
                             dstLine[index] = srcLine[x - startX];        // blue
                             dstLine[index + 1] = srcLine[x - startX];    // green
                             dstLine[index + 2] = srcLine[x - startX];    // red
@@ -311,7 +311,7 @@ namespace Tiny3D
                         }
                         else
                         {
-                            // ڷΧڵģַΧУȫó͸ֵ
+                            // 不在范围内的，但是在字符范围中，其他像素全部置成透明值
                             dstLine[index] = dstLine[index + 1] = dstLine[index + 2] = dstLine[index + 3] = 0;
                         }
                     }
@@ -343,8 +343,8 @@ namespace Tiny3D
 //                     if (x >= startX && x < endX
 //                         && y >= startY && y < endY)
 //                     {
-//                         // ڸƷΧڣַλͼݣѻҶͼֵalphaͨУ
-//                         // ֹıɫʧ˻ҶֵҪ½freetypeһ
+//                         // 在复制范围内，复制字符位图数据，把灰度图值存放在alpha通道中，
+//                         // 防止后面改变字体颜色后丢失了灰度值，需要重新解析freetype，进一步提高性能
 //                         dstLine[index] = srcLine[x-startX];// ((srcLine[x] * 255) >> 8);        // blue
 //                         dstLine[index + 1] = srcLine[x-startX];// ((srcLine[x] * 255) >> 8);    // green
 //                         dstLine[index + 2] = srcLine[x-startX];// ((srcLine[x] * 255) >> 8);    // red
@@ -354,7 +354,7 @@ namespace Tiny3D
 //                     }
 //                     else
 //                     {
-//                         // ڷΧڵģַΧУȫó͸ֵ
+//                         // 不在范围内的，但是在字符范围中，其他像素全部置成透明值
 //                         dstLine[index] = dstLine[index + 1] = dstLine[index + 2] = dstLine[index + 3] = 0;
 //                     }
 //                 }
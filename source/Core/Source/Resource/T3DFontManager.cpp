@@ -55,7 +55,7 @@ namespace Tiny3D
         if (argc == 2)
         {
             int32_t fontSize = va_arg(args, int32_t);
-            Font::FontType fontType = va_arg(args, Font::FontType);
+            Font::FontType fontType = (Font::FontType)va_arg(args, int32_t);
             font = Font::create(name, fontSize, fontType);
         }
 
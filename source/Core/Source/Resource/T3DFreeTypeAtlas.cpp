@@ -61,7 +61,7 @@ namespace Tiny3D
         {
             const FontConfig &config = FontManager::getInstance().getConfig();
 
-            // Ҫblock
+            // 计算这里面需要的block数量
             int32_t blockCols = config.maxTexWidth / config.blockWidth;
             int32_t blockRows = config.maxTexHeight / config.blockHeight;
             int32_t blockCount = blockCols * blockRows;
@@ -71,7 +71,7 @@ namespace Tiny3D
             int32_t cols = config.initTexWidth / config.blockWidth;
             int32_t rows = config.initTexHeight / config.blockHeight;
 
-            // سʼʺ
+            // 加载初始材质和纹理
             std::stringstream ss;
             ss << name << "_#" << index;
             material = MaterialManager::getInstance().loadMaterial(ss.str(), Material::E_MT_MANUAL);
@@ -80,7 +80,7 @@ namespace Tiny3D
 
             if (texture == nullptr)
             {
-                // û״δʣвȡ
+                // 没有纹理，代表首次创建材质，而不是已有材质里面获取回来
                 if (!createTexture(config.initTexWidth, config.initTexHeight, texture))
                 {
                     break;
@@ -89,7 +89,7 @@ namespace Tiny3D
                 material->setTexture(0, texture);
             }
 
-            // еblockѱõķŵmap
+            // 创建所有的block，把备用的放到备用map里
             for (int32_t i = 0; i < blockCount; i++)
             {
                 BlockPtr block = new Block();
@@ -104,12 +104,12 @@ namespace Tiny3D
 
                 if (col < cols && row < rows)
                 {
-                    // ʼСΧڣڿ
+                    // 初始纹理大小区域范围内，存放在可用链表里
                     available.push_back(block);
                 }
                 else
                 {
-                    // ڳʼֻܷŵcacheҪչʱٶ̬
+                    // 不在初始纹理区域里，只能放到后备cache里，等需要扩展纹理的时候再动态调整到可用链表里
                     unavailable.insert(BlocksValue(blockID, block));
                 }
 
@@ -177,7 +177,7 @@ namespace Tiny3D
                     break;
                 }
 
-                // faceĿȡһеblockŵblockmap
+                // 从face的空闲链表里面获取一个空闲的block出来，放到blockmap中
                 block = available.front();
                 available.pop_front();
                 block->size = fontSize;
@@ -186,7 +186,7 @@ namespace Tiny3D
             }
             else
             {
-                // faceĿȡһеblockŵblockmap
+                // 从face的空闲链表里面获取一个空闲的block出来，放到blockmap中
                 block = available.front();
                 available.pop_front();
                 block->size = fontSize;
@@ -218,32 +218,32 @@ namespace Tiny3D
 
             if (texWidth * 2 <= config.maxTexWidth)
             {
-                // Ȱտڵ
+                // 先按照宽度是现在的两倍增长
                 newTexWidth = texWidth * 2;
                 newTexHeight = texHeight;
             }
             else if (texWidth < config.maxTexWidth && texWidth * 2 >= config.maxTexWidth)
             {
-                // ʣռ޷ֱչ
+                // 剩余空间无法按照两倍增长，直接扩展到宽度最大
                 newTexWidth = config.maxTexWidth;
                 newTexHeight = texHeight;
             }
             else if (texWidth >= config.maxTexWidth
                 && texHeight * 2 <= config.maxTexHeight)
             {
-                // Ѿ޷տֻܰո߶
+                // 已经无法按照宽度增长，只能按照高度两倍增长
                 newTexWidth = config.maxTexWidth;
                 newTexHeight = texHeight * 2;
             }
             else if (texWidth >= config.maxTexWidth
                 && texHeight < config.maxTexHeight && texHeight * 2 >= config.maxTexHeight)
             {
-                // ʣռ޷߶ֱչ߶
+                // 剩余空间无法按照两倍高度增长，直接扩展到高度最大
                 newTexWidth = config.maxTexWidth;
                 newTexHeight = config.maxTexHeight;
             }
 
-            // ѻ治õblockŵõblock
+            // 把缓存不可用的block放到可用的block链表里
             int32_t blockCols = texWidth / config.blockWidth;
             int32_t blockRows = texHeight / config.blockHeight;
 
@@ -286,14 +286,14 @@ namespace Tiny3D
             if (!found)
                 break;
 
-            // ´һ
+            // 新创建一个纹理
             TexturePtr newTexture;
             if (!createTexture(newTexWidth, newTexHeight, newTexture))
             {
                 break;
             }
 
-            // ѾݸƵͬ
+            // 把旧纹理的所有数据复制到新纹理相同区域
             Rect srcRect(Point(0, 0), Size(texWidth, texHeight));
             Rect dstRect = srcRect;
             if (!srcTexture->copyTo(newTexture, &dstRect, &srcRect))
@@ -354,13 +354,13 @@ namespace Tiny3D
             size_t i = 0;
             for (i = 0; i < u16text.length(); ++i)
             {
-                // װεβ
+                // 装载字形到字形槽
                 size_t code = u16text[i];
 
-                // Ƿֳַ
+                // 从区块里面查找是否有现成字符
                 if (!lookupCharMap(font, code, ch))
                 {
-                    // ûҵ棬²һַ
+                    // 没找到缓存，新插入一个字符到材质纹理中
                     if (!insertCharMap(font, code, ch))
                     {
                         continue;
@@ -411,19 +411,19 @@ namespace Tiny3D
         {
             const FontConfig &config = FontManager::getInstance().getConfig();
 
-            // һʺϵblockֺŵı
+            // 查找一个适合的block给存放这种字号的文本
             FacePtr face;
             BlockPtr block;
             if (!lookupBlock(font, face, block))
             {
-                // ûҵһʵ飬ֻܲһµ
+                // 没有找到一个合适的区块，只能插入一个新的区块
                 if (!insertBlock(font, face, block))
                 {
                     T3D_LOG_ERROR("Insert block failed !");
                 }
             }
 
-            // ͨ freetype λͼ
+            // 先通过字体对象用 freetype 库加载位图
             Size charSize;
             if (!font->loadBitmap(code, charSize))
             {
@@ -432,18 +432,18 @@ namespace Tiny3D
 
             if (block != nullptr)
             {
-                // жǷҪ
+                // 判断是否需要换行
                 if (block->offset.x + charSize.width > block->area.width())
                 {
-                    // û취ˣֻܻ
+                    // 没办法了，只能换行
                     block->offset.x = 0;
                     block->offset.y += charSize.height;
                 }
 
-                // жǷ񹻿ռµַ
+                // 判断是否够空间放入新的字符
                 if (block->offset.y + charSize.height > block->area.height())
                 {
-                    // blockռ䲻ַֻ½һblock
+                    // block空间不足放这个字符，只能新建一个block
                     block = nullptr;
 
                     if (!insertBlock(font, face, block))
@@ -458,8 +458,8 @@ namespace Tiny3D
 
             if (block != nullptr)
             {
-                // ~~~ ȻпԲµblockǲˣֱ
-                // Ѿͨ freetype λͼˣﲻü
+                // 咦~~~ 居然有空闲区域可以插入新的block，那不客气了，直接拿来用
+                // 由于上面已经通过 freetype 库加载了位图了，所以这里不用加载了
                 uv.x = block->area.left + block->offset.x;
                 uv.y = block->area.top + block->offset.y;
 
@@ -468,7 +468,7 @@ namespace Tiny3D
                 dstRect.right = dstRect.left + charSize.width - 1;
                 dstRect.bottom = dstRect.top + charSize.height - 1;
 
-                // ַϢ
+                // 把字符信息缓存起来
                 ch = new Font::Char();
                 ch->release();
                 ch->mArea = dstRect;
@@ -477,10 +477,10 @@ namespace Tiny3D
             }
             else
             {
-                // ˣ blockʧˣûռˣõĲͬȥµĿռ
+                // 杯具了！ 插入block失败了，纹理没空间了，按照配置的不同策略去申请新的空间
                 if (FontConfig::E_STRATEGY_LRU == config.strategy)
                 {
-                    // ֱʹLRṶûõַ̭󻹲ֻܷش
+                    // 直接使用LRU淘汰没用的字符，如果淘汰后还不够，只能返回错误
                     if (!doStrategyLRU(font, face, block, charSize, ch))
                     {
                         break;
@@ -488,7 +488,7 @@ namespace Tiny3D
                 }
                 else if (FontConfig::E_STRATEGY_APPEND == config.strategy)
                 {
-                    // ֲԾֱ½ʺַ
+                    // 这种策略就直接新建材质和纹理来存放新字符
                     if (!doStrategyAppend(font, face, block, charSize, ch))
                     {
                         break;
@@ -496,7 +496,7 @@ namespace Tiny3D
                 }
                 else
                 {
-                    // ԶʹLRṶûõַʵṷ̂ʱ½ַ
+                    // 自动策略是先使用LRU淘汰没用的字符，实在没有淘汰的时候，再新建新纹理来存放新字符
                     if (!doStrategyAuto(font, face, block, charSize, ch))
                     {
                         break;
@@ -508,7 +508,7 @@ namespace Tiny3D
 
             T3D_ASSERT(block != nullptr);
 
-            // Ⱦָ
+            // 渲染到纹理指定区域
             T3D_LOG_INFO("code [%d]", code);
 
             TexturePtr texture = face->material->getTexture(0);
@@ -533,25 +533,25 @@ namespace Tiny3D
     {
         bool found = false;
 
-        // ҶӦϢ
+        // 先在所有字体外观里面查找对应字体外观信息
         auto itr = mFaces.find(font->getName());
         if (itr != mFaces.end())
         {
-            // ҵжӦϢ
+            // 找到有对应的字体外观信息
             FaceList &faceList = itr->second;
             
-            // ͬ۲ǷͬСϢ
+            // 逐个遍历相同字体外观查找是否有相同字体大小区块信息
             for (auto i = faceList.begin(); i != faceList.end(); ++i)
             {
                 FacePtr temp = *i;
 
-                // ͬۺֺͬţǷжӦ
+                // 查找相同字体外观和相同字号，看是否有对应的区块
                 auto ii = temp->blockmap.find(font->getFontSize());
                 if (ii != temp->blockmap.end())
                 {
                     BlockList &blockList = ii->second;
 
-                    // ϶һΪֻһпǴڿblock
+                    // 这里肯定返回最后一个，因为只有最后一个才有可能是存在空闲区域的block
                     block = blockList.back();
 
                     
@@ -562,7 +562,7 @@ namespace Tiny3D
                 }
                 else
                 {
-                    // ûֺͬŵblockȥһΪֻһпܴڿ
+                    // 如果没有相同字号的block，就去字体外观链上最后一个，因为只有最后一个才有可能存在空闲区域
                     face = faceList.back();
                 }
             }
@@ -585,7 +585,7 @@ namespace Tiny3D
 
             if (mFaces.empty() || face == nullptr)
             {
-                // ֱӴһ۶
+                // 直接创建一个字体外观对象
                 const String &fontName = font->getName();
                 if (!createFace(fontName, face))
                 {
@@ -597,7 +597,7 @@ namespace Tiny3D
 
             if (face->isBlockAvailable())
             {
-                // пblockֱӴһblock
+                // 还有空闲block，直接创建一个block
                 if (!face->createBlock(font->getFontSize(), block))
                 {
                     break;
@@ -605,13 +605,13 @@ namespace Tiny3D
             }
             else if (face->isTextureAvailable())
             {
-                // ֱչ
+                // 直接扩展纹理
                 if (!face->extendTexture())
                 {
                     break;
                 }
 
-                // һblock
+                // 继续创建一个block
                 if (!face->createBlock(font->getFontSize(), block))
                 {
                     break;
@@ -619,7 +619,7 @@ namespace Tiny3D
             }
             else
             {
-                // ûпblockֱӸʧˣԤԴ
+                // 没有空闲block，直接告诉外面失败了，让外面根据预设策略处理
                 break;
             }
 
@@ -635,7 +635,7 @@ namespace Tiny3D
 
         do 
         {
-            // ̭ϵûõַṷ̂ɶһۺ
+            // 本策略是先淘汰老的没用的字符，如果都没得淘汰，就新生成多一个字体外观和相关纹理
             if (!doStrategyLRU(font, face, block, charSize, ch))
             {
                 if (!doStrategyAppend(font, face, block, charSize, ch))
@@ -656,7 +656,7 @@ namespace Tiny3D
 
         do 
         {
-            // ֻLRṶϵģûп̭ģֱӷfalse
+            // 本策略只是用LRU淘汰老的，如果没有可以淘汰的，直接返回false
             size_t fontSize = font->getFontSize();
 
             auto itr = face->blockmap.find(fontSize);
@@ -673,12 +673,12 @@ namespace Tiny3D
                     {
                         Font::CharPtr temp = ii->second;
 
-                        // Ϊͬ߶ȿ϶
+                        // 因为字体相同，所以字体高度肯定相等
                         T3D_ASSERT(charSize.height == temp->mArea.height());
 
                         if (temp->referCount() == 2 && charSize.width <= temp->mArea.width())
                         {
-                            // ûⲿãֳַܴ
+                            // 没有外部引用，并且现成区域能存放新增的字符
                             ch = temp;
                             tempBlock->charmap.erase(temp->mCode);
                             mCharmap.erase(temp->mCode);
@@ -734,7 +734,7 @@ namespace Tiny3D
 
             if (itr != mFaces.end())
             {
-                // Ѿͬ۶ˣȡ
+                // 已经存在同样字体外观对象了，获取回来，插入链表里
                 FaceList &faceList = itr->second;
                 size_t faceIdx = faceList.size();
                 face = Face::create(fontName, faceIdx);
@@ -742,7 +742,7 @@ namespace Tiny3D
             }
             else
             {
-                // û۶ֱӲһ
+                // 没有字体外观对象，直接插入一个链表
                 auto r = mFaces.insert(FaceMapValue(fontName, FaceList()));
                 if (!r.second)
                 {
@@ -38,7 +38,7 @@ namespace Tiny3D
         bool updateContent(FontFreeTypePtr font, const String &text, MaterialPtr &material, Font::CharSet &set, Size &size);
 
     protected:
-        // 洢ַӦϢ
+        // 存储所有字符对应的信息
         typedef std::map<int32_t, Font::CharPtr>    CharMap;
         typedef CharMap::iterator                   CharMapItr;
         typedef CharMap::const_iterator             CharMapConstItr;
@@ -51,22 +51,22 @@ namespace Tiny3D
                 , size(0)
             {}
 
-            Object          *face;      /// ۣΪ˱ѭõʱ޷ͷţֱָ룬ָ
-            size_t          size;       /// С
-            Rect            area;       /// block
-            Point           offset;     /// ַʼλ
-            CharMap         charmap;    /// ַ
+            Object          *face;      /// 区块所属的字体外观，为了避免循环引用到时无法释放，这里直接用指针，不用智能指针
+            size_t          size;       /// 字体大小
+            Rect            area;       /// block的区域
+            Point           offset;     /// 字符起始位置
+            CharMap         charmap;    /// 字符集
         };
 
         T3D_DECLARE_SMART_PTR(Block);
 
-        // 洢ͬۺͬСblockϢһԪһblock
+        // 存储所有相同字体外观和相同字体大小的block信息，一个元素是一个block
         typedef std::list<BlockPtr>             BlockList;
         typedef BlockList::iterator             BlockListItr;
         typedef BlockList::const_iterator       BlockListConstItr;
         typedef BlockList::value_type           BlockListValue;
 
-        // 洢ͬ۲ͬСblockϢͬСͨһlist
+        // 存储所有相同字体外观不同大小的block信息，相同字体大小会通过一个list串接起来
         typedef std::map<size_t, BlockList>     BlockMap;
         typedef BlockMap::iterator              BlockMapItr;
         typedef BlockMap::const_iterator        BlockMapConstItr;
@@ -90,44 +90,44 @@ namespace Tiny3D
             bool init(size_t index);
 
             /**
-             * @brief Ƿпblockʹ
+             * @brief 是否还有空闲block可使用
              */
             bool isBlockAvailable() const;
 
             /**
-             * @brief Ƿпռ
+             * @brief 纹理是否还有空间可用
              */
             bool isTextureAvailable() const;
 
             /**
-             * @brief 
+             * @brief 创建纹理
              */
             bool createTexture(size_t texWidth, size_t texHeight, TexturePtr &texture);
 
             /**
-             * @brief block
+             * @brief 创建block
              */
             bool createBlock(size_t fontSize, BlockPtr &block);
 
             /**
-             * @brief Ԥչ
+             * @brief 按照预设策略扩展纹理
              */
             bool extendTexture();
 
-            String          name;          /// 
-            MaterialPtr     material;      /// Ӧ۵Ĳ
+            String          name;          /// 字体外观名称
+            MaterialPtr     material;      /// 对应字体外观的材质
             BlockMap        blockmap;      /// blockmap
-            BlockList       available;     /// пblock
-            Blocks          unavailable;   /// вblockбΪkeyţչʱblocksŵfree
+            BlockList       available;     /// 空闲可用block链表
+            Blocks          unavailable;   /// 空闲不可用block，按照行列编号作为key存放，方便扩展纹理时候从blocks放到free里面
         };
 
-        // ۣͬһһԪһ۶Ӧblockmap
+        // 相同的字体外观，用一个链表串起来，一个元素是一个字体外观对应的blockmap
         typedef std::list<FacePtr>              FaceList;
         typedef FaceList::iterator              FaceListItr;
         typedef FaceList::const_iterator        FaceListConstItr;
         typedef FaceList::value_type            FaceListValue;
 
-        // 洢вͬ
+        // 存储所有不同字体外观
         typedef std::map<String, FaceList>      FaceMap;
         typedef FaceMap::iterator               FaceMapItr;
         typedef FaceMap::const_iterator         FaceMapConstItr;
@@ -136,34 +136,34 @@ namespace Tiny3D
         FreeTypeAtlas();
 
         /**
-         * @brief charmap
-         * @param [in] code : ַ
-         * @param [out] block : ص
-         * @param [out] ch : صַϢ
-         * @return ҵtrue򷵻false
+         * @brief 查找charmap
+         * @param [in] code : 字符编码
+         * @param [out] block : 返回的区块对象
+         * @param [out] ch : 返回的字符信息对象
+         * @return 查找到返回true，否则返回false
          */
         bool lookupCharMap(FontFreeTypePtr font, int32_t code, Font::CharPtr &ch);
 
         /**
-         * @brief ַcharmap
-         * @param [in] code : ַ
-         * @param [in] block : 
-         * @param [out] ch : صַϢ
-         * @return ɹtrue򷵻false
+         * @brief 插入字符到charmap
+         * @param [in] code : 字符编码
+         * @param [in] block : 区块对象
+         * @param [out] ch : 返回的字符信息对象
+         * @return 插入成功返回true，否则返回false
          */
         bool insertCharMap(FontFreeTypePtr font, int32_t code, Font::CharPtr &ch);
 
         /**
-         * @brief ʺϵ
-         * @param [out] block : ص
-         * @return ҵʺϵķtrue򷵻false
+         * @brief 查找适合的区块
+         * @param [out] block : 返回的区块对象
+         * @return 查找到适合的返回true，否则返回false
          */
         bool lookupBlock(FontFreeTypePtr font, FacePtr &face, BlockPtr &block);
 
         /**
-         * @brief һ
-         * @param [out] block : ص
-         * @return ɹtrue򷵻false
+         * @brief 插入一个区块
+         * @param [out] block : 返回的区块对象
+         * @return 插入成功返回true，否则返回false
          */
         bool insertBlock(FontFreeTypePtr font, FacePtr &face, BlockPtr &block);
 
@@ -177,7 +177,7 @@ namespace Tiny3D
 
     protected:
         FaceMap     mFaces;
-        CharMap     mCharmap;           /// 洢ַڲ
+        CharMap     mCharmap;           /// 存储所有字符，方便用于查找
     };
 }
 
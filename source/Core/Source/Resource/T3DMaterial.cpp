@@ -29,11 +29,15 @@
 #include "Support/tinyxml2/tinyxml2.h"
 
 #include <sstream>
+#include <atomic>
 
 namespace Tiny3D
 {
     using namespace tinyxml2;
 
+    /// 修改标记从全局递增取值，材质释放后新材质分配到同一地址也不会和渲染器缓存的标记相同
+    static std::atomic<uint32_t> sNextChangeStamp(1);
+
     MaterialPtr Material::create(const String &name, MaterialType matType)
     {
         MaterialPtr material = new Material(name, matType);
@@ -49,7 +53,10 @@ namespace Tiny3D
         , mSpecularColor(Color4::WHITE)
         , mEmissiveColor(Color4::WHITE)
         , mShininess(Real(20.0))
+        , mChangeStamp(0)
     {
+        touch();
+
         size_t i = 0;
         for (i = 0; i < E_MAX_TEXTURE_LAYERS; ++i)
         {
@@ -113,12 +120,13 @@ namespace Tiny3D
             ret = true;
         }
 
+        touch();
         return ret;
     }
 
     void Material::unload()
     {
-
+        touch();
     }
 
     ResourcePtr Material::clone() const
@@ -129,11 +137,18 @@ namespace Tiny3D
     void Material::setTexture(size_t layer, const String &name)
     {
         mTextureLayer[layer] = T3D_TEXTURE_MGR.loadTexture(name);
+        touch();
     }
 
     void Material::setTexture(size_t layer, TexturePtr texture)
     {
         mTextureLayer[layer] = texture;
+        touch();
+    }
+
+    void Material::touch()
+    {
+        mChangeStamp = sNextChangeStamp.fetch_add(1, std::memory_order_relaxed);
     }
 
     Material::FileType Material::parseFileType(const String &name) const
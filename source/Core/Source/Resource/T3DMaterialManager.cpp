@@ -51,7 +51,7 @@ namespace Tiny3D
 
         if (argc == 1)
         {
-            Material::MaterialType matType = va_arg(args, Material::MaterialType);
+            Material::MaterialType matType = (Material::MaterialType)va_arg(args, int32_t);
             material = Material::create(name, matType);
         }
 
@@ -24,6 +24,8 @@ namespace Tiny3D
 {
     Resource::Resource(const String &strName)
         : mSize(0)
+        , mID(makeGlobalID())
+        , mCloneID(0)
         , mIsLoaded(false)
         , mName(strName)
     {
@@ -40,4 +42,10 @@ namespace Tiny3D
     {
 
     }
+
+    uint32_t Resource::makeGlobalID()
+    {
+        static uint32_t unID = 0;
+        return ++unID;
+    }
 }
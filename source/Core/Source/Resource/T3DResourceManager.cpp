@@ -54,6 +54,8 @@ namespace Tiny3D
 
     ResourcePtr ResourceManager::load(const String &name, int32_t argc, ...)
     {
+        T3D_PROFILE_ZONE("ResourceManager::load");
+
         ResourcePtr res = nullptr;
 
         // First, search cache
@@ -79,7 +79,7 @@ namespace Tiny3D
                 ArchivePtr archive;
                 MemoryDataStream stream;
 
-                // 
+                // 加载纹理数据
                 if (!ArchiveManager::getInstance().getArchive(mName, archive))
                 {
                     T3D_LOG_ERROR("Get archive named %s failed !", mName.c_str());
@@ -109,7 +109,7 @@ namespace Tiny3D
                     mTexHeight = image.getHeight();
                 }
 
-                // Ӳ
+                // 创建硬件缓冲区
                 mPixelBuffer = HardwareBufferManager::getInstance().createPixelBuffer(mTexWidth, mTexHeight, mFormat, HardwareBuffer::E_HBU_DYNAMIC, false);
 
                 if (mPixelBuffer == nullptr)
@@ -118,7 +118,7 @@ namespace Tiny3D
                     break;
                 }
 
-                // ݵӲ
+                // 复制纹理数据到硬件缓冲区
                 if (!mPixelBuffer->readImage(image))
                 {
                     T3D_LOG_ERROR("Read image data failed !");
@@ -127,7 +127,7 @@ namespace Tiny3D
             }
             else
             {
-                // Ӳ
+                // 创建硬件缓冲区
                 mPixelBuffer = HardwareBufferManager::getInstance().createPixelBuffer(mTexWidth, mTexHeight, mFormat, HardwareBuffer::E_HBU_DYNAMIC, false);
 
                 if (mPixelBuffer == nullptr)
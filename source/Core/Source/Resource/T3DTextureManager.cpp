@@ -58,9 +58,9 @@ namespace Tiny3D
             int32_t width = va_arg(args, int32_t);
             int32_t height = va_arg(args, int32_t);
             int32_t numMipMaps = va_arg(args, int32_t);
-            PixelFormat format = va_arg(args, PixelFormat);
-            Texture::TexUsage texUsage = va_arg(args, Texture::TexUsage);
-            Texture::TexType texType = va_arg(args, Texture::TexType);
+            PixelFormat format = (PixelFormat)va_arg(args, int32_t);
+            Texture::TexUsage texUsage = (Texture::TexUsage)va_arg(args, int32_t);
+            Texture::TexType texType = (Texture::TexType)va_arg(args, int32_t);
             numMipMaps = (numMipMaps == -1 ? mDefaultNumMipMaps : numMipMaps);
             res = Texture::create(name, numMipMaps, width, height, texUsage, texType, format);//createTexture(name, width, height, numMipMaps, format, texUsage, texType);
         }
@@ -74,7 +74,7 @@ namespace Tiny3D
 
                 mModelData->mMeshes.resize(meshCount);
 
-                // 
+                // 网格数据
                 size_t i = 0;
                 while (pMeshElement != nullptr)
                 {
@@ -89,19 +89,19 @@ namespace Tiny3D
                     ++i;
                 }
 
-                // κ͹ر任
+                // 骨骼层次和骨骼本地变换数据
                 XMLElement *pSkelElement = pModelElement->FirstChildElement(T3D_XML_TAG_SKELETON);
                 ret = ret && parseSkeleton(pSkelElement);
 
-                // ƤϢ
+                // 蒙皮信息
 //                 XMLElement *pSkinsElement = pModelElement->FirstChildElement(T3D_XML_TAG_SKIN);
 //                 ret = ret && parseSkins(pSkinsElement);
 
-                // ؼ֡
+                // 关键帧动画数据
                 XMLElement *pAnimElement = pModelElement->FirstChildElement(T3D_XML_TAG_ANIMATION);
                 ret = ret && parseAnimation(pAnimElement);
 
-                // 任
+                // 变换结点数据
                 XMLElement *pHierarchyElement = pSceneElement->FirstChildElement(T3D_XML_TAG_HIERARCHY);
                 ret = ret && parseHierarchy(pHierarchyElement);
             }
@@ -368,7 +368,7 @@ namespace Tiny3D
         }
         else
         {
-            // ʱ֧ͼԪ
+            // 暂时不支持其他图元类型
             T3D_ASSERT(0);
         }
 
@@ -588,7 +588,7 @@ namespace Tiny3D
     {
         XMLElement *pAttribsElement = pBufferElement->FirstChildElement(T3D_XML_TAG_ATTRIBUTES);
 
-        // бС
+        // 解析顶点属性列表大小
         size_t count = pAttribsElement->IntAttribute(T3D_XML_ATTRIB_COUNT);
 
         if (count == 0)
@@ -597,7 +597,7 @@ namespace Tiny3D
             return false;
         }
 
-        // 
+        // 解析顶点属性
         XMLElement *pAttribElement = pAttribsElement->FirstChildElement(T3D_XML_TAG_ATTRIBUTE);
         size_t i = 0;
         size_t offset = 0;
@@ -614,7 +614,7 @@ namespace Tiny3D
             pAttribElement = pAttribElement->NextSiblingElement(T3D_XML_TAG_ATTRIBUTE);
         }
 
-        // 
+        // 解析顶点数据
         XMLElement *pVerticesElement = pBufferElement->FirstChildElement(T3D_XML_TAG_DATA);
         size_t vertexCount = pVerticesElement->IntAttribute(T3D_XML_ATTRIB_COUNT);
 
@@ -694,11 +694,56 @@ namespace Tiny3D
             i += step;
         } while (i < indexSize);
 
+        parseLods(pSubMeshElement, submesh);
+
         mesh->mSubMeshes.push_back(submesh);
 
         return true;
     }
 
+    bool XMLModelSerializer::parseLods(tinyxml2::XMLElement *pSubMeshElement, SubMeshDataPtr submesh)
+    {
+        XMLElement *pLodsElement = pSubMeshElement->FirstChildElement(T3D_XML_TAG_LODS);
+        if (pLodsElement == nullptr)
+            return true;
+
+        int32_t count = pLodsElement->IntAttribute(T3D_XML_ATTRIB_COUNT);
+        submesh->mLods.reserve(count);
+
+        XMLElement *pLodElement = pLodsElement->FirstChildElement(T3D_XML_TAG_LOD);
+        while (pLodElement != nullptr)
+        {
+            XMLElement *pIndicesElement = pLodElement->FirstChildElement(T3D_XML_TAG_INDICES);
+            int32_t indexCount = pIndicesElement->IntAttribute(T3D_XML_ATTRIB_COUNT);
+
+            if (indexCount > 0)
+            {
+                SubMeshData::LodData lod;
+                lod.mScreenSize = pLodElement->FloatAttribute(T3D_XML_ATTRIB_SCREEN);
+                lod.mIs16Bits = pIndicesElement->BoolAttribute(T3D_XML_ATTRIB_16BITS);
+
+                size_t indexSize = indexCount * (lod.mIs16Bits ? sizeof(uint16_t) : sizeof(uint32_t));
+                lod.mIndices.resize(indexSize);
+
+                String text = pIndicesElement->GetText();
+                size_t start = 0;
+                size_t i = 0;
+
+                while (i < indexSize)
+                {
+                    size_t step = parseIndexValue(text, start, lod.mIs16Bits, &lod.mIndices[i]);
+                    i += step;
+                }
+
+                submesh->mLods.push_back(lod);
+            }
+
+            pLodElement = pLodElement->NextSiblingElement(T3D_XML_TAG_LOD);
+        }
+
+        return true;
+    }
+
 //     bool XMLModelSerializer::parseSkins(tinyxml2::XMLElement *pSkinElement)
 //     {
 //         bool ret = true;
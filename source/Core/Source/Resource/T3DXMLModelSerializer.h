@@ -60,6 +60,7 @@ namespace Tiny3D
 
         bool parseSubMeshes(tinyxml2::XMLElement *pMeshElement, MeshDataPtr mesh);
         bool parseSubMesh(tinyxml2::XMLElement *pSubMeshElement, MeshDataPtr mesh);
+        bool parseLods(tinyxml2::XMLElement *pSubMeshElement, SubMeshDataPtr submesh);
 
         bool parseHierarchy(tinyxml2::XMLElement *pHierarchyElement);
         bool parseNode(tinyxml2::XMLElement *pNodeElement, uint16_t parent);
@@ -0,0 +1,512 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DDynamicAabbTree.h"
+
+
+namespace Tiny3D
+{
+    DynamicAabbTree::DynamicAabbTree(Real margin /* = Real(0.1) */)
+        : mRoot(E_NULL_NODE)
+        , mFreeList(E_NULL_NODE)
+        , mLeafCount(0)
+        , mMargin(margin)
+    {
+
+    }
+
+    DynamicAabbTree::~DynamicAabbTree()
+    {
+
+    }
+
+    const char *DynamicAabbTree::getName() const
+    {
+        return "DynamicAabbTree";
+    }
+
+    int32_t DynamicAabbTree::allocateNode()
+    {
+        int32_t index = mFreeList;
+
+        if (index != E_NULL_NODE)
+        {
+            mFreeList = mNodes[index].parent;
+        }
+        else
+        {
+            index = int32_t(mNodes.size());
+            mNodes.push_back(TreeNode());
+        }
+
+        TreeNode &node = mNodes[index];
+        node.parent = E_NULL_NODE;
+        node.child1 = E_NULL_NODE;
+        node.child2 = E_NULL_NODE;
+        node.height = 0;
+        node.renderable = nullptr;
+        return index;
+    }
+
+    void DynamicAabbTree::freeNode(int32_t index)
+    {
+        TreeNode &node = mNodes[index];
+        node.parent = mFreeList;
+        node.height = -1;
+        node.renderable = nullptr;
+        mFreeList = index;
+    }
+
+    uint32_t DynamicAabbTree::insert(SGRenderable *renderable, const Aabb &box)
+    {
+        int32_t leaf = allocateNode();
+        TreeNode &node = mNodes[leaf];
+        node.renderable = renderable;
+        setFatBound(node, box);
+
+        insertLeaf(leaf);
+        ++mLeafCount;
+        return uint32_t(leaf);
+    }
+
+    void DynamicAabbTree::update(uint32_t proxy, const Aabb &box)
+    {
+        int32_t leaf = int32_t(proxy);
+        T3D_ASSERT(leaf >= 0 && leaf < int32_t(mNodes.size()) && mNodes[leaf].isLeaf());
+
+        // 还在放大的包围盒里面，树不用动
+        if (contains(mNodes[leaf], box))
+            return;
+
+        removeLeaf(leaf);
+        setFatBound(mNodes[leaf], box);
+        insertLeaf(leaf);
+    }
+
+    void DynamicAabbTree::remove(uint32_t proxy)
+    {
+        int32_t leaf = int32_t(proxy);
+        T3D_ASSERT(leaf >= 0 && leaf < int32_t(mNodes.size()) && mNodes[leaf].isLeaf());
+
+        removeLeaf(leaf);
+        freeNode(leaf);
+        --mLeafCount;
+    }
+
+    void DynamicAabbTree::clear()
+    {
+        mNodes.clear();
+        mRoot = E_NULL_NODE;
+        mFreeList = E_NULL_NODE;
+        mLeafCount = 0;
+    }
+
+    int32_t DynamicAabbTree::getHeight() const
+    {
+        return (mRoot != E_NULL_NODE ? mNodes[mRoot].height : 0);
+    }
+
+    void DynamicAabbTree::setFatBound(TreeNode &node, const Aabb &box) const
+    {
+        Real size = std::max(box.getWidth(), std::max(box.getHeight(), box.getDepth()));
+        Real margin = size * mMargin;
+        node.minPos = Vector3(box.getMinX() - margin, box.getMinY() - margin, box.getMinZ() - margin);
+        node.maxPos = Vector3(box.getMaxX() + margin, box.getMaxY() + margin, box.getMaxZ() + margin);
+    }
+
+    Real DynamicAabbTree::computeArea(const Vector3 &minPos, const Vector3 &maxPos)
+    {
+        Vector3 d = maxPos - minPos;
+        return Real(2.0) * (d.x() * d.y() + d.y() * d.z() + d.z() * d.x());
+    }
+
+    void DynamicAabbTree::merge(const TreeNode &a, const TreeNode &b, Vector3 &minPos, Vector3 &maxPos)
+    {
+        minPos.x() = std::min(a.minPos.x(), b.minPos.x());
+        minPos.y() = std::min(a.minPos.y(), b.minPos.y());
+        minPos.z() = std::min(a.minPos.z(), b.minPos.z());
+        maxPos.x() = std::max(a.maxPos.x(), b.maxPos.x());
+        maxPos.y() = std::max(a.maxPos.y(), b.maxPos.y());
+        maxPos.z() = std::max(a.maxPos.z(), b.maxPos.z());
+    }
+
+    bool DynamicAabbTree::contains(const TreeNode &node, const Aabb &box)
+    {
+        return (node.minPos.x() <= box.getMinX() && node.minPos.y() <= box.getMinY()
+            && node.minPos.z() <= box.getMinZ() && node.maxPos.x() >= box.getMaxX()
+            && node.maxPos.y() >= box.getMaxY() && node.maxPos.z() >= box.getMaxZ());
+    }
+
+    void DynamicAabbTree::insertLeaf(int32_t leaf)
+    {
+        if (mRoot == E_NULL_NODE)
+        {
+            mRoot = leaf;
+            mNodes[leaf].parent = E_NULL_NODE;
+            return;
+        }
+
+        // 按表面积代价往下找最合适的兄弟结点
+        const TreeNode &leafNode = mNodes[leaf];
+        Vector3 minPos, maxPos;
+        int32_t index = mRoot;
+
+        while (!mNodes[index].isLeaf())
+        {
+            const TreeNode &node = mNodes[index];
+            Real area = computeArea(node.minPos, node.maxPos);
+
+            merge(node, leafNode, minPos, maxPos);
+            Real combinedArea = computeArea(minPos, maxPos);
+
+            // 在这里新建父结点的代价
+            Real cost = Real(2.0) * combinedArea;
+
+            // 往下走的话，这一层的包围盒至少要增大这么多
+            Real inheritanceCost = Real(2.0) * (combinedArea - area);
+
+            Real cost1, cost2;
+            const TreeNode &child1 = mNodes[node.child1];
+            merge(child1, leafNode, minPos, maxPos);
+            if (child1.isLeaf())
+                cost1 = computeArea(minPos, maxPos) + inheritanceCost;
+            else
+                cost1 = computeArea(minPos, maxPos) - computeArea(child1.minPos, child1.maxPos) + inheritanceCost;
+
+            const TreeNode &child2 = mNodes[node.child2];
+            merge(child2, leafNode, minPos, maxPos);
+            if (child2.isLeaf())
+                cost2 = computeArea(minPos, maxPos) + inheritanceCost;
+            else
+                cost2 = computeArea(minPos, maxPos) - computeArea(child2.minPos, child2.maxPos) + inheritanceCost;
+
+            if (cost < cost1 && cost < cost2)
+                break;
+
+            index = (cost1 < cost2 ? node.child1 : node.child2);
+        }
+
+        int32_t sibling = index;
+
+        // 分配结点可能让数组扩容，之后不能再用前面取到的引用
+        int32_t oldParent = mNodes[sibling].parent;
+        int32_t newParent = allocateNode();
+
+        TreeNode &parentNode = mNodes[newParent];
+        parentNode.parent = oldParent;
+        merge(mNodes[sibling], mNodes[leaf], parentNode.minPos, parentNode.maxPos);
+        parentNode.height = mNodes[sibling].height + 1;
+        parentNode.child1 = sibling;
+        parentNode.child2 = leaf;
+
+        if (oldParent != E_NULL_NODE)
+        {
+            if (mNodes[oldParent].child1 == sibling)
+                mNodes[oldParent].child1 = newParent;
+            else
+                mNodes[oldParent].child2 = newParent;
+        }
+        else
+        {
+            mRoot = newParent;
+        }
+
+        mNodes[sibling].parent = newParent;
+        mNodes[leaf].parent = newParent;
+
+        refit(mNodes[leaf].parent);
+    }
+
+    void DynamicAabbTree::removeLeaf(int32_t leaf)
+    {
+        if (leaf == mRoot)
+        {
+            mRoot = E_NULL_NODE;
+            return;
+        }
+
+        int32_t parent = mNodes[leaf].parent;
+        int32_t grandParent = mNodes[parent].parent;
+        int32_t sibling = (mNodes[parent].child1 == leaf ? mNodes[parent].child2 : mNodes[parent].child1);
+
+        if (grandParent != E_NULL_NODE)
+        {
+            // 兄弟结点顶替父结点的位置
+            if (mNodes[grandParent].child1 == parent)
+                mNodes[grandParent].child1 = sibling;
+            else
+                mNodes[grandParent].child2 = sibling;
+
+            mNodes[sibling].parent = grandParent;
+            freeNode(parent);
+
+            refit(grandParent);
+        }
+        else
+        {
+            mRoot = sibling;
+            mNodes[sibling].parent = E_NULL_NODE;
+            freeNode(parent);
+        }
+
+        mNodes[leaf].parent = E_NULL_NODE;
+    }
+
+    void DynamicAabbTree::refit(int32_t index)
+    {
+        while (index != E_NULL_NODE)
+        {
+            index = balance(index);
+
+            TreeNode &node = mNodes[index];
+            const TreeNode &child1 = mNodes[node.child1];
+            const TreeNode &child2 = mNodes[node.child2];
+
+            node.height = 1 + std::max(child1.height, child2.height);
+            merge(child1, child2, node.minPos, node.maxPos);
+
+            index = node.parent;
+        }
+    }
+
+    int32_t DynamicAabbTree::balance(int32_t iA)
+    {
+        TreeNode &A = mNodes[iA];
+
+        if (A.isLeaf() || A.height < 2)
+            return iA;
+
+        int32_t iB = A.child1;
+        int32_t iC = A.child2;
+        TreeNode &B = mNodes[iB];
+        TreeNode &C = mNodes[iC];
+
+        int32_t diff = C.height - B.height;
+
+        if (diff > 1)
+        {
+            // C比B高，把C旋转上来
+            int32_t iF = C.child1;
+            int32_t iG = C.child2;
+            TreeNode &F = mNodes[iF];
+            TreeNode &G = mNodes[iG];
+
+            C.child1 = iA;
+            C.parent = A.parent;
+            A.parent = iC;
+
+            if (C.parent != E_NULL_NODE)
+            {
+                if (mNodes[C.parent].child1 == iA)
+                    mNodes[C.parent].child1 = iC;
+                else
+                    mNodes[C.parent].child2 = iC;
+            }
+            else
+            {
+                mRoot = iC;
+            }
+
+            // F和G里高的一个留在C下面，矮的一个给A
+            if (F.height > G.height)
+            {
+                C.child2 = iF;
+                A.child2 = iG;
+                G.parent = iA;
+                merge(B, G, A.minPos, A.maxPos);
+                merge(A, F, C.minPos, C.maxPos);
+                A.height = 1 + std::max(B.height, G.height);
+                C.height = 1 + std::max(A.height, F.height);
+            }
+            else
+            {
+                C.child2 = iG;
+                A.child2 = iF;
+                F.parent = iA;
+                merge(B, F, A.minPos, A.maxPos);
+                merge(A, G, C.minPos, C.maxPos);
+                A.height = 1 + std::max(B.height, F.height);
+                C.height = 1 + std::max(A.height, G.height);
+            }
+
+            return iC;
+        }
+
+        if (diff < -1)
+        {
+            // B比C高，把B旋转上来
+            int32_t iD = B.child1;
+            int32_t iE = B.child2;
+            TreeNode &D = mNodes[iD];
+            TreeNode &E = mNodes[iE];
+
+            B.child1 = iA;
+            B.parent = A.parent;
+            A.parent = iB;
+
+            if (B.parent != E_NULL_NODE)
+            {
+                if (mNodes[B.parent].child1 == iA)
+                    mNodes[B.parent].child1 = iB;
+                else
+                    mNodes[B.parent].child2 = iB;
+            }
+            else
+            {
+                mRoot = iB;
+            }
+
+            if (D.height > E.height)
+            {
+                B.child2 = iD;
+                A.child1 = iE;
+                E.parent = iA;
+                merge(C, E, A.minPos, A.maxPos);
+                merge(A, D, B.minPos, B.maxPos);
+                A.height = 1 + std::max(C.height, E.height);
+                B.height = 1 + std::max(A.height, D.height);
+            }
+            else
+            {
+                B.child2 = iE;
+                A.child1 = iD;
+                D.parent = iA;
+                merge(C, D, A.minPos, A.maxPos);
+                merge(A, E, B.minPos, B.maxPos);
+                A.height = 1 + std::max(C.height, D.height);
+                B.height = 1 + std::max(A.height, E.height);
+            }
+
+            return iB;
+        }
+
+        return iA;
+    }
+
+    void DynamicAabbTree::collect(Renderables &result) const
+    {
+        if (mRoot != E_NULL_NODE)
+        {
+            mStack.clear();
+            collectLeaves(mRoot, result);
+        }
+    }
+
+    void DynamicAabbTree::collectLeaves(int32_t index, Renderables &result) const
+    {
+        size_t base = mStack.size();
+        mStack.push_back(index);
+
+        while (mStack.size() > base)
+        {
+            const TreeNode &node = mNodes[mStack.back()];
+            mStack.pop_back();
+            ++mVisitedCount;
+
+            if (node.isLeaf())
+            {
+                result.push_back(node.renderable);
+            }
+            else
+            {
+                mStack.push_back(node.child1);
+                mStack.push_back(node.child2);
+            }
+        }
+    }
+
+    void DynamicAabbTree::query(const Frustum &frustum, Renderables &result) const
+    {
+        mVisitedCount = 0;
+
+        if (mRoot == E_NULL_NODE)
+            return;
+
+        mStack.clear();
+        mMasks.clear();
+        mStack.push_back(mRoot);
+        mMasks.push_back(Frustum::E_FACE_MASK_ALL);
+
+        while (!mMasks.empty())
+        {
+            int32_t index = mStack.back();
+            uint32_t mask = mMasks.back();
+            mStack.pop_back();
+            mMasks.pop_back();
+
+            const TreeNode &node = mNodes[index];
+            ++mVisitedCount;
+
+            if (!testFrustum(node.minPos, node.maxPos, frustum, mask))
+                continue;
+
+            if (node.isLeaf())
+            {
+                result.push_back(node.renderable);
+            }
+            else if (mask == Frustum::E_FACE_MASK_NONE)
+            {
+                // 整个结点都在视景体里，下面的叶子不用再测试
+                collectLeaves(node.child1, result);
+                collectLeaves(node.child2, result);
+            }
+            else
+            {
+                mStack.push_back(node.child1);
+                mMasks.push_back(mask);
+                mStack.push_back(node.child2);
+                mMasks.push_back(mask);
+            }
+        }
+    }
+
+    void DynamicAabbTree::query(const Aabb &box, Renderables &result) const
+    {
+        mVisitedCount = 0;
+
+        if (mRoot == E_NULL_NODE)
+            return;
+
+        Vector3 minPos(box.getMinX(), box.getMinY(), box.getMinZ());
+        Vector3 maxPos(box.getMaxX(), box.getMaxY(), box.getMaxZ());
+
+        mStack.clear();
+        mStack.push_back(mRoot);
+
+        while (!mStack.empty())
+        {
+            const TreeNode &node = mNodes[mStack.back()];
+            mStack.pop_back();
+            ++mVisitedCount;
+
+            if (!testOverlap(node.minPos, node.maxPos, minPos, maxPos))
+                continue;
+
+            if (node.isLeaf())
+            {
+                result.push_back(node.renderable);
+            }
+            else
+            {
+                mStack.push_back(node.child1);
+                mStack.push_back(node.child2);
+            }
+        }
+    }
+}
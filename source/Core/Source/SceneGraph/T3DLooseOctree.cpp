@@ -0,0 +1,467 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DLooseOctree.h"
+
+
+namespace Tiny3D
+{
+    LooseOctree::LooseOctree(Real minCellSize /* = Real(1.0) */)
+        : mRoot(E_NULL_CELL)
+        , mCount(0)
+        , mMinHalfSize(minCellSize * Real(0.5))
+    {
+
+    }
+
+    LooseOctree::~LooseOctree()
+    {
+
+    }
+
+    const char *LooseOctree::getName() const
+    {
+        return "LooseOctree";
+    }
+
+    int32_t LooseOctree::allocateCell(const Vector3 &center, Real halfSize, int32_t parent)
+    {
+        int32_t index;
+
+        if (!mFreeCells.empty())
+        {
+            index = mFreeCells.back();
+            mFreeCells.pop_back();
+        }
+        else
+        {
+            index = int32_t(mCells.size());
+            mCells.push_back(Cell());
+        }
+
+        Cell &cell = mCells[index];
+        cell.center = center;
+        cell.halfSize = halfSize;
+        cell.parent = parent;
+        cell.items.clear();
+        cell.count = 0;
+
+        int32_t i = 0;
+        for (i = 0; i < E_MAX_CHILDREN; ++i)
+        {
+            cell.children[i] = E_NULL_CELL;
+        }
+
+        return index;
+    }
+
+    void LooseOctree::freeCells(int32_t index)
+    {
+        CellIndices stack;
+        stack.push_back(index);
+
+        while (!stack.empty())
+        {
+            Cell &cell = mCells[stack.back()];
+            mFreeCells.push_back(stack.back());
+            stack.pop_back();
+
+            int32_t i = 0;
+            for (i = 0; i < E_MAX_CHILDREN; ++i)
+            {
+                if (cell.children[i] != E_NULL_CELL)
+                {
+                    stack.push_back(cell.children[i]);
+                    cell.children[i] = E_NULL_CELL;
+                }
+            }
+
+            cell.items.clear();
+            cell.count = 0;
+        }
+    }
+
+    bool LooseOctree::fits(const Cell &cell, const Vector3 &center, Real radius) const
+    {
+        // 中心在单元里、半径不超过半边长，就一定在两倍大小的松散范围里
+        return (radius <= cell.halfSize
+            && Math::Abs(center.x() - cell.center.x()) <= cell.halfSize
+            && Math::Abs(center.y() - cell.center.y()) <= cell.halfSize
+            && Math::Abs(center.z() - cell.center.z()) <= cell.halfSize);
+    }
+
+    void LooseOctree::growRoot(const Vector3 &center, Real radius)
+    {
+        if (mRoot == E_NULL_CELL)
+        {
+            mRoot = allocateCell(center, std::max(radius, mMinHalfSize), E_NULL_CELL);
+            return;
+        }
+
+        while (!fits(mCells[mRoot], center, radius))
+        {
+            // 往对象的方向扩大一倍，原来的根单元成为新根单元的一个子单元
+            const Cell &root = mCells[mRoot];
+            Real halfSize = root.halfSize;
+            Vector3 newCenter = root.center;
+            uint32_t octant = 0;
+
+            if (center.x() >= root.center.x())
+                newCenter.x() += halfSize;
+            else
+            {
+                newCenter.x() -= halfSize;
+                octant |= 1;
+            }
+
+            if (center.y() >= root.center.y())
+                newCenter.y() += halfSize;
+            else
+            {
+                newCenter.y() -= halfSize;
+                octant |= 2;
+            }
+
+            if (center.z() >= root.center.z())
+                newCenter.z() += halfSize;
+            else
+            {
+                newCenter.z() -= halfSize;
+                octant |= 4;
+            }
+
+            int32_t newRoot = allocateCell(newCenter, halfSize * Real(2.0), E_NULL_CELL);
+            mCells[newRoot].children[octant] = mRoot;
+            mCells[newRoot].count = mCells[mRoot].count;
+            mCells[mRoot].parent = newRoot;
+            mRoot = newRoot;
+        }
+    }
+
+    int32_t LooseOctree::findCell(const Vector3 &center, Real radius)
+    {
+        growRoot(center, radius);
+
+        int32_t index = mRoot;
+
+        while (true)
+        {
+            const Cell &cell = mCells[index];
+            Real childHalf = cell.halfSize * Real(0.5);
+
+            // 对象比子单元大，或者已经是最小单元，就放在这一层
+            if (childHalf < mMinHalfSize || radius > childHalf)
+                break;
+
+            uint32_t octant = 0;
+            Vector3 childCenter = cell.center;
+
+            if (center.x() >= cell.center.x())
+            {
+                octant |= 1;
+                childCenter.x() += childHalf;
+            }
+            else
+                childCenter.x() -= childHalf;
+
+            if (center.y() >= cell.center.y())
+            {
+                octant |= 2;
+                childCenter.y() += childHalf;
+            }
+            else
+                childCenter.y() -= childHalf;
+
+            if (center.z() >= cell.center.z())
+            {
+                octant |= 4;
+                childCenter.z() += childHalf;
+            }
+            else
+                childCenter.z() -= childHalf;
+
+            int32_t child = cell.children[octant];
+
+            if (child == E_NULL_CELL)
+            {
+                // 分配单元可能让数组扩容，不能再用前面取到的引用
+                child = allocateCell(childCenter, childHalf, index);
+                mCells[index].children[octant] = child;
+            }
+
+            index = child;
+        }
+
+        return index;
+    }
+
+    void LooseOctree::link(uint32_t item, int32_t cell)
+    {
+        Item &it = mItems[item];
+        it.cell = cell;
+        it.slot = uint32_t(mCells[cell].items.size());
+        mCells[cell].items.push_back(item);
+
+        while (cell != E_NULL_CELL)
+        {
+            ++mCells[cell].count;
+            cell = mCells[cell].parent;
+        }
+    }
+
+    void LooseOctree::unlink(uint32_t item)
+    {
+        Item &it = mItems[item];
+        Cell &cell = mCells[it.cell];
+
+        // 用最后一个对象填补空位
+        uint32_t last = cell.items.back();
+        cell.items[it.slot] = last;
+        mItems[last].slot = it.slot;
+        cell.items.pop_back();
+
+        int32_t index = it.cell;
+        int32_t empty = E_NULL_CELL;
+
+        while (index != E_NULL_CELL)
+        {
+            Cell &c = mCells[index];
+            --c.count;
+
+            if (c.count == 0 && index != mRoot)
+                empty = index;
+
+            index = c.parent;
+        }
+
+        if (empty != E_NULL_CELL)
+        {
+            // 回收最上面一个空的子树
+            Cell &parent = mCells[mCells[empty].parent];
+
+            int32_t i = 0;
+            for (i = 0; i < E_MAX_CHILDREN; ++i)
+            {
+                if (parent.children[i] == empty)
+                {
+                    parent.children[i] = E_NULL_CELL;
+                    break;
+                }
+            }
+
+            freeCells(empty);
+        }
+
+        it.cell = E_NULL_CELL;
+    }
+
+    void LooseOctree::getBox(const Aabb &box, Vector3 &minPos, Vector3 &maxPos, Vector3 &center, Real &radius)
+    {
+        minPos = Vector3(box.getMinX(), box.getMinY(), box.getMinZ());
+        maxPos = Vector3(box.getMaxX(), box.getMaxY(), box.getMaxZ());
+        center = (minPos + maxPos) * Real(0.5);
+        radius = std::max(box.getWidth(), std::max(box.getHeight(), box.getDepth())) * Real(0.5);
+    }
+
+    uint32_t LooseOctree::insert(SGRenderable *renderable, const Aabb &box)
+    {
+        uint32_t index;
+
+        if (!mFreeItems.empty())
+        {
+            index = mFreeItems.back();
+            mFreeItems.pop_back();
+        }
+        else
+        {
+            index = uint32_t(mItems.size());
+            mItems.push_back(Item());
+        }
+
+        Vector3 center;
+        Real radius;
+        Item &item = mItems[index];
+        item.renderable = renderable;
+        getBox(box, item.minPos, item.maxPos, center, radius);
+
+        link(index, findCell(center, radius));
+        ++mCount;
+        return index;
+    }
+
+    void LooseOctree::update(uint32_t proxy, const Aabb &box)
+    {
+        T3D_ASSERT(proxy < mItems.size() && mItems[proxy].renderable != nullptr);
+
+        Vector3 center;
+        Real radius;
+        Item &item = mItems[proxy];
+        getBox(box, item.minPos, item.maxPos, center, radius);
+
+        // 还在原来单元的松散范围里，不用移动
+        if (fits(mCells[item.cell], center, radius))
+            return;
+
+        unlink(proxy);
+        link(proxy, findCell(center, radius));
+    }
+
+    void LooseOctree::remove(uint32_t proxy)
+    {
+        T3D_ASSERT(proxy < mItems.size() && mItems[proxy].renderable != nullptr);
+
+        unlink(proxy);
+        mItems[proxy].renderable = nullptr;
+        mFreeItems.push_back(proxy);
+        --mCount;
+
+        if (mCount == 0)
+        {
+            clear();
+        }
+    }
+
+    void LooseOctree::clear()
+    {
+        mCells.clear();
+        mFreeCells.clear();
+        mItems.clear();
+        mFreeItems.clear();
+        mRoot = E_NULL_CELL;
+        mCount = 0;
+    }
+
+    void LooseOctree::query(const Frustum &frustum, Renderables &result) const
+    {
+        mVisitedCount = 0;
+
+        if (mRoot != E_NULL_CELL)
+        {
+            queryCell(mRoot, frustum, Frustum::E_FACE_MASK_ALL, result);
+        }
+    }
+
+    void LooseOctree::query(const Aabb &box, Renderables &result) const
+    {
+        mVisitedCount = 0;
+
+        if (mRoot != E_NULL_CELL)
+        {
+            Vector3 minPos(box.getMinX(), box.getMinY(), box.getMinZ());
+            Vector3 maxPos(box.getMaxX(), box.getMaxY(), box.getMaxZ());
+            queryCell(mRoot, minPos, maxPos, result);
+        }
+    }
+
+    void LooseOctree::collect(Renderables &result) const
+    {
+        ItemsConstItr itr = mItems.begin();
+        while (itr != mItems.end())
+        {
+            if (itr->renderable != nullptr)
+            {
+                result.push_back(itr->renderable);
+            }
+
+            ++itr;
+        }
+    }
+
+    void LooseOctree::queryCell(int32_t index, const Frustum &frustum, uint32_t mask, Renderables &result) const
+    {
+        const Cell &cell = mCells[index];
+
+        if (cell.count == 0)
+            return;
+
+        ++mVisitedCount;
+
+        if (mask != Frustum::E_FACE_MASK_NONE)
+        {
+            Real loose = cell.halfSize * Real(2.0);
+            Vector3 extent(loose, loose, loose);
+
+            if (!testFrustum(cell.center - extent, cell.center + extent, frustum, mask))
+                return;
+        }
+
+        ItemIndices::const_iterator itr = cell.items.begin();
+        while (itr != cell.items.end())
+        {
+            const Item &item = mItems[*itr];
+            uint32_t itemMask = mask;
+
+            // 单元完全在视景体里的，里面的对象不用再测试
+            if (itemMask == Frustum::E_FACE_MASK_NONE
+                || testFrustum(item.minPos, item.maxPos, frustum, itemMask))
+            {
+                result.push_back(item.renderable);
+            }
+
+            ++itr;
+        }
+
+        int32_t i = 0;
+        for (i = 0; i < E_MAX_CHILDREN; ++i)
+        {
+            if (cell.children[i] != E_NULL_CELL)
+            {
+                queryCell(cell.children[i], frustum, mask, result);
+            }
+        }
+    }
+
+    void LooseOctree::queryCell(int32_t index, const Vector3 &minPos, const Vector3 &maxPos, Renderables &result) const
+    {
+        const Cell &cell = mCells[index];
+
+        if (cell.count == 0)
+            return;
+
+        ++mVisitedCount;
+
+        Real loose = cell.halfSize * Real(2.0);
+        Vector3 extent(loose, loose, loose);
+
+        if (!testOverlap(cell.center - extent, cell.center + extent, minPos, maxPos))
+            return;
+
+        ItemIndices::const_iterator itr = cell.items.begin();
+        while (itr != cell.items.end())
+        {
+            const Item &item = mItems[*itr];
+
+            if (testOverlap(item.minPos, item.maxPos, minPos, maxPos))
+            {
+                result.push_back(item.renderable);
+            }
+
+            ++itr;
+        }
+
+        int32_t i = 0;
+        for (i = 0; i < E_MAX_CHILDREN; ++i)
+        {
+            if (cell.children[i] != E_NULL_CELL)
+            {
+                queryCell(cell.children[i], minPos, maxPos, result);
+            }
+        }
+    }
+}
@@ -23,6 +23,8 @@
 
 namespace Tiny3D
 {
+    T3D_IMPLEMENT_POOL_ALLOCATOR(SGBone, 64);
+
     SGBonePtr SGBone::create(ObjectPtr data /* = nullptr */, uint32_t unID /* = E_NID_AUTOMATIC */)
     {
         SGBonePtr bone = new SGBone(unID);
@@ -42,6 +44,7 @@ namespace Tiny3D
     SGBone::SGBone(uint32_t unID /* = E_NID_AUTOMATIC */)
         : SGTransformNode(unID)
         , mBoneData(nullptr)
+        , mFinalVersion(0)
     {
 
     }
@@ -66,12 +69,15 @@ namespace Tiny3D
 
     void SGBone::updateTransform()
     {
-        bool isTransformDirty = isDirty();
-
         SGTransformNode::updateTransform();
 
-        if (isTransformDirty)
+        // 自己或者任何祖先的变换变了，世界变换版本号都会变
+        uint32_t version = getWorldVersion();
+
+        if (version != mFinalVersion)
         {
+            mFinalVersion = version;
+
             const Matrix4 &matCombine = getLocalToWorldTransform().getAffineMatrix();
             Matrix4 matLocal = getLocalTransform().getAffineMatrix();
 //             matCombine.printLog(getName() + " matCombine : ");
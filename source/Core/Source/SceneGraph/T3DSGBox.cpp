@@ -45,9 +45,9 @@ namespace Tiny3D
         , mVertexData(nullptr)
         , mIndexData(nullptr)
     {
-        // ΪһҪӦһUV޷8ʾһ壬
-        // Ҫÿ4ʾ
-        // 嶥㶨£
+        // 因为一个顶点要对应一个纹理UV，所以这里无法用8个顶点表示一个立方体，
+        // 而需要每个立方体面用4个顶点表示
+        // 正方体顶点定义如下：
         //
         //          v6-------v4
         //          /|       /|
@@ -58,7 +58,7 @@ namespace Tiny3D
         //        |/       |/
         //        v1-------v3
         //
-        // ֽ6Ϊ
+        // 分界成6个面为：
         //
         //         v0-------v2          v6-------v0          v6-------v4
         //         |         |          |         |          |         |
@@ -73,7 +73,7 @@ namespace Tiny3D
         //         v5-------v7          v3-------v5          v7-------v5
 
 
-        // 㻺
+        // 创建顶点缓存
         // Front
 //         mVertices[0].position = Vector3(-50.0, 50.0, 100.0);
 //         mVertices[0].texcoord = Vector2(0.0, 0.0);
@@ -210,7 +210,7 @@ namespace Tiny3D
         mVertexData = VertexData::create(vertexDecl);
         mVertexData->addVertexBuffer(vertexBuffer);
 
-        // 
+        // 创建索引缓存
         const uint16_t indices[] =
         {
 //             // front face
@@ -271,6 +271,8 @@ namespace Tiny3D
         mMaterial->setEmissiveColor(Color4::WHITE);
         mMaterial->setTexture(0, "blocks.png");
 
+        updateLocalBound();
+
         return true;
     }
 
@@ -441,6 +443,31 @@ namespace Tiny3D
 
         size_t vertexCount = sizeof(mVertices) / sizeof(Vertex);
         vertexBuffer->writeData(0, vertexSize * vertexCount, mVertices, true);
+
+        updateLocalBound();
+    }
+
+    void SGBox::updateLocalBound()
+    {
+        Vector3 minPos = mVertices[0].position;
+        Vector3 maxPos = mVertices[0].position;
+        size_t vertexCount = sizeof(mVertices) / sizeof(Vertex);
+        size_t i = 0;
+
+        for (i = 1; i < vertexCount; ++i)
+        {
+            const Vector3 &pos = mVertices[i].position;
+            minPos.x() = std::min(minPos.x(), pos.x());
+            minPos.y() = std::min(minPos.y(), pos.y());
+            minPos.z() = std::min(minPos.z(), pos.z());
+            maxPos.x() = std::max(maxPos.x(), pos.x());
+            maxPos.y() = std::max(maxPos.y(), pos.y());
+            maxPos.z() = std::max(maxPos.z(), pos.z());
+        }
+
+        Aabb box;
+        box.setParam(minPos, maxPos);
+        setLocalBound(box);
     }
 
     NodePtr SGBox::clone() const
@@ -452,7 +479,7 @@ namespace Tiny3D
 
     void SGBox::cloneProperties(const NodePtr &node) const
     {
-        SGRenderable::cloneProperties(node);
+        SGGeometry::cloneProperties(node);
 
         const SGBoxPtr &newNode = smart_pointer_cast<SGBox>(node);
         size_t sizeInBytes = sizeof(mVertices);
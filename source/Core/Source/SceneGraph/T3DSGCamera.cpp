@@ -45,7 +45,9 @@ namespace Tiny3D
         , mNearDistance(Real(1.0))
         , mAspectRatio(Real(4.0)/Real(3.0))
         , mProjType(E_PT_PERSPECTIVE)
+        , mIsViewDirty(true)
         , mIsFrustumDirty(false)
+        , mParentWorldVersion(0)
     {
         mBound = FrustumBound::create(unID, this);
     }
@@ -89,13 +91,27 @@ namespace Tiny3D
 
     void SGCamera::updateTransform()
     {
+        // 父结点的变换不再递归设置子结点脏标记，这里比较世界变换版本号
+        SGTransformNode *parent = getTransformParent();
+
+        if (parent != nullptr)
+        {
+            uint32_t version = parent->getWorldVersion();
+
+            if (version != mParentWorldVersion)
+            {
+                mParentWorldVersion = version;
+                mIsViewDirty = true;
+            }
+        }
+
         bool isViewDirty = mIsViewDirty;
         bool isFrustumDirty = mIsFrustumDirty;
 
         getViewMatrix();
         getProjectionMatrix();
 
-        // Ƚ⣬ֱȸfrustum޷frustum culling
+        // 相机比较特殊，直接先更新自身的frustum，避免其他物体无法做frustum culling
         if (isViewDirty || isFrustumDirty)
         {
             updateBound();
@@ -121,24 +137,24 @@ namespace Tiny3D
     {
         if (mIsViewDirty)
         {
-            // ͼƵ
-            // C任ľTƽƱ任Rת任Sű任
-            //  C = T * R * S
-            //  C(-1) = (T * R * S) (-1) = S(-1) * R(-1) * T(-1)
+            // 视图矩阵推导：
+            // 其中C是相机进行世界变换的矩阵，T是平移变换，R是旋转变换，S是缩放变换
+            // 由 C = T * R * S
+            // 得 C(-1) = (T * R * S) (-1) = S(-1) * R(-1) * T(-1)
             // 
             Node *parent = getParent();
             SGTransformNode *node = (SGTransformNode *)parent;
             T3D_ASSERT(node->getNodeType() == E_NT_TRANSFORM);
 
             const Transform &transform = node->getLocalToWorldTransform();
-            // ת
+            // 旋转矩阵
             Matrix4 R = transform.getOrientation();
-            /// תתþ
+            /// 旋转矩阵是正交矩阵，正交矩阵的逆矩阵是其转置矩阵
             Matrix4 invertR = R.transpose();
-            // ƽƾ
+            // 平移矩阵
             Matrix4 invertT(false);
             invertT.makeTranslate(-transform.getTranslate());
-            // ž
+            // 缩放矩阵
             Matrix4 invertS(false);
             const Vector3 &scale = transform.getScale();
             invertS[0][0] = Real(1.0) / scale.x();
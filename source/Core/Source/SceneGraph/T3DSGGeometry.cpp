@@ -18,13 +18,20 @@
  ******************************************************************************/
 
 #include "SceneGraph/T3DSGGeometry.h"
+#include "SceneGraph/T3DSGTransformNode.h"
+#include "SceneGraph/T3DSceneManager.h"
 #include "Render/T3DRenderQueue.h"
+#include "Render/T3DOcclusionCuller.h"
+#include "Bound/T3DFrustumBound.h"
 
 
 namespace Tiny3D
 {
     SGGeometry::SGGeometry(uint32_t uID /* = E_NID_AUTOMATIC */)
         : SGRenderable(uID)
+        , mBoundVersion(0)
+        , mHasLocalBound(false)
+        , mIsBoundDirty(true)
     {
 
     }
@@ -34,8 +41,119 @@ namespace Tiny3D
 
     }
 
+    void SGGeometry::setLocalBound(const Aabb &box)
+    {
+        mLocalBound = box;
+        mHasLocalBound = true;
+        mIsBoundDirty = true;
+    }
+
+    void SGGeometry::removeLocalBound()
+    {
+        mHasLocalBound = false;
+        mIsBoundDirty = true;
+    }
+
+    const Aabb *SGGeometry::getSpatialBound() const
+    {
+        return (mHasLocalBound ? &mWorldBound : nullptr);
+    }
+
+    void SGGeometry::updateEnclosingBound()
+    {
+        if (!mHasLocalBound)
+        {
+            // 范围未知，整棵子树都不能用包围盒剔除，也要从空间索引移除
+            if (isInSpatialIndex())
+            {
+                notifySpatialBoundChanged();
+            }
+
+            mBoundState = E_BS_INFINITE;
+            return;
+        }
+
+        SGTransformNode *parent = getTransformParent();
+        uint32_t version = (parent != nullptr ? parent->getWorldVersion() : 0);
+
+        if (mIsBoundDirty || version != mBoundVersion)
+        {
+            // 变换没变的不用重新拟合
+            if (parent != nullptr)
+            {
+                const Matrix4 &m = parent->getLocalToWorldTransform().getAffineMatrix();
+                mLocalBound.transform(m, mWorldBound);
+            }
+            else
+            {
+                mWorldBound = mLocalBound;
+            }
+
+            mBoundVersion = version;
+            mIsBoundDirty = false;
+
+            notifySpatialBoundChanged();
+        }
+
+        mEnclosingBound = mWorldBound;
+        mBoundState = E_BS_FINITE;
+
+        auto itr = mChildren.begin();
+
+        while (itr != mChildren.end())
+        {
+            Node *child = *itr;
+            mergeEnclosingBound((SGNode *)child);
+            ++itr;
+        }
+    }
+
     void SGGeometry::frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue)
     {
-        queue->addRenderable(RenderQueue::E_GRPID_SOLID, this);
+        uint32_t parentMask = 0;
+
+        if (!isVisible() || !cullEnclosingBound(bound, parentMask))
+            return;
+
+        bool visible = true;
+
+        if (mHasLocalBound && T3D_SCENE_MGR.isCullingByIndex())
+        {
+            // 自己在空间索引里，由场景管理器查询后加入渲染队列
+            visible = false;
+        }
+        else if (!mChildren.empty() && mHasLocalBound
+            && bound != nullptr && bound->getType() == Bound::E_BT_FRUSTUM)
+        {
+            // 有子结点的，子树包围盒比自己的大，还要单独测试自己的包围盒
+            FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+            uint32_t mask = frustum->getPlaneMask();
+            visible = Math::intersects(mWorldBound, frustum->getFrustum(), mask);
+
+            OcclusionCuller *culler = T3D_SCENE_MGR.getFrameOcclusionCuller();
+
+            if (visible && culler != nullptr)
+            {
+                visible = !culler->isOccluded(mWorldBound);
+            }
+        }
+
+        if (visible)
+        {
+            addToRenderQueue(queue);
+        }
+
+        frustumCullingChildren(bound, queue);
+        restorePlaneMask(bound, parentMask);
+    }
+
+    void SGGeometry::cloneProperties(const NodePtr &node) const
+    {
+        SGRenderable::cloneProperties(node);
+
+        const SGGeometryPtr &newNode = smart_pointer_cast<SGGeometry>(node);
+        newNode->mLocalBound = mLocalBound;
+        newNode->mHasLocalBound = mHasLocalBound;
+        newNode->mIsBoundDirty = true;
     }
 }
@@ -24,14 +24,18 @@
 #include "Resource/T3DMaterialManager.h"
 #include "Misc/T3DModelData.h"
 #include "Render/T3DHardwareBufferManager.h"
+#include "SceneGraph/T3DSceneManager.h"
+#include "SceneGraph/T3DSGCamera.h"
 
 
 namespace Tiny3D
 {
-    SGMeshPtr SGMesh::create(VertexDataPtr vertexData, ObjectPtr submeshData, uint32_t uID /* = E_NID_AUTOMATIC */)
+    T3D_IMPLEMENT_POOL_ALLOCATOR(SGMesh, 32);
+
+    SGMeshPtr SGMesh::create(VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr submeshData, uint32_t uID /* = E_NID_AUTOMATIC */)
     {
         SGMeshPtr mesh = new SGMesh(uID);
-        if (mesh != nullptr && mesh->init(vertexData, submeshData))
+        if (mesh != nullptr && mesh->init(vertexData, meshData, submeshData))
         {
             mesh->release();
         }
@@ -44,8 +48,12 @@ namespace Tiny3D
 
     SGMesh::SGMesh(uint32_t uID /* = E_NID_AUTOMATIC */)
         : SGGeometry(uID)
+        , mMeshData(nullptr)
         , mSubMeshData(nullptr)
         , mMaterial(nullptr)
+        , mLodCenter(Vector3::ZERO)
+        , mLodRadius(Real(0.0))
+        , mLodLevel(0)
     {
 
     }
@@ -55,39 +63,163 @@ namespace Tiny3D
         T3D_MATERIAL_MGR.unloadMaterial(mMaterial);
     }
 
-    bool SGMesh::init(VertexDataPtr vertexData, ObjectPtr subData)
+    bool SGMesh::init(VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr subData)
     {
         bool ret = false;
 
         mVertexData = vertexData;
+        mMeshData = meshData;
         mSubMeshData = subData;
 
         SubMeshDataPtr submeshData = smart_pointer_cast<SubMeshData>(mSubMeshData);
 
+        mIndexData = createIndexData(submeshData->mIs16Bits, submeshData->mIndices);
+
+        if (mIndexData != nullptr)
+        {
+            mMaterial = T3D_MATERIAL_MGR.loadMaterial(submeshData->mMaterialName, Material::E_MT_DEFAULT);
+            initBound();
+            ret = initLod();
+        }
+
+        return ret;
+    }
+
+    IndexDataPtr SGMesh::createIndexData(bool is16Bits, const std::vector<uint8_t> &indices) const
+    {
+        IndexDataPtr indexData = nullptr;
+
         HardwareIndexBuffer::Type indexType = HardwareIndexBuffer::E_IT_32BITS;
-        size_t indexCount = submeshData->mIndices.size() / sizeof(uint32_t);
+        size_t indexCount = indices.size() / sizeof(uint32_t);
 
-        if (submeshData->mIs16Bits)
+        if (is16Bits)
         {
             indexType = HardwareIndexBuffer::E_IT_16BITS;
-            indexCount = submeshData->mIndices.size() / sizeof(uint16_t);
+            indexCount = indices.size() / sizeof(uint16_t);
         }
 
         HardwareIndexBufferPtr indexBuffer = T3D_HARDWARE_BUFFER_MGR.createIndexBuffer(indexType, indexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
 
-        if (indexBuffer != nullptr)
+        if (indexBuffer != nullptr && indexBuffer->writeData(0, indices.size(), &indices[0]))
         {
-            size_t indexSize = submeshData->mIndices.size();
-            ret = indexBuffer->writeData(0, indexSize, &submeshData->mIndices[0]);
+            indexData = IndexData::create(indexBuffer);
+        }
 
-            if (ret)
+        return indexData;
+    }
+
+    void SGMesh::initBound()
+    {
+        SubMeshDataPtr submeshData = smart_pointer_cast<SubMeshData>(mSubMeshData);
+
+        // 找位置属性所在的顶点缓冲
+        MeshDataPtr meshData = smart_pointer_cast<MeshData>(mMeshData);
+        VertexBufferPtr positions = nullptr;
+        size_t offset = 0;
+
+        auto itr = meshData->mBuffers.begin();
+        while (itr != meshData->mBuffers.end() && positions == nullptr)
+        {
+            VertexBufferPtr buffer = *itr;
+            auto i = buffer->mAttributes.begin();
+            while (i != buffer->mAttributes.end())
             {
-                mIndexData = IndexData::create(indexBuffer);
-                mMaterial = T3D_MATERIAL_MGR.loadMaterial(submeshData->mMaterialName, Material::E_MT_DEFAULT);
+                const VertexElement &element = *i;
+                if (element.getSemantic() == VertexElement::E_VES_POSITION
+                    && (element.getType() == VertexElement::E_VET_FLOAT3 || element.getType() == VertexElement::E_VET_FLOAT4))
+                {
+                    positions = buffer;
+                    offset = element.getOffset();
+                    break;
+                }
+                ++i;
             }
+            ++itr;
         }
 
-        return ret;
+        if (positions == nullptr || submeshData->mIndices.empty())
+        {
+            // 没有位置的不知道范围，不参与剔除
+            return;
+        }
+
+        // 只统计本子网格用到的顶点，共享顶点缓冲里还有其他子网格的顶点
+        size_t indexSize = (submeshData->mIs16Bits ? sizeof(uint16_t) : sizeof(uint32_t));
+        size_t indexCount = submeshData->mIndices.size() / indexSize;
+        size_t vertexCount = positions->mVertices.size() / positions->mVertexSize;
+        Vector3 minPos, maxPos;
+        bool isFirst = true;
+        size_t i = 0;
+
+        for (i = 0; i < indexCount; ++i)
+        {
+            size_t index = submeshData->mIs16Bits
+                ? ((const uint16_t *)&submeshData->mIndices[0])[i]
+                : ((const uint32_t *)&submeshData->mIndices[0])[i];
+            if (index >= vertexCount)
+                continue;
+
+            const float *value = (const float *)&positions->mVertices[index * positions->mVertexSize + offset];
+            Vector3 pos(value[0], value[1], value[2]);
+
+            if (isFirst)
+            {
+                minPos = maxPos = pos;
+                isFirst = false;
+            }
+            else
+            {
+                minPos.x() = std::min(minPos.x(), pos.x());
+                minPos.y() = std::min(minPos.y(), pos.y());
+                minPos.z() = std::min(minPos.z(), pos.z());
+                maxPos.x() = std::max(maxPos.x(), pos.x());
+                maxPos.y() = std::max(maxPos.y(), pos.y());
+                maxPos.z() = std::max(maxPos.z(), pos.z());
+            }
+        }
+
+        if (!isFirst)
+        {
+            Aabb box;
+            box.setParam(minPos, maxPos);
+            setLocalBound(box);
+        }
+    }
+
+    bool SGMesh::initLod()
+    {
+        SubMeshDataPtr submeshData = smart_pointer_cast<SubMeshData>(mSubMeshData);
+
+        if (submeshData->mLods.empty())
+            return true;
+
+        if (!hasLocalBound())
+        {
+            T3D_LOG_WARNING("Mesh %s has LOD data but no position, LOD disabled !", submeshData->mName.c_str());
+            return true;
+        }
+
+        // 选LOD用的包围球就是本地包围盒的外接球
+        mLodCenter = mLocalBound.getCenter();
+        mLodRadius = mLocalBound.getRadius();
+
+        mLodIndexData.reserve(submeshData->mLods.size());
+
+        auto lod = submeshData->mLods.begin();
+        while (lod != submeshData->mLods.end())
+        {
+            IndexDataPtr indexData = createIndexData(lod->mIs16Bits, lod->mIndices);
+            if (indexData == nullptr)
+            {
+                // 只保留前面创建成功的几级
+                break;
+            }
+
+            mLodIndexData.push_back(indexData);
+            ++lod;
+        }
+
+        return true;
     }
 
     Node::Type SGMesh::getNodeType() const
@@ -97,7 +229,23 @@ namespace Tiny3D
 
     NodePtr SGMesh::clone() const
     {
-        SGMeshPtr mesh = create(mVertexData, mSubMeshData);
+        return createInstance(mVertexData);
+    }
+
+    SGMeshPtr SGMesh::createInstance(VertexDataPtr vertexData, uint32_t uID /* = E_NID_AUTOMATIC */) const
+    {
+        SGMeshPtr mesh = new SGMesh(uID);
+        mesh->release();
+
+        mesh->mVertexData = vertexData;
+        mesh->mMeshData = mMeshData;
+        mesh->mSubMeshData = mSubMeshData;
+        mesh->mIndexData = mIndexData;
+        mesh->mMaterial = mMaterial;
+        mesh->mLodIndexData = mLodIndexData;
+        mesh->mLodCenter = mLodCenter;
+        mesh->mLodRadius = mLodRadius;
+
         cloneProperties(mesh);
         return mesh;
     }
@@ -131,6 +279,11 @@ namespace Tiny3D
 
     IndexDataPtr SGMesh::getIndexData() const
     {
+        if (mLodLevel > 0)
+        {
+            return mLodIndexData[mLodLevel - 1];
+        }
+
         return mIndexData;
     }
 
@@ -143,4 +296,62 @@ namespace Tiny3D
     {
         SGGeometry::updateTransform();
     }
+
+    void SGMesh::addToRenderQueue(const RenderQueuePtr &queue)
+    {
+        // 只给通过了剔除的网格选LOD
+        if (!mLodIndexData.empty())
+        {
+            selectLod(T3D_SCENE_MGR.getCurCamera());
+        }
+
+        SGGeometry::addToRenderQueue(queue);
+    }
+
+    void SGMesh::selectLod(const SGCameraPtr &camera)
+    {
+        if (camera == nullptr || camera->getProjectionType() != SGCamera::E_PT_PERSPECTIVE)
+            return;
+
+        // 切换阈值上下各留一段缓冲区，在阈值附近来回移动时不会反复切换
+        const Real hysteresis = Real(0.15);
+
+        // 包围球变换到视空间，半径取世界矩阵里最大的缩放
+        const Matrix4 &world = getWorldMatrix();
+        Vector3 center = camera->getViewMatrix().transformAffine(world.transformAffine(mLodCenter));
+
+        Real scaleX = world[0][0] * world[0][0] + world[1][0] * world[1][0] + world[2][0] * world[2][0];
+        Real scaleY = world[0][1] * world[0][1] + world[1][1] * world[1][1] + world[2][1] * world[2][1];
+        Real scaleZ = world[0][2] * world[0][2] + world[1][2] * world[1][2] + world[2][2] * world[2][2];
+        Real radius = mLodRadius * Math::Sqrt(std::max(scaleX, std::max(scaleY, scaleZ)));
+
+        Real distance = center.length();
+        Real tanHalfFov = Math::Tan(camera->getFovY() * Real(0.5));
+
+        if (distance <= radius || tanHalfFov <= Real(0.0))
+        {
+            mLodLevel = 0;
+            return;
+        }
+
+        // 包围球直径投影后占视口高度的比例
+        Real screenSize = radius / (distance * tanHalfFov);
+
+        SubMeshDataPtr submeshData = smart_pointer_cast<SubMeshData>(mSubMeshData);
+        const SubMeshData::LodList &lods = submeshData->mLods;
+        size_t count = mLodIndexData.size();
+        size_t level = std::min(mLodLevel, count);
+
+        while (level < count && screenSize < lods[level].mScreenSize * (Real(1.0) - hysteresis))
+        {
+            ++level;
+        }
+
+        while (level > 0 && screenSize > lods[level - 1].mScreenSize * (Real(1.0) + hysteresis))
+        {
+            --level;
+        }
+
+        mLodLevel = level;
+    }
 }
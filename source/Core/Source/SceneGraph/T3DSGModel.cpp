@@ -26,6 +26,7 @@
 #include "Misc/T3DModelData.h"
 #include "Misc/T3DEntrance.h"
 #include "Render/T3DHardwareBufferManager.h"
+#include "Misc/T3DString.h"
 
 
 namespace Tiny3D
@@ -83,6 +84,7 @@ namespace Tiny3D
         , mIsActionRunning(false)
         , mIsLoop(false)
         , mCurActionData(nullptr)
+        , mSkinUploadCount(0)
     {
 
     }
@@ -94,104 +96,166 @@ namespace Tiny3D
 
     bool SGModel::init(const String &modelName)
     {
-        bool ret = false;
         mModel = T3D_MODEL_MGR.loadModel(modelName);
 
-        if (mModel != nullptr)
+        if (mModel == nullptr)
+            return false;
+
+        createMeshes(nullptr);
+        return createHierarchy();
+    }
+
+    bool SGModel::initInstance(const SGModel *source)
+    {
+        // 直接引用模板的模型资源，析构时照样通过unloadModel释放
+        mModel = source->mModel;
+
+        if (mModel == nullptr)
+            return false;
+
+        createMeshes(source);
+        return createHierarchy();
+    }
+
+    void SGModel::createMeshes(const SGModel *source)
+    {
+        ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
+
+        // 有骨骼的模型蒙皮要改写顶点，每个实例需要自己的蒙皮顶点流
+        bool isSkinned = (modelData->mBones.size() > 0);
+        size_t k = 0;
+
+        if (modelData->mIsVertexShared)
         {
-            ret = true;
+            // 共享顶点模式，只有一个mesh，多个submesh
+            T3D_ASSERT(modelData->mMeshes.size() == 1);
 
-            ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
+            // 创建共享的顶点数据对象
+            MeshDataPtr meshData = modelData->mMeshes[0];
+            VertexDataPtr vertexData;
+
+            if (source == nullptr)
+                vertexData = createVertexData(meshData);
+            else if (isSkinned)
+                vertexData = createInstanceVertexData(meshData, source->mVertexDataList[0]);
+            else
+                vertexData = source->mVertexDataList[0];
 
-            if (modelData->mIsVertexShared)
+            mVertexDataList.push_back(vertexData);
+
+            // 根据子网格数据逐个创建渲染用的网格对象
+            size_t submeshCount = meshData->mSubMeshes.size();
+            size_t i = 0;
+            mMeshes.resize(submeshCount);
+
+            auto itr = meshData->mSubMeshes.begin();
+            for (i = 0; i < submeshCount; ++i)
             {
-                // ģʽֻһmeshsubmesh
-                T3D_ASSERT(modelData->mMeshes.size() == 1);
+                mMeshes[i] = createMesh(source, k++, vertexData, meshData, *itr);
+                ++itr;
+            }
+        }
+        else
+        {
+            // 不共享顶点模式，有多个mesh和多个submesh
+            size_t meshCount = modelData->mMeshes.size();
+            size_t i = 0;
+            mVertexDataList.resize(meshCount);
+
+            for (i = 0; i < meshCount; ++i)
+            {
+                // 根据网格数据来逐个创建渲染用网格对象
+                MeshDataPtr meshData = modelData->mMeshes[i];
+                VertexDataPtr vertexData;
 
-                // Ķݶ
-                MeshDataPtr meshData = modelData->mMeshes[0];
-                VertexDataPtr vertexData = createVertexData(meshData);
-                mVertexDataList.push_back(vertexData);
+                if (source == nullptr)
+                    vertexData = createVertexData(meshData);
+                else if (isSkinned)
+                    vertexData = createInstanceVertexData(meshData, source->mVertexDataList[i]);
+                else
+                    vertexData = source->mVertexDataList[i];
 
-                // Ⱦõ
+                mVertexDataList[i] = vertexData;
+
+                // 根据子网格数据逐个创建渲染用的网格对象
+                size_t j = 0;
                 size_t submeshCount = meshData->mSubMeshes.size();
-                size_t i = 0;
-                mMeshes.resize(submeshCount);
 
                 auto itr = meshData->mSubMeshes.begin();
-                for (i = 0; i < submeshCount; ++i)
+                for (j = 0; j < submeshCount; ++j)
                 {
-                    SubMeshDataPtr submeshData = *itr;
-                    SGMeshPtr mesh = SGMesh::create(vertexData, submeshData);
-                    mesh->setName(meshData->mName);
-                    mMeshes[i] = mesh;
+                    mMeshes.push_back(createMesh(source, k++, vertexData, meshData, *itr));
                     ++itr;
                 }
             }
-            else
-            {
-                // ģʽжmeshͶsubmesh
-                size_t meshCount = modelData->mMeshes.size();
-                size_t i = 0;
-                mVertexDataList.resize(meshCount);
+        }
+    }
 
-                for (i = 0; i < meshCount; ++i)
-                {
-                    // Ⱦ
-                    MeshDataPtr meshData = modelData->mMeshes[i];
-                    VertexDataPtr vertexData = createVertexData(meshData);
-                    mVertexDataList[i] = vertexData;
-
-                    // Ⱦõ
-                    size_t j = 0;
-                    size_t submeshCount = meshData->mSubMeshes.size();
-
-                    auto itr = meshData->mSubMeshes.begin();
-                    for (j = 0; j < submeshCount; ++j)
-                    {
-                        SubMeshDataPtr submeshData = *itr;
-                        SGMeshPtr mesh = SGMesh::create(vertexData, submeshData);
-                        mesh->setName(meshData->mName);
-                        mMeshes.push_back(mesh);
-                        ++itr;
-                    }
-                }
-            }
+    SGMeshPtr SGModel::createMesh(const SGModel *source, size_t index, VertexDataPtr vertexData, ObjectPtr meshData, ObjectPtr submeshData)
+    {
+        SGMeshPtr mesh;
 
-            if (modelData->mNodes.size() > 0)
+        if (source != nullptr)
+        {
+            // 模板的网格和这里按同样的顺序创建，直接按下标取
+            T3D_ASSERT(index < source->mMeshes.size());
+            mesh = source->mMeshes[index]->createInstance(vertexData);
+        }
+        else
+        {
+            mesh = SGMesh::create(vertexData, meshData, submeshData);
+            mesh->setName(smart_pointer_cast<MeshData>(meshData)->mName);
+
+            // 蒙皮会改写顶点位置，绑定姿势下的包围盒不可靠，不参与视景体剔除。
+            // 实例从模板复制属性，不用再设置
+            ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
+            if (mesh != nullptr && modelData->mBones.size() > 0)
             {
-                // б任㣬򴴽н
-                ret = ret && createNodes();
+                mesh->removeLocalBound();
             }
-            else
+        }
+
+        return mesh;
+    }
+
+    bool SGModel::createHierarchy()
+    {
+        bool ret = true;
+        ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
+
+        if (modelData->mNodes.size() > 0)
+        {
+            // 有变换结点，则创建所有结点
+            ret = ret && createNodes();
+        }
+        else
+        {
+            // 没有变换结点，直接把所有mesh挂到model下
+            auto itr = mMeshes.begin();
+            while (itr != mMeshes.end())
             {
-                // ûб任㣬ֱӰmeshҵmodel
-                auto itr = mMeshes.begin();
-                while (itr != mMeshes.end())
-                {
-                    auto mesh = *itr;
-                    addChild(mesh);
-                    ++itr;
-                }
+                auto mesh = *itr;
+                addChild(mesh);
+                ++itr;
             }
+        }
 
-            if (modelData->mBones.size() > 0)
-            {
-                // κ͹ƫƾ
-                ret = createSkeletons();
+        if (modelData->mBones.size() > 0)
+        {
+            // 创建骨骼层次和骨骼偏移矩阵数组
+            ret = createSkeletons();
 
-                // ƣĬΪһĵһ֡
-                mStartTime = DateTime::currentMSecsSinceEpoch();
+            // 更新姿势，默认姿势为第一个动作的第一帧姿势
+            mStartTime = DateTime::currentMSecsSinceEpoch();
 
-                auto itr = modelData->mAnimations.begin();
-                mCurActionData = itr->second;
+            auto itr = modelData->mAnimations.begin();
+            mCurActionData = itr->second;
 
-                updatePoses();
-                updateSkeletons();
+            updatePoses();
+            updateSkeletons();
 
-                // Ƥ
-                updateSkins();
-            }
+            // 更新蒙皮
+            updateSkins();
         }
 
         return ret;
@@ -204,13 +268,20 @@ namespace Tiny3D
 
     NodePtr SGModel::clone() const
     {
-        SGModelPtr model = create(mModel->getName());
+        SGModelPtr model = new SGModel();
+
+        // 先复制属性再创建子结点，复制属性时新模型下还没有子结点
+        SGNode::cloneProperties(model);
 
-        if (model != nullptr)
+        if (model != nullptr && model->initInstance(this))
         {
-            SGNode::cloneProperties(model);
+            model->release();
         }
-        
+        else
+        {
+            T3D_SAFE_RELEASE(model);
+        }
+
         return model;
     }
 
@@ -218,17 +289,20 @@ namespace Tiny3D
     {
         if (isActionRunning())
         {
-            // ݶݣ¹
+            // 根据动作数据，更新骨骼姿势
             updatePoses();
 
-            // ݸºݣй任ɹձ任
+            // 根据更新后的姿势数据，更新所有骨骼变换生成骨骼最终变换
             updateSkeletons();
 
-            // ݹձ任Ƥ
+            // 根据骨骼最终变换更新蒙皮数据
             updateSkins();
+
+            // 蒙皮后的顶点在渲染线程上写入硬件缓冲区
+            requestPostUpdate();
         }
 
-        // ӽ任
+        // 更新所有子结点变换
         SGNode::updateTransform();
     }
 
@@ -270,7 +344,7 @@ namespace Tiny3D
 
         if (mSkeleton == nullptr)
         {
-            // ûɹȾȴ
+            // 没有生成过骨骼渲染对象，先创建
             mSkeleton = SGSkeleton::create(mRootBone);
         }
 
@@ -329,25 +403,76 @@ namespace Tiny3D
         itr = meshData->mBuffers.begin();
         while (itr != meshData->mBuffers.end())
         {
-            auto buffer = *itr;
-
-            size_t vertexCount = buffer->mVertices.size() / buffer->mVertexSize;
-            HardwareVertexBufferPtr vertexBuffer = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(buffer->mVertexSize, vertexCount, HardwareBuffer::E_HBU_WRITE_ONLY, false);
+            HardwareVertexBufferPtr vertexBuffer = createVertexBuffer(*itr);
 
             if (vertexDecl != nullptr && vertexBuffer != nullptr)
             {
-                if (vertexBuffer->writeData(0, buffer->mVertices.size(), &buffer->mVertices[0]))
+                vertexData->addVertexBuffer(vertexBuffer);
+            }
+
+            ++itr;
+        }
+
+        return vertexData;
+    }
+
+    VertexDataPtr SGModel::createInstanceVertexData(ObjectPtr data, VertexDataPtr shared)
+    {
+        MeshDataPtr meshData = smart_pointer_cast<MeshData>(data);
+
+        // 顶点声明创建后不会再修改，和模板共享
+        VertexDataPtr vertexData = VertexData::create(shared->getDeclaration());
+
+        auto itr = meshData->mBuffers.begin();
+        size_t stream = 0;
+        while (itr != meshData->mBuffers.end())
+        {
+            if (isSkinnedBuffer(*itr))
+            {
+                // 蒙皮顶点流每帧被改写，实例用自己的硬件缓冲区
+                HardwareVertexBufferPtr vertexBuffer = createVertexBuffer(*itr);
+
+                if (vertexBuffer != nullptr)
                 {
                     vertexData->addVertexBuffer(vertexBuffer);
                 }
             }
+            else if (stream < shared->getVertexBufferCount())
+            {
+                vertexData->addVertexBuffer(shared->getVertexBuffer(stream));
+            }
 
+            ++stream;
             ++itr;
         }
 
         return vertexData;
     }
 
+    HardwareVertexBufferPtr SGModel::createVertexBuffer(ObjectPtr data)
+    {
+        VertexBufferPtr buffer = smart_pointer_cast<VertexBuffer>(data);
+
+        size_t vertexCount = buffer->mVertices.size() / buffer->mVertexSize;
+        HardwareVertexBufferPtr vertexBuffer = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(buffer->mVertexSize, vertexCount, HardwareBuffer::E_HBU_WRITE_ONLY, false);
+
+        if (vertexBuffer != nullptr && !vertexBuffer->writeData(0, buffer->mVertices.size(), &buffer->mVertices[0]))
+        {
+            vertexBuffer = nullptr;
+        }
+
+        return vertexBuffer;
+    }
+
+    bool SGModel::isSkinnedBuffer(ObjectPtr buffer)
+    {
+        // 和updateSkinData()的判断一样，位置、权重、骨骼索引都有的才会被蒙皮改写
+        VertexElement element;
+        return getVertexElement(buffer, VertexElement::E_VES_POSITION, element)
+            && getVertexElement(buffer, VertexElement::E_VES_BLENDWEIGHT, element)
+            && getVertexElement(buffer, VertexElement::E_VES_BLENDINDICES, element);
+    }
+
     bool SGModel::createSkeletons()
     {
         ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
@@ -395,7 +520,7 @@ namespace Tiny3D
         
         mNodes.resize(modelData->mNodes.size());
 
-        // н
+        // 创建所有结点
         size_t i = 0;
         for (i = 0; i < modelData->mNodes.size(); ++i)
         {
@@ -412,7 +537,7 @@ namespace Tiny3D
             node->setOrientation(orientation);
         }
 
-        // νṹ
+        // 构建结点的树形结构
         for (i = 0; i < modelData->mNodes.size(); ++i)
         {
             auto nodeData = modelData->mNodes[i];
@@ -444,10 +569,16 @@ namespace Tiny3D
         bool found = false;
         size_t i = 0;
 
+        // 网格名称先比较名称ID，相同了再比较子网格名称
+        uint32_t nameID = NameTable::find(meshName);
+
+        if (nameID == NameTable::E_INVALID_NAME && !meshName.empty())
+            return false;
+
         for (i = 0; i < mMeshes.size(); ++i)
         {
-            auto target = mMeshes[i];
-            if (target->getName() == meshName && target->getSubMeshName() == submeshName)
+            const SGMeshPtr &target = mMeshes[i];
+            if (target->getNameID() == nameID && target->getSubMeshName() == submeshName)
             {
                 found = true;
                 mesh = target;
@@ -497,13 +628,13 @@ namespace Tiny3D
         mIsLoop = repeat;
         mIsActionRunning = true;
 
-        // ݶݣ¹
+        // 根据动作数据，更新骨骼姿势
         updatePoses();
 
-        // ݸºݣй任ɹձ任
+        // 根据更新后的姿势数据，更新所有骨骼变换生成骨骼最终变换
         updateSkeletons();
 
-        // ݹձ任Ƥ
+        // 根据骨骼最终变换更新蒙皮数据
         updateSkins();
 
         return true;
@@ -532,7 +663,7 @@ namespace Tiny3D
         
         KeyFrameDataPtr kf1, kf2;
 
-        // ƽƱ任
+        // 平移变换数据
         Vector3 translation;
         auto itrT = actionData->mBonesTranslation.find(bone->getName());
         if (itrT != actionData->mBonesTranslation.end())
@@ -555,7 +686,7 @@ namespace Tiny3D
             }
         }
 
-        // ת任
+        // 旋转变换数据
         Quaternion orientation;
         auto itrR = actionData->mBonesRotation.find(bone->getName());
         if (itrR != actionData->mBonesRotation.end())
@@ -595,7 +726,7 @@ namespace Tiny3D
             }
         }
 
-        // ű任
+        // 缩放变换数据
         Vector3 scaling;
         auto itrS = actionData->mBonesScaling.find(bone->getName());
         if (itrS != actionData->mBonesScaling.end())
@@ -633,11 +764,15 @@ namespace Tiny3D
 
     void SGModel::updateSkins()
     {
+        T3D_PROFILE_ZONE("SGModel::updateSkins");
+
         ModelDataPtr modelData = smart_pointer_cast<ModelData>(mModel->getModelData());
 
+        mSkinUploadCount = 0;
+
         if (modelData->mIsVertexShared)
         {
-            // ģʽֻһmeshsubmesh
+            // 共享顶点模式，只有一个mesh，多个submesh
             T3D_ASSERT(modelData->mMeshes.size() == 1);
 
             auto itr = mVertexDataList.begin();
@@ -646,14 +781,14 @@ namespace Tiny3D
         }
         else
         {
-            // ģʽжmeshͶsubmesh
+            // 不共享顶点模式，有多个mesh和多个submesh
             size_t meshCount = modelData->mMeshes.size();
             size_t i = 0;
             auto itr = mVertexDataList.begin();
 
             for (i = 0; i < meshCount; ++i)
             {
-                // Ⱦ
+                // 根据网格数据来逐个创建渲染用网格对象
                 MeshDataPtr meshData = modelData->mMeshes[i];
                 updateSkinData(meshData, *itr);
                 ++itr;
@@ -673,7 +808,16 @@ namespace Tiny3D
             size_t step = buffer->mVertexSize;
             size_t vertexCount = buffer->mVertices.size() / buffer->mVertexSize;
             size_t i = 0;
-            VertexBuffer::Vertices vertices(buffer->mVertices);
+
+            // 暂存区跨帧复用，只在第一次用到的时候分配
+            if (mSkinUploadCount == mSkinUploads.size())
+            {
+                mSkinUploads.push_back(SkinUpload());
+            }
+
+            SkinUpload &upload = mSkinUploads[mSkinUploadCount];
+            std::vector<uint8_t> &vertices = upload.vertices;
+            vertices.assign(buffer->mVertices.begin(), buffer->mVertices.end());
             VertexElement posElement;
             bool result = getVertexElement(buffer, VertexElement::E_VES_POSITION, posElement);
             VertexElement weightElement;
@@ -688,8 +832,8 @@ namespace Tiny3D
                     updateSkinVertex(buffer, &vertices[i], posElement, weightElement, indicesElement);
                 }
 
-                HardwareVertexBufferPtr vb = vertexData->getVertexBuffer(stream);
-                result = result && vb->writeData(0, buffer->mVertices.size(), &vertices[0]);
+                upload.buffer = vertexData->getVertexBuffer(stream);
+                ++mSkinUploadCount;
             }
 
             stream++;
@@ -697,6 +841,20 @@ namespace Tiny3D
         }
     }
 
+    void SGModel::postUpdateTransform()
+    {
+        size_t i = 0;
+
+        while (i < mSkinUploadCount)
+        {
+            SkinUpload &upload = mSkinUploads[i];
+            upload.buffer->writeData(0, upload.vertices.size(), &upload.vertices[0]);
+            ++i;
+        }
+
+        mSkinUploadCount = 0;
+    }
+
     void SGModel::updateSkinVertex(ObjectPtr buffer, void *vertex, const VertexElement &posElem, const VertexElement &weightElem, const VertexElement &indicesElem)
     {
         VertexBufferPtr vb = smart_pointer_cast<VertexBuffer>(buffer);
@@ -19,7 +19,12 @@
 
 #include "SceneGraph/T3DSGNode.h"
 #include "Render/T3DRenderQueue.h"
+#include "Render/T3DOcclusionCuller.h"
 #include "Resource/T3DMaterial.h"
+#include "SceneGraph/T3DSceneManager.h"
+#include "SceneGraph/T3DSGTransformNode.h"
+#include "Bound/T3DFrustumBound.h"
+#include "Misc/T3DString.h"
 
 
 namespace Tiny3D
@@ -28,7 +33,11 @@ namespace Tiny3D
         : Node(unID)
         , mUserData(0)
         , mUserObject(nullptr)
+        , mTransformParent(nullptr)
+        , mTransform2DParent(nullptr)
+        , mBoundState(E_BS_INFINITE)
         , mIsDirty(true)
+        , mIsVisible(true)
     {
 
     }
@@ -38,6 +47,19 @@ namespace Tiny3D
 
     }
 
+    void SGNode::setName(const String &name)
+    {
+        uint32_t oldNameID = getNameID();
+        Node::setName(name);
+
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        if (mgr != nullptr && oldNameID != getNameID())
+        {
+            mgr->renameNode(this, oldNameID);
+        }
+    }
+
     void SGNode::updateTransform()
     {
         auto itr = mChildren.begin();
@@ -48,9 +70,42 @@ namespace Tiny3D
             node->updateTransform();
             ++itr;
         }
+
+        // 子结点都更新完了，从下往上合并子树包围盒
+        updateEnclosingBound();
+    }
+
+    void SGNode::postUpdateTransform()
+    {
+
+    }
+
+    void SGNode::requestPostUpdate()
+    {
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        if (mgr != nullptr && mgr->isUpdatingInParallel())
+        {
+            mgr->addPostUpdateNode(this);
+        }
+        else
+        {
+            postUpdateTransform();
+        }
     }
 
     void SGNode::frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue)
+    {
+        uint32_t parentMask = 0;
+
+        if (!isVisible() || !cullEnclosingBound(bound, parentMask))
+            return;
+
+        frustumCullingChildren(bound, queue);
+        restorePlaneMask(bound, parentMask);
+    }
+
+    void SGNode::frustumCullingChildren(const BoundPtr &bound, const RenderQueuePtr &queue)
     {
         auto itr = mChildren.begin();
 
@@ -62,6 +117,87 @@ namespace Tiny3D
         }
     }
 
+    void SGNode::updateEnclosingBound()
+    {
+        mBoundState = E_BS_EMPTY;
+
+        auto itr = mChildren.begin();
+
+        while (itr != mChildren.end())
+        {
+            Node *child = *itr;
+            mergeEnclosingBound((SGNode *)child);
+            ++itr;
+        }
+    }
+
+    void SGNode::mergeEnclosingBound(const SGNode *node)
+    {
+        // 不可见的子树不参与渲染，当作空的
+        if (mBoundState == E_BS_INFINITE || !node->isVisible()
+            || node->mBoundState == E_BS_EMPTY)
+            return;
+
+        if (node->mBoundState == E_BS_INFINITE)
+        {
+            mBoundState = E_BS_INFINITE;
+        }
+        else if (mBoundState == E_BS_EMPTY)
+        {
+            mEnclosingBound = node->mEnclosingBound;
+            mBoundState = E_BS_FINITE;
+        }
+        else
+        {
+            mEnclosingBound.merge(node->mEnclosingBound);
+        }
+    }
+
+    bool SGNode::cullEnclosingBound(const BoundPtr &bound, uint32_t &parentMask) const
+    {
+        parentMask = Frustum::E_FACE_MASK_ALL;
+
+        if (mBoundState == E_BS_EMPTY)
+            return false;
+
+        if (bound == nullptr || bound->getType() != Bound::E_BT_FRUSTUM)
+            return true;
+
+        // 包围盒有限的子树里所有可渲染对象都在空间索引里，由场景管理器查询
+        if (mBoundState == E_BS_FINITE && SceneManager::getInstance().isCullingByIndex())
+            return false;
+
+        FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+        parentMask = frustum->getPlaneMask();
+
+        if (mBoundState != E_BS_FINITE)
+            return true;
+
+        uint32_t mask = parentMask;
+
+        if (mask != Frustum::E_FACE_MASK_NONE
+            && !Math::intersects(mEnclosingBound, frustum->getFrustum(), mask))
+            return false;
+
+        // 在视景体里的子树再看是否被遮挡体完全挡住
+        OcclusionCuller *culler = SceneManager::getInstance().getFrameOcclusionCuller();
+
+        if (culler != nullptr && culler->isOccluded(mEnclosingBound))
+            return false;
+
+        frustum->setPlaneMask(mask);
+        return true;
+    }
+
+    void SGNode::restorePlaneMask(const BoundPtr &bound, uint32_t parentMask) const
+    {
+        if (bound != nullptr && bound->getType() == Bound::E_BT_FRUSTUM)
+        {
+            FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+            frustum->setPlaneMask(parentMask);
+        }
+    }
+
     void SGNode::setDirty(bool isDirty, bool recursive /* = false */)
     {
         mIsDirty = isDirty;
@@ -88,6 +224,158 @@ namespace Tiny3D
         newNode->mUserObject = mUserObject;
     }
 
+    void SGNode::onAttachParent(const NodePtr &parent)
+    {
+        Node::onAttachParent(parent);
+
+        updateTransformParent(findTransformParent(parent), findTransform2DParent(parent));
+
+        if (isInScene(parent))
+        {
+            onEnterScene();
+        }
+    }
+
+    void SGNode::onDetachParent(const NodePtr &parent)
+    {
+        if (isInScene(parent))
+        {
+            onLeaveScene();
+        }
+
+        Node::onDetachParent(parent);
+
+        updateTransformParent(nullptr, nullptr);
+    }
+
+    void SGNode::updateTransformParent(SGTransformNode *parent, SGTransform2D *parent2D)
+    {
+        mTransformParent = parent;
+        mTransform2DParent = parent2D;
+
+        // 中间隔着非变换结点的，子结点最近的变换祖先也跟着变，2D变换结点把自己传给子结点
+        SGTransformNode *childParent = findTransformParent(this);
+        SGTransform2D *childParent2D = findTransform2DParent(this);
+        auto itr = mChildren.begin();
+
+        while (itr != mChildren.end())
+        {
+            const SGNodePtr &node = smart_pointer_cast<SGNode>(*itr);
+            node->updateTransformParent(childParent, childParent2D);
+            ++itr;
+        }
+    }
+
+    SGTransformNode *SGNode::findTransformParent(Node *node)
+    {
+        SGTransformNode *parent = nullptr;
+
+        if (node != nullptr)
+        {
+            if (node->getNodeType() == E_NT_TRANSFORM || node->getNodeType() == E_NT_BONE)
+            {
+                parent = (SGTransformNode *)node;
+            }
+            else
+            {
+                parent = ((SGNode *)node)->mTransformParent;
+            }
+        }
+
+        return parent;
+    }
+
+    SGTransform2D *SGNode::findTransform2DParent(Node *node)
+    {
+        SGTransform2D *parent = nullptr;
+
+        if (node != nullptr)
+        {
+            Type type = node->getNodeType();
+
+            if (type == E_NT_TRANSFORM2D)
+            {
+                parent = (SGTransform2D *)node;
+            }
+            else if (type != E_NT_TRANSFORM && type != E_NT_BONE)
+            {
+                parent = ((SGNode *)node)->mTransform2DParent;
+            }
+        }
+
+        return parent;
+    }
+
+    void SGNode::onEnterScene()
+    {
+        SceneManager::getInstance().registerNode(this);
+
+        auto itr = mChildren.begin();
+
+        while (itr != mChildren.end())
+        {
+            const SGNodePtr &node = smart_pointer_cast<SGNode>(*itr);
+            node->onEnterScene();
+            ++itr;
+        }
+    }
+
+    void SGNode::onLeaveScene()
+    {
+        SceneManager::getInstance().unregisterNode(this);
+
+        auto itr = mChildren.begin();
+
+        while (itr != mChildren.end())
+        {
+            const SGNodePtr &node = smart_pointer_cast<SGNode>(*itr);
+            node->onLeaveScene();
+            ++itr;
+        }
+    }
+
+    Node *SGNode::findChild(uint32_t nodeID) const
+    {
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        // 登记在结点索引里说明在场景里，子结点也都登记了
+        if (mgr != nullptr && mgr->findNode(getNodeID()) == this)
+        {
+            SGNode *node = mgr->findNode(nodeID);
+            return ((node != nullptr && (const Node *)node->getParent() == this) ? node : nullptr);
+        }
+
+        return Node::findChild(nodeID);
+    }
+
+    Node *SGNode::findNamedChild(uint32_t nameID) const
+    {
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        // 没有名称的结点不在名称索引里
+        if (nameID != NameTable::E_INVALID_NAME && mgr != nullptr && mgr->findNode(getNodeID()) == this)
+        {
+            return mgr->findNamedChild(this, nameID);
+        }
+
+        return Node::findNamedChild(nameID);
+    }
+
+    bool SGNode::isInScene(const Node *node)
+    {
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        if (mgr == nullptr || mgr->getRoot() == nullptr || node == nullptr)
+            return false;
+
+        while (node->getParent() != nullptr)
+        {
+            node = node->getParent();
+        }
+
+        return (node == mgr->getRoot());
+    }
+
     void SGNode::setVisible(bool visible)
     {
         mIsVisible = visible;
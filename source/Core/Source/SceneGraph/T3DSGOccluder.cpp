@@ -0,0 +1,164 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DSGOccluder.h"
+#include "SceneGraph/T3DSGTransformNode.h"
+#include "SceneGraph/T3DSceneManager.h"
+#include "Render/T3DOcclusionCuller.h"
+#include "T3DMath.h"
+
+
+namespace Tiny3D
+{
+    SGOccluderPtr SGOccluder::create(uint32_t uID /* = E_NID_AUTOMATIC */)
+    {
+        SGOccluder *occluder = new SGOccluder(uID);
+        SGOccluderPtr ptr(occluder);
+        occluder->release();
+        return ptr;
+    }
+
+    SGOccluder::SGOccluder(uint32_t uID /* = E_NID_AUTOMATIC */)
+        : SGNode(uID)
+    {
+
+    }
+
+    SGOccluder::~SGOccluder()
+    {
+
+    }
+
+    Node::Type SGOccluder::getNodeType() const
+    {
+        return E_NT_OCCLUDER;
+    }
+
+    NodePtr SGOccluder::clone() const
+    {
+        SGOccluderPtr occluder = create();
+        cloneProperties(occluder);
+        return occluder;
+    }
+
+    void SGOccluder::cloneProperties(const NodePtr &node) const
+    {
+        SGNode::cloneProperties(node);
+
+        const SGOccluderPtr &newNode = smart_pointer_cast<SGOccluder>(node);
+        newNode->mVertices = mVertices;
+        newNode->mIndices = mIndices;
+        newNode->mLocalBound = mLocalBound;
+    }
+
+    void SGOccluder::setMesh(const Vector3 *vertices, size_t vertexCount,
+        const uint16_t *indices, size_t indexCount)
+    {
+        T3D_ASSERT(indexCount % 3 == 0);
+
+        mVertices.assign(vertices, vertices + vertexCount);
+        mIndices.assign(indices, indices + indexCount);
+
+        if (vertexCount > 0)
+        {
+            Vector3 minPos = vertices[0];
+            Vector3 maxPos = vertices[0];
+
+            size_t i = 0;
+            for (i = 1; i < vertexCount; ++i)
+            {
+                const Vector3 &v = vertices[i];
+                minPos.x() = std::min(minPos.x(), v.x());
+                minPos.y() = std::min(minPos.y(), v.y());
+                minPos.z() = std::min(minPos.z(), v.z());
+                maxPos.x() = std::max(maxPos.x(), v.x());
+                maxPos.y() = std::max(maxPos.y(), v.y());
+                maxPos.z() = std::max(maxPos.z(), v.z());
+            }
+
+            mLocalBound.setParam(minPos, maxPos);
+        }
+    }
+
+    void SGOccluder::setBox(const Aabb &box)
+    {
+        Vector3 vertices[8];
+
+        size_t i = 0;
+        for (i = 0; i < 8; ++i)
+        {
+            vertices[i].x() = (i & 1) ? box.getMaxX() : box.getMinX();
+            vertices[i].y() = (i & 2) ? box.getMaxY() : box.getMinY();
+            vertices[i].z() = (i & 4) ? box.getMaxZ() : box.getMinZ();
+        }
+
+        // 六个面各两个三角形，不区分正反面
+        static const uint16_t indices[36] =
+        {
+            0, 2, 3,  0, 3, 1,      // -z
+            4, 5, 7,  4, 7, 6,      // +z
+            0, 1, 5,  0, 5, 4,      // -y
+            2, 6, 7,  2, 7, 3,      // +y
+            0, 4, 6,  0, 6, 2,      // -x
+            1, 3, 7,  1, 7, 5,      // +x
+        };
+
+        setMesh(vertices, 8, indices, 36);
+    }
+
+    const Matrix4 &SGOccluder::getWorldMatrix() const
+    {
+        SGTransformNode *parent = getTransformParent();
+
+        if (parent == nullptr)
+            return Matrix4::IDENTITY;
+
+        return parent->getLocalToWorldTransform().getAffineMatrix();
+    }
+
+    bool SGOccluder::rasterize(OcclusionCuller *culler, const Frustum &frustum) const
+    {
+        if (mIndices.empty())
+            return false;
+
+        const Matrix4 &world = getWorldMatrix();
+
+        Aabb box;
+        mLocalBound.transform(world, box);
+
+        if (!Math::intersects(box, frustum))
+            return false;
+
+        culler->rasterizeOccluder(world, &mVertices[0], mVertices.size(),
+            &mIndices[0], mIndices.size());
+        return true;
+    }
+
+    void SGOccluder::onEnterScene()
+    {
+        SGNode::onEnterScene();
+        T3D_SCENE_MGR.registerOccluder(this);
+    }
+
+    void SGOccluder::onLeaveScene()
+    {
+        T3D_SCENE_MGR.unregisterOccluder(this);
+        SGNode::onLeaveScene();
+    }
+}
@@ -20,12 +20,17 @@
 #include "SceneGraph/T3DSGRenderable.h"
 #include "SceneGraph/T3DSGTransformNode.h"
 #include "SceneGraph/T3DSGTransform2D.h"
+#include "SceneGraph/T3DSceneManager.h"
+#include "SceneGraph/T3DSpatialIndex.h"
+#include "Render/T3DRenderQueue.h"
 
 
 namespace Tiny3D
 {
     SGRenderable::SGRenderable(uint32_t unID /* = E_NID_AUTOMATIC */)
         : SGNode(unID)
+        , mQueueSlot(RenderQueue::E_INVALID_SLOT)
+        , mSpatialProxy(SpatialIndex::INVALID_PROXY)
     {
 
     }
@@ -36,29 +41,73 @@ namespace Tiny3D
 
     const Matrix4 &SGRenderable::getWorldMatrix() const
     {
-        NodePtr node = getParent();
-        while (node != nullptr 
-            && node->getNodeType() != E_NT_TRANSFORM
-            && node->getNodeType() != E_NT_TRANSFORM2D)
+        // 最近的变换祖先在挂接关系变化时已经缓存，2D变换祖先只在比3D变换祖先更近时才有
+        if (mTransform2DParent != nullptr)
         {
-            node = node->getParent();
+            return mTransform2DParent->getWorldMatrix();
         }
 
-        if (node != nullptr)
+        if (mTransformParent != nullptr)
         {
-            T3D_ASSERT(node->getNodeType() == E_NT_TRANSFORM || node->getNodeType() == E_NT_TRANSFORM2D);
-            if (node->getNodeType() == E_NT_TRANSFORM)
-            {
-                SGTransformNodePtr parent = smart_pointer_cast<SGTransformNode>(node);
-                return parent->getLocalToWorldTransform().getAffineMatrix();
-            }
-            else
-            {
-                SGTransform2DPtr parent = smart_pointer_cast<SGTransform2D>(node);
-                return parent->getLocalToWorldTransform().getAffineMatrix();
-            }
+            return mTransformParent->getLocalToWorldTransform().getAffineMatrix();
         }
 
         return Matrix4::IDENTITY;
     }
+
+    void SGRenderable::updateEnclosingBound()
+    {
+        mBoundState = E_BS_INFINITE;
+    }
+
+    void SGRenderable::addToRenderQueue(const RenderQueuePtr &queue)
+    {
+        queue->addRenderable(RenderQueue::E_GRPID_SOLID, this);
+    }
+
+    void SGRenderable::notifySpatialBoundChanged()
+    {
+        SceneManager *mgr = SceneManager::getInstancePtr();
+
+        // 不在场景里的对象不进索引，离开场景时也就不会留在登记列表里
+        if (mgr != nullptr && mgr->getSpatialIndex() != nullptr && isInScene(this))
+        {
+            mgr->addMovedRenderable(this);
+        }
+    }
+
+    bool SGRenderable::isInSpatialIndex() const
+    {
+        return (mSpatialProxy != SpatialIndex::INVALID_PROXY);
+    }
+
+    void SGRenderable::onEnterScene()
+    {
+        const RenderQueuePtr &queue = T3D_SCENE_MGR.getRenderQueue();
+
+        if (queue->isRetainedMode())
+        {
+            queue->registerRenderable(this);
+        }
+
+        // 包围盒要等这一帧更新完才是对的，登记下来，裁剪前再加入空间索引
+        if (mSpatialProxy == SpatialIndex::INVALID_PROXY)
+        {
+            notifySpatialBoundChanged();
+        }
+
+        SGNode::onEnterScene();
+    }
+
+    void SGRenderable::onLeaveScene()
+    {
+        SGNode::onLeaveScene();
+
+        if (mQueueSlot != RenderQueue::E_INVALID_SLOT)
+        {
+            T3D_SCENE_MGR.getRenderQueue()->unregisterRenderable(this);
+        }
+
+        T3D_SCENE_MGR.removeSpatialProxy(this);
+    }
 }
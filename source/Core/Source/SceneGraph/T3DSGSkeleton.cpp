@@ -122,16 +122,22 @@ namespace Tiny3D
 
     void SGSkeleton::updateVertices()
     {
-        std::vector<BoneVertex> vertices;
-        bool ret = buildSkeletonVertices(mSkeleton, vertices);
+        mVertices.clear();
+        bool ret = buildSkeletonVertices(mSkeleton, mVertices);
 
-        if (ret)
+        if (ret && !mVertices.empty())
         {
-            HardwareVertexBufferPtr vb = mVertexData->getVertexBuffer(0);
-            ret = vb->writeData(0, sizeof(BoneVertex) * vertices.size(), &vertices[0]);
+            // 顶点在渲染线程上写入硬件缓冲区
+            requestPostUpdate();
         }
     }
 
+    void SGSkeleton::postUpdateTransform()
+    {
+        HardwareVertexBufferPtr vb = mVertexData->getVertexBuffer(0);
+        vb->writeData(0, sizeof(BoneVertex) * mVertices.size(), &mVertices[0]);
+    }
+
     SGNode::Type SGSkeleton::getNodeType() const
     {
         return E_NT_SKELETON;
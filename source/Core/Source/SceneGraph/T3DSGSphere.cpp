@@ -78,6 +78,8 @@ namespace Tiny3D
 
         mIndexData = IndexData::create(indexBuffer);
 
+        setLocalBound(Aabb(-mRadius, mRadius, -mRadius, mRadius, -mRadius, mRadius));
+
         return true;
     }
 
@@ -95,7 +97,7 @@ namespace Tiny3D
 
     void SGSphere::cloneProperties(const NodePtr &node) const
     {
-        SGRenderable::cloneProperties(node);
+        SGGeometry::cloneProperties(node);
 
         const SGSpherePtr &newNode = (const SGSpherePtr &)node;
         newNode->mRadius = mRadius;
@@ -108,6 +110,8 @@ namespace Tiny3D
         void *vertices = mVertexData->getVertexBuffer(0)->lock(HardwareBuffer::E_HBL_DISCARD);
         loadVertices((Vector3*)vertices, vertexCount);
         mVertexData->getVertexBuffer(0)->unlock();
+
+        setLocalBound(Aabb(-mRadius, mRadius, -mRadius, mRadius, -mRadius, mRadius));
     }
 
     void SGSphere::loadVertices(Vector3 *vertices, size_t vertexCount)
@@ -18,6 +18,18 @@
  **************************************************************************************************/
 
 #include "SceneGraph/T3DSGSprite.h"
+#include "SceneGraph/T3DSGCamera.h"
+
+#include "Resource/T3DMaterial.h"
+#include "Resource/T3DTexture.h"
+
+#include "Render/T3DViewport.h"
+#include "Render/T3DRenderer.h"
+#include "Render/T3DRenderQueue.h"
+#include "Render/T3DVertexData.h"
+#include "Render/T3DIndexData.h"
+
+#include "Misc/T3DEntrance.h"
 
 
 namespace Tiny3D
@@ -38,6 +50,9 @@ namespace Tiny3D
 
     SGSprite::SGSprite(uint32_t uID /* = E_NID_AUTOMATIC */)
         : SGRenderable(uID)
+        , mIsBufferDirty(false)
+        , mAnchorPos(0.5f, 0.5f)
+        , mIsRectUV(false)
     {
 
     }
@@ -49,6 +64,14 @@ namespace Tiny3D
 
     bool SGSprite::init()
     {
+        mQuad.resize(E_VERTEX_COUNT);
+
+        mUVs[0] = Vector2(0.0f, 0.0f);
+        mUVs[1] = Vector2(0.0f, 1.0f);
+        mUVs[2] = Vector2(1.0f, 0.0f);
+        mUVs[3] = Vector2(1.0f, 1.0f);
+
+        setVerticesColor(Color4::WHITE);
         return true;
     }
 
@@ -59,32 +82,78 @@ namespace Tiny3D
 
     NodePtr SGSprite::clone() const
     {
-        return SGSprite::create();
+        SGSpritePtr sprite = SGSprite::create();
+
+        if (sprite != nullptr)
+        {
+            sprite->mMaterial = mMaterial;
+            sprite->mAnchorPos = mAnchorPos;
+            sprite->mSize = mSize;
+            sprite->mTexRect = mTexRect;
+            sprite->mIsRectUV = mIsRectUV;
+
+            size_t i = 0;
+            while (i < E_VERTEX_COUNT)
+            {
+                sprite->mUVs[i] = mUVs[i];
+                sprite->mColors[i] = mColors[i];
+                ++i;
+            }
+        }
+
+        return sprite;
+    }
+
+    void SGSprite::setMaterial(const MaterialPtr &material)
+    {
+        mMaterial = material;
+        setDirty(true);
     }
 
     void SGSprite::setTextureUV(size_t index, const Vector2 &uv)
     {
-
+        if (index < E_VERTEX_COUNT)
+        {
+            mUVs[index] = uv;
+            mIsRectUV = false;
+            setDirty(true);
+        }
     }
 
     void SGSprite::setTextureUV(const Rect &rect)
     {
-
+        // 纹理大小要等到渲染线程上生成顶点时才换算成UV
+        mTexRect = rect;
+        mIsRectUV = true;
+        setDirty(true);
     }
 
     void SGSprite::setVertexColor(size_t index, const Color4 &color)
     {
-
+        if (index < E_VERTEX_COUNT)
+        {
+            mColors[index] = color.A8R8G8B8();
+            setDirty(true);
+        }
     }
 
     void SGSprite::setVerticesColor(const Color4 &color)
     {
+        uint32_t c = color.A8R8G8B8();
+        size_t i = 0;
+        while (i < E_VERTEX_COUNT)
+        {
+            mColors[i] = c;
+            ++i;
+        }
 
+        setDirty(true);
     }
 
     void SGSprite::setAnchorPos(const Vector2 &pos)
     {
-
+        mAnchorPos = pos;
+        setDirty(true);
     }
 
     const Vector2 &SGSprite::getAnchorPos() const
@@ -94,7 +163,8 @@ namespace Tiny3D
 
     void SGSprite::setSize(const Size &size)
     {
-
+        mSize = size;
+        setDirty(true);
     }
 
     const Size &SGSprite::getSize() const
@@ -102,9 +172,106 @@ namespace Tiny3D
         return mSize;
     }
 
+    void SGSprite::updateTransform()
+    {
+        if (isDirty())
+        {
+            // 像素大小换算要用到视口，纹理区域换算要用到纹理，放到渲染线程上做
+            requestPostUpdate();
+        }
+
+        SGNode::updateTransform();
+    }
+
+    void SGSprite::postUpdateTransform()
+    {
+        updateVertices();
+        setDirty(false);
+    }
+
+    void SGSprite::updateVertices()
+    {
+        Renderer *renderer = T3D_ENTRANCE.getActiveRenderer();
+        ViewportPtr viewport = renderer->getViewport();
+        SGCameraPtr camera = viewport->getCamera();
+
+        // 和文字一样，把像素大小换算到覆盖层的坐标
+        Real width = Real(mSize.width) / Real(viewport->getActualWidth()) * camera->getAspectRatio();
+        Real height = Real(mSize.height) / Real(viewport->getActualHeight());
+        Real left = -mAnchorPos.x() * width;
+        Real bottom = -mAnchorPos.y() * height;
+        Real right = left + width;
+        Real top = bottom + height;
+        Real z(-0.5);
+
+        if (mIsRectUV && mMaterial != nullptr && mMaterial->getTexture(0) != nullptr)
+        {
+            Texture *texture = mMaterial->getTexture(0);
+            Real texWidth = Real(texture->getTexWidth());
+            Real texHeight = Real(texture->getTexHeight());
+            Real u0 = Real(mTexRect.left) / texWidth;
+            Real u1 = Real(mTexRect.right) / texWidth;
+            Real v0 = Real(mTexRect.top) / texHeight;
+            Real v1 = Real(mTexRect.bottom) / texHeight;
+
+            mUVs[0] = Vector2(u0, v0);
+            mUVs[1] = Vector2(u0, v1);
+            mUVs[2] = Vector2(u1, v0);
+            mUVs[3] = Vector2(u1, v1);
+        }
+
+        mQuad[0].position = Vector3(left, top, z);
+        mQuad[1].position = Vector3(left, bottom, z);
+        mQuad[2].position = Vector3(right, top, z);
+        mQuad[3].position = Vector3(right, bottom, z);
+
+        size_t i = 0;
+        while (i < E_VERTEX_COUNT)
+        {
+            mQuad[i].diffuse = mColors[i];
+            mQuad[i].texcoord = mUVs[i];
+            ++i;
+        }
+
+        mIsBufferDirty = true;
+    }
+
+    void SGSprite::updateBuffers() const
+    {
+        if (mIsBufferDirty)
+        {
+            // 只有不合批时才会用到单独的缓冲，所以到取缓冲时才生成
+            OverlayBatcher::createQuadBuffers(mQuad, mVertexData, mIndexData);
+            mIsBufferDirty = false;
+        }
+    }
+
     void SGSprite::frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue)
     {
+        if (isVisible())
+        {
+            if (mMaterial != nullptr && mSize.width > 0 && mSize.height > 0)
+            {
+                queue->addRenderable(RenderQueue::E_GRPID_OVERLAY, this);
+            }
+
+            SGNode::frustumCulling(bound, queue);
+        }
+    }
+
+    bool SGSprite::isOverlayBatchable() const
+    {
+        return true;
+    }
+
+    size_t SGSprite::getOverlayQuadCount() const
+    {
+        return 1;
+    }
 
+    void SGSprite::fillOverlayQuads(OverlayVertex *vertices) const
+    {
+        OverlayBatcher::transformQuads(&mQuad[0], E_VERTEX_COUNT, getWorldMatrix(), vertices);
     }
 
     MaterialPtr SGSprite::getMaterial() const
@@ -119,16 +286,18 @@ namespace Tiny3D
 
     VertexDataPtr SGSprite::getVertexData() const
     {
+        updateBuffers();
         return mVertexData;
     }
 
     IndexDataPtr SGSprite::getIndexData() const
     {
-        return nullptr;
+        updateBuffers();
+        return mIndexData;
     }
 
     bool SGSprite::isIndicesUsed() const
     {
-        return false;
+        return true;
     }
 }
@@ -0,0 +1,447 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DSGStaticBatch.h"
+#include "SceneGraph/T3DSGMesh.h"
+#include "Bound/T3DFrustumBound.h"
+#include "Resource/T3DMaterialManager.h"
+#include "Misc/T3DModelData.h"
+#include "Render/T3DRenderQueue.h"
+#include "Render/T3DHardwareBufferManager.h"
+#include "T3DMatrix3.h"
+
+
+namespace Tiny3D
+{
+    SGBatchChunkPtr SGBatchChunk::create(const String &materialName, const VertexDataPtr &vertexData, const IndexDataPtr &indexData, const Aabb &bound, uint32_t uID /* = E_NID_AUTOMATIC */)
+    {
+        SGBatchChunkPtr chunk = new SGBatchChunk(uID);
+        if (chunk != nullptr && chunk->init(materialName, vertexData, indexData, bound))
+        {
+            chunk->release();
+        }
+        else
+        {
+            T3D_SAFE_RELEASE(chunk);
+        }
+        return chunk;
+    }
+
+    SGBatchChunk::SGBatchChunk(uint32_t uID /* = E_NID_AUTOMATIC */)
+        : SGRenderable(uID)
+        , mMaterial(nullptr)
+        , mVertexData(nullptr)
+        , mIndexData(nullptr)
+    {
+
+    }
+
+    SGBatchChunk::~SGBatchChunk()
+    {
+        T3D_MATERIAL_MGR.unloadMaterial(mMaterial);
+    }
+
+    bool SGBatchChunk::init(const String &materialName, const VertexDataPtr &vertexData, const IndexDataPtr &indexData, const Aabb &bound)
+    {
+        mVertexData = vertexData;
+        mIndexData = indexData;
+        mBound = bound;
+        mEnclosingBound = bound;
+        mBoundState = E_BS_FINITE;
+        mMaterial = T3D_MATERIAL_MGR.loadMaterial(materialName, Material::E_MT_DEFAULT);
+        return (mVertexData != nullptr && mIndexData != nullptr);
+    }
+
+    Node::Type SGBatchChunk::getNodeType() const
+    {
+        return E_NT_BATCH_CHUNK;
+    }
+
+    NodePtr SGBatchChunk::clone() const
+    {
+        String materialName = (mMaterial != nullptr ? mMaterial->getName() : "");
+        SGBatchChunkPtr chunk = create(materialName, mVertexData, mIndexData, mBound);
+        if (chunk != nullptr)
+        {
+            cloneProperties(chunk);
+        }
+        return chunk;
+    }
+
+    void SGBatchChunk::cloneProperties(const NodePtr &node) const
+    {
+        SGRenderable::cloneProperties(node);
+    }
+
+    const Matrix4 &SGBatchChunk::getWorldMatrix() const
+    {
+        return Matrix4::IDENTITY;
+    }
+
+    const Aabb *SGBatchChunk::getSpatialBound() const
+    {
+        return &mBound;
+    }
+
+    void SGBatchChunk::frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue)
+    {
+        uint32_t parentMask = 0;
+
+        if (isVisible() && cullEnclosingBound(bound, parentMask))
+        {
+            queue->addRenderable(RenderQueue::E_GRPID_SOLID, this);
+            restorePlaneMask(bound, parentMask);
+        }
+    }
+
+    void SGBatchChunk::updateEnclosingBound()
+    {
+        mEnclosingBound = mBound;
+        mBoundState = E_BS_FINITE;
+    }
+
+    MaterialPtr SGBatchChunk::getMaterial() const
+    {
+        return mMaterial;
+    }
+
+    Renderer::PrimitiveType SGBatchChunk::getPrimitiveType() const
+    {
+        return Renderer::E_PT_TRIANGLE_LIST;
+    }
+
+    VertexDataPtr SGBatchChunk::getVertexData() const
+    {
+        return mVertexData;
+    }
+
+    IndexDataPtr SGBatchChunk::getIndexData() const
+    {
+        return mIndexData;
+    }
+
+    bool SGBatchChunk::isIndicesUsed() const
+    {
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    SGStaticBatchPtr SGStaticBatch::create(uint32_t uID /* = E_NID_AUTOMATIC */)
+    {
+        SGStaticBatchPtr batch = new SGStaticBatch(uID);
+        batch->release();
+        return batch;
+    }
+
+    SGStaticBatch::SGStaticBatch(uint32_t uID /* = E_NID_AUTOMATIC */)
+        : SGNode(uID)
+    {
+
+    }
+
+    SGStaticBatch::~SGStaticBatch()
+    {
+
+    }
+
+    Node::Type SGStaticBatch::getNodeType() const
+    {
+        return E_NT_STATIC_BATCH;
+    }
+
+    NodePtr SGStaticBatch::clone() const
+    {
+        SGStaticBatchPtr batch = create();
+        cloneProperties(batch);
+        return batch;
+    }
+
+    void SGStaticBatch::cloneProperties(const NodePtr &node) const
+    {
+        SGNode::cloneProperties(node);
+    }
+
+    size_t SGStaticBatch::getChunkCount() const
+    {
+        return mChildren.size();
+    }
+
+    void SGStaticBatch::clear()
+    {
+        removeAllChildren(true);
+    }
+
+    bool SGStaticBatch::build(const SGNodePtr &node)
+    {
+        clear();
+
+        Batches batches;
+        collect(node, batches);
+
+        // 把每个批次剩下的数据生成最后一个块
+        auto itr = batches.begin();
+        while (itr != batches.end())
+        {
+            Batch &batch = itr->second;
+            if (!batch.indices.empty())
+            {
+                flush(batch);
+            }
+            ++itr;
+        }
+
+        return !mChildren.empty();
+    }
+
+    void SGStaticBatch::collect(const NodePtr &node, Batches &batches)
+    {
+        if (node->getNodeType() == E_NT_MESH)
+        {
+            SGMeshPtr mesh = smart_pointer_cast<SGMesh>(node);
+            appendMesh(mesh, batches);
+        }
+
+        const Children &children = node->getChildren();
+        auto itr = children.begin();
+        while (itr != children.end())
+        {
+            collect(*itr, batches);
+            ++itr;
+        }
+    }
+
+    void SGStaticBatch::appendMesh(const SGMeshPtr &mesh, Batches &batches)
+    {
+        MeshDataPtr meshData = smart_pointer_cast<MeshData>(mesh->getMeshData());
+        SubMeshDataPtr submeshData = smart_pointer_cast<SubMeshData>(mesh->getSubMeshData());
+
+        if (meshData == nullptr || submeshData == nullptr
+            || submeshData->mPrimitiveType != Renderer::E_PT_TRIANGLE_LIST
+            || meshData->mBuffers.empty())
+        {
+            return;
+        }
+
+        // 多个顶点流交错合并成一个顶点流，同时生成区分批次的顶点声明签名
+        VertexDeclaration::VertexElementList elements;
+        std::stringstream ss;
+        ss << submeshData->mMaterialName << "#";
+
+        size_t vertexSize = 0;
+        auto itr = meshData->mBuffers.begin();
+        while (itr != meshData->mBuffers.end())
+        {
+            VertexBufferPtr buffer = *itr;
+            auto i = buffer->mAttributes.begin();
+            while (i != buffer->mAttributes.end())
+            {
+                const VertexElement &element = *i;
+                size_t offset = vertexSize + element.getOffset();
+                elements.push_back(VertexElement(0, offset, element.getType(), element.getSemantic()));
+                ss << element.getSemantic() << ":" << element.getType() << ":" << offset << ";";
+                ++i;
+            }
+            vertexSize += buffer->mVertexSize;
+            ++itr;
+        }
+
+        VertexBufferPtr firstBuffer = meshData->mBuffers.front();
+        size_t vertexCount = firstBuffer->mVertices.size() / firstBuffer->mVertexSize;
+
+        Batch &batch = batches[ss.str()];
+
+        if (batch.declaration == nullptr)
+        {
+            batch.materialName = submeshData->mMaterialName;
+            batch.vertexSize = vertexSize;
+            batch.declaration = T3D_HARDWARE_BUFFER_MGR.createVertexDeclaration();
+
+            auto i = elements.begin();
+            while (i != elements.end())
+            {
+                batch.declaration->addElement(*i);
+                ++i;
+            }
+        }
+
+        // 位置用世界矩阵变换，法线、切线、副法线用逆转置矩阵变换
+        const Matrix4 &world = mesh->getWorldMatrix();
+        Matrix3 rotation;
+        world.extractMatrix(rotation);
+        Matrix3 normalMatrix = rotation.inverse().transpose();
+
+        size_t indexSize = (submeshData->mIs16Bits ? sizeof(uint16_t) : sizeof(uint32_t));
+        size_t indexCount = submeshData->mIndices.size() / indexSize;
+        const uint8_t *indices = &submeshData->mIndices[0];
+
+        // 源顶点在当前块里的新索引，-1表示还没有拷贝到当前块
+        std::vector<int32_t> remap(vertexCount, -1);
+
+        size_t triangle = 0;
+        for (triangle = 0; triangle + 2 < indexCount; triangle += 3)
+        {
+            uint32_t corners[3];
+            size_t newVertices = 0;
+            size_t k = 0;
+
+            for (k = 0; k < 3; ++k)
+            {
+                if (submeshData->mIs16Bits)
+                {
+                    corners[k] = ((const uint16_t *)indices)[triangle + k];
+                }
+                else
+                {
+                    corners[k] = ((const uint32_t *)indices)[triangle + k];
+                }
+
+                if (remap[corners[k]] < 0)
+                {
+                    newVertices++;
+                }
+            }
+
+            // 放不下这个三角形就生成新块，源顶点需要重新拷贝到新块里
+            size_t used = batch.vertices.size() / batch.vertexSize;
+            if (used + newVertices > E_MAX_CHUNK_VERTICES)
+            {
+                flush(batch);
+                std::fill(remap.begin(), remap.end(), -1);
+            }
+
+            for (k = 0; k < 3; ++k)
+            {
+                uint32_t index = corners[k];
+
+                if (remap[index] < 0)
+                {
+                    size_t base = batch.vertices.size();
+                    remap[index] = int32_t(base / batch.vertexSize);
+                    batch.vertices.resize(base + batch.vertexSize);
+
+                    size_t offset = 0;
+                    auto i = meshData->mBuffers.begin();
+                    while (i != meshData->mBuffers.end())
+                    {
+                        VertexBufferPtr buffer = *i;
+                        memcpy(&batch.vertices[base + offset], &buffer->mVertices[index * buffer->mVertexSize], buffer->mVertexSize);
+                        offset += buffer->mVertexSize;
+                        ++i;
+                    }
+
+                    auto e = elements.begin();
+                    while (e != elements.end())
+                    {
+                        const VertexElement &element = *e;
+                        float *value = (float *)&batch.vertices[base + element.getOffset()];
+
+                        if (element.getSemantic() == VertexElement::E_VES_POSITION
+                            && (element.getType() == VertexElement::E_VET_FLOAT3 || element.getType() == VertexElement::E_VET_FLOAT4))
+                        {
+                            Vector3 pos = world.transformAffine(Vector3(value[0], value[1], value[2]));
+                            value[0] = pos.x();
+                            value[1] = pos.y();
+                            value[2] = pos.z();
+
+                            if (base == 0)
+                            {
+                                batch.minPos = batch.maxPos = pos;
+                            }
+                            else
+                            {
+                                batch.minPos.x() = std::min(batch.minPos.x(), pos.x());
+                                batch.minPos.y() = std::min(batch.minPos.y(), pos.y());
+                                batch.minPos.z() = std::min(batch.minPos.z(), pos.z());
+                                batch.maxPos.x() = std::max(batch.maxPos.x(), pos.x());
+                                batch.maxPos.y() = std::max(batch.maxPos.y(), pos.y());
+                                batch.maxPos.z() = std::max(batch.maxPos.z(), pos.z());
+                            }
+                        }
+                        else if ((element.getSemantic() == VertexElement::E_VES_NORMAL
+                            || element.getSemantic() == VertexElement::E_VES_TANGENT
+                            || element.getSemantic() == VertexElement::E_VES_BINORMAL)
+                            && element.getType() == VertexElement::E_VET_FLOAT3)
+                        {
+                            Vector3 dir = normalMatrix * Vector3(value[0], value[1], value[2]);
+                            dir.normalize();
+                            value[0] = dir.x();
+                            value[1] = dir.y();
+                            value[2] = dir.z();
+                        }
+
+                        ++e;
+                    }
+                }
+
+                batch.indices.push_back(uint16_t(remap[index]));
+            }
+        }
+    }
+
+    bool SGStaticBatch::flush(Batch &batch)
+    {
+        bool ret = false;
+
+        size_t vertexCount = batch.vertices.size() / batch.vertexSize;
+        size_t indexCount = batch.indices.size();
+
+        do
+        {
+            if (vertexCount == 0 || indexCount == 0)
+            {
+                break;
+            }
+
+            HardwareVertexBufferPtr vertexBuffer = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(batch.vertexSize, vertexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
+            if (vertexBuffer == nullptr || !vertexBuffer->writeData(0, batch.vertices.size(), &batch.vertices[0]))
+            {
+                T3D_LOG_ERROR("Create static batch vertex buffer failed !");
+                break;
+            }
+
+            HardwareIndexBufferPtr indexBuffer = T3D_HARDWARE_BUFFER_MGR.createIndexBuffer(HardwareIndexBuffer::E_IT_16BITS, indexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
+            if (indexBuffer == nullptr || !indexBuffer->writeData(0, indexCount * sizeof(uint16_t), &batch.indices[0]))
+            {
+                T3D_LOG_ERROR("Create static batch index buffer failed !");
+                break;
+            }
+
+            // 每个块用自己的顶点声明，避免多个块共享时被修改
+            VertexDataPtr vertexData = VertexData::create(batch.declaration->clone());
+            vertexData->addVertexBuffer(vertexBuffer);
+            IndexDataPtr indexData = IndexData::create(indexBuffer);
+
+            Aabb bound;
+            bound.setParam(batch.minPos, batch.maxPos);
+
+            SGBatchChunkPtr chunk = SGBatchChunk::create(batch.materialName, vertexData, indexData, bound);
+            if (chunk != nullptr)
+            {
+                addChild(chunk);
+                ret = true;
+            }
+        } while (0);
+
+        batch.vertices.clear();
+        batch.indices.clear();
+
+        return ret;
+    }
+}
@@ -32,10 +32,9 @@
 #include "Render/T3DViewport.h"
 #include "Render/T3DRenderer.h"
 #include "Render/T3DRenderQueue.h"
+#include "Render/T3DOverlayBatcher.h"
 #include "Render/T3DVertexData.h"
-#include "Render/T3DHardwareVertexBuffer.h"
-#include "Render/T3DHardwareIndexBuffer.h"
-#include "Render/T3DHardwareBufferManager.h"
+#include "Render/T3DIndexData.h"
 
 #include "Misc/T3DEntrance.h"
 
@@ -65,6 +64,7 @@ namespace Tiny3D
         , mAnchorPos(0.5f, 0.5f)
         , mTexWidth(0)
         , mTexHeight(0)
+        , mIsBufferDirty(false)
     {
 
     }
@@ -111,7 +111,7 @@ namespace Tiny3D
         {
             mCharSet.clear();
 
-            // ȸַ
+            // 先更新字符集内容
             if (!mFont->updateContent(text, mMaterial, mCharSet, mSize))
             {
                 T3D_LOG_ERROR("Upadte text content failed !");
@@ -148,20 +148,26 @@ namespace Tiny3D
     {
         if (isDirty())
         {
-            updateVertices();
-            setDirty(false);
+            // 生成文字顶点要用到字体管理器和硬件缓冲区，放到渲染线程上做
+            requestPostUpdate();
         }
 
         SGNode::updateTransform();
     }
 
+    void SGText2D::postUpdateTransform()
+    {
+        updateVertices();
+        setDirty(false);
+    }
+
     void SGText2D::frustumCulling(const BoundPtr &bound, const RenderQueuePtr &queue)
     {
 //         queue->addRenderable(RenderQueue::E_GRPID_SOLID, this);
 //         return;
         if (isVisible())
         {
-            // ɼ壬ҪжǷӾڣж
+            // 可见物体，才需要判断是否在视景体内，否则根本不用判断了
             FrustumBoundPtr frustumBound = smart_pointer_cast<FrustumBound>(bound);
             SGCameraPtr camera = smart_pointer_cast<SGCamera>(frustumBound->getNode());
             ViewportPtr viewport = camera->getViewport();
@@ -174,9 +180,7 @@ namespace Tiny3D
                 parent = parent->getParent();
 
             SGTransform2DPtr node = smart_pointer_cast<SGTransform2D>(parent);
-            const Transform &transform = node->getLocalToWorldTransform();
-
-            const Vector3 &pos = transform.getTranslate();
+            Vector2 pos = node->getLocalToWorldTransform().getTranslate();
 
             Real anchorX = mSize.width * mAnchorPos.x();
             Real left = pos.x() - anchorX;
@@ -191,7 +195,7 @@ namespace Tiny3D
                 || left >= 0 && left < width && bottom >= 0 && bottom < height
                 || right >= 0 && right < width && bottom >= 0 && bottom < height)
             {
-                // ĸϵĵһڷΧڣǱʾٲӾ
+                // 四个角上的点任意一点在范围内，则是表示有至少部分落入视景体中
                 queue->addRenderable(RenderQueue::E_GRPID_OVERLAY, this);
             }
 
@@ -211,11 +215,13 @@ namespace Tiny3D
 
     VertexDataPtr SGText2D::getVertexData() const
     {
+        updateBuffers();
         return mVertexData;
     }
 
     IndexDataPtr SGText2D::getIndexData() const
     {
+        updateBuffers();
         return mIndexData;
     }
 
@@ -234,22 +240,19 @@ namespace Tiny3D
             ViewportPtr viewport = renderer->getViewport();
             SGCameraPtr camera = viewport->getCamera();
 
-            // 
-            size_t vertexCount = mCharSet.size() * 4;
-            std::vector<Vertex> vertices;
-            vertices.resize(vertexCount);
+            // 构建本地空间的四边形顶点，合批时变换到世界空间，不合批时直接生成缓冲
+            mQuads.resize(mCharSet.size() * 4);
+            mIsBufferDirty = true;
 
-            std::vector<Texcoord> texcoords;
-            texcoords.resize(vertexCount);
-
-            size_t indexCount = mCharSet.size() * 6;
-            std::vector<uint16_t> indices;
-            indices.resize(indexCount);
+            if (mQuads.empty())
+            {
+                ret = true;
+                break;
+            }
 
             uint32_t color = Color4::WHITE.A8R8G8B8();
 
             size_t i = 0;
-            size_t c = 0;
             Real width = Real(mSize.width) / Real(viewport->getActualWidth()) * camera->getAspectRatio();
             Real height = Real(mSize.height) / Real(viewport->getActualHeight());
             Real left = -mAnchorPos.x() * width;
@@ -258,99 +261,64 @@ namespace Tiny3D
             Real z(-0.5);
 
             Texture *texture = mMaterial->getTexture(0);
-            int32_t texWidth = texture->getTexWidth();
-            int32_t texHeight = texture->getTexHeight();
-
-            mTexWidth = texWidth;
-            mTexHeight = texHeight;
+            mTexWidth = texture->getTexWidth();
+            mTexHeight = texture->getTexHeight();
 
-            for (auto itr = mCharSet.begin(); itr != mCharSet.end() && i < vertices.size(); ++itr)
+            for (auto itr = mCharSet.begin(); itr != mCharSet.end() && i < mQuads.size(); ++itr)
             {
                 Font::CharPtr ch = *itr;
 
-                // 㶥
-                uint16_t index = i;
-
                 Real width = Real(ch->mArea.width()) / Real(viewport->getActualWidth()) * camera->getAspectRatio();
 
                 // top-left
-                Vertex &v0 = vertices[i];
+                OverlayVertex &v0 = mQuads[i++];
                 v0.position = Vector3(left, top, z);
                 v0.diffuse = color;
-                Texcoord &t0 = texcoords[i];
-                t0.texcoord[0] = Real(ch->mArea.left) / Real(texWidth);
-                t0.texcoord[1] = Real(ch->mArea.top) / Real(texHeight);
-                i++;
 
                 // bottom-left
-                Vertex &v1 = vertices[i];
+                OverlayVertex &v1 = mQuads[i++];
                 v1.position = Vector3(left, bottom, z);
                 v1.diffuse = color;
-                Texcoord &t1 = texcoords[i];
-                t1.texcoord[0] = Real(ch->mArea.left) / Real(texWidth);
-                t1.texcoord[1] = Real(ch->mArea.bottom) / Real(texHeight);
-                i++;
 
                 // top-right
-                Vertex &v2 = vertices[i];
+                OverlayVertex &v2 = mQuads[i++];
                 v2.position = Vector3(left + width, top, z);
                 v2.diffuse = color;
-                Texcoord &t2 = texcoords[i];
-                t2.texcoord[0] = Real(ch->mArea.right) / Real(texWidth);
-                t2.texcoord[1] = Real(ch->mArea.top) / Real(texHeight);
-                i++;
 
                 // bottom-right
-                Vertex &v3 = vertices[i];
+                OverlayVertex &v3 = mQuads[i++];
                 v3.position = Vector3(left + width, bottom, z);
                 v3.diffuse = color;
-                Texcoord &t3 = texcoords[i];
-                t3.texcoord[0] = Real(ch->mArea.right) / Real(texWidth);
-                t3.texcoord[1] = Real(ch->mArea.bottom) / Real(texHeight);
-                i++;
 
                 left += width;
-
-                // 
-                indices[c++] = index;
-                indices[c++] = index + 1;
-                indices[c++] = index + 2;
-                indices[c++] = index + 1;
-                indices[c++] = index + 3;
-                indices[c++] = index + 2;
             }
 
-            // 춥Ӳ
-            VertexDeclarationPtr vertexDecl = T3D_HARDWARE_BUFFER_MGR.createVertexDeclaration();
-            size_t offset = 0;
-            const VertexElement &posElem = vertexDecl->addElement(0, offset, VertexElement::E_VET_FLOAT3, VertexElement::E_VES_POSITION);
-            offset += posElem.getSize();
-            const VertexElement &colorElem = vertexDecl->addElement(0, offset, VertexElement::E_VET_COLOR, VertexElement::E_VES_DIFFUSE);
-            offset += colorElem.getSize();
+            fillTexcoords();
 
-            const VertexElement &texElem = vertexDecl->addElement(1, 0, VertexElement::E_VET_FLOAT2, VertexElement::E_VES_TEXCOORD);
-
-            size_t vertexSize = offset;
-            HardwareVertexBufferPtr vb0 = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(vertexSize, vertexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
-            vb0->writeData(0, vertexSize * vertexCount, &vertices[0]);
+            ret = true;
+        } while (0);
 
-            vertexSize = texElem.getSize();
-            HardwareVertexBufferPtr vb1 = T3D_HARDWARE_BUFFER_MGR.createVertexBuffer(vertexSize, vertexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
-            vb1->writeData(0, vertexSize * vertexCount, &texcoords[0]);
+        return ret;
+    }
 
-            mVertexData = VertexData::create(vertexDecl);
-            mVertexData->addVertexBuffer(vb0);
-            mVertexData->addVertexBuffer(vb1);
+    void SGText2D::fillTexcoords()
+    {
+        size_t i = 0;
 
-            // 춥
-            HardwareIndexBufferPtr indexBuffer = T3D_HARDWARE_BUFFER_MGR.createIndexBuffer(HardwareIndexBuffer::E_IT_16BITS, indexCount, HardwareBuffer::E_HBU_STATIC_WRITE_ONLY, false);
-            indexBuffer->writeData(0, indexCount * sizeof(uint16_t), &indices[0]);
-            mIndexData = IndexData::create(indexBuffer);
+        for (auto itr = mCharSet.begin(); itr != mCharSet.end() && i < mQuads.size(); ++itr)
+        {
+            Font::CharPtr ch = *itr;
 
-            ret = true;
-        } while (0);
+            Real left = Real(ch->mArea.left) / Real(mTexWidth);
+            Real right = Real(ch->mArea.right) / Real(mTexWidth);
+            Real top = Real(ch->mArea.top) / Real(mTexHeight);
+            Real bottom = Real(ch->mArea.bottom) / Real(mTexHeight);
 
-        return ret;
+            mQuads[i++].texcoord = Vector2(left, top);
+            mQuads[i++].texcoord = Vector2(left, bottom);
+            mQuads[i++].texcoord = Vector2(right, top);
+            mQuads[i++].texcoord = Vector2(right, bottom);
+        }
     }
 
     bool SGText2D::updateTexcoord()
@@ -362,65 +330,45 @@ namespace Tiny3D
             if (mMaterial == nullptr || (mTexWidth == mMaterial->getTexture(0)->getTexWidth() &&
                 mTexHeight == mMaterial->getTexture(0)->getTexHeight()))
             {
-                // Сûı䣬øUV
+                // 纹理大小没改变，不用更新UV了
                 break;
             }
 
-            HardwareVertexBufferPtr vb = mVertexData->getVertexBuffer(1);
-            if (vb == nullptr)
-            {
-                T3D_LOG_ERROR("Vertex buffer is empty !!!");
-                break;
-            }
+            mTexWidth = mMaterial->getTexture(0)->getTexWidth();
+            mTexHeight = mMaterial->getTexture(0)->getTexHeight();
 
-            Texcoord *texcoords = (Texcoord *)vb->lock(HardwareBuffer::E_HBL_WRITE_ONLY);
+            fillTexcoords();
+            mIsBufferDirty = true;
 
-            int32_t texWidth = mMaterial->getTexture(0)->getTexWidth();
-            int32_t texHeight = mMaterial->getTexture(0)->getTexHeight();
-            size_t i = 0;
-            size_t size = vb->getVertexCount();
-
-            for (auto itr = mCharSet.begin(); itr != mCharSet.end() && i < size; ++itr)
-            {
-                Font::CharPtr ch = *itr;
-
-                // 㶥
-                uint16_t index = i;
-
-                // top-left
-                Texcoord &t0 = texcoords[i];
-                t0.texcoord[0] = Real(ch->mArea.left) / Real(texWidth);
-                t0.texcoord[1] = Real(ch->mArea.top) / Real(texHeight);
-                i++;
-
-                // bottom-left
-                Texcoord &t1 = texcoords[i];
-                t1.texcoord[0] = Real(ch->mArea.left) / Real(texWidth);
-                t1.texcoord[1] = Real(ch->mArea.bottom) / Real(texHeight);
-                i++;
-
-                // top-right
-                Texcoord &t2 = texcoords[i];
-                t2.texcoord[0] = Real(ch->mArea.right) / Real(texWidth);
-                t2.texcoord[1] = Real(ch->mArea.top) / Real(texHeight);
-                i++;
+            ret = true;
+        } while (0);
 
-                // bottom-right
-                Texcoord &t3 = texcoords[i];
-                t3.texcoord[0] = Real(ch->mArea.right) / Real(texWidth);
-                t3.texcoord[1] = Real(ch->mArea.bottom) / Real(texHeight);
-                i++;
-            }
+        return ret;
+    }
 
-            vb->unlock();
+    void SGText2D::updateBuffers() const
+    {
+        if (mIsBufferDirty)
+        {
+            // 只有不合批时才会用到单独的缓冲，所以到取缓冲时才生成
+            OverlayBatcher::createQuadBuffers(mQuads, mVertexData, mIndexData);
+            mIsBufferDirty = false;
+        }
+    }
 
-            mTexWidth = texWidth;
-            mTexHeight = texHeight;
+    bool SGText2D::isOverlayBatchable() const
+    {
+        return true;
+    }
 
-            ret = true;
-        } while (0);
+    size_t SGText2D::getOverlayQuadCount() const
+    {
+        return mQuads.size() / 4;
+    }
 
-        return ret;
+    void SGText2D::fillOverlayQuads(OverlayVertex *vertices) const
+    {
+        OverlayBatcher::transformQuads(&mQuads[0], mQuads.size(), getWorldMatrix(), vertices);
     }
 }
 
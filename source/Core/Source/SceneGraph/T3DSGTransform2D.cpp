@@ -18,9 +18,6 @@
  **************************************************************************************************/
 
 #include "SceneGraph/T3DSGTransform2D.h"
-#include "SceneGraph/T3DSGCamera.h"
-#include "Misc/T3DEntrance.h"
-#include "Render/T3DRenderer.h"
 
 
 namespace Tiny3D
@@ -38,15 +35,22 @@ namespace Tiny3D
         , mPosition(Vector2::ZERO)
         , mOrientation(Quaternion::IDENTITY)
         , mScale(Real(1.0), Real(1.0))
+        , mTransformIndex(SGTransform2DStore::INVALID_INDEX)
+        , mMatrixUpdate(0xFFFFFFFF)
+        , mWorldMatrix(false)
     {
-        mWorldTransform.setTranslate(Vector3(mPosition.x(), mPosition.y(), Real(0.0)));
-        mWorldTransform.setOrientation(mOrientation);
-        mWorldTransform.setScale(Vector3(mScale.x(), mScale.y(), Real(1.0)));
+        T3D_ASSERT(SGTransform2DStore::getInstancePtr() != nullptr);
+        mTransformIndex = T3D_TRANSFORM2D_STORE.acquire(this);
     }
 
     SGTransform2D::~SGTransform2D()
     {
+        SGTransform2DStore *store = SGTransform2DStore::getInstancePtr();
 
+        if (store != nullptr)
+        {
+            store->release(mTransformIndex);
+        }
     }
 
     Node::Type SGTransform2D::getNodeType() const
@@ -57,7 +61,6 @@ namespace Tiny3D
     void SGTransform2D::onAttachParent(const NodePtr &parent)
     {
         SGNode::onAttachParent(parent);
-        setDirty(true, true);
     }
 
     void SGTransform2D::onDetachParent(const NodePtr &parent)
@@ -65,53 +68,55 @@ namespace Tiny3D
         SGNode::onDetachParent(parent);
     }
 
+    void SGTransform2D::updateTransformParent(SGTransformNode *parent, SGTransform2D *parent2D)
+    {
+        // 自己或者祖先的挂接关系变了，最近的2D变换祖先可能也变了
+        SGNode::updateTransformParent(parent, parent2D);
+
+        SGTransform2DStore *store = SGTransform2DStore::getInstancePtr();
+
+        if (store != nullptr)
+        {
+            store->markHierarchyChanged();
+        }
+    }
+
+    void SGTransform2D::updateLocal()
+    {
+        // 旋转矩阵左上角2x2就是正交投影到屏幕平面后的旋转，再乘上缩放
+        Matrix3 rotation;
+        mOrientation.toRotationMatrix(rotation);
+
+        Matrix2 linear(
+            rotation[0][0] * mScale.x(), rotation[0][1] * mScale.y(),
+            rotation[1][0] * mScale.x(), rotation[1][1] * mScale.y());
+
+        T3D_TRANSFORM2D_STORE.setLocal(mTransformIndex, linear, mPosition);
+    }
+
     void SGTransform2D::updateTransform()
     {
-        getLocalToWorldTransform();
+        // 世界变换在每帧开始时由2D变换数据仓库算好了，这里只需要更新子结点
         SGNode::updateTransform();
     }
 
-    const Transform &SGTransform2D::getLocalToWorldTransform()
+    Affine2 SGTransform2D::getLocalToWorldTransform()
     {
-        if (isDirty())
+        return T3D_TRANSFORM2D_STORE.resolve(mTransformIndex);
+    }
+
+    const Matrix4 &SGTransform2D::getWorldMatrix()
+    {
+        SGTransform2DStore &store = T3D_TRANSFORM2D_STORE;
+        Affine2 world = store.resolve(mTransformIndex);
+
+        if (mMatrixUpdate != store.getUpdateCount())
         {
-            Node *parent = getParent();
-
-            // 3D任ҲֱԣΪﲻZֵӰı任
-            while (parent != nullptr && (parent->getNodeType() != E_NT_TRANSFORM2D))
-                parent = parent->getParent();
-
-            RendererPtr renderer = T3D_ENTRANCE.getActiveRenderer();
-            ViewportPtr viewport = renderer->getViewport();
-            SGCameraPtr camera = viewport->getCamera();
-
-            Real width = Real(viewport->getActualWidth()) / camera->getAspectRatio();// *Real(0.5);
-            Real height = Real(viewport->getActualHeight());
-
-            Real x = mPosition.x() / width;
-            Real y = mPosition.y() / height;
-            Real z(0.0);
-            Vector3 pos(x, y, z);
-            Vector3 scal(mScale.x(), mScale.y(), Real(1.0));
-
-            if (parent != nullptr)
-            {
-                SGTransform2D *node = (SGTransform2D *)parent;
-                const Transform &transform = node->getLocalToWorldTransform();
-                mWorldTransform.applyTransform(transform, pos, mOrientation, scal);
-            }
-            else
-            {
-                mWorldTransform.setTranslate(pos);
-                mWorldTransform.setOrientation(mOrientation);
-                mWorldTransform.setScale(scal);
-                mWorldTransform.update();
-            }
-
-            setDirty(false);
+            world.toMatrix4(mWorldMatrix);
+            mMatrixUpdate = store.getUpdateCount();
         }
 
-        return mWorldTransform;
+        return mWorldMatrix;
     }
 
     NodePtr SGTransform2D::clone() const
@@ -129,7 +134,6 @@ namespace Tiny3D
         newNode->mPosition = mPosition;
         newNode->mOrientation = mOrientation;
         newNode->mScale = mScale;
-        newNode->mWorldTransform = mWorldTransform;
+        newNode->updateLocal();
     }
 }
-
@@ -0,0 +1,367 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DSGTransform2DStore.h"
+#include "SceneGraph/T3DSGTransform2D.h"
+
+
+namespace Tiny3D
+{
+    T3D_INIT_SINGLETON(SGTransform2DStore);
+
+    const uint32_t SGTransform2DStore::INVALID_INDEX = 0xFFFFFFFF;
+
+    SGTransform2DStore::SGTransform2DStore()
+        : mScaleX(Real(0.0))
+        , mScaleY(Real(0.0))
+        , mEpoch(1)
+        , mUpdatedEpoch(0)
+        , mUpdateCount(0)
+        , mIsHierarchyDirty(false)
+    {
+        mLevels.push_back(0);
+    }
+
+    SGTransform2DStore::~SGTransform2DStore()
+    {
+
+    }
+
+    uint32_t SGTransform2DStore::acquire(SGTransform2D *node)
+    {
+        uint32_t index = 0;
+        size_t i = 0;
+
+        if (!mFreeSlots.empty())
+        {
+            index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+            mNodes[index] = node;
+        }
+        else
+        {
+            index = uint32_t(mNodes.size());
+            mNodes.push_back(node);
+            mParents.push_back(INVALID_INDEX);
+
+            for (i = 0; i < E_MAX_COMPONENTS; ++i)
+            {
+                mLocal[i].push_back(Real(0.0));
+                mWorld[i].push_back(Real(0.0));
+            }
+        }
+
+        mParents[index] = INVALID_INDEX;
+
+        const Real *identity = Affine2::IDENTITY;
+        for (i = 0; i < E_MAX_COMPONENTS; ++i)
+        {
+            mLocal[i][index] = identity[i];
+            mWorld[i][index] = identity[i];
+        }
+
+        // 新槽位还不在任何一层里
+        markHierarchyChanged();
+
+        return index;
+    }
+
+    void SGTransform2DStore::release(uint32_t index)
+    {
+        T3D_ASSERT(index < mNodes.size());
+
+        // 结点析构前已经从父结点上拿走了，没有槽位再引用这里
+        mNodes[index] = nullptr;
+        mParents[index] = INVALID_INDEX;
+        mFreeSlots.push_back(index);
+        markHierarchyChanged();
+    }
+
+    void SGTransform2DStore::setLocal(uint32_t index, const Matrix2 &linear, const Vector2 &position)
+    {
+        mLocal[E_M00][index] = linear[0][0];
+        mLocal[E_M01][index] = linear[0][1];
+        mLocal[E_TX][index] = position.x();
+        mLocal[E_M10][index] = linear[1][0];
+        mLocal[E_M11][index] = linear[1][1];
+        mLocal[E_TY][index] = position.y();
+        ++mEpoch;
+    }
+
+    void SGTransform2DStore::setViewportScale(Real scaleX, Real scaleY)
+    {
+        if (scaleX != mScaleX || scaleY != mScaleY)
+        {
+            mScaleX = scaleX;
+            mScaleY = scaleY;
+            ++mEpoch;
+        }
+    }
+
+    Affine2 SGTransform2DStore::getLocal(uint32_t index) const
+    {
+        return Affine2(
+            mLocal[E_M00][index], mLocal[E_M01][index], mLocal[E_TX][index] * mScaleX,
+            mLocal[E_M10][index], mLocal[E_M11][index], mLocal[E_TY][index] * mScaleY);
+    }
+
+    Affine2 SGTransform2DStore::getWorld(uint32_t index) const
+    {
+        return Affine2(
+            mWorld[E_M00][index], mWorld[E_M01][index], mWorld[E_TX][index],
+            mWorld[E_M10][index], mWorld[E_M11][index], mWorld[E_TY][index]);
+    }
+
+    Affine2 SGTransform2DStore::resolve(uint32_t index)
+    {
+        if (mUpdatedEpoch != mEpoch)
+        {
+            update();
+        }
+
+        return getWorld(index);
+    }
+
+    void SGTransform2DStore::computeRoots(const Real *const *local, Real *const *world,
+        size_t begin, size_t end, Real scaleX, Real scaleY)
+    {
+        const Real *l00 = local[E_M00];
+        const Real *l01 = local[E_M01];
+        const Real *ltx = local[E_TX];
+        const Real *l10 = local[E_M10];
+        const Real *l11 = local[E_M11];
+        const Real *lty = local[E_TY];
+
+        Real *w00 = world[E_M00];
+        Real *w01 = world[E_M01];
+        Real *wtx = world[E_TX];
+        Real *w10 = world[E_M10];
+        Real *w11 = world[E_M11];
+        Real *wty = world[E_TY];
+
+        size_t i = 0;
+        for (i = begin; i < end; ++i)
+        {
+            w00[i] = l00[i];
+            w01[i] = l01[i];
+            wtx[i] = ltx[i] * scaleX;
+            w10[i] = l10[i];
+            w11[i] = l11[i];
+            wty[i] = lty[i] * scaleY;
+        }
+    }
+
+    void SGTransform2DStore::concatenate(const uint32_t *parents, const Real *const *local,
+        Real *const *world, size_t begin, size_t end, Real scaleX, Real scaleY)
+    {
+        const Real *l00 = local[E_M00];
+        const Real *l01 = local[E_M01];
+        const Real *ltx = local[E_TX];
+        const Real *l10 = local[E_M10];
+        const Real *l11 = local[E_M11];
+        const Real *lty = local[E_TY];
+
+        Real *w00 = world[E_M00];
+        Real *w01 = world[E_M01];
+        Real *wtx = world[E_TX];
+        Real *w10 = world[E_M10];
+        Real *w11 = world[E_M11];
+        Real *wty = world[E_TY];
+
+        size_t i = 0;
+        for (i = begin; i < end; ++i)
+        {
+            uint32_t p = parents[i];
+
+            // 父槽位在上一层，先全部读出来，再写自己
+            Real p00 = w00[p];
+            Real p01 = w01[p];
+            Real ptx = wtx[p];
+            Real p10 = w10[p];
+            Real p11 = w11[p];
+            Real pty = wty[p];
+
+            Real x = ltx[i] * scaleX;
+            Real y = lty[i] * scaleY;
+
+            w00[i] = p00 * l00[i] + p01 * l10[i];
+            w01[i] = p00 * l01[i] + p01 * l11[i];
+            wtx[i] = p00 * x + p01 * y + ptx;
+            w10[i] = p10 * l00[i] + p11 * l10[i];
+            w11[i] = p10 * l01[i] + p11 * l11[i];
+            wty[i] = p10 * x + p11 * y + pty;
+        }
+    }
+
+    void SGTransform2DStore::rebuild()
+    {
+        T3D_PROFILE_ZONE("SGTransform2DStore::rebuild");
+
+        const uint32_t count = uint32_t(mNodes.size());
+
+        // 找到每个槽位最近的2D变换祖先和所在层级，中间隔着的其他结点都跳过
+        IndexArray parents(count, INVALID_INDEX);
+        IndexArray depths(count, 0);
+        uint32_t maxDepth = 0;
+        uint32_t i = 0;
+
+        for (i = 0; i < count; ++i)
+        {
+            if (mNodes[i] == nullptr)
+                continue;
+
+            uint32_t depth = 0;
+            Node *node = mNodes[i]->getParent();
+
+            while (node != nullptr)
+            {
+                if (node->getNodeType() == Node::E_NT_TRANSFORM2D)
+                {
+                    if (depth == 0)
+                    {
+                        parents[i] = ((SGTransform2D *)node)->mTransformIndex;
+                    }
+                    ++depth;
+                }
+
+                node = node->getParent();
+            }
+
+            depths[i] = depth;
+            maxDepth = std::max(maxDepth, depth);
+        }
+
+        // 按层级计数排序，同一层保持原来的先后顺序
+        IndexArray levels(maxDepth + 2, 0);
+
+        for (i = 0; i < count; ++i)
+        {
+            if (mNodes[i] != nullptr)
+            {
+                ++levels[depths[i] + 1];
+            }
+        }
+
+        for (i = 0; i <= maxDepth; ++i)
+        {
+            levels[i + 1] += levels[i];
+        }
+
+        const uint32_t liveCount = levels[maxDepth + 1];
+        IndexArray cursors(levels.begin(), levels.end() - 1);
+        IndexArray remap(count, INVALID_INDEX);
+
+        for (i = 0; i < count; ++i)
+        {
+            if (mNodes[i] != nullptr)
+            {
+                remap[i] = cursors[depths[i]]++;
+            }
+        }
+
+        // 按新顺序搬移数据，并回写结点的索引
+        RealArray local[E_MAX_COMPONENTS];
+        RealArray world[E_MAX_COMPONENTS];
+        IndexArray newParents(liveCount);
+        NodeArray nodes(liveCount);
+        uint32_t c = 0;
+
+        for (c = 0; c < E_MAX_COMPONENTS; ++c)
+        {
+            local[c].resize(liveCount);
+            world[c].resize(liveCount);
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            uint32_t slot = remap[i];
+
+            if (slot == INVALID_INDEX)
+                continue;
+
+            for (c = 0; c < E_MAX_COMPONENTS; ++c)
+            {
+                local[c][slot] = mLocal[c][i];
+                world[c][slot] = mWorld[c][i];
+            }
+
+            newParents[slot] = (parents[i] != INVALID_INDEX ? remap[parents[i]] : INVALID_INDEX);
+            nodes[slot] = mNodes[i];
+            nodes[slot]->mTransformIndex = slot;
+        }
+
+        for (c = 0; c < E_MAX_COMPONENTS; ++c)
+        {
+            mLocal[c].swap(local[c]);
+            mWorld[c].swap(world[c]);
+        }
+
+        mParents.swap(newParents);
+        mNodes.swap(nodes);
+        mLevels.swap(levels);
+
+        mFreeSlots.clear();
+        mIsHierarchyDirty = false;
+    }
+
+    void SGTransform2DStore::update()
+    {
+        T3D_PROFILE_ZONE("SGTransform2DStore::update");
+
+        if (mIsHierarchyDirty)
+        {
+            rebuild();
+        }
+
+        if (mUpdatedEpoch == mEpoch)
+        {
+            // 上一次更新后没有任何变化
+            return;
+        }
+
+        const size_t levelCount = mLevels.size() - 1;
+
+        if (levelCount > 0 && mLevels[1] > 0)
+        {
+            const Real *local[E_MAX_COMPONENTS];
+            Real *world[E_MAX_COMPONENTS];
+            size_t c = 0;
+
+            for (c = 0; c < E_MAX_COMPONENTS; ++c)
+            {
+                local[c] = &mLocal[c][0];
+                world[c] = &mWorld[c][0];
+            }
+
+            // 第0层都是没有父槽位的，后面每一层只依赖上一层
+            computeRoots(local, world, mLevels[0], mLevels[1], mScaleX, mScaleY);
+
+            size_t level = 1;
+            while (level < levelCount)
+            {
+                concatenate(&mParents[0], local, world, mLevels[level], mLevels[level + 1],
+                    mScaleX, mScaleY);
+                ++level;
+            }
+        }
+
+        mUpdatedEpoch = mEpoch;
+        ++mUpdateCount;
+    }
+}
@@ -22,6 +22,8 @@
 
 namespace Tiny3D
 {
+    T3D_IMPLEMENT_POOL_ALLOCATOR(SGTransformNode, 64);
+
     SGTransformNodePtr SGTransformNode::create(uint32_t unID /* = E_NID_AUTOMATIC */)
     {
         SGTransformNode *node = new SGTransformNode(unID);
@@ -32,18 +34,20 @@ namespace Tiny3D
 
     SGTransformNode::SGTransformNode(uint32_t unID /* = E_NID_AUTOMATIC */)
         : SGNode(unID)
-        , mPosition(Vector3::ZERO)
-        , mOrientation(Quaternion::IDENTITY)
-        , mScale(Real(1.0), Real(1.0), Real(1.0))
+        , mTransformIndex(SGTransformStore::INVALID_INDEX)
     {
-        mWorldTransform.setTranslate(mPosition);
-        mWorldTransform.setOrientation(mOrientation);
-        mWorldTransform.setScale(mScale);
+        T3D_ASSERT(SGTransformStore::getInstancePtr() != nullptr);
+        mTransformIndex = T3D_TRANSFORM_STORE.acquire(this);
     }
 
     SGTransformNode::~SGTransformNode()
     {
+        SGTransformStore *store = SGTransformStore::getInstancePtr();
 
+        if (store != nullptr)
+        {
+            store->release(mTransformIndex);
+        }
     }
 
     Node::Type SGTransformNode::getNodeType() const
@@ -51,10 +55,19 @@ namespace Tiny3D
         return E_NT_TRANSFORM;
     }
 
+    void SGTransformNode::setDirty(bool isDirty, bool recursive /* = false */)
+    {
+        SGNode::setDirty(isDirty, recursive);
+
+        if (isDirty)
+        {
+            T3D_TRANSFORM_STORE.markLocalChanged(mTransformIndex);
+        }
+    }
+
     void SGTransformNode::onAttachParent(const NodePtr &parent)
     {
         SGNode::onAttachParent(parent);
-        setDirty(true, true);
     }
 
     void SGTransformNode::onDetachParent(const NodePtr &parent)
@@ -62,6 +75,21 @@ namespace Tiny3D
         SGNode::onDetachParent(parent);
     }
 
+    void SGTransformNode::updateTransformParent(SGTransformNode *parent, SGTransform2D *parent2D)
+    {
+        // 子结点最近的3D变换祖先就是本结点，不受影响，不用再往下传递
+        mTransformParent = parent;
+        mTransform2DParent = parent2D;
+
+        SGTransformStore *store = SGTransformStore::getInstancePtr();
+
+        if (store != nullptr)
+        {
+            uint32_t index = (parent != nullptr ? parent->mTransformIndex : SGTransformStore::INVALID_INDEX);
+            store->setParent(mTransformIndex, index);
+        }
+    }
+
     void SGTransformNode::updateTransform()
     {
         getLocalToWorldTransform();
@@ -72,29 +100,19 @@ namespace Tiny3D
     {
         if (isDirty())
         {
-            Node *parent = getParent();
-
-            while (parent != nullptr && (parent->getNodeType() != E_NT_TRANSFORM && parent->getNodeType() != E_NT_BONE))
-                parent = parent->getParent();
-
-            if (parent != nullptr)
-            {
-                SGTransformNode *node = (SGTransformNode *)parent;
-                const Transform &transform = node->getLocalToWorldTransform();
-                mWorldTransform.applyTransform(transform, mPosition, mOrientation, mScale);
-            }
-            else
-            {
-                mWorldTransform.setTranslate(mPosition);
-                mWorldTransform.setOrientation(mOrientation);
-                mWorldTransform.setScale(mScale);
-                mWorldTransform.update();
-            }
-
-            setDirty(false);
+            SGNode::setDirty(false);
         }
 
-        return mWorldTransform;
+        // 通常每帧开始时变换数据仓库已经线性更新过，这里直接返回。只有本帧遍历过程中
+        // 又修改了变换的（例如动画驱动的骨骼）才会沿父槽位检查版本号并重新计算
+        return T3D_TRANSFORM_STORE.resolve(mTransformIndex);
+    }
+
+    uint32_t SGTransformNode::getWorldVersion()
+    {
+        SGTransformStore &store = T3D_TRANSFORM_STORE;
+        store.resolve(mTransformIndex);
+        return store.getWorldVersion(mTransformIndex);
     }
 
     void SGTransformNode::lookAt(const Vector3 &pos, const Vector3 &obj, const Vector3 &up)
@@ -107,18 +125,20 @@ namespace Tiny3D
         U.normalize();
         V = U.cross(N);
 
-        mPosition = pos;
+        SGTransformStore &store = T3D_TRANSFORM_STORE;
+        store.getPosition(mTransformIndex) = pos;
         Matrix3 mat;
         mat.setColumn(0, U);
         mat.setColumn(1, V);
         mat.setColumn(2, -N);
-        mOrientation.fromRotationMatrix(mat);
+        store.getOrientation(mTransformIndex).fromRotationMatrix(mat);
 
-        mScale[0] = Real(1.0);
-        mScale[1] = Real(1.0);
-        mScale[2] = Real(1.0);
+        Vector3 &scale = store.getScale(mTransformIndex);
+        scale[0] = Real(1.0);
+        scale[1] = Real(1.0);
+        scale[2] = Real(1.0);
 
-        setDirty(true, true);
+        store.markLocalChanged(mTransformIndex);
     }
 
     NodePtr SGTransformNode::clone() const
@@ -133,15 +153,19 @@ namespace Tiny3D
         SGNode::cloneProperties(node);
 
         const SGTransformNodePtr &newNode = smart_pointer_cast<SGTransformNode>(node);
-        newNode->mPosition = mPosition;
-        newNode->mOrientation = mOrientation;
-        newNode->mScale = mScale;
-        newNode->mWorldTransform = mWorldTransform;
+        SGTransformStore &store = T3D_TRANSFORM_STORE;
+        store.getPosition(newNode->mTransformIndex) = store.getPosition(mTransformIndex);
+        store.getOrientation(newNode->mTransformIndex) = store.getOrientation(mTransformIndex);
+        store.getScale(newNode->mTransformIndex) = store.getScale(mTransformIndex);
+        store.getWorldTransform(newNode->mTransformIndex) = store.getWorldTransform(mTransformIndex);
     }
 
     void SGTransformNode::setLocalMatrix(const Matrix4 &m)
     {
-        m.decomposition(mPosition, mScale, mOrientation);
-        setDirty(true, true);
+        SGTransformStore &store = T3D_TRANSFORM_STORE;
+        m.decomposition(store.getPosition(mTransformIndex),
+            store.getScale(mTransformIndex),
+            store.getOrientation(mTransformIndex));
+        store.markLocalChanged(mTransformIndex);
     }
 }
@@ -0,0 +1,329 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DSGTransformStore.h"
+#include "SceneGraph/T3DSGTransformNode.h"
+
+
+namespace Tiny3D
+{
+    T3D_INIT_SINGLETON(SGTransformStore);
+
+    const uint32_t SGTransformStore::INVALID_INDEX = 0xFFFFFFFF;
+    const uint32_t SGTransformStore::FROZEN_EPOCH = 0xFFFFFFFF;
+
+    SGTransformStore::SGTransformStore()
+        : mEpoch(1)
+        , mUpdatedEpoch(0)
+        , mIsHierarchyDirty(false)
+    {
+
+    }
+
+    SGTransformStore::~SGTransformStore()
+    {
+
+    }
+
+    uint32_t SGTransformStore::acquire(SGTransformNode *node)
+    {
+        uint32_t index = 0;
+
+        if (!mFreeSlots.empty())
+        {
+            index = mFreeSlots.back();
+            mFreeSlots.pop_back();
+
+            mPositions[index] = Vector3::ZERO;
+            mOrientations[index] = Quaternion::IDENTITY;
+            mScales[index] = Vector3(Real(1.0), Real(1.0), Real(1.0));
+            mWorldTransforms[index] = Transform();
+            mParents[index] = INVALID_INDEX;
+            mLocalVersions[index] = 1;
+            mWorldVersions[index] = 0;
+            mSeenLocalVersions[index] = 0;
+            mSeenParentVersions[index] = 0;
+            mCheckedEpochs[index] = 0;
+            mNodes[index] = node;
+        }
+        else
+        {
+            index = uint32_t(mNodes.size());
+
+            mPositions.push_back(Vector3::ZERO);
+            mOrientations.push_back(Quaternion::IDENTITY);
+            mScales.push_back(Vector3(Real(1.0), Real(1.0), Real(1.0)));
+            mWorldTransforms.push_back(Transform());
+            mParents.push_back(INVALID_INDEX);
+            mLocalVersions.push_back(1);
+            mWorldVersions.push_back(0);
+            mSeenLocalVersions.push_back(0);
+            mSeenParentVersions.push_back(0);
+            mCheckedEpochs.push_back(0);
+            mNodes.push_back(node);
+        }
+
+        // 新槽位的局部版本号和计算过的不一样，需要计算一次世界变换
+        mEpoch.fetch_add(1, std::memory_order_relaxed);
+
+        return index;
+    }
+
+    void SGTransformStore::release(uint32_t index)
+    {
+        T3D_ASSERT(index < mNodes.size());
+
+        // 结点析构前已经从父结点上拿走了，子结点也都已经拿走，没有槽位再引用这里
+        mNodes[index] = nullptr;
+        mParents[index] = INVALID_INDEX;
+        mSeenLocalVersions[index] = mLocalVersions[index];
+        mSeenParentVersions[index] = 0;
+        mFreeSlots.push_back(index);
+    }
+
+    void SGTransformStore::setParent(uint32_t index, uint32_t parent)
+    {
+        mParents[index] = parent;
+
+        if (parent != INVALID_INDEX && parent > index)
+        {
+            mIsHierarchyDirty = true;
+        }
+
+        // 换了父槽位，不同父槽位的世界版本号不能比较，所以当作局部变换变化处理
+        markLocalChanged(index);
+    }
+
+    void SGTransformStore::computeWorld(uint32_t index, uint32_t parentVersion)
+    {
+        Transform &world = mWorldTransforms[index];
+        uint32_t parent = mParents[index];
+
+        if (parent != INVALID_INDEX)
+        {
+            world.applyTransform(mWorldTransforms[parent],
+                mPositions[index], mOrientations[index], mScales[index]);
+        }
+        else
+        {
+            world.setTranslate(mPositions[index]);
+            world.setOrientation(mOrientations[index]);
+            world.setScale(mScales[index]);
+            world.update();
+        }
+
+        mSeenLocalVersions[index] = mLocalVersions[index];
+        mSeenParentVersions[index] = parentVersion;
+        ++mWorldVersions[index];
+    }
+
+    const Transform &SGTransformStore::resolve(uint32_t index)
+    {
+        uint32_t epoch = mEpoch.load(std::memory_order_relaxed);
+        uint32_t checked = mCheckedEpochs[index];
+
+        if (mUpdatedEpoch != epoch && checked != epoch && checked != FROZEN_EPOCH)
+        {
+            uint32_t parent = mParents[index];
+            uint32_t parentVersion = 0;
+
+            if (parent != INVALID_INDEX)
+            {
+                resolve(parent);
+                parentVersion = mWorldVersions[parent];
+            }
+
+            if (mLocalVersions[index] != mSeenLocalVersions[index]
+                || parentVersion != mSeenParentVersions[index])
+            {
+                computeWorld(index, parentVersion);
+            }
+
+            mCheckedEpochs[index] = epoch;
+        }
+
+        return mWorldTransforms[index];
+    }
+
+    void SGTransformStore::rebuild()
+    {
+        T3D_PROFILE_ZONE("SGTransformStore::rebuild");
+
+        const uint32_t count = uint32_t(mNodes.size());
+
+        // 统计每个槽位的子槽位数量
+        IndexArray offsets(count + 1, 0);
+        uint32_t i = 0;
+
+        while (i < count)
+        {
+            if (mNodes[i] != nullptr && mParents[i] != INVALID_INDEX)
+            {
+                ++offsets[mParents[i] + 1];
+            }
+            ++i;
+        }
+
+        i = 0;
+        while (i < count)
+        {
+            offsets[i + 1] += offsets[i];
+            ++i;
+        }
+
+        // 子槽位按父槽位分段连续存放
+        IndexArray children(offsets[count]);
+        IndexArray cursors(offsets.begin(), offsets.end() - 1);
+
+        i = 0;
+        while (i < count)
+        {
+            if (mNodes[i] != nullptr && mParents[i] != INVALID_INDEX)
+            {
+                children[cursors[mParents[i]]++] = i;
+            }
+            ++i;
+        }
+
+        // 从每个根槽位深度优先先序遍历，得到父在前子在后的顺序
+        IndexArray order;
+        order.reserve(count);
+        IndexArray stack;
+
+        i = 0;
+        while (i < count)
+        {
+            if (mNodes[i] != nullptr && mParents[i] == INVALID_INDEX)
+            {
+                stack.push_back(i);
+
+                while (!stack.empty())
+                {
+                    uint32_t slot = stack.back();
+                    stack.pop_back();
+                    order.push_back(slot);
+
+                    // 逆序压栈，保持兄弟结点原来的先后顺序
+                    uint32_t child = offsets[slot + 1];
+                    while (child > offsets[slot])
+                    {
+                        --child;
+                        stack.push_back(children[child]);
+                    }
+                }
+            }
+            ++i;
+        }
+
+        // 按新顺序搬移数据，并回写结点的索引
+        const uint32_t liveCount = uint32_t(order.size());
+        IndexArray remap(count, INVALID_INDEX);
+
+        i = 0;
+        while (i < liveCount)
+        {
+            remap[order[i]] = i;
+            ++i;
+        }
+
+        Vector3Array positions(liveCount);
+        QuaternionArray orientations(liveCount);
+        Vector3Array scales(liveCount);
+        TransformArray worldTransforms(liveCount);
+        IndexArray parents(liveCount);
+        VersionArray localVersions(liveCount);
+        VersionArray worldVersions(liveCount);
+        VersionArray seenLocalVersions(liveCount);
+        VersionArray seenParentVersions(liveCount);
+        VersionArray checkedEpochs(liveCount);
+        NodeArray nodes(liveCount);
+
+        i = 0;
+        while (i < liveCount)
+        {
+            uint32_t slot = order[i];
+            uint32_t parent = mParents[slot];
+
+            positions[i] = mPositions[slot];
+            orientations[i] = mOrientations[slot];
+            scales[i] = mScales[slot];
+            worldTransforms[i] = mWorldTransforms[slot];
+            parents[i] = (parent != INVALID_INDEX ? remap[parent] : INVALID_INDEX);
+            localVersions[i] = mLocalVersions[slot];
+            worldVersions[i] = mWorldVersions[slot];
+            seenLocalVersions[i] = mSeenLocalVersions[slot];
+            seenParentVersions[i] = mSeenParentVersions[slot];
+            checkedEpochs[i] = mCheckedEpochs[slot];
+            nodes[i] = mNodes[slot];
+            nodes[i]->mTransformIndex = i;
+            ++i;
+        }
+
+        mPositions.swap(positions);
+        mOrientations.swap(orientations);
+        mScales.swap(scales);
+        mWorldTransforms.swap(worldTransforms);
+        mParents.swap(parents);
+        mLocalVersions.swap(localVersions);
+        mWorldVersions.swap(worldVersions);
+        mSeenLocalVersions.swap(seenLocalVersions);
+        mSeenParentVersions.swap(seenParentVersions);
+        mCheckedEpochs.swap(checkedEpochs);
+        mNodes.swap(nodes);
+
+        mFreeSlots.clear();
+        mIsHierarchyDirty = false;
+    }
+
+    void SGTransformStore::update()
+    {
+        T3D_PROFILE_ZONE("SGTransformStore::update");
+
+        if (mIsHierarchyDirty)
+        {
+            rebuild();
+        }
+
+        uint32_t epoch = mEpoch.load(std::memory_order_relaxed);
+
+        if (mUpdatedEpoch == epoch)
+        {
+            // 上一次更新后没有任何变化
+            return;
+        }
+
+        const uint32_t count = uint32_t(mNodes.size());
+        uint32_t i = 0;
+
+        while (i < count)
+        {
+            uint32_t parent = mParents[i];
+            uint32_t parentVersion = (parent != INVALID_INDEX ? mWorldVersions[parent] : 0);
+
+            if (mLocalVersions[i] != mSeenLocalVersions[i]
+                || parentVersion != mSeenParentVersions[i])
+            {
+                computeWorld(i, parentVersion);
+            }
+            ++i;
+        }
+
+        mUpdatedEpoch = epoch;
+    }
+}
@@ -20,12 +20,21 @@
 #include "SceneGraph/T3DSceneManager.h"
 #include "SceneGraph/T3DSGCamera.h"
 #include "SceneGraph//T3DSGTransformNode.h"
+#include "SceneGraph/T3DSGTransformStore.h"
+#include "SceneGraph/T3DSGTransform2DStore.h"
 #include "SceneGraph/T3DSGRenderable.h"
 #include "SceneGraph/T3DSGTransform2D.h"
 #include "SceneGraph/T3DSGText2D.h"
+#include "SceneGraph/T3DDynamicAabbTree.h"
+#include "SceneGraph/T3DLooseOctree.h"
+#include "SceneGraph/T3DSGOccluder.h"
+#include "Bound/T3DFrustumBound.h"
 #include "Render/T3DRenderer.h"
 #include "Render/T3DRenderQueue.h"
+#include "Render/T3DOcclusionCuller.h"
 #include "Resource/T3DFontManager.h"
+#include "Misc/T3DString.h"
+#include <algorithm>
 
 
 namespace Tiny3D
@@ -36,10 +45,24 @@ namespace Tiny3D
         : mRoot(nullptr)
         , mRenderer(nullptr)
         , mRenderQueue(nullptr)
+        , mTransformStore(nullptr)
+        , mTransform2DStore(nullptr)
+        , mSpatialIndex(nullptr)
+        , mIsCullingByIndex(false)
+        , mOcclusionCuller(nullptr)
+        , mFrameOcclusionCuller(nullptr)
+        , mParallelThreshold(E_DEFAULT_PARALLEL_THRESHOLD)
+        , mIsUpdatingInParallel(false)
     {
+        // 变换数据仓库要比所有3D变换结点先创建、后销毁
+        mTransformStore = new SGTransformStore();
+        mTransform2DStore = new SGTransform2DStore();
         mRenderQueue = RenderQueue::create();
         mRoot = SGTransformNode::create();
         mRoot->setName("Root");
+
+        // 根结点没有父结点，不会收到进入场景的通知
+        registerNode(mRoot);
     }
 
     SceneManager::~SceneManager()
@@ -47,26 +70,571 @@ namespace Tiny3D
         mRoot->removeAllChildren(true);
         mRoot = nullptr;
 
+        mNodes.clear();
+        mNamedNodes.clear();
+
         mRenderQueue = nullptr;
+        mOcclusionCuller = nullptr;
+
+        // 对象离开场景时已经从空间索引移除了
+        T3D_SAFE_DELETE(mSpatialIndex);
+
+        T3D_SAFE_DELETE(mTransform2DStore);
+        T3D_SAFE_DELETE(mTransformStore);
     }
 
     void SceneManager::renderScene(const SGCameraPtr &camera, const ViewportPtr &viewport)
     {
+        T3D_PROFILE_ZONE("SceneManager::renderScene");
+
         mCurCamera = camera;
         mRenderer->setViewport(viewport);
 
-        // ȸ任
-        mCurCamera->updateTransform();
+        {
+            T3D_PROFILE_ZONE("SceneManager::updateTransform");
+
+            // 按父在前子在后的顺序线性计算所有脏结点的世界变换
+            mTransformStore->update();
+
+            // 2D变换的视口缩放每帧只取一次，然后按层级算完所有2D结点的世界变换
+            Real vpWidth = Real(viewport->getActualWidth());
+            Real vpHeight = Real(viewport->getActualHeight());
+            Real scaleX = (vpWidth > Real(0.0) ? camera->getAspectRatio() / vpWidth : Real(0.0));
+            Real scaleY = (vpHeight > Real(0.0) ? Real(1.0) / vpHeight : Real(0.0));
+            mTransform2DStore->setViewportScale(scaleX, scaleY);
+            mTransform2DStore->update();
+
+            // 优先更新相机变换
+            mCurCamera->updateTransform();
+
+            // 更新scene graph上所有结点
+            updateScene();
+        }
+
+        {
+            T3D_PROFILE_ZONE("SceneManager::frustumCulling");
+
+            // 每帧从测试所有面开始，结点包围盒完全在某个面内侧的，子结点不再测试这个面
+            BoundPtr bound = mCurCamera->getBound();
+            if (bound != nullptr && bound->getType() == Bound::E_BT_FRUSTUM)
+            {
+                FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+                frustum->setPlaneMask(Frustum::E_FACE_MASK_ALL);
+            }
+
+            rasterizeOccluders(bound);
+
+            if (mSpatialIndex != nullptr)
+            {
+                // 先把这一帧移动过的对象更新到空间索引，再查询
+                syncSpatialIndex();
+                cullByIndex(bound);
+            }
+            else
+            {
+                // 对scene graph上所有结点做frustum culling
+                mRoot->frustumCulling(bound, mRenderQueue);
+            }
+
+            mFrameOcclusionCuller = nullptr;
+        }
+
+        {
+            T3D_PROFILE_ZONE("RenderQueue::render");
+
+            // 直接对渲染队列的对象渲染
+            mRenderer->beginRender(viewport->getBackgroundColor());
+            mRenderQueue->render(mRenderer);
+            mRenderer->endRender();
+        }
+    }
+
+    void SceneManager::setRetainedMode(bool enable)
+    {
+        if (enable == mRenderQueue->isRetainedMode())
+            return;
+
+        mRenderQueue->setRetainedMode(enable);
+
+        if (enable)
+        {
+            // 把已经在场景里的渲染对象都注册到渲染队列
+            SGNode *root = mRoot;
+            root->onEnterScene();
+        }
+    }
+
+    bool SceneManager::isRetainedMode() const
+    {
+        return mRenderQueue->isRetainedMode();
+    }
+
+    void SceneManager::updateProcedure(void *context, size_t begin, size_t end)
+    {
+        T3D_PROFILE_ZONE("SceneManager::updateProcedure");
+
+        SceneManager *mgr = (SceneManager *)context;
+
+        while (begin < end)
+        {
+            mgr->mUpdateTasks[begin]->updateTransform();
+            ++begin;
+        }
+    }
+
+    void SceneManager::splitUpdateTasks(SGNode *node, uint32_t depth)
+    {
+        // 只有普通3D变换结点的更新是算完自己的世界变换再更新子结点，可以展开，
+        // 其他结点（例如模型）有自己的更新逻辑，整棵子树作为一个任务
+        if (node->getNodeType() == Node::E_NT_TRANSFORM && depth < E_MAX_SPLIT_DEPTH
+            && !node->getChildren().empty())
+        {
+            SGTransformNode *xform = (SGTransformNode *)node;
+            xform->getLocalToWorldTransform();
+            mTransformStore->freeze(xform->getTransformIndex());
+            mFrozenNodes.push_back(xform);
+
+            const Children &children = node->getChildren();
+            auto itr = children.begin();
+
+            while (itr != children.end())
+            {
+                Node *child = *itr;
+                splitUpdateTasks((SGNode *)child, depth + 1);
+                ++itr;
+            }
+        }
+        else
+        {
+            mUpdateTasks.push_back(node);
+        }
+    }
+
+    void SceneManager::updateScene()
+    {
+        SGNode *root = mRoot;
+        TaskScheduler *scheduler = TaskScheduler::getInstancePtr();
+
+        if (scheduler == nullptr || scheduler->getThreadCount() <= 1
+            || mTransformStore->getCount() < mParallelThreshold)
+        {
+            root->updateTransform();
+            return;
+        }
+
+        mUpdateTasks.clear();
+        mFrozenNodes.clear();
+        splitUpdateTasks(root, 0);
+
+        mIsUpdatingInParallel = true;
+
+        // 子树大小差别很大，每个子树单独作为一个任务，由调度器在线程之间平衡
+        scheduler->parallelFor(mUpdateTasks.size(), 1, SceneManager::updateProcedure, this);
+
+        mIsUpdatingInParallel = false;
+
+        TransformNodeArray::iterator itr = mFrozenNodes.begin();
+        while (itr != mFrozenNodes.end())
+        {
+            mTransformStore->unfreeze((*itr)->getTransformIndex());
+            ++itr;
+        }
+
+        // 展开的结点自己没有执行updateTransform()，子树包围盒在这里补上，
+        // 展开时父在前子在后，倒序合并保证子结点先算完
+        TransformNodeArray::reverse_iterator ritr = mFrozenNodes.rbegin();
+        while (ritr != mFrozenNodes.rend())
+        {
+            SGNode *node = *ritr;
+            node->updateEnclosingBound();
+            ++ritr;
+        }
+
+        // 后续操作按结点ID排序，和任务被哪个线程领取无关
+        std::sort(mPostUpdateNodes.begin(), mPostUpdateNodes.end(), SceneManager::lessNodeID);
+
+        UpdateTaskArray::iterator nodeItr = mPostUpdateNodes.begin();
+        while (nodeItr != mPostUpdateNodes.end())
+        {
+            (*nodeItr)->postUpdateTransform();
+            ++nodeItr;
+        }
+
+        mPostUpdateNodes.clear();
+    }
+
+    void SceneManager::setSpatialIndexType(SpatialIndexType type)
+    {
+        SpatialIndex *index = nullptr;
+
+        switch (type)
+        {
+        case E_SIT_DYNAMIC_AABB_TREE:
+            index = new DynamicAabbTree();
+            break;
+        case E_SIT_LOOSE_OCTREE:
+            index = new LooseOctree();
+            break;
+        default:
+            break;
+        }
+
+        setSpatialIndex(index);
+    }
+
+    void SceneManager::setSpatialIndex(SpatialIndex *index)
+    {
+        if (index == mSpatialIndex)
+            return;
+
+        if (mSpatialIndex != nullptr)
+        {
+            // 旧索引的代理ID在新索引里无效
+            mVisibleRenderables.clear();
+            mSpatialIndex->collect(mVisibleRenderables);
+
+            SpatialIndex::RenderablesItr itr = mVisibleRenderables.begin();
+            while (itr != mVisibleRenderables.end())
+            {
+                (*itr)->mSpatialProxy = SpatialIndex::INVALID_PROXY;
+                ++itr;
+            }
+
+            mVisibleRenderables.clear();
+            T3D_SAFE_DELETE(mSpatialIndex);
+        }
+
+        mMovedRenderables.clear();
+        mSpatialIndex = index;
+
+        if (mSpatialIndex != nullptr)
+        {
+            // 场景里的可渲染对象重新登记，下一次裁剪前加入新的索引
+            SGNode *root = mRoot;
+            root->onEnterScene();
+        }
+    }
+
+    size_t SceneManager::queryRenderables(const Aabb &box, SpatialIndex::Renderables &renderables) const
+    {
+        if (mSpatialIndex == nullptr)
+            return 0;
+
+        size_t count = renderables.size();
+        mSpatialIndex->query(box, renderables);
+        return renderables.size() - count;
+    }
+
+    void SceneManager::addMovedRenderable(SGRenderable *renderable)
+    {
+        std::unique_lock<std::mutex> lock(mMovedMutex);
+        mMovedRenderables.push_back(renderable);
+    }
+
+    void SceneManager::removeSpatialProxy(SGRenderable *renderable)
+    {
+        if (renderable->mSpatialProxy != SpatialIndex::INVALID_PROXY)
+        {
+            mSpatialIndex->remove(renderable->mSpatialProxy);
+            renderable->mSpatialProxy = SpatialIndex::INVALID_PROXY;
+        }
+
+        if (!mMovedRenderables.empty())
+        {
+            mMovedRenderables.erase(std::remove(mMovedRenderables.begin(),
+                mMovedRenderables.end(), renderable), mMovedRenderables.end());
+        }
+    }
+
+    void SceneManager::syncSpatialIndex()
+    {
+        T3D_PROFILE_ZONE("SceneManager::syncSpatialIndex");
+
+        std::sort(mMovedRenderables.begin(), mMovedRenderables.end(), SceneManager::lessNodeID);
+
+        // 同一个对象可能登记了多次，第一次插入后面的就变成更新
+        RenderableArray::iterator itr = mMovedRenderables.begin();
+        while (itr != mMovedRenderables.end())
+        {
+            SGRenderable *renderable = *itr;
+            const Aabb *box = renderable->getSpatialBound();
+
+            if (box != nullptr)
+            {
+                if (renderable->mSpatialProxy == SpatialIndex::INVALID_PROXY)
+                {
+                    renderable->mSpatialProxy = mSpatialIndex->insert(renderable, *box);
+                }
+                else
+                {
+                    mSpatialIndex->update(renderable->mSpatialProxy, *box);
+                }
+            }
+            else if (renderable->mSpatialProxy != SpatialIndex::INVALID_PROXY)
+            {
+                mSpatialIndex->remove(renderable->mSpatialProxy);
+                renderable->mSpatialProxy = SpatialIndex::INVALID_PROXY;
+            }
+
+            ++itr;
+        }
+
+        mMovedRenderables.clear();
+    }
+
+    void SceneManager::cullByIndex(const BoundPtr &bound)
+    {
+        if (bound == nullptr || bound->getType() != Bound::E_BT_FRUSTUM)
+        {
+            mRoot->frustumCulling(bound, mRenderQueue);
+            return;
+        }
+
+        // 包围盒无限大的子树还是遍历场景树，包围盒有限的子树整个跳过
+        mIsCullingByIndex = true;
+        mRoot->frustumCulling(bound, mRenderQueue);
+        mIsCullingByIndex = false;
+
+        FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+        mVisibleRenderables.clear();
+        mSpatialIndex->query(frustum->getFrustum(), mVisibleRenderables);
+
+        SpatialIndex::RenderablesItr itr = mVisibleRenderables.begin();
+        while (itr != mVisibleRenderables.end())
+        {
+            SGRenderable *renderable = *itr;
+
+            if (isVisibleInScene(renderable) && (mFrameOcclusionCuller == nullptr
+                || !mFrameOcclusionCuller->isOccluded(*renderable->getSpatialBound())))
+            {
+                renderable->addToRenderQueue(mRenderQueue);
+            }
+
+            ++itr;
+        }
+    }
+
+    void SceneManager::setOcclusionCulling(bool enable, uint32_t width /* = 256 */,
+        uint32_t height /* = 128 */)
+    {
+        mOcclusionCuller = (enable ? OcclusionCuller::create(width, height) : nullptr);
+    }
+
+    void SceneManager::registerOccluder(SGOccluder *occluder)
+    {
+        OccluderArrayItr itr = std::find(mOccluders.begin(), mOccluders.end(), occluder);
+
+        if (itr == mOccluders.end())
+        {
+            mOccluders.push_back(occluder);
+        }
+    }
+
+    void SceneManager::unregisterOccluder(SGOccluder *occluder)
+    {
+        OccluderArrayItr itr = std::find(mOccluders.begin(), mOccluders.end(), occluder);
+
+        if (itr != mOccluders.end())
+        {
+            mOccluders.erase(itr);
+        }
+    }
+
+    void SceneManager::rasterizeOccluders(const BoundPtr &bound)
+    {
+        mFrameOcclusionCuller = nullptr;
+
+        if (mOcclusionCuller == nullptr || mOccluders.empty()
+            || bound == nullptr || bound->getType() != Bound::E_BT_FRUSTUM)
+            return;
+
+        T3D_PROFILE_ZONE("SceneManager::rasterizeOccluders");
+
+        // 正交投影的w总是1，不用按近平面裁剪
+        Real nearDistance = Real(0.0);
+        if (mCurCamera->getProjectionType() == SGCamera::E_PT_PERSPECTIVE)
+        {
+            nearDistance = mCurCamera->getNearPlaneDistance();
+        }
+
+        Matrix4 viewProj = mCurCamera->getProjectionMatrix() * mCurCamera->getViewMatrix();
+        mOcclusionCuller->beginFrame(viewProj, nearDistance);
+
+        FrustumBound *frustum = (FrustumBound *)(Bound *)bound;
+        size_t count = 0;
+
+        OccluderArrayConstItr itr = mOccluders.begin();
+        while (itr != mOccluders.end())
+        {
+            SGOccluder *occluder = *itr;
+
+            if (isVisibleInScene(occluder) && occluder->rasterize(mOcclusionCuller, frustum->getFrustum()))
+            {
+                ++count;
+            }
+
+            ++itr;
+        }
+
+        if (count > 0)
+        {
+            mOcclusionCuller->buildHierarchy();
+            mFrameOcclusionCuller = mOcclusionCuller;
+        }
+    }
+
+    bool SceneManager::isVisibleInScene(const SGNode *node)
+    {
+        while (node != nullptr)
+        {
+            if (!node->isVisible())
+                return false;
+
+            Node *parent = node->getParent();
+            node = (SGNode *)parent;
+        }
+
+        return true;
+    }
+
+    bool SceneManager::lessNodeID(SGNode *a, SGNode *b)
+    {
+        return a->getNodeID() < b->getNodeID();
+    }
+
+    void SceneManager::addPostUpdateNode(SGNode *node)
+    {
+        std::unique_lock<std::mutex> lock(mPostUpdateMutex);
+        mPostUpdateNodes.push_back(node);
+    }
+
+    SGNodePtr SceneManager::getNode(uint32_t nodeID) const
+    {
+        NodeMapConstItr itr = mNodes.find(nodeID);
+        return (itr != mNodes.end() ? itr->second : nullptr);
+    }
+
+    SGNodePtr SceneManager::getNode(const String &name) const
+    {
+        uint32_t nameID = NameTable::find(name);
+
+        if (nameID == NameTable::E_INVALID_NAME)
+            return nullptr;
+
+        NameMapConstItr itr = mNamedNodes.find(nameID);
+        return (itr != mNamedNodes.end() ? itr->second : nullptr);
+    }
+
+    size_t SceneManager::getNodes(const String &name, SGNodeArray &nodes) const
+    {
+        uint32_t nameID = NameTable::find(name);
+
+        if (nameID == NameTable::E_INVALID_NAME)
+            return 0;
+
+        size_t count = 0;
+        auto range = mNamedNodes.equal_range(nameID);
+        NameMapConstItr itr = range.first;
+
+        while (itr != range.second)
+        {
+            nodes.push_back(itr->second);
+            ++count;
+            ++itr;
+        }
+
+        return count;
+    }
+
+    SGNode *SceneManager::findNode(uint32_t nodeID) const
+    {
+        NodeMapConstItr itr = mNodes.find(nodeID);
+        return (itr != mNodes.end() ? itr->second : nullptr);
+    }
+
+    SGNode *SceneManager::findNamedChild(const SGNode *parent, uint32_t nameID) const
+    {
+        SGNode *child = nullptr;
+        auto range = mNamedNodes.equal_range(nameID);
+        NameMapConstItr itr = range.first;
+
+        while (itr != range.second)
+        {
+            SGNode *node = itr->second;
+
+            // 同名的子结点按挂上来的顺序取第一个，和遍历子结点的结果一致
+            if ((const Node *)node->getParent() == parent
+                && (child == nullptr || node->getChildIndex() < child->getChildIndex()))
+            {
+                child = node;
+            }
+
+            ++itr;
+        }
+
+        return child;
+    }
+
+    void SceneManager::registerNode(SGNode *node)
+    {
+        auto ret = mNodes.insert(NodeMap::value_type(node->getNodeID(), node));
+
+        if (!ret.second)
+        {
+            // 已经登记过了，或者外部指定的结点ID重复了
+            T3D_ASSERT(ret.first->second == node);
+            return;
+        }
+
+        if (node->getNameID() != NameTable::E_INVALID_NAME)
+        {
+            mNamedNodes.insert(NameMap::value_type(node->getNameID(), node));
+        }
+    }
+
+    void SceneManager::unregisterNode(SGNode *node)
+    {
+        NodeMapItr itr = mNodes.find(node->getNodeID());
+
+        if (itr != mNodes.end() && itr->second == node)
+        {
+            mNodes.erase(itr);
+            removeName(node, node->getNameID());
+        }
+    }
+
+    void SceneManager::renameNode(SGNode *node, uint32_t oldNameID)
+    {
+        NodeMapConstItr itr = mNodes.find(node->getNodeID());
+
+        if (itr == mNodes.end() || itr->second != node)
+            return;
+
+        removeName(node, oldNameID);
+
+        if (node->getNameID() != NameTable::E_INVALID_NAME)
+        {
+            mNamedNodes.insert(NameMap::value_type(node->getNameID(), node));
+        }
+    }
+
+    void SceneManager::removeName(SGNode *node, uint32_t nameID)
+    {
+        if (nameID == NameTable::E_INVALID_NAME)
+            return;
 
-        // scene graphн
-        mRoot->updateTransform();
+        auto range = mNamedNodes.equal_range(nameID);
+        NameMapItr itr = range.first;
 
-        // scene graphнfrustum culling
-        mRoot->frustumCulling(mCurCamera->getBound(), mRenderQueue);
+        while (itr != range.second)
+        {
+            if (itr->second == node)
+            {
+                mNamedNodes.erase(itr);
+                break;
+            }
 
-        // ֱӶȾеĶȾ
-        mRenderer->beginRender(viewport->getBackgroundColor());
-        mRenderQueue->render(mRenderer);
-        mRenderer->endRender();
+            ++itr;
+        }
     }
 }
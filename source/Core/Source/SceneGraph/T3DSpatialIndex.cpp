@@ -0,0 +1,76 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "SceneGraph/T3DSpatialIndex.h"
+
+
+namespace Tiny3D
+{
+    const uint32_t SpatialIndex::INVALID_PROXY = 0xFFFFFFFF;
+
+    SpatialIndex::SpatialIndex()
+        : mVisitedCount(0)
+    {
+
+    }
+
+    SpatialIndex::~SpatialIndex()
+    {
+
+    }
+
+    bool SpatialIndex::testFrustum(const Vector3 &minPos, const Vector3 &maxPos, const Frustum &frustum, uint32_t &mask)
+    {
+        Real cx = (minPos.x() + maxPos.x()) * Real(0.5);
+        Real cy = (minPos.y() + maxPos.y()) * Real(0.5);
+        Real cz = (minPos.z() + maxPos.z()) * Real(0.5);
+        Real ex = (maxPos.x() - minPos.x()) * Real(0.5);
+        Real ey = (maxPos.y() - minPos.y()) * Real(0.5);
+        Real ez = (maxPos.z() - minPos.z()) * Real(0.5);
+
+        int32_t i = 0;
+        for (i = 0; i < Frustum::E_MAX_FACE; ++i)
+        {
+            uint32_t bit = (1 << i);
+
+            if ((mask & bit) == 0)
+                continue;
+
+            const Plane &plane = frustum.getFace(Frustum::Face(i));
+            Real distance = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3];
+            Real radius = Math::Abs(plane[0]) * ex + Math::Abs(plane[1]) * ey
+                + Math::Abs(plane[2]) * ez;
+
+            if (distance + radius <= Real(0.0))
+                return false;
+
+            if (distance - radius > Real(0.0))
+                mask &= ~bit;
+        }
+
+        return true;
+    }
+
+    bool SpatialIndex::testOverlap(const Vector3 &minPos0, const Vector3 &maxPos0, const Vector3 &minPos1, const Vector3 &maxPos1)
+    {
+        return !(maxPos0.x() < minPos1.x() || minPos0.x() > maxPos1.x()
+            || maxPos0.y() < minPos1.y() || minPos0.y() > maxPos1.y()
+            || maxPos0.z() < minPos1.z() || minPos0.z() > maxPos1.z());
+    }
+}
@@ -54,6 +54,8 @@ namespace Tiny3D
     #define T3D_XML_TAG_SUBMESHES               "submeshes"
     #define T3D_XML_TAG_SUBMESH                 "submesh"
     #define T3D_XML_TAG_INDICES                 "indices"
+    #define T3D_XML_TAG_LODS                    "lods"
+    #define T3D_XML_TAG_LOD                     "lod"
     #define T3D_XML_TAG_SKIN                    "skin"
     #define T3D_XML_TAG_SKIN_INFO               "skininfo"
     #define T3D_XML_TAG_BONE                    "bone"
@@ -99,6 +101,7 @@ namespace Tiny3D
     #define T3D_XML_ATTRIB_MESH                 "mesh"
     #define T3D_XML_ATTRIB_SUBMESH              "submesh"
     #define T3D_XML_ATTRIB_INDEX                "index"
+    #define T3D_XML_ATTRIB_SCREEN               "screen"
 
     #define T3D_XML_ATTRIB_WRAP_U               "wrap_u"
     #define T3D_XML_ATTRIB_WRAP_V               "wrap_v"
@@ -62,10 +62,10 @@ namespace Tiny3D
 
         struct Strategy
         {
-            Level       eLevel;         /// ǰ־ļ𣬸ڸü־
-            uint32_t    unMaxCacheSize; /// ־󻺴ڴСôСύ첽߳дļ
-            uint32_t    unMaxCacheTime; /// ־ݻ¼ʱύ첽߳дļ
-            uint32_t    unExpired;      /// ʱ䣬ӽ쿪ʼݹȥunExpired
+            Level       eLevel;         /// 当前日志输出的级别，高于该级别的日志都不输出
+            uint32_t    unMaxCacheSize; /// 日志内容最大缓存内存大小，超过该大小，马上提交异步线程写回文件
+            uint32_t    unMaxCacheTime; /// 日志内容缓存最长事件，超过该时间间隔，马上提交异步线程写回文件
+            uint32_t    unExpired;      /// 过期时间，从今天开始回溯过去unExpired天
         };
 
     public:
@@ -80,125 +80,125 @@ namespace Tiny3D
         virtual ~Logger();
 
         /**
-         * @brief ־
+         * @brief 设置日志策略
          */
         void setStrategy(const Strategy &strategy);
 
         /**
-         * @brief õǰ־߼𣬸ڸü־Բ
+         * @brief 设置当前日志输出的最高级别，高于该级别的日志被忽略不输出
          */
         void setLevel(Level eLevel);
 
         /**
-         * @brief 󻺴СڸôСĻ־ύ첽߳дļ
+         * @brief 设置最大缓存大小，大于该大小的缓存日志会马上提交异步线程写回文件
          */
         void setMaxCacheSize(uint32_t unMaxCacheSize);
 
         /**
-         * @brief 󻺴ʱʱ־ύ첽߳дļ
+         * @brief 设置最大缓存时间间隔，超过该时间间隔缓存日志会马上提交异步线程写回文件
          */
         void setMaxCacheTime(uint32_t unMaxCacheTime);
 
         /**
-         * @brief ùʱ䣬ӽ쿪ʼݹȥunExpired
+         * @brief 设置过期时间，从今天开始回溯过去unExpired天
          */
         void setExpired(uint32_t unExpired);
 
         /**
-         * @brief ־ģ
-         * @param [in] appID : ʶǰӦóIDԱ־ļ
-         * @param [in] tag : Ӧóǩ־ļӶϢ
-         * @param [in] force : Ƿ־ȫ־
-         * @return óɹtrue
-         * @note øúǰͨsetStrategy()setLevel()setMaxCacheSize()setMaxCacheTime()ú־ԣ
-         *      Ĭϲ
+         * @brief 启动日志模块
+         * @param [in] appID : 标识当前应用程序的ID，以便区分日志文件
+         * @param [in] tag : 额外的应用程序标签，给日志文件名附加额外信息以作区别
+         * @param [in] force : 是否忽略日志级别，全量日志输出
+         * @return 调用成功返回true
+         * @note 调用该函数前，请先通过setStrategy()或者setLevel()、setMaxCacheSize()、setMaxCacheTime()设置好日志输出策略，
+         *      否则会用默认策略
          */
         bool startup(uint32_t appID, const String &tag, bool force = false, bool outputConsole = false);
 
         /**
-         * @brief ־
-         * @param [in] level : ־Ӧ
-         * @param [in] filename : ־Դļ
-         * @param [in] line : ־ӦԴļ
-         * @param [in] fmt : ʽַ
-         * @param [in] var_list : ɱ
+         * @brief 输出日志
+         * @param [in] level : 输出日志相应级别
+         * @param [in] filename : 输出日志的源码文件
+         * @param [in] line : 输出日志对应源码文件的行数
+         * @param [in] fmt : 格式化字符串
+         * @param [in] var_list : 可变参数
          * @return void
          */
         void trace(Level level, const char *filename, int32_t line, const char *fmt, ...);
 
         /**
-         * @brief ر־ģ
+         * @brief 关闭日志模块
          */
         void shutdown();
 
         /**
-         * @brief ̨
+         * @brief 程序进入后台调用
          */
         void enterBackground();
 
         /**
-         * @brief صǰ̨
+         * @brief 程序回到前台调用
          */
         void enterForeground();
 
         /**
-         * @brief ־ıȡ־öֵ
+         * @brief 根据日志文本获取日志级别枚举值
          */
         Level toLevelValue(const String &level);
 
         /**
-         * @brief ־öֵȡı
+         * @brief 根据日志级别枚举值获取文本
          */
         String toLevelString(Level eLevel);
 
     private:
-        /// ȡ־ļ·
+        /// 获取日志文件存放路径
         String getLogPath() const;
 
-        /// ־ļ
+        /// 构造日志文件名
         String makeLogFileName(uint32_t appID, const String &tag, const DateTime &dt);
 
-        /// ־ļ
+        /// 打开日志文件
         bool openLogFile();
-        /// ݻ滺дļ
+        /// 根据缓存缓冲区索引写文件
         void writeLogFile(std::vector<LogItem*> &cache);
-        /// ر־ļ
+        /// 关闭日志文件
         void closeLogFile();
 
-        /// л涼дļ
+        /// 把所有缓存都写回文件
         void flushCache();
 
-        /// дػʱʱ
+        /// 启动写回缓存时间间隔定时器
         void startFlushTimer();
-        /// ֹͣдػʱʱ
+        /// 停止写回缓存时间间隔定时器
         void stopFlushTimer();
 
-        /// ʱص̳RunLoopObserver
+        /// 定时器回调，继承自RunLoopObserver
         virtual void onExecute(uint32_t unLoopID, uint64_t dt) override;
 
         String getFileName(const String &path) const;
 
-        /// 첽̵߳õĹ
+        /// 异步线程调用的工作过程
         static int32_t asyncWorkingProcedure(Logger *pThis);
         int32_t workingProcedure();
 
-        /// 첽첽̲߳򴴽̱߳
+        /// 启动异步任务，如果异步线程不存在则创建，如果线程被挂起，则唤醒
         void startAsyncTask();
-        /// ֹͣ첽
+        /// 停止异步任务
         void stopAsyncTask();
-        /// 첽߳
+        /// 挂起异步任务线程
         void suspendAsyncTask();
-        /// 첽߳
+        /// 唤醒异步任务线程
         void wakeAsyncTask();
 
-        /// ύ־첽
+        /// 提交检查过期日志异步任务
         void commitCheckExpiredTask();
-        /// ύѻдļ첽
+        /// 提交把缓存写回文件异步任务
         void commitFlushCacheTask();
 
-        /// ־첽
+        /// 处理检查过期日志异步任务
         int32_t processCheckExpiredTask(LogTask *task);
-        /// ѻдļ첽
+        /// 处理把缓存写回文件异步任务
         int32_t processFlushCacheTask(LogTask *task);
 
     private:
@@ -210,34 +210,35 @@ namespace Tiny3D
         typedef TaskQueue::iterator         TaskQueueItr;
         typedef TaskQueue::const_iterator   TaskQueueConstItr;
 
-        uint32_t            mFlushCacheTimerID; /// дضʱID
+        uint32_t            mFlushCacheTimerID; /// 写回定时器ID
 
-        uint32_t            mAppID;             /// Ӧóʶ
-        String              mTag;               /// ӦóϢǩ
+        uint32_t            mAppID;             /// 应用程序标识
+        String              mTag;               /// 应用程序额外信息标签
 
-        Strategy            mStrategy;          /// ־ز
+        Strategy            mStrategy;          /// 日志输出相关策略
 
-        DateTime            mCurLogFileTime;    /// ǰ־ļʱ䣬ڿСʱл־ļ
+        DateTime            mCurLogFileTime;    /// 当前日志文件的时间，用于跨小时切换日志文件
 
-        ItemCache           mItemCache;         /// ־¼һʱʱύ첽дش
-        TaskQueue           mTaskQueue;         /// 첽
+        ItemCache           mItemCache;         /// 缓存日志记录，到达一定数量或者时间时提交异步写回处理
+        std::mutex          mCacheMutex;        /// 日志缓存互斥量，场景并行更新时多个线程会同时输出日志
+        TaskQueue           mTaskQueue;         /// 异步任务队列
 
-        FileDataStream      mFileStream;        /// ļ
+        FileDataStream      mFileStream;        /// 文件输出对象
 
-        std::thread         mWorkingThread;     /// 첽̣߳־ļд־ļ첽
+        std::thread         mWorkingThread;     /// 异步工作线程，用于清除过期日志文件、写入日志文件等异步操作
 
-        std::mutex              mWaitMutex;     /// ڹ̻߳
-        std::condition_variable mWaitCond;      /// 첽߳
+        std::mutex              mWaitMutex;     /// 用于挂起线程互斥量
+        std::condition_variable mWaitCond;      /// 异步线程条件变量
 
-        std::mutex          mTaskMutex;         /// 첽񻥳
+        std::mutex          mTaskMutex;         /// 异步任务互斥量
 
-        int32_t             mTaskType;          /// ǰ
+        int32_t             mTaskType;          /// 当前处理任务
 
-        bool                mIsForced;          /// Ƿǿ
-        bool                mIsOutputConsole;   /// Ƿ̨ͬ
-        bool                mIsRunning;         /// ־ϵͳǷ
-        bool                mIsTerminated;      /// 첽߳Ƿֹ
-        bool                mIsSuspended;       /// Ƿ񱻹
+        bool                mIsForced;          /// 是否强制输出
+        bool                mIsOutputConsole;   /// 是否同步输出到控制台
+        bool                mIsRunning;         /// 日志系统是否运行中
+        bool                mIsTerminated;      /// 异步线程是否被终止
+        bool                mIsSuspended;       /// 是否被挂起
     };
 }
 
@@ -42,7 +42,7 @@ namespace Tiny3D
 
         void outputFile(FileDataStream &fs) const
         {
-            // ־ʽ
+            // 日志格式
             // YYYY-MM-DD HH:MM:SS.XXX|Level|ThreadID|FineName|Line|Content
             fs.write((void *)mContent, mContentSize);
         }
@@ -33,9 +33,9 @@ namespace Tiny3D
     public:
         enum Type
         {
-            E_TYPE_NONE = 0,        /// û
-            E_TYPE_CHECK_EXPIRED,   /// ־ļ
-            E_TYPE_FLUSH_CACHE,     /// ѻ־дļ
+            E_TYPE_NONE = 0,        /// 没有类型
+            E_TYPE_CHECK_EXPIRED,   /// 检查过期日志文件
+            E_TYPE_FLUSH_CACHE,     /// 把缓存日志写回文件
             E_TYPE_MAX
         };
 
@@ -117,16 +117,16 @@ namespace Tiny3D
 
         if (mStrategy.eLevel != E_LEVEL_OFF)
         {
-            /// ǹر־Ҫȴ־
+            /// 不是关闭日志输出，需要先打开日志
             if (openLogFile())
             {
-                /// ʱʱύд첽
+                /// 启动定时器，定时提交写回异步任务
                 stopFlushTimer();
                 startFlushTimer();
             }
         }
 
-        /// ǷҪ־ύһ־ļ첽
+        /// 不管是否要输出日志，都提交一个检查过期日志文件的异步任务
         commitCheckExpiredTask();
 
         return true;
@@ -144,18 +144,19 @@ namespace Tiny3D
         vsnprintf(content, sizeof(content)-1, fmt, args);
         va_end(args);
 
-        /// ȡ·ֱӻȡԴļ
+        /// 截取路径，直接获取源码文件名
         String name = getFileName(filename);
 
-        /// һ־
+        /// 生成一条日志项
         LogItem *item = new LogItem(level, name.c_str(), line, content);
         
-        /// ̨
+        /// 输出到控制台
         if (mIsOutputConsole)
         {
             item->outputConsole();
         }
 
+        std::lock_guard<std::mutex> lock(mCacheMutex);
         mItemCache.push_back(item);
 
         if (mItemCache.size() >= mStrategy.unMaxCacheSize)
@@ -166,13 +167,13 @@ namespace Tiny3D
 
     void Logger::shutdown()
     {
-        /// ֹͣдļʱ
+        /// 停止缓存写回文件间隔定时器
         stopFlushTimer();
 
-        /// л涼ͬдļ
+        /// 把所有缓存都同步写回文件中
         flushCache();
 
-        /// رļ
+        /// 关闭文件
         closeLogFile();
     }
 
@@ -253,7 +254,7 @@ namespace Tiny3D
 
     bool Logger::openLogFile()
     {
-        /// ȴ־ļ
+        /// 先创建日志文件夹
         String logPath = getLogPath();
         Dir dir;
         dir.makeDir(logPath);
@@ -271,6 +272,8 @@ namespace Tiny3D
 
     void Logger::writeLogFile(std::vector<LogItem*> &cache)
     {
+        T3D_PROFILE_ZONE("Logger::writeLogFile");
+
         std::vector<LogItem*>::iterator itr = cache.begin();
 
         while (itr != cache.end() && !mIsTerminated)
@@ -279,7 +282,7 @@ namespace Tiny3D
 
             if (item->getHour() != mCurLogFileTime.Hour())
             {
-                // ԽһСʱдһļ
+                // 跨越到下一个小时，重新写一个新文件
                 closeLogFile();
                 openLogFile();
             }
@@ -303,13 +306,14 @@ namespace Tiny3D
 
     void Logger::flushCache()
     {
-        /// ֹ̨̣ͣ߳ͬд
+        /// 先停止后台工作线程，同步写回所有数据
         stopAsyncTask();
 
-        /// õǰ־ֱȹرգд־
+        /// 设置当前日志级别，直接先关闭，避免再写入日志
         Level eLevel = mStrategy.eLevel;
         mStrategy.eLevel = E_LEVEL_OFF;
 
+        mCacheMutex.lock();
         std::vector<LogItem *> cache(mItemCache.size());
         std::vector<LogItem *>::iterator itr = cache.begin();
         while (itr != cache.end())
@@ -318,10 +322,11 @@ namespace Tiny3D
             mItemCache.pop_front();
             ++itr;
         }
+        mCacheMutex.unlock();
 
         writeLogFile(cache);
 
-        /// ָǰ־
+        /// 恢复当前日志级别
         mStrategy.eLevel = eLevel;
     }
 
@@ -343,6 +348,7 @@ namespace Tiny3D
     {
         if (unLoopID == mFlushCacheTimerID)
         {
+            std::lock_guard<std::mutex> lock(mCacheMutex);
             commitFlushCacheTask();
         }
     }
@@ -415,7 +421,7 @@ namespace Tiny3D
     {
         if (!mWorkingThread.joinable())
         {
-            /// 첽߳
+            /// 启动异步线程
             mWorkingThread = std::thread(Logger::asyncWorkingProcedure, this);
             mIsRunning = true;
             mIsTerminated = false;
@@ -423,10 +429,10 @@ namespace Tiny3D
         }
         else
         {
-            // 첽߳Ѿ
+            // 异步线程已经启动了
             if (mIsSuspended)
             {
-                /// 첽̱߳
+                /// 异步线程被挂起，则唤醒
                 wakeAsyncTask();
             }
         }
@@ -438,11 +444,11 @@ namespace Tiny3D
         {
             if (mIsSuspended)
             {
-                /// 첽̹߳Уֱӻ
+                /// 异步任务线程挂起中，直接唤醒
                 wakeAsyncTask();
             }
 
-            /// ûֱͣ
+            /// 没挂起，直接停掉
             mIsTerminated = true;
             mWorkingThread.join();
             mIsRunning = false;
@@ -76,6 +76,13 @@ namespace Tiny3D
 
         void setParam(const Vector3 &vMin, const Vector3 &vMax);
 
+        /// Grow this box to enclose rkBox as well.
+        void merge(const Aabb &rkBox);
+
+        /// Compute the axis aligned box enclosing this box transformed by an affine matrix.
+        /// Uses the center/extent form, extents are mapped through the absolute matrix.
+        void transform(const Matrix4 &rkMatrix, Aabb &rResult) const;
+
     private:
         Real    mMinX;
         Real    mMaxX;
@@ -260,8 +260,17 @@ namespace Tiny3D
 
         Vector3 temp = vMax - vMin;
         Vector3 center = temp * Real(0.5) + vMin;
-        Real radius = temp.length();
+        Real radius = temp.length() * Real(0.5);
         mSphere.setCenter(center);
         mSphere.setRadius(radius);
     }
+
+    inline void Aabb::merge(const Aabb &rkBox)
+    {
+        Vector3 vMin(std::min(mMinX, rkBox.mMinX), std::min(mMinY, rkBox.mMinY),
+            std::min(mMinZ, rkBox.mMinZ));
+        Vector3 vMax(std::max(mMaxX, rkBox.mMaxX), std::max(mMaxY, rkBox.mMaxY),
+            std::max(mMaxZ, rkBox.mMaxZ));
+        setParam(vMin, vMax);
+    }
 }
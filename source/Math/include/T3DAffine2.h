@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#ifndef __T3D_AFFINE2_H__
+#define __T3D_AFFINE2_H__
+
+
+#include "T3DMathPrerequisites.h"
+#include "T3DMath.h"
+#include "T3DVector2.h"
+#include "T3DMatrix2.h"
+#include "T3DMatrix4.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 2D affine transform stored as a 2x3 row major matrix.
+     * @remarks
+     *      | m00 m01 tx |
+     *      | m10 m11 ty |
+     *  The implicit third row is (0, 0, 1). Points are column vectors, so
+     *  A * B applies B first and then A.
+     */
+    class T3D_MATH_API Affine2
+    {
+    public:
+        /// Create and initialize as identity.
+        Affine2();
+        /// Copy constructor.
+        Affine2(const Affine2 &other);
+        /// Create and initialize using rows of numbers.
+        Affine2(Real fM00, Real fM01, Real fTx, Real fM10, Real fM11, Real fTy);
+        /// Create from a linear part and a translation.
+        Affine2(const Matrix2 &rkLinear, const Vector2 &rkTranslate);
+
+        /// Make identity transform.
+        void makeIdentity();
+        /// Make transform that scales, then rotates, then translates.
+        void makeTransform(const Vector2 &rkTranslate, const Radian &rkAngle, const Vector2 &rkScale);
+
+        /// Get array of members in row major (constant).
+        operator const Real *() const;
+        /// Get array of members in row major.
+        operator Real *();
+
+        /// Get array of row members (constant).
+        const Real *operator [](int32_t nRow) const;
+        /// Get array of row members.
+        Real *operator [](int32_t nRow);
+
+        /// Set the translation.
+        void setTranslate(const Vector2 &rkTranslate);
+        /// Get the translation.
+        Vector2 getTranslate() const;
+
+        /// Set the linear part.
+        void setLinear(const Matrix2 &rkLinear);
+        /// Get the linear part.
+        Matrix2 getLinear() const;
+
+        /// Assignment.
+        Affine2 &operator =(const Affine2 &other);
+
+        /// Comparison (equal to).
+        bool operator ==(const Affine2 &other) const;
+        /// Comparison (not equal to).
+        bool operator !=(const Affine2 &other) const;
+
+        /// Concatenation, the right transform is applied first.
+        Affine2 operator *(const Affine2 &other) const;
+        /// Concatenate and assign.
+        Affine2 &operator *=(const Affine2 &other);
+
+        /// Transform a point, translation is applied.
+        Vector2 transformPoint(const Vector2 &rkV) const;
+        /// Transform a direction, translation is ignored.
+        Vector2 transformVector(const Vector2 &rkV) const;
+
+        /// Inverse transform.
+        Affine2 inverse() const;
+
+        /// Calculate determinant of the linear part.
+        Real determinant() const;
+
+        /// Expand to a 4x4 matrix on the z = 0 plane.
+        void toMatrix4(Matrix4 &rkMat) const;
+
+    public:
+        static const Affine2 IDENTITY;
+
+    private:
+        Real    m_afEntry[6];
+    };
+}
+
+
+#include "T3DAffine2.inl"
+
+
+#endif  /*__T3D_AFFINE2_H__*/
@@ -0,0 +1,165 @@
+
+namespace Tiny3D
+{
+    inline Affine2::Affine2()
+    {
+        makeIdentity();
+    }
+
+    inline Affine2::Affine2(const Affine2 &other)
+    {
+        memcpy(m_afEntry, other.m_afEntry, sizeof(m_afEntry));
+    }
+
+    inline Affine2::Affine2(Real fM00, Real fM01, Real fTx, Real fM10, Real fM11, Real fTy)
+    {
+        m_afEntry[0] = fM00;
+        m_afEntry[1] = fM01;
+        m_afEntry[2] = fTx;
+        m_afEntry[3] = fM10;
+        m_afEntry[4] = fM11;
+        m_afEntry[5] = fTy;
+    }
+
+    inline Affine2::Affine2(const Matrix2 &rkLinear, const Vector2 &rkTranslate)
+    {
+        setLinear(rkLinear);
+        setTranslate(rkTranslate);
+    }
+
+    inline void Affine2::makeIdentity()
+    {
+        m_afEntry[0] = Real(1.0);
+        m_afEntry[1] = Real(0.0);
+        m_afEntry[2] = Real(0.0);
+        m_afEntry[3] = Real(0.0);
+        m_afEntry[4] = Real(1.0);
+        m_afEntry[5] = Real(0.0);
+    }
+
+    inline void Affine2::makeTransform(const Vector2 &rkTranslate, const Radian &rkAngle, const Vector2 &rkScale)
+    {
+        Real c = Math::Cos(rkAngle);
+        Real s = Math::Sin(rkAngle);
+        m_afEntry[0] = c * rkScale.x();
+        m_afEntry[1] = -s * rkScale.y();
+        m_afEntry[2] = rkTranslate.x();
+        m_afEntry[3] = s * rkScale.x();
+        m_afEntry[4] = c * rkScale.y();
+        m_afEntry[5] = rkTranslate.y();
+    }
+
+    inline Affine2::operator const Real *() const
+    {
+        return m_afEntry;
+    }
+
+    inline Affine2::operator Real *()
+    {
+        return m_afEntry;
+    }
+
+    inline const Real *Affine2::operator [](int32_t nRow) const
+    {
+        return &m_afEntry[nRow * 3];
+    }
+
+    inline Real *Affine2::operator [](int32_t nRow)
+    {
+        return &m_afEntry[nRow * 3];
+    }
+
+    inline void Affine2::setTranslate(const Vector2 &rkTranslate)
+    {
+        m_afEntry[2] = rkTranslate.x();
+        m_afEntry[5] = rkTranslate.y();
+    }
+
+    inline Vector2 Affine2::getTranslate() const
+    {
+        return Vector2(m_afEntry[2], m_afEntry[5]);
+    }
+
+    inline void Affine2::setLinear(const Matrix2 &rkLinear)
+    {
+        m_afEntry[0] = rkLinear[0][0];
+        m_afEntry[1] = rkLinear[0][1];
+        m_afEntry[3] = rkLinear[1][0];
+        m_afEntry[4] = rkLinear[1][1];
+    }
+
+    inline Matrix2 Affine2::getLinear() const
+    {
+        return Matrix2(m_afEntry[0], m_afEntry[1], m_afEntry[3], m_afEntry[4]);
+    }
+
+    inline Affine2 &Affine2::operator =(const Affine2 &other)
+    {
+        memcpy(m_afEntry, other.m_afEntry, sizeof(m_afEntry));
+        return *this;
+    }
+
+    inline bool Affine2::operator ==(const Affine2 &other) const
+    {
+        return memcmp(m_afEntry, other.m_afEntry, sizeof(m_afEntry)) == 0;
+    }
+
+    inline bool Affine2::operator !=(const Affine2 &other) const
+    {
+        return !operator ==(other);
+    }
+
+    inline Affine2 Affine2::operator *(const Affine2 &other) const
+    {
+        const Real *a = m_afEntry;
+        const Real *b = other.m_afEntry;
+        return Affine2(
+            a[0] * b[0] + a[1] * b[3], a[0] * b[1] + a[1] * b[4], a[0] * b[2] + a[1] * b[5] + a[2],
+            a[3] * b[0] + a[4] * b[3], a[3] * b[1] + a[4] * b[4], a[3] * b[2] + a[4] * b[5] + a[5]);
+    }
+
+    inline Affine2 &Affine2::operator *=(const Affine2 &other)
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    inline Vector2 Affine2::transformPoint(const Vector2 &rkV) const
+    {
+        return Vector2(
+            m_afEntry[0] * rkV.x() + m_afEntry[1] * rkV.y() + m_afEntry[2],
+            m_afEntry[3] * rkV.x() + m_afEntry[4] * rkV.y() + m_afEntry[5]);
+    }
+
+    inline Vector2 Affine2::transformVector(const Vector2 &rkV) const
+    {
+        return Vector2(
+            m_afEntry[0] * rkV.x() + m_afEntry[1] * rkV.y(),
+            m_afEntry[3] * rkV.x() + m_afEntry[4] * rkV.y());
+    }
+
+    inline Real Affine2::determinant() const
+    {
+        return m_afEntry[0] * m_afEntry[4] - m_afEntry[1] * m_afEntry[3];
+    }
+
+    inline void Affine2::toMatrix4(Matrix4 &rkMat) const
+    {
+        rkMat[0][0] = m_afEntry[0];
+        rkMat[0][1] = m_afEntry[1];
+        rkMat[0][2] = Real(0.0);
+        rkMat[0][3] = m_afEntry[2];
+        rkMat[1][0] = m_afEntry[3];
+        rkMat[1][1] = m_afEntry[4];
+        rkMat[1][2] = Real(0.0);
+        rkMat[1][3] = m_afEntry[5];
+        rkMat[2][0] = Real(0.0);
+        rkMat[2][1] = Real(0.0);
+        rkMat[2][2] = Real(1.0);
+        rkMat[2][3] = Real(0.0);
+        rkMat[3][0] = Real(0.0);
+        rkMat[3][1] = Real(0.0);
+        rkMat[3][2] = Real(0.0);
+        rkMat[3][3] = Real(1.0);
+    }
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#ifndef __T3D_BOUND_BATCH_H__
+#define __T3D_BOUND_BATCH_H__
+
+
+#include "T3DMathPrerequisites.h"
+#include "T3DVector3.h"
+#include "T3DFrustum.h"
+
+
+namespace Tiny3D
+{
+    /// Axis aligned boxes stored as structure of arrays in center/extent form.
+    /// Storage is padded to a multiple of E_PADDING so the batch kernels can
+    /// run 4 or 8 boxes per step without a scalar tail.
+    class T3D_MATH_API AabbArray
+    {
+    public:
+        enum
+        {
+            E_PADDING = 8,
+        };
+
+        AabbArray();
+
+        /// Resize to count boxes. New boxes are empty (zero center and extent).
+        void resize(size_t count);
+        size_t getCount() const;
+
+        void setAabb(size_t idx, const Aabb &box);
+        void getAabb(size_t idx, Aabb &box) const;
+
+        void setCenterExtent(size_t idx, const Vector3 &center, const Vector3 &extent);
+
+        /// Stream of center (or extent) components along one axis, 0 = x, 1 = y, 2 = z.
+        const Real *getCenter(int32_t axis) const;
+        Real *getCenter(int32_t axis);
+        const Real *getExtent(int32_t axis) const;
+        Real *getExtent(int32_t axis);
+
+    protected:
+        typedef std::vector<Real>   Reals;
+
+        Reals   mCenter[3];
+        Reals   mExtent[3];
+        size_t  mCount;
+    };
+
+    /// Spheres stored as structure of arrays, padded like AabbArray.
+    class T3D_MATH_API SphereArray
+    {
+    public:
+        enum
+        {
+            E_PADDING = 8,
+        };
+
+        SphereArray();
+
+        /// Resize to count spheres. New spheres have zero center and radius.
+        void resize(size_t count);
+        size_t getCount() const;
+
+        void setSphere(size_t idx, const Sphere &sphere);
+        void getSphere(size_t idx, Sphere &sphere) const;
+
+        const Real *getCenter(int32_t axis) const;
+        Real *getCenter(int32_t axis);
+        const Real *getRadius() const;
+        Real *getRadius();
+
+    protected:
+        typedef std::vector<Real>   Reals;
+
+        Reals   mCenter[3];
+        Reals   mRadius;
+        size_t  mCount;
+    };
+
+    /// Batch kernels over AabbArray and SphereArray.
+    /// SSE2 or AVX2 is chosen at compile time (AVX2 needs TINY3D_ENABLE_AVX2),
+    /// with a scalar fallback for other targets and for double precision Real.
+    class T3D_MATH_API BoundBatch
+    {
+    public:
+        enum SimdLevel
+        {
+            E_SIMD_NONE = 0,
+            E_SIMD_SSE2,
+            E_SIMD_AVX2,
+        };
+
+        /// Instruction set the kernels were compiled with.
+        static SimdLevel getSimdLevel();
+
+        /// Number of 32 bit words needed for a visibility mask of count bounds.
+        static size_t getMaskWordCount(size_t count);
+
+        /// Test boxes against the faces flagged in planeMask (see Frustum::FaceMask).
+        /// Bit i of visibility (word i / 32, bit i % 32) is set unless box i is
+        /// completely outside a tested face, the same rule as Math::intersects().
+        /// visibility must hold getMaskWordCount(boxes.getCount()) words.
+        static void cullAabbs(const Frustum &frustum, const AabbArray &boxes,
+            uint32_t *visibility, uint32_t planeMask = Frustum::E_FACE_MASK_ALL);
+
+        /// Same as cullAabbs() for spheres.
+        static void cullSpheres(const Frustum &frustum, const SphereArray &spheres,
+            uint32_t *visibility, uint32_t planeMask = Frustum::E_FACE_MASK_ALL);
+
+        /// Refit local boxes to world space, box i with matrices[i], using the
+        /// absolute matrix: center' = M * center, extent' = |M| * extent.
+        /// worldBoxes is resized to localBoxes.getCount().
+        static void transformAabbs(const Matrix4 *matrices, const AabbArray &localBoxes,
+            AabbArray &worldBoxes);
+    };
+}
+
+
+#include "T3DBoundBatch.inl"
+
+
+#endif  /*__T3D_BOUND_BATCH_H__*/
@@ -0,0 +1,74 @@
+namespace Tiny3D
+{
+    inline size_t AabbArray::getCount() const
+    {
+        return mCount;
+    }
+
+    inline const Real *AabbArray::getCenter(int32_t axis) const
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mCenter[axis].data();
+    }
+
+    inline Real *AabbArray::getCenter(int32_t axis)
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mCenter[axis].data();
+    }
+
+    inline const Real *AabbArray::getExtent(int32_t axis) const
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mExtent[axis].data();
+    }
+
+    inline Real *AabbArray::getExtent(int32_t axis)
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mExtent[axis].data();
+    }
+
+    inline void AabbArray::setCenterExtent(size_t idx, const Vector3 &center, const Vector3 &extent)
+    {
+        T3D_ASSERT(idx < mCount);
+        mCenter[0][idx] = center.x();
+        mCenter[1][idx] = center.y();
+        mCenter[2][idx] = center.z();
+        mExtent[0][idx] = extent.x();
+        mExtent[1][idx] = extent.y();
+        mExtent[2][idx] = extent.z();
+    }
+
+    inline size_t SphereArray::getCount() const
+    {
+        return mCount;
+    }
+
+    inline const Real *SphereArray::getCenter(int32_t axis) const
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mCenter[axis].data();
+    }
+
+    inline Real *SphereArray::getCenter(int32_t axis)
+    {
+        T3D_ASSERT(axis >= 0 && axis < 3);
+        return mCenter[axis].data();
+    }
+
+    inline const Real *SphereArray::getRadius() const
+    {
+        return mRadius.data();
+    }
+
+    inline Real *SphereArray::getRadius()
+    {
+        return mRadius.data();
+    }
+
+    inline size_t BoundBatch::getMaskWordCount(size_t count)
+    {
+        return (count + 31) / 32;
+    }
+}
@@ -41,6 +41,13 @@ namespace Tiny3D
             E_MAX_FACE
         };
 
+        /// One bit per face, bit i stands for Face(i).
+        enum FaceMask
+        {
+            E_FACE_MASK_NONE = 0,
+            E_FACE_MASK_ALL = (1 << E_MAX_FACE) - 1
+        };
+
         Frustum();
         virtual ~Frustum();
 
@@ -205,10 +205,18 @@ namespace Tiny3D
         static bool intersects(const Aabb &aabb1, const Aabb &aabb2);
         static bool intersects(const Aabb &aabb, const Obb &obb);
         static bool intersects(const Aabb &aabb, const Frustum &frustum);
+        /// Test aabb only against the faces flagged in planeMask (see Frustum::FaceMask).
+        /// Faces the box lies completely inside are cleared from planeMask, so boxes
+        /// enclosed by this one can skip them. Returns false if the box is completely
+        /// outside any tested face.
+        static bool intersects(const Aabb &aabb, const Frustum &frustum, uint32_t &planeMask);
         static bool intersects(const Aabb &box, const Plane &plane);
         static bool intersects(const Obb &box1, const Obb &box2);
         static bool intersects(const Obb &obb, const Frustum &frustum);
         static bool intersects(const Obb &box, const Plane &plane);
+        /// Conservative: tests the corners of each frustum against the faces of the
+        /// other, so frustums separated only along an edge cross axis report true.
+        static bool intersects(const Frustum &frustum1, const Frustum &frustum2);
 
     public:
         static const Real POS_INFINITY;
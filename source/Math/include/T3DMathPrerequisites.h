@@ -44,6 +44,7 @@ namespace Tiny3D
     class Matrix2;
     class Matrix3;
     class Matrix4;
+    class Affine2;
     class Quaternion;
     class Vector2;
     class Vector3;
@@ -55,6 +56,10 @@ namespace Tiny3D
     class Sphere;
     class Plane;
     class Transform;
+
+    class AabbArray;
+    class SphereArray;
+    class BoundBatch;
 }
 
 
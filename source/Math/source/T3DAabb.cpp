@@ -17,4 +17,32 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  ******************************************************************************/
 
-#include "T3DAabb.h"
\ No newline at end of file
+#include "T3DAabb.h"
+#include "T3DMatrix4.h"
+
+
+namespace Tiny3D
+{
+    void Aabb::transform(const Matrix4 &rkMatrix, Aabb &rResult) const
+    {
+        Real cx = (mMinX + mMaxX) * Real(0.5);
+        Real cy = (mMinY + mMaxY) * Real(0.5);
+        Real cz = (mMinZ + mMaxZ) * Real(0.5);
+        Real ex = (mMaxX - mMinX) * Real(0.5);
+        Real ey = (mMaxY - mMinY) * Real(0.5);
+        Real ez = (mMaxZ - mMinZ) * Real(0.5);
+
+        Vector3 center, extent;
+        int32_t i = 0;
+
+        for (i = 0; i < 3; ++i)
+        {
+            const Real *row = rkMatrix[i];
+            center[i] = row[0] * cx + row[1] * cy + row[2] * cz + row[3];
+            extent[i] = Math::Abs(row[0]) * ex + Math::Abs(row[1]) * ey
+                + Math::Abs(row[2]) * ez;
+        }
+
+        rResult.setParam(center - extent, center + extent);
+    }
+}
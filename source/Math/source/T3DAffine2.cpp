@@ -0,0 +1,46 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DAffine2.h"
+
+
+namespace Tiny3D
+{
+    const Affine2 Affine2::IDENTITY(1.0, 0.0, 0.0, 0.0, 1.0, 0.0);
+
+    Affine2 Affine2::inverse() const
+    {
+        Real det = determinant();
+
+        if (det == 0.0)
+        {
+            return Affine2(0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+        }
+
+        Real invDet = Real(1.0) / det;
+        Real m00 = m_afEntry[4] * invDet;
+        Real m01 = -m_afEntry[1] * invDet;
+        Real m10 = -m_afEntry[3] * invDet;
+        Real m11 = m_afEntry[0] * invDet;
+
+        return Affine2(
+            m00, m01, -(m00 * m_afEntry[2] + m01 * m_afEntry[5]),
+            m10, m11, -(m10 * m_afEntry[2] + m11 * m_afEntry[5]));
+    }
+}
@@ -0,0 +1,485 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DBoundBatch.h"
+#include "T3DAabb.h"
+#include "T3DSphere.h"
+#include "T3DMatrix4.h"
+#include "T3DMath.h"
+
+
+// The SIMD paths work on 32 bit floats only, double precision builds use the scalar path.
+#if !defined (__T3D_HIGH_PERCISION_FLOAT__)
+    #if defined (__AVX2__)
+        #define T3D_BOUND_BATCH_AVX2
+        #include <immintrin.h>
+    #endif
+
+    #if defined (__SSE2__) || defined (_M_X64) || (defined (_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define T3D_BOUND_BATCH_SSE2
+        #include <emmintrin.h>
+    #endif
+#endif
+
+
+namespace Tiny3D
+{
+    static inline size_t padBatchCount(size_t count, size_t padding)
+    {
+        return (count + padding - 1) / padding * padding;
+    }
+
+    AabbArray::AabbArray()
+        : mCount(0)
+    {
+
+    }
+
+    void AabbArray::resize(size_t count)
+    {
+        size_t padded = padBatchCount(count, E_PADDING);
+
+        int32_t i = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            mCenter[i].resize(padded, Real(0.0));
+            mExtent[i].resize(padded, Real(0.0));
+        }
+
+        mCount = count;
+    }
+
+    void AabbArray::setAabb(size_t idx, const Aabb &box)
+    {
+        T3D_ASSERT(idx < mCount);
+        mCenter[0][idx] = (box.getMinX() + box.getMaxX()) * Real(0.5);
+        mCenter[1][idx] = (box.getMinY() + box.getMaxY()) * Real(0.5);
+        mCenter[2][idx] = (box.getMinZ() + box.getMaxZ()) * Real(0.5);
+        mExtent[0][idx] = (box.getMaxX() - box.getMinX()) * Real(0.5);
+        mExtent[1][idx] = (box.getMaxY() - box.getMinY()) * Real(0.5);
+        mExtent[2][idx] = (box.getMaxZ() - box.getMinZ()) * Real(0.5);
+    }
+
+    void AabbArray::getAabb(size_t idx, Aabb &box) const
+    {
+        T3D_ASSERT(idx < mCount);
+        Vector3 center(mCenter[0][idx], mCenter[1][idx], mCenter[2][idx]);
+        Vector3 extent(mExtent[0][idx], mExtent[1][idx], mExtent[2][idx]);
+        box.setParam(center - extent, center + extent);
+    }
+
+    SphereArray::SphereArray()
+        : mCount(0)
+    {
+
+    }
+
+    void SphereArray::resize(size_t count)
+    {
+        size_t padded = padBatchCount(count, E_PADDING);
+
+        int32_t i = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            mCenter[i].resize(padded, Real(0.0));
+        }
+
+        mRadius.resize(padded, Real(0.0));
+        mCount = count;
+    }
+
+    void SphereArray::setSphere(size_t idx, const Sphere &sphere)
+    {
+        T3D_ASSERT(idx < mCount);
+        const Vector3 &center = sphere.getCenter();
+        mCenter[0][idx] = center.x();
+        mCenter[1][idx] = center.y();
+        mCenter[2][idx] = center.z();
+        mRadius[idx] = sphere.getRadius();
+    }
+
+    void SphereArray::getSphere(size_t idx, Sphere &sphere) const
+    {
+        T3D_ASSERT(idx < mCount);
+        sphere.setCenter(Vector3(mCenter[0][idx], mCenter[1][idx], mCenter[2][idx]));
+        sphere.setRadius(mRadius[idx]);
+    }
+
+    /// One frustum face with the absolute normal used for the projected extent.
+    struct BatchPlane
+    {
+        Real    nx, ny, nz, d;
+        Real    ax, ay, az;
+    };
+
+    static size_t prepareBatchPlanes(const Frustum &frustum, uint32_t planeMask,
+        BatchPlane *planes)
+    {
+        size_t count = 0;
+
+        int32_t i = 0;
+        for (i = 0; i < Frustum::E_MAX_FACE; ++i)
+        {
+            if ((planeMask & (1 << i)) == 0)
+                continue;
+
+            const Plane &plane = frustum.getFace(Frustum::Face(i));
+            BatchPlane &p = planes[count++];
+            p.nx = plane[0];
+            p.ny = plane[1];
+            p.nz = plane[2];
+            p.d = plane[3];
+            p.ax = Math::Abs(plane[0]);
+            p.ay = Math::Abs(plane[1]);
+            p.az = Math::Abs(plane[2]);
+        }
+
+        return count;
+    }
+
+    static inline void clearMaskPadding(uint32_t *visibility, size_t count)
+    {
+        // The SIMD paths also write bits for the padding elements.
+        if ((count & 31) != 0)
+        {
+            visibility[count >> 5] &= (uint32_t(1) << (count & 31)) - 1;
+        }
+    }
+
+    BoundBatch::SimdLevel BoundBatch::getSimdLevel()
+    {
+#if defined (T3D_BOUND_BATCH_AVX2)
+        return E_SIMD_AVX2;
+#elif defined (T3D_BOUND_BATCH_SSE2)
+        return E_SIMD_SSE2;
+#else
+        return E_SIMD_NONE;
+#endif
+    }
+
+    void BoundBatch::cullAabbs(const Frustum &frustum, const AabbArray &boxes,
+        uint32_t *visibility, uint32_t planeMask /* = Frustum::E_FACE_MASK_ALL */)
+    {
+        size_t count = boxes.getCount();
+        memset(visibility, 0, getMaskWordCount(count) * sizeof(uint32_t));
+
+        BatchPlane planes[Frustum::E_MAX_FACE];
+        size_t planeCount = prepareBatchPlanes(frustum, planeMask, planes);
+
+        const Real *cx = boxes.getCenter(0);
+        const Real *cy = boxes.getCenter(1);
+        const Real *cz = boxes.getCenter(2);
+        const Real *ex = boxes.getExtent(0);
+        const Real *ey = boxes.getExtent(1);
+        const Real *ez = boxes.getExtent(2);
+
+        size_t i = 0, j = 0;
+
+#if defined (T3D_BOUND_BATCH_AVX2)
+        size_t padded = padBatchCount(count, AabbArray::E_PADDING);
+        __m256 wn[Frustum::E_MAX_FACE][7];
+
+        for (j = 0; j < planeCount; ++j)
+        {
+            const BatchPlane &p = planes[j];
+            wn[j][0] = _mm256_set1_ps(p.nx);
+            wn[j][1] = _mm256_set1_ps(p.ny);
+            wn[j][2] = _mm256_set1_ps(p.nz);
+            wn[j][3] = _mm256_set1_ps(p.d);
+            wn[j][4] = _mm256_set1_ps(p.ax);
+            wn[j][5] = _mm256_set1_ps(p.ay);
+            wn[j][6] = _mm256_set1_ps(p.az);
+        }
+
+        const __m256 zero = _mm256_setzero_ps();
+
+        for (i = 0; i < padded; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(cx + i);
+            __m256 y = _mm256_loadu_ps(cy + i);
+            __m256 z = _mm256_loadu_ps(cz + i);
+            __m256 sx = _mm256_loadu_ps(ex + i);
+            __m256 sy = _mm256_loadu_ps(ey + i);
+            __m256 sz = _mm256_loadu_ps(ez + i);
+            __m256 outside = zero;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                // Signed distance of the center plus the extent projected on the normal
+                __m256 dist = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(wn[j][0], x), _mm256_mul_ps(wn[j][1], y)),
+                    _mm256_add_ps(_mm256_mul_ps(wn[j][2], z), wn[j][3]));
+                __m256 radius = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(wn[j][4], sx), _mm256_mul_ps(wn[j][5], sy)),
+                    _mm256_mul_ps(wn[j][6], sz));
+                outside = _mm256_or_ps(outside,
+                    _mm256_cmp_ps(_mm256_add_ps(dist, radius), zero, _CMP_LE_OQ));
+            }
+
+            uint32_t bits = uint32_t(~_mm256_movemask_ps(outside)) & 0xFF;
+            visibility[i >> 5] |= bits << (i & 31);
+        }
+
+        clearMaskPadding(visibility, count);
+#elif defined (T3D_BOUND_BATCH_SSE2)
+        size_t padded = padBatchCount(count, AabbArray::E_PADDING);
+        __m128 wn[Frustum::E_MAX_FACE][7];
+
+        for (j = 0; j < planeCount; ++j)
+        {
+            const BatchPlane &p = planes[j];
+            wn[j][0] = _mm_set1_ps(p.nx);
+            wn[j][1] = _mm_set1_ps(p.ny);
+            wn[j][2] = _mm_set1_ps(p.nz);
+            wn[j][3] = _mm_set1_ps(p.d);
+            wn[j][4] = _mm_set1_ps(p.ax);
+            wn[j][5] = _mm_set1_ps(p.ay);
+            wn[j][6] = _mm_set1_ps(p.az);
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+
+        for (i = 0; i < padded; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(cx + i);
+            __m128 y = _mm_loadu_ps(cy + i);
+            __m128 z = _mm_loadu_ps(cz + i);
+            __m128 sx = _mm_loadu_ps(ex + i);
+            __m128 sy = _mm_loadu_ps(ey + i);
+            __m128 sz = _mm_loadu_ps(ez + i);
+            __m128 outside = zero;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                // Signed distance of the center plus the extent projected on the normal
+                __m128 dist = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(wn[j][0], x), _mm_mul_ps(wn[j][1], y)),
+                    _mm_add_ps(_mm_mul_ps(wn[j][2], z), wn[j][3]));
+                __m128 radius = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(wn[j][4], sx), _mm_mul_ps(wn[j][5], sy)),
+                    _mm_mul_ps(wn[j][6], sz));
+                outside = _mm_or_ps(outside, _mm_cmple_ps(_mm_add_ps(dist, radius), zero));
+            }
+
+            uint32_t bits = uint32_t(~_mm_movemask_ps(outside)) & 0xF;
+            visibility[i >> 5] |= bits << (i & 31);
+        }
+
+        clearMaskPadding(visibility, count);
+#else
+        for (i = 0; i < count; ++i)
+        {
+            bool outside = false;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                const BatchPlane &p = planes[j];
+                Real dist = p.nx * cx[i] + p.ny * cy[i] + p.nz * cz[i] + p.d;
+                Real radius = p.ax * ex[i] + p.ay * ey[i] + p.az * ez[i];
+                outside |= (dist + radius <= Real(0.0));
+            }
+
+            if (!outside)
+            {
+                visibility[i >> 5] |= uint32_t(1) << (i & 31);
+            }
+        }
+#endif
+    }
+
+    void BoundBatch::cullSpheres(const Frustum &frustum, const SphereArray &spheres,
+        uint32_t *visibility, uint32_t planeMask /* = Frustum::E_FACE_MASK_ALL */)
+    {
+        size_t count = spheres.getCount();
+        memset(visibility, 0, getMaskWordCount(count) * sizeof(uint32_t));
+
+        BatchPlane planes[Frustum::E_MAX_FACE];
+        size_t planeCount = prepareBatchPlanes(frustum, planeMask, planes);
+
+        const Real *cx = spheres.getCenter(0);
+        const Real *cy = spheres.getCenter(1);
+        const Real *cz = spheres.getCenter(2);
+        const Real *cr = spheres.getRadius();
+
+        size_t i = 0, j = 0;
+
+#if defined (T3D_BOUND_BATCH_AVX2)
+        size_t padded = padBatchCount(count, SphereArray::E_PADDING);
+        __m256 wn[Frustum::E_MAX_FACE][4];
+
+        for (j = 0; j < planeCount; ++j)
+        {
+            wn[j][0] = _mm256_set1_ps(planes[j].nx);
+            wn[j][1] = _mm256_set1_ps(planes[j].ny);
+            wn[j][2] = _mm256_set1_ps(planes[j].nz);
+            wn[j][3] = _mm256_set1_ps(planes[j].d);
+        }
+
+        const __m256 zero = _mm256_setzero_ps();
+
+        for (i = 0; i < padded; i += 8)
+        {
+            __m256 x = _mm256_loadu_ps(cx + i);
+            __m256 y = _mm256_loadu_ps(cy + i);
+            __m256 z = _mm256_loadu_ps(cz + i);
+            __m256 r = _mm256_loadu_ps(cr + i);
+            __m256 outside = zero;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                __m256 dist = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(wn[j][0], x), _mm256_mul_ps(wn[j][1], y)),
+                    _mm256_add_ps(_mm256_mul_ps(wn[j][2], z), wn[j][3]));
+                outside = _mm256_or_ps(outside,
+                    _mm256_cmp_ps(_mm256_add_ps(dist, r), zero, _CMP_LE_OQ));
+            }
+
+            uint32_t bits = uint32_t(~_mm256_movemask_ps(outside)) & 0xFF;
+            visibility[i >> 5] |= bits << (i & 31);
+        }
+
+        clearMaskPadding(visibility, count);
+#elif defined (T3D_BOUND_BATCH_SSE2)
+        size_t padded = padBatchCount(count, SphereArray::E_PADDING);
+        __m128 wn[Frustum::E_MAX_FACE][4];
+
+        for (j = 0; j < planeCount; ++j)
+        {
+            wn[j][0] = _mm_set1_ps(planes[j].nx);
+            wn[j][1] = _mm_set1_ps(planes[j].ny);
+            wn[j][2] = _mm_set1_ps(planes[j].nz);
+            wn[j][3] = _mm_set1_ps(planes[j].d);
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+
+        for (i = 0; i < padded; i += 4)
+        {
+            __m128 x = _mm_loadu_ps(cx + i);
+            __m128 y = _mm_loadu_ps(cy + i);
+            __m128 z = _mm_loadu_ps(cz + i);
+            __m128 r = _mm_loadu_ps(cr + i);
+            __m128 outside = zero;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                __m128 dist = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(wn[j][0], x), _mm_mul_ps(wn[j][1], y)),
+                    _mm_add_ps(_mm_mul_ps(wn[j][2], z), wn[j][3]));
+                outside = _mm_or_ps(outside, _mm_cmple_ps(_mm_add_ps(dist, r), zero));
+            }
+
+            uint32_t bits = uint32_t(~_mm_movemask_ps(outside)) & 0xF;
+            visibility[i >> 5] |= bits << (i & 31);
+        }
+
+        clearMaskPadding(visibility, count);
+#else
+        for (i = 0; i < count; ++i)
+        {
+            bool outside = false;
+
+            for (j = 0; j < planeCount; ++j)
+            {
+                const BatchPlane &p = planes[j];
+                Real dist = p.nx * cx[i] + p.ny * cy[i] + p.nz * cz[i] + p.d;
+                outside |= (dist + cr[i] <= Real(0.0));
+            }
+
+            if (!outside)
+            {
+                visibility[i >> 5] |= uint32_t(1) << (i & 31);
+            }
+        }
+#endif
+    }
+
+    void BoundBatch::transformAabbs(const Matrix4 *matrices, const AabbArray &localBoxes,
+        AabbArray &worldBoxes)
+    {
+        size_t count = localBoxes.getCount();
+        worldBoxes.resize(count);
+
+        const Real *cx = localBoxes.getCenter(0);
+        const Real *cy = localBoxes.getCenter(1);
+        const Real *cz = localBoxes.getCenter(2);
+        const Real *ex = localBoxes.getExtent(0);
+        const Real *ey = localBoxes.getExtent(1);
+        const Real *ez = localBoxes.getExtent(2);
+
+        Real *wcx = worldBoxes.getCenter(0);
+        Real *wcy = worldBoxes.getCenter(1);
+        Real *wcz = worldBoxes.getCenter(2);
+        Real *wex = worldBoxes.getExtent(0);
+        Real *wey = worldBoxes.getExtent(1);
+        Real *wez = worldBoxes.getExtent(2);
+
+        size_t i = 0;
+
+#if defined (T3D_BOUND_BATCH_SSE2)
+        // Matrices are stored one after another, so each box is done 4 wide
+        // across the rows: transpose the 3x4 affine part to get the columns,
+        // then center' = c0 * x + c1 * y + c2 * z + c3 and
+        // extent' = |c0| * ex + |c1| * ey + |c2| * ez.
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        float center[4], extent[4];
+
+        for (i = 0; i < count; ++i)
+        {
+            const Real *m = matrices[i];
+            __m128 c0 = _mm_loadu_ps(m);
+            __m128 c1 = _mm_loadu_ps(m + 4);
+            __m128 c2 = _mm_loadu_ps(m + 8);
+            __m128 c3 = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+            __m128 c = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(cx[i])), _mm_mul_ps(c1, _mm_set1_ps(cy[i]))),
+                _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(cz[i])), c3));
+            __m128 e = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, c0), _mm_set1_ps(ex[i])),
+                    _mm_mul_ps(_mm_andnot_ps(signMask, c1), _mm_set1_ps(ey[i]))),
+                _mm_mul_ps(_mm_andnot_ps(signMask, c2), _mm_set1_ps(ez[i])));
+
+            _mm_storeu_ps(center, c);
+            _mm_storeu_ps(extent, e);
+
+            wcx[i] = center[0];
+            wcy[i] = center[1];
+            wcz[i] = center[2];
+            wex[i] = extent[0];
+            wey[i] = extent[1];
+            wez[i] = extent[2];
+        }
+#else
+        for (i = 0; i < count; ++i)
+        {
+            const Matrix4 &m = matrices[i];
+
+            wcx[i] = m[0][0] * cx[i] + m[0][1] * cy[i] + m[0][2] * cz[i] + m[0][3];
+            wcy[i] = m[1][0] * cx[i] + m[1][1] * cy[i] + m[1][2] * cz[i] + m[1][3];
+            wcz[i] = m[2][0] * cx[i] + m[2][1] * cy[i] + m[2][2] * cz[i] + m[2][3];
+
+            wex[i] = Math::Abs(m[0][0]) * ex[i] + Math::Abs(m[0][1]) * ey[i] + Math::Abs(m[0][2]) * ez[i];
+            wey[i] = Math::Abs(m[1][0]) * ex[i] + Math::Abs(m[1][1]) * ey[i] + Math::Abs(m[1][2]) * ez[i];
+            wez[i] = Math::Abs(m[2][0]) * ex[i] + Math::Abs(m[2][1]) * ey[i] + Math::Abs(m[2][2]) * ez[i];
+        }
+#endif
+    }
+}
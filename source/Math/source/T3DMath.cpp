@@ -90,7 +90,20 @@ namespace Tiny3D
 
     bool Math::intersects(const Sphere &sphere, const Obb &box)
     {
-        return false;
+        // Closest point on the box to the sphere center, in the box frame
+        Vector3 diff = sphere.getCenter() - box.getCenter();
+        Real distance = Real(0.0);
+
+        int32_t i = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            Real d = diff.dot(box.getAxis(i));
+            Real e = box.getExtent(i);
+            Real outside = std::max(Math::Abs(d) - e, Real(0.0));
+            distance += outside * outside;
+        }
+
+        return (distance <= sphere.getRadius() * sphere.getRadius());
     }
 
     bool Math::intersects(const Sphere &sphere, const Frustum &frustum)
@@ -114,53 +127,55 @@ namespace Tiny3D
 
     bool Math::intersects(const Sphere &sphere, const Plane &plane)
     {
-        return (Math::Abs(plane.getNormal().dot(plane.getNormal()) - plane.getDistance()) < sphere.getRadius());
+        // The plane need not be normalized, scale the radius by the normal length instead
+        Real distance = plane.distanceToPoint(sphere.getCenter());
+        return (Math::Abs(distance) <= sphere.getRadius() * plane.getNormal().length());
     }
 
     bool Math::intersects(const Aabb &aabb1, const Aabb &aabb2)
     {
-        return false;
+        // Evaluate all six comparisons, no early out
+        return (aabb1.getMaxX() >= aabb2.getMinX()) & (aabb1.getMinX() <= aabb2.getMaxX())
+            & (aabb1.getMaxY() >= aabb2.getMinY()) & (aabb1.getMinY() <= aabb2.getMaxY())
+            & (aabb1.getMaxZ() >= aabb2.getMinZ()) & (aabb1.getMinZ() <= aabb2.getMaxZ());
     }
 
     bool Math::intersects(const Aabb &aabb, const Frustum &frustum)
     {
-        const Real &minX = aabb.getMinX();
-        const Real &maxX = aabb.getMaxX();
-        const Real &minY = aabb.getMinY();
-        const Real &maxY = aabb.getMaxY();
-        const Real &minZ = aabb.getMinZ();
-        const Real &maxZ = aabb.getMaxZ();
+        // Center/extent form: one plane evaluation per face instead of 8 corners
+        uint32_t planeMask = Frustum::E_FACE_MASK_ALL;
+        return intersects(aabb, frustum, planeMask);
+    }
+
+    bool Math::intersects(const Aabb &aabb, const Frustum &frustum, uint32_t &planeMask)
+    {
+        Real cx = (aabb.getMinX() + aabb.getMaxX()) * Real(0.5);
+        Real cy = (aabb.getMinY() + aabb.getMaxY()) * Real(0.5);
+        Real cz = (aabb.getMinZ() + aabb.getMaxZ()) * Real(0.5);
+        Real ex = (aabb.getMaxX() - aabb.getMinX()) * Real(0.5);
+        Real ey = (aabb.getMaxY() - aabb.getMinY()) * Real(0.5);
+        Real ez = (aabb.getMaxZ() - aabb.getMinZ()) * Real(0.5);
 
         int32_t i = 0;
         for (i = 0; i < Frustum::E_MAX_FACE; ++i)
         {
-            const Plane &plane = frustum.getFace(Frustum::Face(i));
-            
-            if (plane[0] * minX + plane[1] * minY + plane[2] * minZ + plane[3] > 0)
-                continue;
-
-            if (plane[0] * maxX + plane[1] * minY + plane[2] * minZ + plane[3] > 0)
-                continue;
-
-            if (plane[0] * minX + plane[1] * maxY + plane[2] * minZ + plane[3] > 0)
-                continue;
+            uint32_t bit = (1 << i);
 
-            if (plane[0] * maxX + plane[1] * maxY + plane[2] * minZ + plane[3] > 0)
+            if ((planeMask & bit) == 0)
                 continue;
 
-            if (plane[0] * minX + plane[1] * minY + plane[2] * maxZ + plane[3] > 0)
-                continue;
+            const Plane &plane = frustum.getFace(Frustum::Face(i));
 
-            if (plane[0] * maxX + plane[1] * minY + plane[2] * maxZ + plane[3] > 0)
-                continue;
+            // distance of the center and projected radius of the box on the plane normal
+            Real distance = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3];
+            Real radius = Math::Abs(plane[0]) * ex + Math::Abs(plane[1]) * ey
+                + Math::Abs(plane[2]) * ez;
 
-            if (plane[0] * minX + plane[1] * maxY + plane[2] * maxZ + plane[3] > 0)
-                continue;
-
-            if (plane[0] * maxX + plane[1] * maxY + plane[2] * maxZ + plane[3] > 0)
-                continue;
+            if (distance + radius <= Real(0.0))
+                return false;
 
-            return false;
+            if (distance - radius > Real(0.0))
+                planeMask &= ~bit;
         }
 
         return true;
@@ -168,26 +183,235 @@ namespace Tiny3D
 
     bool Math::intersects(const Aabb &box, const Plane &plane)
     {
-        return false;
+        Real cx = (box.getMinX() + box.getMaxX()) * Real(0.5);
+        Real cy = (box.getMinY() + box.getMaxY()) * Real(0.5);
+        Real cz = (box.getMinZ() + box.getMaxZ()) * Real(0.5);
+        Real ex = (box.getMaxX() - box.getMinX()) * Real(0.5);
+        Real ey = (box.getMaxY() - box.getMinY()) * Real(0.5);
+        Real ez = (box.getMaxZ() - box.getMinZ()) * Real(0.5);
+
+        // The box touches the plane if the center is no further than the projected radius
+        Real distance = plane[0] * cx + plane[1] * cy + plane[2] * cz + plane[3];
+        Real radius = Math::Abs(plane[0]) * ex + Math::Abs(plane[1]) * ey
+            + Math::Abs(plane[2]) * ez;
+
+        return (Math::Abs(distance) <= radius);
+    }
+
+    // Separating axis test between box A and box B, given in the frame of A.
+    // a and b are the extents, R[i][j] = dot(axis i of A, axis j of B) and t is the
+    // offset from the center of A to the center of B along the axes of A.
+    // Tests the 3 + 3 face normals and the 9 edge cross products, true if none separates.
+    static inline bool testObbOverlap(const Real *a, const Real *b,
+        const Real R[3][3], const Real *t)
+    {
+        // The epsilon keeps near parallel edges from producing a null cross axis
+        const Real epsilon = Real(1e-6);
+        Real AbsR[3][3];
+
+        int32_t i = 0, j = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            for (j = 0; j < 3; ++j)
+            {
+                AbsR[i][j] = Math::Abs(R[i][j]) + epsilon;
+            }
+        }
+
+        Real ra, rb;
+
+        // Axes of A
+        for (i = 0; i < 3; ++i)
+        {
+            ra = a[i];
+            rb = b[0] * AbsR[i][0] + b[1] * AbsR[i][1] + b[2] * AbsR[i][2];
+            if (Math::Abs(t[i]) > ra + rb)
+                return false;
+        }
+
+        // Axes of B
+        for (j = 0; j < 3; ++j)
+        {
+            ra = a[0] * AbsR[0][j] + a[1] * AbsR[1][j] + a[2] * AbsR[2][j];
+            rb = b[j];
+            if (Math::Abs(t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j]) > ra + rb)
+                return false;
+        }
+
+        // Cross products of axis i of A and axis j of B
+        for (i = 0; i < 3; ++i)
+        {
+            int32_t i1 = (i + 1) % 3;
+            int32_t i2 = (i + 2) % 3;
+
+            for (j = 0; j < 3; ++j)
+            {
+                int32_t j1 = (j + 1) % 3;
+                int32_t j2 = (j + 2) % 3;
+
+                ra = a[i1] * AbsR[i2][j] + a[i2] * AbsR[i1][j];
+                rb = b[j1] * AbsR[i][j2] + b[j2] * AbsR[i][j1];
+                if (Math::Abs(t[i2] * R[i1][j] - t[i1] * R[i2][j]) > ra + rb)
+                    return false;
+            }
+        }
+
+        return true;
     }
 
     bool Math::intersects(const Aabb &aabb, const Obb &obb)
     {
-        return false;
+        // The frame of the aabb is the world frame, R is just the obb axes
+        Real a[3] =
+        {
+            (aabb.getMaxX() - aabb.getMinX()) * Real(0.5),
+            (aabb.getMaxY() - aabb.getMinY()) * Real(0.5),
+            (aabb.getMaxZ() - aabb.getMinZ()) * Real(0.5)
+        };
+
+        const Vector3 &center = obb.getCenter();
+        Real t[3] =
+        {
+            center.x() - (aabb.getMinX() + aabb.getMaxX()) * Real(0.5),
+            center.y() - (aabb.getMinY() + aabb.getMaxY()) * Real(0.5),
+            center.z() - (aabb.getMinZ() + aabb.getMaxZ()) * Real(0.5)
+        };
+
+        Real R[3][3];
+
+        int32_t i = 0, j = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            for (j = 0; j < 3; ++j)
+            {
+                R[i][j] = obb.getAxis(j)[i];
+            }
+        }
+
+        return testObbOverlap(a, obb.getExtent(), R, t);
     }
 
     bool Math::intersects(const Obb &box1, const Obb &box2)
     {
-        return false;
+        // The axes of both boxes must be orthonormal
+        Real R[3][3];
+
+        int32_t i = 0, j = 0;
+        for (i = 0; i < 3; ++i)
+        {
+            for (j = 0; j < 3; ++j)
+            {
+                R[i][j] = box1.getAxis(i).dot(box2.getAxis(j));
+            }
+        }
+
+        Vector3 diff = box2.getCenter() - box1.getCenter();
+        Real t[3] =
+        {
+            diff.dot(box1.getAxis(0)), diff.dot(box1.getAxis(1)), diff.dot(box1.getAxis(2))
+        };
+
+        return testObbOverlap(box1.getExtent(), box2.getExtent(), R, t);
     }
 
     bool Math::intersects(const Obb &box, const Frustum &frustum)
     {
-        return false;
+        const Vector3 &center = box.getCenter();
+
+        int32_t i = 0;
+        for (i = 0; i < Frustum::E_MAX_FACE; ++i)
+        {
+            const Plane &plane = frustum.getFace(Frustum::Face(i));
+            Vector3 normal = plane.getNormal();
+
+            // Same rule as the Aabb version, the extents are projected through the box axes
+            Real distance = normal.dot(center) + plane[3];
+            Real radius = box.getExtent(0) * Math::Abs(normal.dot(box.getAxis(0)))
+                + box.getExtent(1) * Math::Abs(normal.dot(box.getAxis(1)))
+                + box.getExtent(2) * Math::Abs(normal.dot(box.getAxis(2)));
+
+            if (distance + radius <= Real(0.0))
+                return false;
+        }
+
+        return true;
     }
 
     bool Math::intersects(const Obb &box, const Plane &plane)
     {
+        Vector3 normal = plane.getNormal();
+        Real distance = normal.dot(box.getCenter()) + plane[3];
+        Real radius = box.getExtent(0) * Math::Abs(normal.dot(box.getAxis(0)))
+            + box.getExtent(1) * Math::Abs(normal.dot(box.getAxis(1)))
+            + box.getExtent(2) * Math::Abs(normal.dot(box.getAxis(2)));
+
+        return (Math::Abs(distance) <= radius);
+    }
+
+    // Near corners first, then far corners, each in left-bottom, right-bottom,
+    // right-top, left-top order. Fails if three of the planes do not meet in a point.
+    static inline bool computeFrustumCorners(const Frustum &frustum, Vector3 *corners)
+    {
+        static const Frustum::Face sides[4][2] =
+        {
+            { Frustum::E_FACE_LEFT, Frustum::E_FACE_BOTTOM },
+            { Frustum::E_FACE_RIGHT, Frustum::E_FACE_BOTTOM },
+            { Frustum::E_FACE_RIGHT, Frustum::E_FACE_TOP },
+            { Frustum::E_FACE_LEFT, Frustum::E_FACE_TOP },
+        };
+
+        int32_t i = 0;
+        for (i = 0; i < 8; ++i)
+        {
+            const Plane &p1 = frustum.getFace(i < 4 ? Frustum::E_FACE_NEAR : Frustum::E_FACE_FAR);
+            const Plane &p2 = frustum.getFace(sides[i % 4][0]);
+            const Plane &p3 = frustum.getFace(sides[i % 4][1]);
+
+            // Point on all three planes n.p + d = 0
+            Vector3 n1 = p1.getNormal(), n2 = p2.getNormal(), n3 = p3.getNormal();
+            Vector3 n23 = n2.cross(n3);
+            Real det = n1.dot(n23);
+
+            if (Math::Abs(det) <= Real(1e-12))
+                return false;
+
+            corners[i] = (n23 * p1[3] + n3.cross(n1) * p2[3] + n1.cross(n2) * p3[3]) * (Real(-1.0) / det);
+        }
+
+        return true;
+    }
+
+    // True if all corners lie outside one face of the frustum
+    static inline bool isOutsideAnyFace(const Frustum &frustum, const Vector3 *corners)
+    {
+        int32_t i = 0, j = 0;
+        for (i = 0; i < Frustum::E_MAX_FACE; ++i)
+        {
+            const Plane &plane = frustum.getFace(Frustum::Face(i));
+            bool outside = true;
+
+            for (j = 0; j < 8 && outside; ++j)
+            {
+                outside = (plane.distanceToPoint(corners[j]) <= Real(0.0));
+            }
+
+            if (outside)
+                return true;
+        }
+
         return false;
     }
+
+    bool Math::intersects(const Frustum &frustum1, const Frustum &frustum2)
+    {
+        Vector3 corners1[8], corners2[8];
+
+        // A frustum without a finite far plane has no corners, treat it as touching everything
+        if (!computeFrustumCorners(frustum1, corners1) || !computeFrustumCorners(frustum2, corners2))
+            return true;
+
+        // Separated if all corners of one frustum are outside a face of the other.
+        // The edge cross axes are not tested, so a few separated pairs still report true.
+        return !isOutsideAnyFace(frustum1, corners2) && !isOutsideAnyFace(frustum2, corners1);
+    }
 }
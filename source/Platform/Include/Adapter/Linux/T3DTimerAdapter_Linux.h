@@ -0,0 +1,60 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#ifndef __T3D_TIMER_ADAPTER_LINUX_H__
+#define __T3D_TIMER_ADAPTER_LINUX_H__
+
+
+#include "Adapter/T3DTimerInterface.h"
+#include "Time/T3DRunLoopObserver.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief Linux平台的定时器
+     * @remarks 没有Windows那样的消息循环定时器，这里挂到主循环上，
+     *      由System::process在主线程上回调，定时器ID就是主循环分配的ID。
+     */
+    class Timer_Linux
+        : public TimerInterface
+        , public RunLoopObserver
+    {
+        T3D_DISABLE_COPY(Timer_Linux);
+
+    public:
+        Timer_Linux();
+        virtual ~Timer_Linux();
+
+    protected:
+        virtual uint32_t start(uint32_t unInterval);
+        virtual void stop();
+        virtual void setObserver(TimerObserver *pObserver);
+        virtual uint32_t getTimerID() const;
+
+        virtual void onExecute(uint32_t unLoopID, uint64_t dt);
+
+    private:
+        TimerObserver   *m_pObserver;
+        uint32_t        m_unTimerID;
+    };
+}
+
+
+#endif  /*__T3D_TIMER_ADAPTER_LINUX_H__*/
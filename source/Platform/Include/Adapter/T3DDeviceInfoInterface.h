@@ -33,62 +33,62 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief ȡƽ̨
+         * @brief 获取平台类型
          */
         virtual uint32_t getPlatform() const = 0;
 
         /**
-         * @brief ȡ汾ַ
+         * @brief 获取软件版本号字符串
          */
         virtual String getSoftwareVersion() const = 0;
 
         /**
-         * @brief ȡϵͳ汾ַ
+         * @brief 获取操作系统版本号字符串
          */
         virtual String getOSVersion() const = 0;
 
         /**
-         * @brief ȡ豸Ͱ汾Ϣַ
+         * @brief 获取设备机型版本信息字符串
          */
         virtual String getDeviceVersion() const = 0;
 
         /**
-         * @brief ȡĻ.
+         * @brief 获取屏幕宽度.
          */
         virtual int32_t getScreenWidth() const = 0;
 
         /**
-         * @brief ȡĻ߶.
+         * @brief 获取屏幕高度.
          */
         virtual int32_t getScreenHeight() const = 0;
 
         /**
-         * @brief ȡĻܶ.
+         * @brief 获取屏幕像素密度.
          */
         virtual float getScreenDPI() const = 0;
 
         /**
-         * @brief ȡ豸macַ.
+         * @brief 获取设备mac地址.
          */
         virtual String getMacAddress() const = 0;
 
         /**
-         * @brief ȡCPUϢ.
+         * @brief 获取CPU类型信息.
          */
         virtual String getCPUType() const = 0;
 
         /**
-         * @brief ȡCPU.
+         * @brief 获取CPU核数.
          */
         virtual int32_t getNumberOfProcessors() const = 0;
 
         /**
-         * @brief ȡڴϢ.
+         * @brief 获取内存信息.
          */
         virtual uint32_t getMemoryCapacity() const = 0;
 
         /**
-         * @brief ȡ豸ID.
+         * @brief 获取设备ID.
          */
         virtual String getDeviceID() const = 0;
     };
@@ -45,8 +45,8 @@ namespace Tiny3D
 
     /**
      * @class IAdapterFactory
-     * @brief ϵͳ㹤ӿ.
-     * @note ͬϵͳƽ̨Ҫʵּ̳иʵ־ƽ̨ӿ
+     * @brief 操作系统适配层工厂接口.
+     * @note 不同操作系统平台需要实现继承该类实现具体平台接口
      */
     class FactoryInterface
     {
@@ -54,40 +54,40 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief ϵͳصĿ̨.
-         * @return ؿ̨ҪûdeleteͷԴ
+         * @brief 创建操作系统相关的控制台对象.
+         * @return 返回控制台对象，需要用户调用delete释放资源
          */
         virtual ConsoleInterface *createConsoleAdapter() = 0;
 
         /**
-         * @brief ϵͳصĶʱ.
-         * @return ضʱҪûdeleteͷԴ
+         * @brief 创建操作系统相关的定时器对象.
+         * @return 返回定时器对象，需要用户调用delete释放资源
          */
         virtual TimerInterface *createTimerAdapter() = 0;
 
         /**
-         * @brief ϵͳص·.
-         * @return ·ҪûdeleteͷԴ
+         * @brief 创建操作系统相关的搜索路径对象.
+         * @return 返回搜索路径对象，需要用户调用delete释放资源
          */
         virtual DirInterface *createDirAdapter() = 0;
 
         /**
-         * @brief ϵͳص豸Ϣ.
-         * @return 豸ϢҪûdeleteͷԴ
+         * @brief 创建操作系统相关的设备信息对象.
+         * @return 返回设备信息操作对象，需要用户调用delete释放资源
          */
         virtual DeviceInfoInterface *createDeviceInfoAdapter() = 0;
 
         /**
-         * @brief ȡǰƽ̨.
-         * @return صǰƽ̨
+         * @brief 获取当前平台类型.
+         * @return 返回当前平台类型
          */
         virtual EPlatform getPlatform() = 0;
     };
 
     /**
-     * @brief ϵͳص㹤.
-     * @note ͬϵͳƽ̨ҪʵָýӿԷزϵͳ㹤
-     * @return 㹤ҪûdeleteͷԴ
+     * @brief 创建操作系统相关的适配层工厂对象.
+     * @note 不同操作系统平台需要实现该接口以返回操作系统适配层工厂对象
+     * @return 返回适配层工厂对象，需要用户调用delete释放资源
      */
     FactoryInterface *createAdapterFactory();
 }
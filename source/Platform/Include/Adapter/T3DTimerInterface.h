@@ -29,12 +29,12 @@ namespace Tiny3D
 {
     class TimerObserver;
 
-    const uint32_t T3D_INVALID_TIMER_ID = 0;        /**< ЧʱID */
+    const uint32_t T3D_INVALID_TIMER_ID = 0;        /**< 无效定时器ID */
 
     /**
      * @class ITimerAdapter
-     * @brief ϵͳƽ̨صĶʱӿ.
-     * @note زϵͳƽ̨Ҫ̳иýӿʵ־ƽ̨ع.
+     * @brief 操作系统平台相关的定时器接口类.
+     * @note 相关操作系统平台需要继承该接口类实现具体平台相关功能.
      */
     class TimerInterface
     {
@@ -42,30 +42,30 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief ʱʱѭʱ.
-         * @param [in] unInterval : ʱʱ
-         * @return ضʱӦID.
+         * @brief 启动定时器，定时器是循环定时.
+         * @param [in] unInterval : 定时器时间间隔毫秒数
+         * @return 返回定时器对应ID.
          */
         virtual uint32_t start(uint32_t unInterval) = 0;
 
         /**
-         * @brief رնʱ.
+         * @brief 关闭定时器.
          * @return void
          */
         virtual void stop() = 0;
 
         /**
-         * @brief öʱص۲߶.
-         * @param [in] pObserver : ۲߶
+         * @brief 设置定时器回调观察者对象.
+         * @param [in] pObserver : 观察者对象
          * @return void
          * @see class ITimerObserver
          */
         virtual void setObserver(TimerObserver *pObserver) = 0;
 
         /**
-         * @brief ȡʱӦĶʱID
-         * @note ǰʱڼʱ򷵻غϷĶӦĶʱID򷵻ЧʱID.
-         * @return ضʱID
+         * @brief 获取定时器对象对应的定时器ID
+         * @note 当前定时器正在计时，则返回合法的对应的定时器ID，否则返回无效定时器ID.
+         * @return 返回定时器ID
          */
         virtual uint32_t getTimerID() const = 0;
     };
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#ifndef __T3D_DIR_ADAPTER_UNIX_H__
+#define __T3D_DIR_ADAPTER_UNIX_H__
+
+
+#include "Adapter/T3DDirInterface.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <dirent.h>
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief POSIX平台的目录操作
+     * @remarks findFile的参数和Windows一样是"目录/通配符"的形式，
+     *      目录用opendir/readdir枚举，文件名用fnmatch匹配通配符。
+     */
+    class Dir_Unix : public DirInterface
+    {
+        T3D_DISABLE_COPY(Dir_Unix);
+
+    public:
+        Dir_Unix();
+        virtual ~Dir_Unix();
+
+    protected:
+        virtual bool findFile(const String &strPath);
+        virtual bool findNextFile();
+        virtual void close();
+
+        virtual String getRoot() const;
+        virtual String getFileName() const;
+        virtual String getFilePath() const;
+        virtual String getFileTitle() const;
+
+        virtual uint32_t getLength() const;
+
+        virtual bool isDots() const;
+        virtual bool isDirectory() const;
+
+        virtual long_t getCreationTime() const;
+        virtual long_t getLastAccessTime() const;
+        virtual long_t getLastWriteTime() const;
+
+        virtual bool makeDir(const String &strDir);
+        virtual bool removeDir(const String &strDir);
+
+        virtual bool remove(const String &strFileName);
+        virtual bool exists(const String &strPath) const;
+
+        virtual String getCachePath() const;
+        virtual String getAppPath() const;
+        virtual char getNativeSeparator() const;
+
+        /**
+         * @brief 读下一个和通配符匹配的目录项，没有了返回false
+         */
+        bool readNextEntry();
+
+        void extractRoot(const String &strFilePath, String &strRoot, String &strPattern) const;
+        void extractFileName(const String &strFilePath, String &strName, String &strTitle) const;
+
+    protected:
+        DIR                 *m_pDir;
+        struct stat         m_FileStat;
+        bool                m_bHasStat;
+
+        String              m_strRoot;
+        String              m_strPattern;
+        String              m_strName;
+        String              m_strTitle;
+    };
+}
+
+
+#endif  /*__T3D_DIR_ADAPTER_UNIX_H__*/
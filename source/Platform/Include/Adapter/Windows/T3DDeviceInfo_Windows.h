@@ -35,62 +35,62 @@ namespace Tiny3D
         virtual ~DeviceInfo_Windows();
 
         /**
-         * @brief ȡƽ̨
+         * @brief 获取平台类型
          */
         virtual uint32_t getPlatform() const;
 
         /**
-         * @brief ȡ汾ַ
+         * @brief 获取软件版本号字符串
          */
         virtual String getSoftwareVersion() const;
 
         /**
-         * @brief ȡϵͳ汾ַ
+         * @brief 获取操作系统版本号字符串
          */
         virtual String getOSVersion() const;
 
         /**
-         * @brief ȡ豸Ͱ汾Ϣַ
+         * @brief 获取设备机型版本信息字符串
          */
         virtual String getDeviceVersion() const;
 
         /**
-         * @brief ȡĻ.
+         * @brief 获取屏幕宽度.
          */
         virtual int32_t getScreenWidth() const;
 
         /**
-         * @brief ȡĻ߶.
+         * @brief 获取屏幕高度.
          */
         virtual int32_t getScreenHeight() const;
 
         /**
-         * @brief ȡĻܶ.
+         * @brief 获取屏幕像素密度.
          */
         virtual float getScreenDPI() const;
 
         /**
-         * @brief ȡ豸macַ.
+         * @brief 获取设备mac地址.
          */
         virtual String getMacAddress() const;
 
         /**
-         * @brief ȡCPUϢ.
+         * @brief 获取CPU类型信息.
          */
         virtual String getCPUType() const;
 
         /**
-         * @brief ȡCPU
+         * @brief 获取CPU核数
          */
         virtual int32_t getNumberOfProcessors() const;
 
         /**
-         * @brief ȡڴϢ.
+         * @brief 获取内存信息.
          */
         virtual uint32_t getMemoryCapacity() const;
 
         /**
-         * @brief ȡ豸ID.
+         * @brief 获取设备ID.
          */
         virtual String getDeviceID() const;
     };
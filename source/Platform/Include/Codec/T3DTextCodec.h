@@ -39,46 +39,46 @@ namespace Tiny3D
 
         bool UTF16ToUTF8(const UTF16String &src, UTF8String &dst);
 
-//      /** GBKַЧԼ飬˵ضϵĲgbk */
+//      /** GBK字符串有效性检查，过滤掉被截断的不完整gbk码 */
 //      bool checkGBKString(char *pText, int32_t nTextLength);
 //
-//      /** Ƿgbkֽ */
+//      /** 是否是gbk首字节 */
 //      bool IsGBKLeadByte(uchar_t ucChar) const;
 //
-//      /** Ƿgbkַ */
+//      /** 是否gbk字符 */
 //      bool IsGBKChar(uint16_t ushChar) const;
 //
-//      /** Ƿgb2312ַ */
+//      /** 是否gb2312字符 */
 //      bool IsGB2312Char(uint16_t ushChar) const;
 //
-//      /** UTF-8תUnicode */
+//      /** UTF-8转换成Unicode */
 //      bool UTF8ToUnicode(wchar_t &wchar, const char szInString[3]);
 //
-//      /** UnicodeתUTF-8 */
+//      /** Unicode转换成UTF-8 */
 //      bool UnicodeToUTF8(char szOutString[3], wchar_t wchar);
 //
-//      /** UnicodeתGB2312 */
+//      /** 把Unicode转换成GB2312 */
 //      uint32_t UnicodeToGB2312(char *pszOutString, const wchar_t *pwszInString, uint32_t unInSize = -1);
 //
-//      /** UnicodeתGB2312 */
+//      /** 把Unicode转换成GB2312 */
 //      uint32_t UnicodeToGB2312Ex(TString &strOut, const wchar_t *pwszInString, uint32_t unInSize = -1);
 //
-//      /** UTF-8תΪGB2312 */
+//      /** UTF-8转为GB2312 */
 //      uint32_t UTF8ToGB2312(char *pszOutString, const char *pszInString, uint32_t unInSize = -1);
 //
-//      /** UTF-8תΪGB2312 */
+//      /** UTF-8转为GB2312 */
 //      uint32_t UTF8ToGB2312Ex(TString &strOut, const char *pszInString, uint32_t unInSize = -1);
 //
-//      /** GB2312תUnicode */
+//      /** GB2312转换成Unicode */
 //      uint32_t GB2312ToUnicode(wchar_t *pwszOutString, const char *pszInString, uint32_t unInSize = -1);
 //
-//      /** GB2312תUnicode */
+//      /** GB2312转换成Unicode */
 //      uint32_t GB2312ToUnicodeEx(TWString &wstrOut, const char *pszInString, uint32_t unInSize = -1);
 //
-//      /** GB2312תΪUTF-8 */
+//      /** GB2312转为UTF-8 */
 //      uint32_t GB2312ToUTF8(char *pszOutString, const char *pszInString, uint32_t unInSize = -1);
 //
-//      /** GB2312תΪUTF-8 */
+//      /** GB2312转为UTF-8 */
 //      uint32_t GB2312ToUTF8Ex(TString &strOut, const char *pszInString, uint32_t unInSize = -1);
 //
 //      bool TrimString(const TString &strSrc, TString &strDst);
@@ -54,67 +54,67 @@ namespace Tiny3D
         virtual ~DeviceInfo();
 
         /**
-         * @brief ȡƽ̨
+         * @brief 获取平台类型
          */
         uint32_t getPlatform() const;
 
         /**
-         * @brief ȡƽַ̨
+         * @brief 获取平台类型字符串
          */
         String getPlatformString() const;
 
         /**
-         * @brief ȡ汾ַ
+         * @brief 获取软件版本号字符串
          */
         String getSoftwareVersion() const;
 
         /**
-         * @brief ȡϵͳ汾ַ
+         * @brief 获取操作系统版本号字符串
          */
         String getOSVersion() const;
 
         /**
-         * @brief ȡ豸Ͱ汾Ϣַ
+         * @brief 获取设备机型版本信息字符串
          */
         String getDeviceVersion() const;
 
         /**
-         * @brief ȡĻ.
+         * @brief 获取屏幕宽度.
          */
         int32_t getScreenWidth() const;
 
         /**
-         * @brief ȡĻ߶.
+         * @brief 获取屏幕高度.
          */
         int32_t getScreenHeight() const;
 
         /**
-         * @brief ȡĻܶ.
+         * @brief 获取屏幕像素密度.
          */
         float getScreenDPI() const;
 
         /**
-         * @brief ȡ豸macַ.
+         * @brief 获取设备mac地址.
          */
         String getMacAddress() const;
 
         /**
-         * @brief ȡCPUϢ.
+         * @brief 获取CPU类型信息.
          */
         String getCPUType() const;
 
         /**
-         * @brief ȡCPU
+         * @brief 获取CPU核数
          */
         int32_t getNumberOfProcessors() const;
 
         /**
-         * @brief ȡڴϢ.
+         * @brief 获取内存信息.
          */
         uint32_t getMemoryCapacity() const;
 
         /**
-         * @brief ȡ豸ID.
+         * @brief 获取设备ID.
          */
         String getDeviceID() const;
 
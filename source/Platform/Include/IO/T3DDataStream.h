@@ -34,71 +34,71 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief жݵ.
-         * @param [in] pBuffer : ݻ
-         * @param [in] nSize : ݻС
-         * @return ضȡݴС.
+         * @brief 从数据流中读数据到缓冲区.
+         * @param [in] pBuffer : 数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 返回读取到的数据大小.
          */
         virtual size_t read(void *pBuffer, size_t nSize) = 0;
 
         /**
-         * @brief дݵ.
-         * @param [in] pBuffer : ݻ
-         * @param [in] nSize : ݻС
-         * @return дݴС.
+         * @brief 写缓冲区数据到数据流中.
+         * @param [in] pBuffer : 数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 返回写入的数据大小.
          */
         virtual size_t write(void *pBuffer, size_t nSize) = 0;
 
         /**
-         * @brief ָƶָλ.
-         * @param [in] llPos : ָƫλ
-         * @param [in] relative : Ƿλ
-         * @return óɹʱtrue
+         * @brief 把数据流指针移动到指定位置.
+         * @param [in] llPos : 指定偏移位置
+         * @param [in] relative : 是否相对位置
+         * @return 当调用成功时，返回true
          */
         virtual bool seek(long_t lPos, bool relative) = 0;
 
         /**
-         * @brief ȡǰдλ.
-         * @return صǰдλ.
+         * @brief 获取当前数据流读写位置.
+         * @return 返回当前数据流读写位置.
          */
         virtual long_t tell() const = 0;
 
         /**
-         * @brief ȡĴС.
-         * @return صǰĴС
+         * @brief 获取数据流的大小.
+         * @return 返回当前数据流的大小
          */
         virtual long_t size() const = 0;
 
         /**
-         * @brief Ƿĩβ.
-         * @return ĩβtrue򷵻false.
+         * @brief 是否到数据流末尾.
+         * @return 到末尾返回true，否则返回false.
          */
         virtual bool eof() const = 0;
 
         /**
-         * @brief һΰȡ겢buffer
-         * @note صpDataڲⲿøͷ
-         * @param [in][out] pData : ضȡ׵ַ
-         * @return ضȡĳ
+         * @brief 一次把整个数据流读取完并返回这块buffer
+         * @note 返回的pData内部管理，外部不用负责释放
+         * @param [in][out] pData : 返回读取的数据首地址
+         * @return 返回读取的长度
          */
         virtual size_t read(uint8_t *&pData) = 0;
 
         /**
-         * @brief ȡһı
-         * @param [in] trim : ǷüǰtabոЧַ
-         * @return һı
+         * @brief 读取一行文本
+         * @param [in] trim : 是否裁剪掉前后的tab、空格等无效字符
+         * @return 返回一行文本
          */
         String readLine(bool trim = true);
 
         /**
-         * @brief дһı
-         * @param [in] strLine : ı
-         * @return дı
+         * @brief 写一行文本
+         * @param [in] strLine : 文本串
+         * @return 返回写入文本长度
          */
         size_t writeLine(const String &strLine);
 
         /**
-         * @brief ֵ
+         * @brief 输出基本类型值到数据流
          */
         DataStream &operator<<(bool val);
         DataStream &operator<<(int8_t val);
@@ -115,7 +115,7 @@ namespace Tiny3D
         DataStream &operator<<(const String &s);
 
         /**
-         * @brief ֵ
+         * @brief 输入数据流到基本类型值
          */
         DataStream &operator>>(bool &val);
         DataStream &operator>>(int8_t &val);
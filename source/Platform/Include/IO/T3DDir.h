@@ -49,128 +49,128 @@ namespace Tiny3D
         ~Dir();
 
         /**
-         * @brief ʼöָĿ¼µļ.
-         * @param [in] strPath : ָĿ¼ļʽַ
-         * @return óɹtrueʧܷfalse.
+         * @brief 开始枚举搜索指定目录下的文件.
+         * @param [in] strPath : 指定目录文件格式字符串
+         * @return 调用成功返回true，失败返回false.
          */
         bool findFile(const String &strPath);
 
         /**
-         * @brief һļ.
-         * @return öûtrue򷵻falseʾöٽ.
+         * @brief 搜索下一个文件.
+         * @return 枚举没结束返回true，否则返回false表示枚举结束.
          */
         bool findNextFile();
 
         /**
-         * @brief ǰö.
+         * @brief 结束当前枚举搜索.
          * @return void
          */
         void close();
 
         /**
-         * @brief ȡöĿ¼·.
-         * @return öĿ¼·std::string.
+         * @brief 获取枚举目录的完整路径.
+         * @return 返回枚举目录的路径，返回类型std::string.
          */
         String getRoot() const;
 
         /**
-         * @brief ȡǰöٵļ.
-         * @return صǰöٵļstd::string.
+         * @brief 获取当前枚举到的完整文件名.
+         * @return 返回当前枚举到的完整文件名，类型std::string.
          */
         String getFileName() const;
 
         /**
-         * @brief ȡǰöٵļȫ·ļ.
-         * @return صǰöٵļȫ·std::string.
+         * @brief 获取当前枚举到的文件的全路径名，包括完整文件名.
+         * @return 返回当前枚举到的文件的全路径名，类型std::string.
          */
         String getFilePath() const;
 
         /**
-         * @brief ȡǰöٵļļչ.
-         * @return صǰöٵļļstd::string.
+         * @brief 获取当前枚举到的文件文件名，不包括扩展名.
+         * @return 返回当前枚举到的文件文件名，类型std::string.
          */
         String getFileTitle() const;
 
         /**
-         * @brief ȡǰöٵļС.
-         * @return صǰöٵļС.
+         * @brief 获取当前枚举到的文件大小.
+         * @return 返回当前枚举到的文件大小.
          */
         uint32_t getFileSize() const;
 
         /**
-         * @brief жϵǰöٵļǷĿ¼'.''..' .
-         * @return Ŀ¼true򷵻false.
+         * @brief 判断当前枚举到的文件是否点目录，包括'.'和'..' .
+         * @return 点目录返回true，否则返回false.
          */
         bool isDots() const;
 
         /**
-         * @brief жϵǰöٵļǷļ.
-         * @return ļtrue򷵻false.
+         * @brief 判断当前枚举到的文件是否文件夹.
+         * @return 文件返回true，否则返回false.
          */
         bool isDirectory() const;
 
         /**
-         * @brief ȡǰöٵļĴʱ.
-         * @return ļʱʱǴ197011յǰ
+         * @brief 获取当前枚举到的文件的创建时间戳.
+         * @return 返回文件创建时间戳，该时间是从1970年1月1日到当前的秒数
          */
         long_t getCreationTime() const;
 
         /**
-         * @brief ȡǰöٵļʱ.
-         * @return ļʱʱǴ197011յǰ
+         * @brief 获取当前枚举到的文件的最后访问时间戳.
+         * @return 返回文件最后访问时间戳，该时间是从1970年1月1日到当前的秒数
          */
         long_t getLastAccessTime() const;
 
         /**
-         * @brief ȡǰöٵļ޸ʱ.
-         * @return ļ޸ʱʱǴ197011յǰ
+         * @brief 获取当前枚举到的文件的最后修改时间戳.
+         * @return 返回文件最后修改时间戳，该时间是从1970年1月1日到当前的秒数
          */
         long_t getLastWriteTime() const;
 
         /**
-         * @brief ļ.
-         * @note ýӿڲܴ༶ļ.
-         * @param [in] strDir : ļ·
-         * @return óɹtrue򷵻false.
+         * @brief 创建文件夹.
+         * @note 该接口不能创建多级文件夹.
+         * @param [in] strDir : 文件夹路径名称
+         * @return 调用成功返回true，否则返回false.
          */
         static bool makeDir(const String &strDir);
 
         /**
-         * @brief ɾļ.
-         * @note ýӿڲɾ༶ļ.
-         * @param [in] strDir : ļ·
-         * @return óɹtrue򷵻false.
+         * @brief 删除文件夹.
+         * @note 该接口不能删除多级文件夹.
+         * @param [in] strDir : 文件夹路径名称
+         * @return 调用成功返回true，否则返回false.
          */
         static bool removeDir(const String &strDir);
 
         /**
-         * @brief ɾļ.
-         * @param [in] strFileName : Ҫɾļ.
-         * @return óɹtrue򷵻false.
+         * @brief 删除文件.
+         * @param [in] strFileName : 需要删除文件的名称.
+         * @return 调用成功返回true，否则返回false.
          */
         static bool remove(const String &strFileName);
 
         /**
-         * @brief ж·ӦļǷ.
-         * @param [in] strPath : ·
-         * @return ļڷtrue򷵻false.
+         * @brief 判断路径对应的文件是否存在.
+         * @param [in] strPath : 完整路径名
+         * @return 文件存在返回true，否则返回false.
          */
         static bool exists(const String &strPath);
 
         /**
-         * @brief ȡӦó򻺴ݴ洢·ͬƽָ̨Ӧ·Զϲ͸.
-         * @return Ӧó򻺴ݴ洢·.
+         * @brief 获取应用程序缓存数据存储路径，不同平台指定对应的路径，以对上层透明处理.
+         * @return 返回应用程序缓存数据存储路径.
          */
         static String getCachePath();
 
         /**
-         * @brief ȡӦó·.
-         * @return Ӧó·.
+         * @brief 获取应用程序路径.
+         * @return 返回应用程序路径.
          */
         static String getAppPath();
 
         /**
-         * @brief ȡϵͳص·ָ
+         * @brief 获取系统相关的路径分隔符
          */
         static char getNativeSeparator();
 
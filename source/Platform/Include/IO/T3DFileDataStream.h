@@ -30,8 +30,8 @@ namespace Tiny3D
 {
     /**
      * @class T3DFileDataStream
-     * @brief ļ.
-     * @note ṩļд.
+     * @brief 文件流类.
+     * @note 该类提供文件流读写操作.
      */
     class T3D_PLATFORM_API FileDataStream : public DataStream
     {
@@ -39,17 +39,17 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief ļģʽ
+         * @brief 文件流打开模式
          */
         enum EOpenMode
         {
-            E_MODE_NOT_OPEN = 0x00000000L,      /**< ļûд */
-            E_MODE_READ_ONLY = 0x00000001L,     /**< ֻʽ */
-            E_MODE_WRITE_ONLY = 0x00000002L,        /**< ֻдʽ */
-            E_MODE_READ_WRITE = E_MODE_READ_ONLY | E_MODE_WRITE_ONLY,   /**< дʽ */
-            E_MODE_APPEND = 0x00000004L,            /**< ׷ӷʽ */
-            E_MODE_TRUNCATE = 0x00000008L,      /**< ļѾʱԭݴ */
-            E_MODE_TEXT = 0x00000010L           /**< ıļ */
+            E_MODE_NOT_OPEN = 0x00000000L,      /**< 文件没有打开 */
+            E_MODE_READ_ONLY = 0x00000001L,     /**< 只读方式打开 */
+            E_MODE_WRITE_ONLY = 0x00000002L,        /**< 只写方式打开 */
+            E_MODE_READ_WRITE = E_MODE_READ_ONLY | E_MODE_WRITE_ONLY,   /**< 读写方式打开 */
+            E_MODE_APPEND = 0x00000004L,            /**< 追加方式打开 */
+            E_MODE_TRUNCATE = 0x00000008L,      /**< 文件已经存在时清空原来内容打开 */
+            E_MODE_TEXT = 0x00000010L           /**< 文本文件 */
         };
 
         /**
@@ -63,81 +63,81 @@ namespace Tiny3D
         virtual ~FileDataStream();
 
         /**
-         * @brief ļ.
-         * @param [in] szFileName : ļ
-         * @param [in] eMode : 򿪷ʽ
-         * @return 򿪳ɹtrue򷵻false.
+         * @brief 打开文件流.
+         * @param [in] szFileName : 文件名
+         * @param [in] eMode : 打开方式
+         * @return 打开成功返回true，否则返回false.
          * @see enum EOpenMode
          */
         bool open(const char *szFileName, uint32_t unMode);
 
         /**
-         * @brief رļ.
+         * @brief 关闭文件流.
          * @return void
          */
         void close();
 
         /**
-         * @brief ȡļ.
-         * @param [in] pBuffer : ݻ
-         * @param [in] nSize : ݻС
-         * @return ȡݴС.
+         * @brief 读取文件流.
+         * @param [in] pBuffer : 数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 读取到的数据大小.
          */
         virtual size_t read(void *pBuffer, size_t nSize) override;
 
         /**
-         * @brief дļ.
-         * @param [in] pBuffer : дݻ
-         * @param [in] nSize : ݻС
-         * @return дݴС
+         * @brief 写入文件流.
+         * @param [in] pBuffer : 待写入数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 写入的数据大小
          */
         virtual size_t write(void *pBuffer, size_t nSize) override;
 
         /**
-         * @brief ļڴȫǿдļ
+         * @brief 把文件缓存在内存的内容全部强制写到文件中
          */
         void flush();
 
         /**
-         * @brief ļдƫλ.
-         * @param [in] llPos : ƫλ
-         * @return óɹʱصǰдλãʱ-1
+         * @brief 设置文件流读写偏移位置.
+         * @param [in] llPos : 偏移位置
+         * @return 当调用成功时，返回当前读写位置，若错误时，返回-1
          */
         virtual bool seek(long_t lPos, bool relative) override;
 
         /**
-         * @brief ȡǰļǰдλ.
-         * @return ļǰдλ
+         * @brief 获取当前文件流当前读写位置.
+         * @return 返回文件流当前读写位置
          */
         virtual long_t tell() const override;
 
         /**
-         * @brief ȡļС.
-         * @return ļС
+         * @brief 获取文件大小.
+         * @return 返回文件大小
          */
         virtual long_t size() const override;
 
         /**
-         * @brief ȡǷļĩβ.
-         * @return ѵļĩβ
+         * @brief 获取是否到文件流末尾.
+         * @return 已到文件流末尾
          */
         virtual bool eof() const override;
 
         /**
-         * @brief һΰȡ겢buffer
-         * @note صpDataڲⲿøͷ
-         * @param [in][out] pData : ضȡ׵ַ
-         * @return ضȡĳ
+         * @brief 一次把整个数据流读取完并返回这块buffer
+         * @note 返回的pData内部管理，外部不用负责释放
+         * @param [in][out] pData : 返回读取的数据首地址
+         * @return 返回读取的长度
          */
         virtual size_t read(uint8_t *&pData) override;
 
         bool isOpened() const   { return m_bIsOpened; }
 
     protected:
-        FILE                *m_pFileHandle;     /**< ļָ */
-        mutable long_t      m_lSize;            /**< ļС */
-        bool                m_bIsOpened;        /**< ļǷ */
-        uint8_t             *m_pData;           /**< ȡ */
+        FILE                *m_pFileHandle;     /**< 文件操作指针 */
+        mutable long_t      m_lSize;            /**< 文件大小 */
+        bool                m_bIsOpened;        /**< 文件是否打开 */
+        uint8_t             *m_pData;           /**< 读取回来的数据 */
     };
 }
 
@@ -28,37 +28,37 @@ namespace Tiny3D
 {
     /**
      * @class T3DMemoryDataStream
-     * @brief ڴ.
-     * @note ṩڴĴ洢.
+     * @brief 内存数据流类.
+     * @note 该类提供基于内存数据流的存储访问.
      */
     class T3D_PLATFORM_API MemoryDataStream : public DataStream
     {
     public:
-        static const uint32_t MEMORY_BUFFER_SIZE;   /**< ĬڴС */
+        static const uint32_t MEMORY_BUFFER_SIZE;   /**< 默认内存流大小 */
 
         MemoryDataStream();
 
         /**
          * @brief Constructor for T3DMemoryDataStream.
-         * @note ù캯ڲԶռ䣬ֱӶԴĻ
-         * @param [in] pBuffer : ݻ
-         * @param [in] unSize : С
-         * @param [in] reallocate : Ƿڲ·ռ䣬Ĭڲ·ռ洢
+         * @note 该构造函数内部不自动非配空间，直接对传入的缓冲区操作
+         * @param [in] pBuffer : 数据缓冲
+         * @param [in] unSize : 缓冲大小
+         * @param [in] reallocate : 是否内部重新分配空间，默认由类内部重新分配空间存储数据
          */
         MemoryDataStream(uchar_t *pBuffer, size_t unSize, bool reallocate = true);
 
         /**
          * @brief Constructor for T3DMemoryDataStream.
-         * @note ڲԶռ.
-         * @param [in] unSize : ռСĬΪV_MEMORY_DATA_STREAM_BUFFER_SIZE.
+         * @note 内部自动分配空间.
+         * @param [in] unSize : 分配空间大小，默认为V_MEMORY_DATA_STREAM_BUFFER_SIZE.
          * @see V_MEMORY_DATA_STREAM_BUFFER_SIZE
          */
         MemoryDataStream(size_t unSize);
 
         /**
          * @brief Constructor for T3DMemoryDataStream.
-         * @note .
-         * @param [in] other : Դ
+         * @note 拷贝构造.
+         * @param [in] other : 源对象
          */
         MemoryDataStream(const MemoryDataStream &other);
 
@@ -68,56 +68,56 @@ namespace Tiny3D
         virtual ~MemoryDataStream();
 
         /**
-         * @brief ظֵ.
+         * @brief 重载赋值操作符.
          */
         MemoryDataStream &operator =(const MemoryDataStream &other);
 
         /**
-         * @brief ȡڴ.
-         * @param [in] pBuffer : ݻ
-         * @param [in] nSize : ݻС
-         * @return ȡݴС
+         * @brief 读取内存数据流.
+         * @param [in] pBuffer : 数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 读取到的数据大小
          */
         virtual size_t read(void *pBuffer, size_t nSize) override;
 
         /**
-         * @brief дڴ.
-         * @param [in] pBuffer : ݻ
-         * @param [in] nSize : ݻС
-         * @return дݴС
+         * @brief 写入内存数据流.
+         * @param [in] pBuffer : 数据缓冲区
+         * @param [in] nSize : 数据缓冲区大小
+         * @return 写入数据大小
          */
         virtual size_t write(void *pBuffer, size_t nSize) override;
 
         /**
-         * @brief ڴдƫλ.
-         * @param [in] unPos : ƫλ
-         * @return óɹʱtrue
+         * @brief 设置内存数据流读写偏移位置.
+         * @param [in] unPos : 偏移位置
+         * @return 当调用成功时，返回true
          */
         virtual bool seek(long_t lPos, bool relative) override;
 
         /**
-         * @brief ȡǰڴдƫλ.
-         * @return ضдƫλ
+         * @brief 获取当前内存数据流读写偏移位置.
+         * @return 返回读写偏移位置
          */
         virtual long_t tell() const override;
 
         /**
-         * @brief ȡڴС.
-         * @return ڴС
+         * @brief 获取内存数据流大小.
+         * @return 返回内存数据流大小
          */
         virtual long_t size() const override;
 
         /**
-         * @brief Ƿ񵽴ڴĩβ.
-         * @return ĩβtrue򷵻false.
+         * @brief 是否到达内存数据流末尾.
+         * @return 到达末尾返回true，否则返回false.
          */
         virtual bool eof() const override;
 
         /**
-         * @brief һΰȡ겢buffer
-         * @note صpDataڲⲿøͷ
-         * @param [in][out] pData : ضȡ׵ַ
-         * @return ضȡĳ
+         * @brief 一次把整个数据流读取完并返回这块buffer
+         * @note 返回的pData内部管理，外部不用负责释放
+         * @param [in][out] pData : 返回读取的数据首地址
+         * @return 返回读取的长度
          */
         virtual size_t read(uint8_t *&pData) override;
 
@@ -129,11 +129,11 @@ namespace Tiny3D
         void copy(const MemoryDataStream &other);
 
     protected:
-        uchar_t     *m_pBuffer;     /**< ݻ */
-        long_t      m_lSize;        /**< ݻС */
-        long_t      m_lCurPos;      /**< ǰдλ */
+        uchar_t     *m_pBuffer;     /**< 数据缓冲区 */
+        long_t      m_lSize;        /**< 数据缓冲区大小 */
+        long_t      m_lCurPos;      /**< 当前读写位置 */
 
-        bool        m_bCreated;     /**< Ƿڴ洴 */
+        bool        m_bCreated;     /**< 是否内存创建标记 */
     };
 }
 
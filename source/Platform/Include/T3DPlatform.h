@@ -30,11 +30,13 @@
 #include <IO/T3DDataStream.h>
 #include <IO/T3DMemoryDataStream.h>
 #include <IO/T3DFileDataStream.h>
+#include <Thread/T3DTaskScheduler.h>
 #include <Time/T3DDateTime.h>
 #include <Time/T3DRunLoop.h>
 #include <Time/T3DRunLoopObserver.h>
 #include <Time/T3DTimer.h>
 #include <Time/T3DTimerObserver.h>
+#include <Time/T3DProfiler.h>
 
 
 #endif  /*__T3D_PLATFORM_H__*/
@@ -32,11 +32,12 @@ namespace Tiny3D
     class DeviceInfo;
     class TextCodec;
     class RunLoop;
+    class Profiler;
 
     /**
      * @class VSystem
-     * @brief ϵͳ.
-     * @note һЩȫֵĵͷţΪϲṩܲϵͳͳһӿ.
+     * @brief 系统类.
+     * @note 该类对一些全局的单例创建和释放，为上层提供框架层和系统层统一接口.
      */
     class T3D_PLATFORM_API System : public Singleton<System>
     {
@@ -54,13 +55,13 @@ namespace Tiny3D
         ~System();
 
         /**
-         * @brief ÿѭô.
+         * @brief 每个程序循环调用处理.
          * @return void
          */
         void process();
 
         /**
-         * @brief ȡϵͳ㹤ӿڶ
+         * @brief 获取操作系统适配层工厂接口对象
          */
         FactoryInterface &getAdapterFactory()
         {
@@ -75,11 +76,13 @@ namespace Tiny3D
         Console                 *m_pConsole;
         DeviceInfo              *m_pDeviceInfo;
         RunLoop                 *m_pMainRunLoop;
+        Profiler                *m_pProfiler;
     };
 
     #define T3D_SYSTEM              (System::getInstance())
     #define T3D_ADAPTER_FACTORY     (T3D_SYSTEM.getAdapterFactory())
     #define T3D_MAIN_RUNLOOP        (System::getInstance().getMainRunLoop())
+    #define T3D_PROFILER            (Profiler::getInstance())
 }
 
 
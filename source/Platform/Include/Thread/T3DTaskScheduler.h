@@ -0,0 +1,339 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_TASK_SCHEDULER_H__
+#define __T3D_TASK_SCHEDULER_H__
+
+
+#include "T3DSingleton.h"
+#include "T3DPlatformPrerequisites.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+
+
+namespace Tiny3D
+{
+    /** 任务函数，pContext是提交任务时传入的上下文 */
+    typedef void (*TaskProc)(void *pContext);
+
+    /** 区间任务函数，处理[unBegin, unEnd)这一段 */
+    typedef void (*RangeTaskProc)(void *pContext, size_t unBegin, size_t unEnd);
+
+    class TaskScheduler;
+
+    /**
+     * @class TaskGroup
+     * @brief 任务组，用来等待一批任务完成，以及在组之间建立依赖和后续任务
+     * @note 组创建后处于打开状态，可以往里提交任务。调用TaskScheduler::close()或者
+     *      TaskScheduler::wait()后关闭，关闭并且组里的任务全部完成后组才算完成。
+     *      组里的任务在执行过程中可以继续往同一个组里提交任务。
+     */
+    class T3D_PLATFORM_API TaskGroup
+    {
+        T3D_DISABLE_COPY(TaskGroup);
+
+        friend class TaskScheduler;
+
+    public:
+        TaskGroup();
+        ~TaskGroup();
+
+        /**
+         * @brief 组是否已经完成，完成后依赖它的组和后续任务都已经提交
+         */
+        bool isFinished() const { return m_bFinished.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 重置成打开状态，跨帧复用同一个组
+         * @note 只能在组完成后或者还没有提交过任务时调用
+         */
+        void reset();
+
+    protected:
+        struct Continuation
+        {
+            TaskProc    pfnProc;        /// 任务函数
+            void        *pContext;      /// 任务上下文
+            TaskGroup   *pGroup;        /// 后续任务所属的组，可以为空
+            uint32_t    unAffinity;     /// 执行线程
+        };
+
+        typedef std::vector<Continuation>       Continuations;
+        typedef Continuations::iterator         ContinuationsItr;
+
+        typedef std::vector<TaskGroup *>        TaskGroups;
+        typedef TaskGroups::iterator            TaskGroupsItr;
+
+        struct DeferredTask
+        {
+            TaskProc        pfnProc;
+            RangeTaskProc   pfnRange;
+            void            *pContext;
+            size_t          unBegin;
+            size_t          unEnd;
+            uint32_t        unAffinity;
+        };
+
+        typedef std::vector<DeferredTask>       DeferredTasks;
+        typedef DeferredTasks::iterator         DeferredTasksItr;
+
+        std::mutex              m_mutex;            /// 保护下面的后续任务、后继组和依赖计数
+        Continuations           m_continuations;    /// 组完成后提交的后续任务
+        TaskGroups              m_successors;       /// 依赖本组的组
+        DeferredTasks           m_deferred;         /// 依赖的组没完成前提交的任务
+        uint32_t                m_unDependencies;   /// 还没完成的依赖组数量
+        bool                    m_bCompleting;      /// 已经开始派发后续任务，不能再添加依赖和后续任务
+
+        std::atomic<uint32_t>   m_unPending;        /// 没完成的任务数量，打开状态额外加1
+        std::atomic<bool>       m_bFinished;        /// 是否已经完成，完成后调度器不再访问本组
+        bool                    m_bClosed;          /// 是否已经关闭
+    };
+
+    /**
+     * @class TaskScheduler
+     * @brief 引擎共用的任务调度器
+     * @note 每个工作线程有自己的任务队列，自己从队尾取任务，空闲时从其他线程的队头偷任务。
+     *      启动调度器的线程是主线程，占0号队列，调用wait()等待时也参与执行任务。
+     *      只能在主线程上执行的任务（例如访问渲染器的任务）提交到单独的主线程队列，
+     *      主线程在wait()里或者每帧调用executeMainThreadTasks()时执行。
+     *      没有启动或者已经停止时，提交的任务直接在调用线程上执行。
+     */
+    class T3D_PLATFORM_API TaskScheduler : public Singleton<TaskScheduler>
+    {
+        T3D_DISABLE_COPY(TaskScheduler);
+
+    public:
+        enum Affinity
+        {
+            E_AFFINITY_ANY = 0,     /// 任意线程
+            E_AFFINITY_MAIN,        /// 只在主线程执行
+        };
+
+        static const uint32_t INVALID_THREAD_INDEX;
+
+        /**
+         * @brief Constructor for TaskScheduler.
+         */
+        TaskScheduler();
+
+        /**
+         * @brief Destructor for TaskScheduler.
+         */
+        ~TaskScheduler();
+
+        /**
+         * @brief 启动工作线程，调用线程作为主线程
+         * @param [in] nWorkers : 工作线程数量，小于0时按CPU核数减去主线程
+         * @return 成功返回true
+         */
+        bool startup(int32_t nWorkers = -1);
+
+        /**
+         * @brief 停止并回收所有工作线程，队列里剩下的任务在主线程上执行完
+         */
+        void shutdown();
+
+        /**
+         * @brief 返回参与执行任务的线程数量，包括主线程
+         */
+        uint32_t getThreadCount() const { return m_unThreadCount; }
+
+        /**
+         * @brief 返回调用线程的序号，主线程是0，工作线程从1开始，
+         *      不是调度器的线程返回INVALID_THREAD_INDEX
+         * @note 可以用来给每个线程分配独立的临时数据
+         */
+        uint32_t getThreadIndex() const;
+
+        /**
+         * @brief 调用线程是否是主线程
+         */
+        bool isMainThread() const   { return getThreadIndex() == 0; }
+
+        /**
+         * @brief 提交一个任务
+         * @param [in] pfnProc : 任务函数
+         * @param [in] pContext : 任务上下文
+         * @param [in] pGroup : 任务所属的组，可以为空
+         * @param [in] unAffinity : 执行线程，见Affinity
+         */
+        void submit(TaskProc pfnProc, void *pContext, TaskGroup *pGroup = nullptr,
+            uint32_t unAffinity = E_AFFINITY_ANY);
+
+        /**
+         * @brief 把[0, unCount)按粒度切成区间任务提交到组里，不等待完成
+         * @param [in] pGroup : 任务所属的组
+         * @param [in] unCount : 元素数量
+         * @param [in] unGrain : 每个任务的元素数量，0表示按线程数量自动切分
+         * @param [in] pfnProc : 区间任务函数
+         * @param [in] pContext : 任务上下文
+         */
+        void parallelFor(TaskGroup *pGroup, size_t unCount, size_t unGrain,
+            RangeTaskProc pfnProc, void *pContext);
+
+        /**
+         * @brief 并行处理[0, unCount)，调用线程也参与，全部完成后才返回
+         * @note 只有一个任务或者没有工作线程时直接在调用线程上执行
+         */
+        void parallelFor(size_t unCount, size_t unGrain, RangeTaskProc pfnProc, void *pContext);
+
+        /**
+         * @brief 让组在依赖的组完成后才开始执行
+         * @param [in] pGroup : 后继组，必须在提交任务前添加依赖
+         * @param [in] pPredecessor : 依赖的组
+         */
+        void addDependency(TaskGroup *pGroup, TaskGroup *pPredecessor);
+
+        /**
+         * @brief 添加组完成后执行的后续任务
+         * @param [in] pGroup : 等待的组
+         * @param [in] pfnProc : 后续任务函数
+         * @param [in] pContext : 后续任务上下文
+         * @param [in] pTarget : 后续任务所属的组，可以为空
+         * @param [in] unAffinity : 执行线程，见Affinity
+         * @remarks 组已经完成时直接提交
+         */
+        void continueWith(TaskGroup *pGroup, TaskProc pfnProc, void *pContext,
+            TaskGroup *pTarget = nullptr, uint32_t unAffinity = E_AFFINITY_ANY);
+
+        /**
+         * @brief 关闭组，之后组里的任务全部完成时组就完成
+         */
+        void close(TaskGroup *pGroup);
+
+        /**
+         * @brief 关闭组并等待组完成
+         * @remarks 调度器的线程在等待期间执行其他任务，主线程还会执行主线程队列里的任务
+         */
+        void wait(TaskGroup *pGroup);
+
+        /**
+         * @brief 在主线程上执行主线程队列里的任务，每帧调用一次
+         * @remarks 没有工作线程时同时执行普通任务队列里的任务
+         */
+        void executeMainThreadTasks();
+
+    protected:
+        struct Task
+        {
+            TaskProc        pfnProc;        /// 任务函数，区间任务时为空
+            RangeTaskProc   pfnRange;       /// 区间任务函数
+            void            *pContext;      /// 任务上下文
+            size_t          unBegin;        /// 区间开始
+            size_t          unEnd;          /// 区间结束，不包含
+            TaskGroup       *pGroup;        /// 所属的组
+        };
+
+        typedef std::deque<Task>            TaskQueue;
+
+        /**
+         * 一个线程的任务队列，起始地址和大小都对齐到缓存行，
+         * 每个队列的互斥量都从新的缓存行开始，避免相邻队列的伪共享
+         */
+        struct alignas(64) WorkerQueue
+        {
+            std::mutex      mutex;
+            TaskQueue       tasks;
+        };
+
+        typedef std::vector<std::thread>    ThreadArray;
+        typedef ThreadArray::iterator       ThreadArrayItr;
+
+        /**
+         * @brief 调用线程在当前调度器里的序号
+         */
+        static uint32_t &threadIndex();
+
+        /**
+         * @brief 工作线程过程
+         */
+        static void workerProcedure(TaskScheduler *pScheduler, uint32_t unIndex);
+
+        /**
+         * @brief 放入队列，依赖没完成的组先暂存在组里
+         */
+        void enqueue(const Task &task, uint32_t unAffinity);
+
+        /**
+         * @brief 直接放入队列
+         */
+        void push(const Task &task, uint32_t unAffinity);
+
+        /**
+         * @brief 从主线程队列取一个任务执行，只能在主线程调用
+         * @return 执行了任务返回true
+         */
+        bool runMainTask();
+
+        /**
+         * @brief 取一个任务执行，先取自己的队列，再取主线程队列，最后去其他线程偷
+         * @return 执行了任务返回true
+         */
+        bool runOneTask(uint32_t unIndex);
+
+        /**
+         * @brief 执行任务并结算所属的组
+         */
+        void execute(const Task &task);
+
+        /**
+         * @brief 组里的一个任务完成
+         */
+        void finish(TaskGroup *pGroup);
+
+        /**
+         * @brief 组完成，提交后续任务并释放后继组
+         */
+        void complete(TaskGroup *pGroup);
+
+        /**
+         * @brief 后继组的一个依赖完成，依赖都完成后提交暂存的任务
+         */
+        void release(TaskGroup *pGroup);
+
+        /**
+         * @brief 唤醒等待中的线程
+         * @param [in] bAll : 是否唤醒全部，否则唤醒一个
+         */
+        void wakeup(bool bAll);
+
+        uint8_t                 *m_pQueueBuffer;    /// 队列的内存，多分配一个缓存行用于对齐
+        WorkerQueue             *m_pQueues;         /// 每个线程一个队列，主线程是0号
+        TaskQueue               m_mainTasks;        /// 只能在主线程执行的任务
+        std::mutex              m_mainMutex;        /// 保护主线程队列
+        ThreadArray             m_workers;          /// 工作线程
+        uint32_t                m_unThreadCount;    /// 线程数量，包括主线程
+
+        std::mutex              m_sleepMutex;       /// 线程挂起互斥量
+        std::condition_variable m_wakeCond;         /// 有新任务或者有组完成时通知调度器的线程
+        std::condition_variable m_doneCond;         /// 有组完成时通知其他线程
+        std::atomic<uint32_t>   m_unQueued;         /// 普通队列里的任务数量
+        std::atomic<uint32_t>   m_unMainQueued;     /// 主线程队列里的任务数量
+        std::atomic<uint32_t>   m_unSleeping;       /// 挂起的线程数量
+        std::atomic<bool>       m_bExiting;         /// 工作线程退出标记
+    };
+
+    #define T3D_TASK_SCHEDULER      (TaskScheduler::getInstance())
+}
+
+
+#endif  /*__T3D_TASK_SCHEDULER_H__*/
@@ -30,14 +30,14 @@ namespace Tiny3D
 {
     /**
      * @class T3DDateTime
-     * @brief ʱز.
+     * @brief 各种时间相关操作的类.
      */
     class T3D_PLATFORM_API DateTime
     {
     public:
         enum ETimeFormat
         {
-            E_HH_MM_SS_XXX = 0,     /// תַʽΪHH:MM:SS.XXX
+            E_HH_MM_SS_XXX = 0,     /// 转成字符串格式为：HH:MM:SS.XXX
             E_HH_MM_SS,
             E_HH_MM,
         };
@@ -57,144 +57,144 @@ namespace Tiny3D
 
         /**
          * @brief Constructor for T3DDateTime.
-         * @param [in] nYear : 
-         * @param [in] nMonth : 
-         * @param [in] nDay : 
-         * @param [in] nHour : ʱ
-         * @param [in] nMin : 
-         * @param [in] nSecond : 
-         * @param [in] millisecond : 
+         * @param [in] nYear : 年
+         * @param [in] nMonth : 月
+         * @param [in] nDay : 日
+         * @param [in] nHour : 时
+         * @param [in] nMin : 分
+         * @param [in] nSecond : 秒
+         * @param [in] millisecond : 毫秒
          */
         DateTime(int32_t nYear, int32_t nMonth, int32_t nDay, int32_t nHour, int32_t nMin, int32_t nSecond, int32_t millisecond);
 
         /**
-         * @brief T3DDateTimeʱתɴ197011տʼĺ.
-         * @return ʱ.
+         * @brief 把T3DDateTime中时间转换成从1970年1月1日开始的毫秒数.
+         * @return 返回时间毫秒数.
          */
         uint64_t toMSecsSinceEpoch() const;
 
         /**
-         * @brief VDataTimeʱתַ.
-         * @note ַʽ磺YYYY-MM-DD HH:MM:SS.XXX
-         * @return std::string
+         * @brief 把VDataTime中时间转成字符串.
+         * @note 字符串格式形如：YYYY-MM-DD HH:MM:SS.XXX
+         * @return 返回std::string对象
          */
         String toString() const;
 
         /**
-         * @brief VDataTimeʱתַ.
-         * @note ַʽ磺HH:MM:SS.XXX
-         * @return std::string
+         * @brief 把VDataTime中时间转成字符串.
+         * @note 字符串格式形如：HH:MM:SS.XXX
+         * @return 返回std::string对象
          */
         String timeToString(ETimeFormat eFormat = E_HH_MM_SS_XXX) const;
 
         /**
-         * @brief VDataTimeʱתַ.
-         * @note ַʽ磺YYYY-MM-DD
-         * @return std::string
+         * @brief 把VDataTime中时间转成字符串.
+         * @note 字符串格式形如：YYYY-MM-DD
+         * @return 返回std::string对象
          */
         String dateToString(EDateFormat eFormat = E_YY_MM_DD) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator ==(const DateTime &other) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator !=(const DateTime &other) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator <(const DateTime &other) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator <=(const DateTime &other) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator >(const DateTime &other) const;
 
         /**
-         * @brief жʱǷ
+         * @brief 判断时间是否相等
          */
         bool operator >=(const DateTime &other) const;
 
     public:
         /**
-         * @brief ̬ӿڣȡǰʱT3DDateTime.
-         * @return صǰʱT3DDateTime.
+         * @brief 静态接口，获取当前时间的T3DDateTime对象.
+         * @return 返回当前时间的T3DDateTime对象.
          */
         static DateTime currentDateTime();
 
         /**
-         * @brief ̬ӿڣȡǰʱT3DDateTime.
-         * @return صǰʱT3DDateTime.
+         * @brief 静态接口，获取当前格林威治时间的T3DDateTime对象.
+         * @return 返回当前格林威治时间的T3DDateTime对象.
          */
         static DateTime currentDateTimeUTC();
 
         /**
-         * @brief ̬ӿڣȡ197011յڵʱ
-         * @return ʱ
+         * @brief 静态接口，获取从1970年1月1日到现在的时间秒数
+         * @return 返回时间秒数
          */
         static uint64_t currentSecsSinceEpoch();
 
         /**
-         * @brief ̬ӿڣȡ197011յڵʱ.
-         * @return ʱ.
+         * @brief 静态接口，获取从1970年1月1日到现在的时间毫秒数.
+         * @return 返回时间毫秒数.
          */
         static uint64_t currentMSecsSinceEpoch();
 
         /**
-         * @brief ̬ӿڣѴ197011տʼĺתT3DDateTime.
-         * @param [in] msecs : 197011տʼĺ
-         * @return T3DDateTime.
+         * @brief 静态接口，把从1970年1月1日开始的毫秒数转换成T3DDateTime对象.
+         * @param [in] msecs : 从1970年1月1日开始的毫秒数
+         * @return 返回T3DDateTime对象.
          */
         static DateTime fromMSecsSinceEpoch(uint64_t msecs);
 
         /**
-         * @brief ̬ӿڣѴ197011տʼתT3DDateTime.
-         * @param [in] msecs : 197011տʼ
-         * @return T3DDateTime.
+         * @brief 静态接口，把从1970年1月1日开始的秒数转换成T3DDateTime对象.
+         * @param [in] msecs : 从1970年1月1日开始的秒数
+         * @return 返回T3DDateTime对象.
          */
         static DateTime fromSecsSinceEpoch(uint64_t sces);
 
     public:
-        /**  */
+        /** 返回年 */
         int32_t Year() const
         {
             return m_nYear;
         }
-        /**  */
+        /** 返回月 */
         int32_t Month() const
         {
             return m_nMonth;
         }
-        /**  */
+        /** 返回日 */
         int32_t Day() const
         {
             return m_nDay;
         }
-        /** ʱ */
+        /** 返回时 */
         int32_t Hour() const
         {
             return m_nHour;
         }
-        /** ط */
+        /** 返回分 */
         int32_t Minute() const
         {
             return m_nMinute;
         }
-        /**  */
+        /** 返回秒 */
         int32_t Second() const
         {
             return m_nSecond;
         }
-        /** غ */
+        /** 返回毫秒 */
         int32_t Millisecond() const
         {
             return m_nMillisecond;
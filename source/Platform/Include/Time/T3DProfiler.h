@@ -0,0 +1,243 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_PROFILER_H__
+#define __T3D_PROFILER_H__
+
+
+#include "T3DSingleton.h"
+#include "T3DPlatformPrerequisites.h"
+#include <atomic>
+#include <mutex>
+
+
+namespace Tiny3D
+{
+    /**
+     * @class Profiler
+     * @brief 分层CPU帧分析器
+     * @note 每个线程有自己的环形缓冲区，记录区段只由所属线程写入，不需要加锁。
+     *      缓冲区写满后覆盖最早的记录，所以总能导出最近若干帧。
+     *      缓冲区和帧开始时间表的字段都是原子变量，导出线程和写入线程之间没有数据竞争，
+     *      导出时用累计写入数判断哪些记录在复制过程中被覆盖了。
+     *      区段名称必须是静态字符串，只保存指针。
+     *      编译时没有定义T3D_ENABLE_PROFILER的话，T3D_PROFILE_XXX宏展开为空。
+     */
+    class T3D_PLATFORM_API Profiler : public Singleton<Profiler>
+    {
+        T3D_DISABLE_COPY(Profiler);
+
+    public:
+        /**
+         * @brief 一条区段记录
+         */
+        struct Zone
+        {
+            const char  *szName;        /// 区段名称
+            uint64_t    ullBegin;       /// 开始时间，纳秒
+            uint64_t    ullEnd;         /// 结束时间，纳秒
+            uint32_t    unDepth;        /// 嵌套深度，0是最外层
+        };
+
+        /**
+         * @brief 环形缓冲区里的一条区段记录，所属线程写入的同时其他线程可以读取
+         */
+        struct ZoneSlot
+        {
+            std::atomic<const char *>   szName;     /// 区段名称
+            std::atomic<uint64_t>       ullBegin;   /// 开始时间，纳秒
+            std::atomic<uint64_t>       ullEnd;     /// 结束时间，纳秒
+            std::atomic<uint32_t>       unDepth;    /// 嵌套深度
+        };
+
+        /**
+         * @brief 每个线程的区段环形缓冲区
+         */
+        struct ThreadBuffer
+        {
+            ZoneSlot                *pZones;        /// 区段记录
+            size_t                  unCapacity;     /// 最多保存的记录数
+            std::atomic<uint64_t>   ullWritten;     /// 累计写入的记录数，只由所属线程修改
+            uint32_t                unDepth;        /// 当前嵌套深度
+            uint32_t                unThreadID;     /// 注册顺序编号，导出时作为线程ID
+
+            /**
+             * @brief 写入一条记录，只能在所属线程调用
+             * @remarks 写字段前的release屏障保证导出线程读到新字段时，
+             *      随后读到的累计写入数不小于written，能识别出这条记录覆盖了旧记录
+             */
+            void push(const char *szName, uint64_t ullBegin, uint64_t ullEnd, uint32_t depth)
+            {
+                uint64_t written = ullWritten.load(std::memory_order_relaxed);
+                ZoneSlot &zone = pZones[written % unCapacity];
+                std::atomic_thread_fence(std::memory_order_release);
+                zone.szName.store(szName, std::memory_order_relaxed);
+                zone.ullBegin.store(ullBegin, std::memory_order_relaxed);
+                zone.ullEnd.store(ullEnd, std::memory_order_relaxed);
+                zone.unDepth.store(depth, std::memory_order_relaxed);
+                ullWritten.store(written + 1, std::memory_order_release);
+            }
+        };
+
+        /**
+         * @brief Constructor for Profiler.
+         * @param [in] unZonesPerThread : 每个线程最多保存的区段记录数
+         * @param [in] unMaxFrames : 最多保存的帧边界数，也是一次最多能导出的帧数
+         */
+        Profiler(size_t unZonesPerThread = 32768, uint32_t unMaxFrames = 300);
+
+        /**
+         * @brief Destructor for Profiler.
+         */
+        ~Profiler();
+
+        /**
+         * @brief 返回单调时钟的当前时间，单位纳秒
+         */
+        static uint64_t now();
+
+        /**
+         * @brief 运行时开关，关闭后区段只做一次判断
+         */
+        void setEnabled(bool bEnabled)  { m_bEnabled.store(bEnabled, std::memory_order_relaxed); }
+
+        bool isEnabled() const          { return m_bEnabled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief 结束当前帧，由主线程每帧调用一次
+         * @return 返回刚结束这一帧的耗时，单位纳秒
+         */
+        uint64_t endFrame();
+
+        /**
+         * @brief 返回已经结束的帧数
+         */
+        uint32_t getFrameIndex() const  { return m_unFrameIndex.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 返回最多能导出的帧数
+         */
+        uint32_t getMaxFrames() const   { return m_unMaxFrames; }
+
+        /**
+         * @brief 返回调用线程的缓冲区，第一次调用时注册
+         */
+        ThreadBuffer *getThreadBuffer();
+
+        /**
+         * @brief 把最近若干帧的区段导出成Chrome trace格式的JSON
+         * @param [out] json : 导出的JSON文本
+         * @param [in] unFrames : 导出的帧数，超过保存的帧数时按保存的帧数导出
+         * @note 可以在任意线程调用，其他线程同时写入时被覆盖的记录会丢弃，
+         *      主线程同时结束帧时导出的第一帧可能少一些记录
+         */
+        void exportChromeTrace(String &json, uint32_t unFrames) const;
+
+        /**
+         * @brief 把最近若干帧的区段保存成Chrome trace文件，可以在chrome://tracing里打开
+         * @param [in] path : 文件路径
+         * @param [in] unFrames : 导出的帧数
+         * @return 写文件成功返回true
+         */
+        bool dumpChromeTrace(const String &path, uint32_t unFrames) const;
+
+    protected:
+        typedef std::vector<ThreadBuffer *>     ThreadBuffers;
+        typedef ThreadBuffers::iterator         ThreadBuffersItr;
+        typedef ThreadBuffers::const_iterator   ThreadBuffersConstItr;
+
+        typedef std::vector<Zone>               Zones;
+        typedef Zones::const_iterator           ZonesConstItr;
+
+        /**
+         * @brief 复制一个线程缓冲区里结束时间不早于ullSince的记录
+         */
+        static void collectZones(const ThreadBuffer *pBuffer, uint64_t ullSince, Zones &zones);
+
+        mutable std::mutex      m_mutex;            /// 保护线程缓冲区列表
+        ThreadBuffers           m_buffers;          /// 所有线程的缓冲区
+        size_t                  m_unZonesPerThread; /// 每个线程最多保存的区段记录数
+
+        std::atomic<uint64_t>   *m_pFrameStarts;    /// 帧开始时间环形表，有m_unMaxFrames + 1项
+        uint32_t                m_unMaxFrames;      /// 最多保存的帧数
+        std::atomic<uint32_t>   m_unFrameIndex;     /// 已经结束的帧数
+        std::atomic<bool>       m_bEnabled;         /// 运行时开关
+        uint32_t                m_unGeneration;     /// 分析器的代数，每个实例都不同，线程据此判断缓冲区是否属于当前分析器
+
+        static std::atomic<uint32_t>    m_unNextGeneration; /// 下一个分析器的代数，0表示线程还没有注册过
+    };
+
+    /**
+     * @class ProfileZone
+     * @brief 记录一个作用域耗时的区段，构造时开始计时，析构时写入调用线程的缓冲区
+     */
+    class ProfileZone
+    {
+        T3D_DISABLE_COPY(ProfileZone);
+
+    public:
+        ProfileZone(const char *szName)
+            : m_szName(szName)
+            , m_ullBegin(0)
+            , m_pBuffer(nullptr)
+        {
+            Profiler *profiler = Profiler::getInstancePtr();
+
+            if (profiler != nullptr && profiler->isEnabled())
+            {
+                m_pBuffer = profiler->getThreadBuffer();
+                ++m_pBuffer->unDepth;
+                m_ullBegin = Profiler::now();
+            }
+        }
+
+        ~ProfileZone()
+        {
+            if (m_pBuffer != nullptr)
+            {
+                uint64_t end = Profiler::now();
+                --m_pBuffer->unDepth;
+                m_pBuffer->push(m_szName, m_ullBegin, end, m_pBuffer->unDepth);
+            }
+        }
+
+    private:
+        const char                  *m_szName;
+        uint64_t                    m_ullBegin;
+        Profiler::ThreadBuffer      *m_pBuffer;
+    };
+}
+
+
+#define T3D_PROFILE_CONCAT_IMPL(a, b)   a##b
+#define T3D_PROFILE_CONCAT(a, b)        T3D_PROFILE_CONCAT_IMPL(a, b)
+
+#if defined (T3D_ENABLE_PROFILER)
+    /** 记录当前作用域的耗时，name必须是静态字符串 */
+    #define T3D_PROFILE_ZONE(name)  \
+        Tiny3D::ProfileZone T3D_PROFILE_CONCAT(__t3d_profile_zone_, __LINE__)(name)
+    /** 以函数名记录当前函数的耗时 */
+    #define T3D_PROFILE_FUNCTION()  T3D_PROFILE_ZONE(__FUNCTION__)
+#else
+    #define T3D_PROFILE_ZONE(name)
+    #define T3D_PROFILE_FUNCTION()
+#endif
+
+
+#endif  /*__T3D_PROFILER_H__*/
@@ -34,8 +34,8 @@ namespace Tiny3D
 
     /**
      * @class T3DRunLoop
-     * @brief ѭ
-     * @note ϵͳѭϵͳѭʱ
+     * @brief 运行循环对象
+     * @note 该类是系统循环，按照系统循环计时
      */
     class T3D_PLATFORM_API RunLoop
     {
@@ -53,40 +53,40 @@ namespace Tiny3D
         ~RunLoop();
 
         /**
-         * @brief ϵͳѭʱ.
-         * @param [in] unInterval : ʱ
-         * @param [in] bRepeat : Ƿѭʱ
-         * @return ѭID
+         * @brief 启动系统循环计时器.
+         * @param [in] unInterval : 定时毫秒数
+         * @param [in] bRepeat : 是否循环计时器
+         * @return 循环ID
          */
         uint32_t start(uint32_t unInterval, bool bRepeat, RunLoopObserver *pObserver);
 
         /**
-         * @brief 򵥵ϵͳѭѭص
+         * @brief 简单的启动系统循环，按照循环次数来回调
          * @param : void
-         * @return ѭID
+         * @return 循环ID
          */
         uint32_t start(RunLoopObserver *pObserver);
 
         /**
-         * @brief رѭʱ.
-         * @param [in] unLoopID : ѭIDstartӿڷ
-         * @return ӦѭʱIDЧͷtrue򷵻false
+         * @brief 关闭循环计时器.
+         * @param [in] unLoopID : 循环ID，调用start接口返回
+         * @return 对应的循环计时器ID有效就返回true，否则返回false
          */
         bool stop(uint32_t unLoopID);
 
         /**
-         * @brief ִмʱɷص
+         * @brief 执行计时器，并且派发回调
          */
         void execute();
 
     protected:
         struct RunLoopInfo
         {
-            uint64_t            ullLastTimestamp;   /// ϴμʱʱ
-            uint64_t            ullInterval;        /// 趨ʱ
-            RunLoopObserver     *pObserver;         /// ص
-            bool                bRepeat;            /// Ƿѭʱ
-            bool                bAlive;             /// ǷЧ
+            uint64_t            ullLastTimestamp;   /// 上次计时时间戳
+            uint64_t            ullInterval;        /// 设定的时间间隔
+            RunLoopObserver     *pObserver;         /// 回调对象
+            bool                bRepeat;            /// 是否循环计时
+            bool                bAlive;             /// 是否还有效
         };
 
         typedef std::map<uint32_t, RunLoopInfo> RunLoopInfos;
@@ -33,8 +33,8 @@ namespace Tiny3D
 
     /**
      * @class VTimer
-     * @brief ʱ.
-     * @note ǲϵͳƽ̨޹ضʱƽ̨Ľһװ.
+     * @brief 定时器类.
+     * @note 该类是操作系统平台无关定时器，对平台适配层的进一步封装.
      */
     class T3D_PLATFORM_API Timer
     {
@@ -52,28 +52,28 @@ namespace Tiny3D
         ~Timer();
 
         /**
-         * @brief ʱ.
-         * @param [in] unInterval : ʱ
-         * @return ʱID
+         * @brief 启动定时器.
+         * @param [in] unInterval : 定时毫秒数
+         * @return 定时器ID
          */
         uint32_t start(uint32_t unInterval);
 
         /**
-         * @brief رնʱ.
+         * @brief 关闭定时器.
          * @return void
          */
         void stop();
 
         /**
-         * @brief öʱ۲߶.
-         * @param [in] pObserver : ۲߶
+         * @brief 设置定时器观察者对象.
+         * @param [in] pObserver : 观察者对象
          * @return void
          */
         void setObserver(TimerObserver *pObserver);
 
         /**
-         * @brief ȡʱID.
-         * @return ضʱID
+         * @brief 获取定时器ID.
+         * @return 返回定时器ID
          */
         uint32_t getTimerID() const;
 
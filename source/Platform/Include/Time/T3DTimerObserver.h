@@ -30,8 +30,8 @@ namespace Tiny3D
 {
     /**
      * @class ITimerObserver
-     * @brief ʱ۲߽ӿ.
-     * @note ̳иʵֽӿԶԶʱ¼.
+     * @brief 定时器观察者接口类.
+     * @note 继承该类实现接口以对定时器事件监听.
      */
     class T3D_PLATFORM_API TimerObserver
     {
@@ -39,8 +39,8 @@ namespace Tiny3D
 
     public:
         /**
-         * @brief ʱʱ䵽ص.
-         * @param [in] unTimerID : ʱĶʱID
+         * @brief 定时器时间到达回调.
+         * @param [in] unTimerID : 到达时间的定时器ID
          * @return void
          */
         virtual void onTimer(uint32_t unTimerID) = 0;
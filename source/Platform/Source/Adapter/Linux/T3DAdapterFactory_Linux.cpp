@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DAdapterFactory_Linux.h"
+#include "T3DConsoleAdapter_Linux.h"
+#include "T3DDeviceInfoAdapter_Linux.h"
+#include "T3DTimerAdapter_Linux.h"
+#include "T3DDirAdapter_Unix.h"
+
+
+namespace Tiny3D
+{
+    FactoryInterface *createAdapterFactory()
+    {
+        return new Factory_Linux();
+    }
+
+    Factory_Linux::Factory_Linux()
+    {
+
+    }
+
+    Factory_Linux::~Factory_Linux()
+    {
+
+    }
+
+    ConsoleInterface *Factory_Linux::createConsoleAdapter()
+    {
+        return new Console_Linux();
+    }
+
+    TimerInterface *Factory_Linux::createTimerAdapter()
+    {
+        return new Timer_Linux();
+    }
+
+    DirInterface *Factory_Linux::createDirAdapter()
+    {
+        return new Dir_Unix();
+    }
+
+    DeviceInfoInterface *Factory_Linux::createDeviceInfoAdapter()
+    {
+        return new DeviceInfo_Linux();
+    }
+
+    EPlatform Factory_Linux::getPlatform()
+    {
+        return E_PLATFORM_LINUX;
+    }
+}
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DDeviceInfoAdapter_Linux.h"
+#include "Adapter/T3DFactoryInterface.h"
+#include <sys/utsname.h>
+#include <sys/sysinfo.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <string.h>
+#include <fstream>
+#include <set>
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 返回/proc/cpuinfo里一行的值，不是"key : value"格式的行返回false
+     */
+    static bool parseCPUInfoLine(const String &strLine, String &strKey, String &strValue)
+    {
+        size_t nPos = strLine.find(':');
+
+        if (nPos == String::npos)
+            return false;
+
+        size_t nEnd = strLine.find_last_not_of(" \t", nPos == 0 ? 0 : nPos - 1);
+        strKey = (nEnd == String::npos) ? "" : strLine.substr(0, nEnd + 1);
+
+        size_t nBegin = strLine.find_first_not_of(" \t", nPos + 1);
+        strValue = (nBegin == String::npos) ? "" : strLine.substr(nBegin);
+
+        return true;
+    }
+
+    DeviceInfo_Linux::DeviceInfo_Linux()
+    {
+
+    }
+
+    DeviceInfo_Linux::~DeviceInfo_Linux()
+    {
+
+    }
+
+    uint32_t DeviceInfo_Linux::getPlatform() const
+    {
+        return E_PLATFORM_LINUX;
+    }
+
+    String DeviceInfo_Linux::getSoftwareVersion() const
+    {
+        return "3.0.0.0";
+    }
+
+    String DeviceInfo_Linux::getOSVersion() const
+    {
+        struct utsname name;
+
+        if (uname(&name) != 0)
+            return "Linux";
+
+        return String(name.sysname) + " " + name.release;
+    }
+
+    String DeviceInfo_Linux::getDeviceVersion() const
+    {
+        return "PC";
+    }
+
+    int32_t DeviceInfo_Linux::getScreenWidth() const
+    {
+        return 0;
+    }
+
+    int32_t DeviceInfo_Linux::getScreenHeight() const
+    {
+        return 0;
+    }
+
+    float DeviceInfo_Linux::getScreenDPI() const
+    {
+        return 0.0f;
+    }
+
+    String DeviceInfo_Linux::getMacAddress() const
+    {
+        // 取第一个不是回环设备的网卡地址
+        String strAddress;
+        DIR *pDir = opendir("/sys/class/net");
+
+        if (pDir != nullptr)
+        {
+            struct dirent *pEntry = readdir(pDir);
+
+            while (pEntry != nullptr && strAddress.empty())
+            {
+                if (pEntry->d_name[0] != '.' && strcmp(pEntry->d_name, "lo") != 0)
+                {
+                    String strPath = String("/sys/class/net/") + pEntry->d_name + "/address";
+                    std::ifstream fs(strPath.c_str());
+                    std::getline(fs, strAddress);
+                }
+
+                pEntry = readdir(pDir);
+            }
+
+            closedir(pDir);
+        }
+
+        if (strAddress.empty())
+        {
+            strAddress = "00:00:00:00:00:00";
+        }
+
+        return strAddress;
+    }
+
+    String DeviceInfo_Linux::getCPUType() const
+    {
+        std::ifstream fs("/proc/cpuinfo");
+        String strLine, strKey, strValue;
+
+        while (std::getline(fs, strLine))
+        {
+            if (parseCPUInfoLine(strLine, strKey, strValue) && strKey == "model name")
+            {
+                return strValue;
+            }
+        }
+
+        return "Unknown";
+    }
+
+    int32_t DeviceInfo_Linux::getNumberOfProcessors() const
+    {
+        // 和Windows一样按物理核数计算，不同的(physical id, core id)算一个核
+        std::ifstream fs("/proc/cpuinfo");
+        std::set<String> cores;
+        String strLine, strKey, strValue;
+        String strPhysicalID;
+
+        while (std::getline(fs, strLine))
+        {
+            if (!parseCPUInfoLine(strLine, strKey, strValue))
+                continue;
+
+            if (strKey == "physical id")
+            {
+                strPhysicalID = strValue;
+            }
+            else if (strKey == "core id")
+            {
+                cores.insert(strPhysicalID + ":" + strValue);
+            }
+        }
+
+        int32_t nCores = (int32_t)cores.size();
+
+        if (nCores == 0)
+        {
+            long lCount = sysconf(_SC_NPROCESSORS_ONLN);
+            nCores = (lCount > 0 ? (int32_t)lCount : 1);
+        }
+
+        return nCores;
+    }
+
+    uint32_t DeviceInfo_Linux::getMemoryCapacity() const
+    {
+        struct sysinfo info;
+
+        if (sysinfo(&info) != 0)
+            return 0;
+
+        uint64_t ullBytes = (uint64_t)info.totalram * info.mem_unit;
+        return (ullBytes > 0xFFFFFFFFULL ? 0xFFFFFFFF : (uint32_t)ullBytes);
+    }
+
+    String DeviceInfo_Linux::getDeviceID() const
+    {
+        return getMacAddress();
+    }
+}
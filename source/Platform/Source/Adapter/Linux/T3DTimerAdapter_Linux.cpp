@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DTimerAdapter_Linux.h"
+#include "Time/T3DTimerObserver.h"
+#include "Time/T3DRunLoop.h"
+#include "T3DSystem.h"
+
+
+namespace Tiny3D
+{
+    Timer_Linux::Timer_Linux()
+        : m_pObserver(nullptr)
+        , m_unTimerID(T3D_INVALID_TIMER_ID)
+    {
+
+    }
+
+    Timer_Linux::~Timer_Linux()
+    {
+        stop();
+    }
+
+    uint32_t Timer_Linux::start(uint32_t unInterval)
+    {
+        m_unTimerID = T3D_MAIN_RUNLOOP.start(unInterval, true, this);
+        return m_unTimerID;
+    }
+
+    void Timer_Linux::stop()
+    {
+        if (T3D_INVALID_TIMER_ID != m_unTimerID)
+        {
+            if (System::getInstancePtr() != nullptr)
+            {
+                T3D_MAIN_RUNLOOP.stop(m_unTimerID);
+            }
+
+            m_unTimerID = T3D_INVALID_TIMER_ID;
+        }
+    }
+
+    void Timer_Linux::setObserver(TimerObserver *pObserver)
+    {
+        m_pObserver = pObserver;
+    }
+
+    uint32_t Timer_Linux::getTimerID() const
+    {
+        return m_unTimerID;
+    }
+
+    void Timer_Linux::onExecute(uint32_t unLoopID, uint64_t dt)
+    {
+        if (m_pObserver != nullptr && unLoopID == m_unTimerID)
+        {
+            m_pObserver->onTimer(m_unTimerID);
+        }
+    }
+}
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+
+#include "T3DDirAdapter_Unix.h"
+#include <unistd.h>
+#include <fnmatch.h>
+#include <limits.h>
+#include <string.h>
+#include <stdio.h>
+
+
+namespace Tiny3D
+{
+    Dir_Unix::Dir_Unix()
+        : m_pDir(nullptr)
+        , m_bHasStat(false)
+    {
+        memset(&m_FileStat, 0, sizeof(m_FileStat));
+    }
+
+    Dir_Unix::~Dir_Unix()
+    {
+        close();
+    }
+
+    bool Dir_Unix::findFile(const String &strPath)
+    {
+        if (strPath.empty())
+            return false;
+
+        close();
+
+        extractRoot(strPath, m_strRoot, m_strPattern);
+
+        m_pDir = opendir(m_strRoot.empty() ? "." : m_strRoot.c_str());
+
+        if (m_pDir == nullptr)
+            return false;
+
+        if (!readNextEntry())
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    bool Dir_Unix::findNextFile()
+    {
+        if (m_pDir == nullptr)
+            return false;
+
+        return readNextEntry();
+    }
+
+    void Dir_Unix::close()
+    {
+        if (m_pDir != nullptr)
+        {
+            closedir(m_pDir);
+            m_pDir = nullptr;
+        }
+
+        memset(&m_FileStat, 0, sizeof(m_FileStat));
+        m_bHasStat = false;
+        m_strName.clear();
+        m_strTitle.clear();
+    }
+
+    bool Dir_Unix::readNextEntry()
+    {
+        struct dirent *pEntry = readdir(m_pDir);
+
+        while (pEntry != nullptr)
+        {
+            if (m_strPattern.empty()
+                || fnmatch(m_strPattern.c_str(), pEntry->d_name, 0) == 0)
+            {
+                extractFileName(pEntry->d_name, m_strName, m_strTitle);
+
+                String strPath = m_strRoot + m_strName;
+                m_bHasStat = (stat(strPath.c_str(), &m_FileStat) == 0);
+                return true;
+            }
+
+            pEntry = readdir(m_pDir);
+        }
+
+        m_bHasStat = false;
+        m_strName.clear();
+        m_strTitle.clear();
+        return false;
+    }
+
+    String Dir_Unix::getRoot() const
+    {
+        if (m_pDir == nullptr)
+            return "";
+
+        return m_strRoot;
+    }
+
+    String Dir_Unix::getFileName() const
+    {
+        if (m_pDir == nullptr)
+            return "";
+
+        return m_strName;
+    }
+
+    String Dir_Unix::getFilePath() const
+    {
+        if (m_pDir == nullptr)
+            return "";
+
+        return m_strRoot + m_strName;
+    }
+
+    String Dir_Unix::getFileTitle() const
+    {
+        if (m_pDir == nullptr)
+            return "";
+
+        return m_strTitle;
+    }
+
+    uint32_t Dir_Unix::getLength() const
+    {
+        if (!m_bHasStat)
+            return 0;
+
+        return (uint32_t)m_FileStat.st_size;
+    }
+
+    bool Dir_Unix::isDots() const
+    {
+        return (m_pDir != nullptr && (m_strName == "." || m_strName == ".."));
+    }
+
+    bool Dir_Unix::isDirectory() const
+    {
+        return (m_bHasStat && S_ISDIR(m_FileStat.st_mode));
+    }
+
+    long_t Dir_Unix::getCreationTime() const
+    {
+        // POSIX没有创建时间，st_ctime是状态改变时间，Windows的_stat也是用它
+        if (!m_bHasStat)
+            return 0;
+
+        return (long_t)m_FileStat.st_ctime;
+    }
+
+    long_t Dir_Unix::getLastAccessTime() const
+    {
+        if (!m_bHasStat)
+            return 0;
+
+        return (long_t)m_FileStat.st_atime;
+    }
+
+    long_t Dir_Unix::getLastWriteTime() const
+    {
+        if (!m_bHasStat)
+            return 0;
+
+        return (long_t)m_FileStat.st_mtime;
+    }
+
+    bool Dir_Unix::makeDir(const String &strDir)
+    {
+        if (strDir.empty())
+            return false;
+
+        return (mkdir(strDir.c_str(), 0755) == 0);
+    }
+
+    bool Dir_Unix::removeDir(const String &strDir)
+    {
+        if (strDir.empty())
+            return false;
+
+        return (rmdir(strDir.c_str()) == 0);
+    }
+
+    bool Dir_Unix::remove(const String &strFileName)
+    {
+        if (strFileName.empty())
+            return false;
+
+        return (::remove(strFileName.c_str()) == 0);
+    }
+
+    bool Dir_Unix::exists(const String &strPath) const
+    {
+        if (strPath.empty())
+            return false;
+
+        return (access(strPath.c_str(), F_OK) == 0);
+    }
+
+    String Dir_Unix::getCachePath() const
+    {
+        char szBuf[PATH_MAX] = {0};
+        ssize_t nLength = readlink("/proc/self/exe", szBuf, sizeof(szBuf) - 1);
+
+        if (nLength <= 0)
+            return "./";
+
+        szBuf[nLength] = 0;
+
+        char *ptr = strrchr(szBuf, '/');
+        if (ptr != nullptr)
+        {
+            *(ptr + 1) = 0;
+        }
+
+        return String(szBuf);
+    }
+
+    String Dir_Unix::getAppPath() const
+    {
+        return getCachePath();
+    }
+
+    char Dir_Unix::getNativeSeparator() const
+    {
+        return '/';
+    }
+
+    void Dir_Unix::extractRoot(const String &strFilePath, String &strRoot, String &strPattern) const
+    {
+        size_t nPos = strFilePath.rfind('/');
+
+        if (nPos != String::npos)
+        {
+            strRoot = strFilePath.substr(0, nPos + 1);
+            strPattern = strFilePath.substr(nPos + 1);
+        }
+        else
+        {
+            strRoot = "";
+            strPattern = strFilePath;
+        }
+    }
+
+    void Dir_Unix::extractFileName(const String &strFilePath, String &strName, String &strTitle) const
+    {
+        strName = strFilePath;
+
+        size_t nPos = strName.rfind('.');
+        if (nPos == 0)
+            strTitle = "";
+        else
+            strTitle = strFilePath.substr(0, nPos);
+    }
+}
@@ -19,6 +19,7 @@
 
 #include "T3DDeviceInfo_Windows.h"
 #include "Adapter/T3DFactoryInterface.h"
+#include <windows.h>
 
 
 namespace Tiny3D
@@ -80,7 +81,38 @@ namespace Tiny3D
 
     int32_t DeviceInfo_Windows::getNumberOfProcessors() const
     {
-        return 1;
+        // 按物理核数计算，超线程的逻辑处理器共用一个核的执行单元
+        int32_t nCores = 0;
+        DWORD dwLength = 0;
+        GetLogicalProcessorInformation(nullptr, &dwLength);
+
+        if (dwLength > 0)
+        {
+            std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> infos(
+                dwLength / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+            if (GetLogicalProcessorInformation(&infos[0], &dwLength))
+            {
+                size_t i = 0;
+                while (i < infos.size())
+                {
+                    if (infos[i].Relationship == RelationProcessorCore)
+                    {
+                        ++nCores;
+                    }
+                    ++i;
+                }
+            }
+        }
+
+        if (nCores == 0)
+        {
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            nCores = (int32_t)info.dwNumberOfProcessors;
+        }
+
+        return nCores;
     }
 
     uint32_t DeviceInfo_Windows::getMemoryCapacity() const
@@ -24,6 +24,7 @@
 #include "Console/T3DConsole.h"
 #include "Device/T3DDeviceInfo.h"
 #include "Time/T3DRunLoop.h"
+#include "Time/T3DProfiler.h"
 
 
 namespace Tiny3D
@@ -36,6 +37,7 @@ namespace Tiny3D
         , m_pConsole(nullptr)
         , m_pDeviceInfo(nullptr)
         , m_pMainRunLoop(nullptr)
+        , m_pProfiler(nullptr)
     {
         m_pAdapterFactory = createAdapterFactory();
 
@@ -45,10 +47,12 @@ namespace Tiny3D
         m_pConsole = new Console(m_pAdapterFactory);
         m_pDeviceInfo = new DeviceInfo(m_pAdapterFactory);
         m_pMainRunLoop = new RunLoop();
+        m_pProfiler = new Profiler();
     }
 
     System::~System()
     {
+        T3D_SAFE_DELETE(m_pProfiler);
         T3D_SAFE_DELETE(m_pMainRunLoop);
         T3D_SAFE_DELETE(m_pConsole);
         T3D_SAFE_DELETE(m_pDeviceInfo);
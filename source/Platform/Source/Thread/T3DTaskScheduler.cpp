@@ -0,0 +1,672 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Thread/T3DTaskScheduler.h"
+#include "Device/T3DDeviceInfo.h"
+
+
+namespace Tiny3D
+{
+    TaskGroup::TaskGroup()
+        : m_unDependencies(0)
+        , m_bCompleting(false)
+        , m_unPending(1)
+        , m_bFinished(false)
+        , m_bClosed(false)
+    {
+
+    }
+
+    TaskGroup::~TaskGroup()
+    {
+        // 组里还有没完成的任务时不能销毁
+        T3D_ASSERT(isFinished() || (!m_bClosed && m_unPending.load() == 1));
+    }
+
+    void TaskGroup::reset()
+    {
+        T3D_ASSERT(isFinished() || (!m_bClosed && m_unPending.load() == 1));
+
+        m_continuations.clear();
+        m_successors.clear();
+        m_deferred.clear();
+        m_unDependencies = 0;
+        m_bCompleting = false;
+        m_unPending.store(1);
+        m_bFinished.store(false);
+        m_bClosed = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+
+    T3D_INIT_SINGLETON(TaskScheduler);
+
+    const uint32_t TaskScheduler::INVALID_THREAD_INDEX = 0xFFFFFFFF;
+
+    TaskScheduler::TaskScheduler()
+        : m_pQueueBuffer(nullptr)
+        , m_pQueues(nullptr)
+        , m_unThreadCount(1)
+        , m_unQueued(0)
+        , m_unMainQueued(0)
+        , m_unSleeping(0)
+        , m_bExiting(false)
+    {
+
+    }
+
+    TaskScheduler::~TaskScheduler()
+    {
+        shutdown();
+    }
+
+    uint32_t &TaskScheduler::threadIndex()
+    {
+        static thread_local uint32_t s_unIndex = INVALID_THREAD_INDEX;
+        return s_unIndex;
+    }
+
+    bool TaskScheduler::startup(int32_t nWorkers /* = -1 */)
+    {
+        if (m_pQueues != nullptr)
+            return false;
+
+        if (nWorkers < 0)
+        {
+            // 主线程加上工作线程正好用满所有核
+            int32_t nCores = 0;
+            DeviceInfo *pDevInfo = DeviceInfo::getInstancePtr();
+
+            if (pDevInfo != nullptr)
+            {
+                nCores = pDevInfo->getNumberOfProcessors();
+            }
+
+            if (nCores <= 0)
+            {
+                nCores = (int32_t)std::thread::hardware_concurrency();
+            }
+
+            nWorkers = (nCores > 1 ? nCores - 1 : 0);
+        }
+
+        m_unThreadCount = (uint32_t)nWorkers + 1;
+
+        // C++17之前new不保证超过默认对齐的要求，自己对齐到缓存行
+        const size_t align = alignof(WorkerQueue);
+        m_pQueueBuffer = new uint8_t[sizeof(WorkerQueue) * m_unThreadCount + align];
+        uintptr_t addr = ((uintptr_t)m_pQueueBuffer + align - 1) & ~(uintptr_t)(align - 1);
+        m_pQueues = (WorkerQueue *)addr;
+
+        uint32_t i = 0;
+        while (i < m_unThreadCount)
+        {
+            new (m_pQueues + i) WorkerQueue();
+            ++i;
+        }
+
+        m_bExiting.store(false);
+
+        threadIndex() = 0;
+
+        i = 1;
+        while (i < m_unThreadCount)
+        {
+            m_workers.push_back(std::thread(TaskScheduler::workerProcedure, this, i));
+            ++i;
+        }
+
+        return true;
+    }
+
+    void TaskScheduler::shutdown()
+    {
+        if (m_pQueues == nullptr)
+            return;
+
+        {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_bExiting.store(true);
+        }
+
+        m_wakeCond.notify_all();
+
+        ThreadArrayItr itr = m_workers.begin();
+        while (itr != m_workers.end())
+        {
+            itr->join();
+            ++itr;
+        }
+
+        m_workers.clear();
+
+        // 队列里剩下的任务在主线程上执行完
+        while (runOneTask(0))
+        {
+
+        }
+
+        threadIndex() = INVALID_THREAD_INDEX;
+
+        uint32_t i = 0;
+        while (i < m_unThreadCount)
+        {
+            m_pQueues[i].~WorkerQueue();
+            ++i;
+        }
+
+        delete []m_pQueueBuffer;
+        m_pQueueBuffer = nullptr;
+        m_pQueues = nullptr;
+        m_unThreadCount = 1;
+    }
+
+    uint32_t TaskScheduler::getThreadIndex() const
+    {
+        return (m_pQueues != nullptr ? threadIndex() : INVALID_THREAD_INDEX);
+    }
+
+    void TaskScheduler::workerProcedure(TaskScheduler *pScheduler, uint32_t unIndex)
+    {
+        threadIndex() = unIndex;
+
+        while (true)
+        {
+            if (pScheduler->runOneTask(unIndex))
+                continue;
+
+            std::unique_lock<std::mutex> lock(pScheduler->m_sleepMutex);
+
+            // 先登记挂起再检查任务数量，和提交任务时先增加任务数量再检查挂起数量对应，不会漏掉通知
+            pScheduler->m_unSleeping.fetch_add(1);
+
+            while (!pScheduler->m_bExiting.load() && pScheduler->m_unQueued.load() == 0)
+            {
+                pScheduler->m_wakeCond.wait(lock);
+            }
+
+            pScheduler->m_unSleeping.fetch_sub(1);
+
+            if (pScheduler->m_bExiting.load())
+                break;
+        }
+
+        threadIndex() = INVALID_THREAD_INDEX;
+    }
+
+    void TaskScheduler::submit(TaskProc pfnProc, void *pContext,
+        TaskGroup *pGroup /* = nullptr */, uint32_t unAffinity /* = E_AFFINITY_ANY */)
+    {
+        Task task = { pfnProc, nullptr, pContext, 0, 0, pGroup };
+
+        if (pGroup != nullptr)
+        {
+            T3D_ASSERT(!pGroup->isFinished());
+            pGroup->m_unPending.fetch_add(1);
+        }
+
+        enqueue(task, unAffinity);
+    }
+
+    void TaskScheduler::parallelFor(TaskGroup *pGroup, size_t unCount, size_t unGrain,
+        RangeTaskProc pfnProc, void *pContext)
+    {
+        T3D_ASSERT(pGroup != nullptr && !pGroup->isFinished());
+
+        if (unCount == 0)
+            return;
+
+        if (unGrain == 0)
+        {
+            // 每个线程大约分到4个任务，给偷任务留出余地
+            unGrain = unCount / (m_unThreadCount * 4);
+
+            if (unGrain == 0)
+            {
+                unGrain = 1;
+            }
+        }
+
+        size_t unTasks = (unCount + unGrain - 1) / unGrain;
+        pGroup->m_unPending.fetch_add((uint32_t)unTasks);
+
+        {
+            std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+
+            if (pGroup->m_unDependencies > 0)
+            {
+                size_t unBegin = 0;
+                while (unBegin < unCount)
+                {
+                    size_t unEnd = std::min(unBegin + unGrain, unCount);
+                    TaskGroup::DeferredTask deferred = { nullptr, pfnProc, pContext, unBegin, unEnd, E_AFFINITY_ANY };
+                    pGroup->m_deferred.push_back(deferred);
+                    unBegin = unEnd;
+                }
+
+                return;
+            }
+        }
+
+        if (m_pQueues == nullptr)
+        {
+            size_t unBegin = 0;
+            while (unBegin < unCount)
+            {
+                size_t unEnd = std::min(unBegin + unGrain, unCount);
+                Task task = { nullptr, pfnProc, pContext, unBegin, unEnd, pGroup };
+                execute(task);
+                unBegin = unEnd;
+            }
+
+            return;
+        }
+
+        uint32_t unIndex = threadIndex();
+        if (unIndex >= m_unThreadCount)
+        {
+            unIndex = 0;
+        }
+
+        {
+            // 一次放入所有区间任务，调用线程从队尾往前做，其他线程从队头偷
+            WorkerQueue &queue = m_pQueues[unIndex];
+            std::unique_lock<std::mutex> lock(queue.mutex);
+
+            size_t unBegin = 0;
+            while (unBegin < unCount)
+            {
+                size_t unEnd = std::min(unBegin + unGrain, unCount);
+                Task task = { nullptr, pfnProc, pContext, unBegin, unEnd, pGroup };
+                queue.tasks.push_back(task);
+                unBegin = unEnd;
+            }
+        }
+
+        m_unQueued.fetch_add((uint32_t)unTasks);
+        wakeup(true);
+    }
+
+    void TaskScheduler::parallelFor(size_t unCount, size_t unGrain, RangeTaskProc pfnProc, void *pContext)
+    {
+        if (unCount == 0)
+            return;
+
+        if (m_unThreadCount <= 1 || unCount == 1 || (unGrain > 0 && unCount <= unGrain))
+        {
+            pfnProc(pContext, 0, unCount);
+            return;
+        }
+
+        TaskGroup group;
+        parallelFor(&group, unCount, unGrain, pfnProc, pContext);
+        wait(&group);
+    }
+
+    void TaskScheduler::addDependency(TaskGroup *pGroup, TaskGroup *pPredecessor)
+    {
+        std::unique_lock<std::mutex> lock(pPredecessor->m_mutex);
+
+        // 依赖的组已经完成
+        if (pPredecessor->m_bCompleting)
+            return;
+
+        pPredecessor->m_successors.push_back(pGroup);
+
+        std::unique_lock<std::mutex> lockGroup(pGroup->m_mutex);
+        ++pGroup->m_unDependencies;
+
+        // 依赖也算作一个没完成的任务，依赖没完成前组不会完成
+        pGroup->m_unPending.fetch_add(1);
+    }
+
+    void TaskScheduler::continueWith(TaskGroup *pGroup, TaskProc pfnProc, void *pContext,
+        TaskGroup *pTarget /* = nullptr */, uint32_t unAffinity /* = E_AFFINITY_ANY */)
+    {
+        if (pTarget != nullptr)
+        {
+            T3D_ASSERT(!pTarget->isFinished());
+            pTarget->m_unPending.fetch_add(1);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+
+            if (!pGroup->m_bCompleting)
+            {
+                TaskGroup::Continuation continuation = { pfnProc, pContext, pTarget, unAffinity };
+                pGroup->m_continuations.push_back(continuation);
+                return;
+            }
+        }
+
+        Task task = { pfnProc, nullptr, pContext, 0, 0, pTarget };
+        enqueue(task, unAffinity);
+    }
+
+    void TaskScheduler::close(TaskGroup *pGroup)
+    {
+        if (!pGroup->m_bClosed)
+        {
+            pGroup->m_bClosed = true;
+            finish(pGroup);
+        }
+    }
+
+    void TaskScheduler::wait(TaskGroup *pGroup)
+    {
+        close(pGroup);
+
+        uint32_t unIndex = getThreadIndex();
+
+        if (unIndex == INVALID_THREAD_INDEX)
+        {
+            // 不是调度器的线程，不执行任务，只等组完成
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_unSleeping.fetch_add(1);
+
+            while (!pGroup->m_bFinished.load())
+            {
+                m_doneCond.wait(lock);
+            }
+
+            m_unSleeping.fetch_sub(1);
+            return;
+        }
+
+        while (!pGroup->isFinished())
+        {
+            if (runOneTask(unIndex))
+                continue;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_unSleeping.fetch_add(1);
+
+            while (!pGroup->m_bFinished.load() && m_unQueued.load() == 0
+                && (unIndex != 0 || m_unMainQueued.load() == 0))
+            {
+                m_wakeCond.wait(lock);
+            }
+
+            m_unSleeping.fetch_sub(1);
+        }
+    }
+
+    void TaskScheduler::executeMainThreadTasks()
+    {
+        if (m_pQueues == nullptr)
+            return;
+
+        T3D_ASSERT(isMainThread());
+
+        // 只执行调用时已经在队列里的任务，任务里再提交的主线程任务留到下一次
+        uint32_t unCount = m_unMainQueued.load();
+
+        while (unCount > 0 && runMainTask())
+        {
+            --unCount;
+        }
+
+        if (m_workers.empty())
+        {
+            while (runOneTask(0))
+            {
+
+            }
+        }
+    }
+
+    void TaskScheduler::enqueue(const Task &task, uint32_t unAffinity)
+    {
+        TaskGroup *pGroup = task.pGroup;
+
+        if (pGroup != nullptr)
+        {
+            std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+
+            if (pGroup->m_unDependencies > 0)
+            {
+                TaskGroup::DeferredTask deferred = { task.pfnProc, task.pfnRange,
+                    task.pContext, task.unBegin, task.unEnd, unAffinity };
+                pGroup->m_deferred.push_back(deferred);
+                return;
+            }
+        }
+
+        push(task, unAffinity);
+    }
+
+    void TaskScheduler::push(const Task &task, uint32_t unAffinity)
+    {
+        if (m_pQueues == nullptr)
+        {
+            execute(task);
+            return;
+        }
+
+        if (unAffinity == E_AFFINITY_MAIN)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mainMutex);
+                m_mainTasks.push_back(task);
+            }
+
+            m_unMainQueued.fetch_add(1);
+
+            // 只有主线程能执行，唤醒全部才能保证主线程被唤醒
+            wakeup(true);
+            return;
+        }
+
+        uint32_t unIndex = threadIndex();
+        if (unIndex >= m_unThreadCount)
+        {
+            unIndex = 0;
+        }
+
+        {
+            WorkerQueue &queue = m_pQueues[unIndex];
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(task);
+        }
+
+        m_unQueued.fetch_add(1);
+        wakeup(false);
+    }
+
+    bool TaskScheduler::runMainTask()
+    {
+        Task task;
+        bool bFound = false;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mainMutex);
+
+            if (!m_mainTasks.empty())
+            {
+                task = m_mainTasks.front();
+                m_mainTasks.pop_front();
+                bFound = true;
+            }
+        }
+
+        if (bFound)
+        {
+            m_unMainQueued.fetch_sub(1);
+            execute(task);
+        }
+
+        return bFound;
+    }
+
+    bool TaskScheduler::runOneTask(uint32_t unIndex)
+    {
+        Task task;
+        bool bFound = false;
+
+        {
+            // 自己的队列从队尾取，刚放进去的任务数据还在缓存里
+            WorkerQueue &queue = m_pQueues[unIndex];
+            std::unique_lock<std::mutex> lock(queue.mutex);
+
+            if (!queue.tasks.empty())
+            {
+                task = queue.tasks.back();
+                queue.tasks.pop_back();
+                bFound = true;
+            }
+        }
+
+        if (!bFound && unIndex == 0 && m_unMainQueued.load(std::memory_order_relaxed) > 0)
+        {
+            if (runMainTask())
+                return true;
+        }
+
+        if (!bFound && m_unQueued.load(std::memory_order_relaxed) > 0)
+        {
+            // 从其他线程的队头偷，偷到的是最早放进去的任务，通常也是最大的一块
+            uint32_t i = 1;
+            while (!bFound && i < m_unThreadCount)
+            {
+                WorkerQueue &victim = m_pQueues[(unIndex + i) % m_unThreadCount];
+                std::unique_lock<std::mutex> lock(victim.mutex);
+
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    bFound = true;
+                }
+
+                ++i;
+            }
+        }
+
+        if (bFound)
+        {
+            m_unQueued.fetch_sub(1);
+            execute(task);
+        }
+
+        return bFound;
+    }
+
+    void TaskScheduler::execute(const Task &task)
+    {
+        if (task.pfnRange != nullptr)
+        {
+            task.pfnRange(task.pContext, task.unBegin, task.unEnd);
+        }
+        else
+        {
+            task.pfnProc(task.pContext);
+        }
+
+        finish(task.pGroup);
+    }
+
+    void TaskScheduler::finish(TaskGroup *pGroup)
+    {
+        if (pGroup != nullptr && pGroup->m_unPending.fetch_sub(1) == 1)
+        {
+            complete(pGroup);
+        }
+    }
+
+    void TaskScheduler::complete(TaskGroup *pGroup)
+    {
+        TaskGroup::Continuations continuations;
+        TaskGroup::TaskGroups successors;
+
+        {
+            std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+            pGroup->m_bCompleting = true;
+            continuations.swap(pGroup->m_continuations);
+            successors.swap(pGroup->m_successors);
+        }
+
+        TaskGroup::ContinuationsItr itr = continuations.begin();
+        while (itr != continuations.end())
+        {
+            Task task = { itr->pfnProc, nullptr, itr->pContext, 0, 0, itr->pGroup };
+            enqueue(task, itr->unAffinity);
+            ++itr;
+        }
+
+        TaskGroup::TaskGroupsItr i = successors.begin();
+        while (i != successors.end())
+        {
+            release(*i);
+            ++i;
+        }
+
+        // 这是最后一次访问组，等待的线程看到完成标记后就可以销毁组了
+        pGroup->m_bFinished.store(true);
+
+        wakeup(true);
+    }
+
+    void TaskScheduler::release(TaskGroup *pGroup)
+    {
+        TaskGroup::DeferredTasks deferred;
+
+        {
+            std::unique_lock<std::mutex> lock(pGroup->m_mutex);
+            --pGroup->m_unDependencies;
+
+            if (pGroup->m_unDependencies == 0)
+            {
+                deferred.swap(pGroup->m_deferred);
+            }
+        }
+
+        TaskGroup::DeferredTasksItr itr = deferred.begin();
+        while (itr != deferred.end())
+        {
+            Task task = { itr->pfnProc, itr->pfnRange, itr->pContext, itr->unBegin, itr->unEnd, pGroup };
+            push(task, itr->unAffinity);
+            ++itr;
+        }
+
+        // 结算添加依赖时计入的任务数
+        finish(pGroup);
+    }
+
+    void TaskScheduler::wakeup(bool bAll)
+    {
+        if (m_unSleeping.load() == 0)
+            return;
+
+        {
+            // 挂起的线程在持有互斥量期间检查条件，这里加锁一次保证通知不会在检查和挂起之间丢失
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+        }
+
+        if (bAll)
+        {
+            m_wakeCond.notify_all();
+            m_doneCond.notify_all();
+        }
+        else
+        {
+            m_wakeCond.notify_one();
+        }
+    }
+}
@@ -0,0 +1,232 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "Time/T3DProfiler.h"
+#include "IO/T3DFileDataStream.h"
+#include <chrono>
+
+
+namespace Tiny3D
+{
+    T3D_INIT_SINGLETON(Profiler);
+
+    std::atomic<uint32_t> Profiler::m_unNextGeneration(1);
+
+    Profiler::Profiler(size_t unZonesPerThread /* = 32768 */, uint32_t unMaxFrames /* = 300 */)
+        : m_unZonesPerThread(unZonesPerThread)
+        , m_pFrameStarts(nullptr)
+        , m_unMaxFrames(unMaxFrames)
+        , m_unFrameIndex(0)
+        , m_bEnabled(true)
+        , m_unGeneration(m_unNextGeneration.fetch_add(1))
+    {
+        m_pFrameStarts = new std::atomic<uint64_t>[m_unMaxFrames + 1];
+
+        uint32_t i = 0;
+        for (i = 0; i <= m_unMaxFrames; ++i)
+        {
+            m_pFrameStarts[i].store(0, std::memory_order_relaxed);
+        }
+
+        m_pFrameStarts[0].store(now(), std::memory_order_relaxed);
+    }
+
+    Profiler::~Profiler()
+    {
+        ThreadBuffersItr itr = m_buffers.begin();
+        while (itr != m_buffers.end())
+        {
+            ThreadBuffer *buffer = *itr;
+            T3D_SAFE_DELETE_ARRAY(buffer->pZones);
+            T3D_SAFE_DELETE(buffer);
+            ++itr;
+        }
+
+        m_buffers.clear();
+
+        T3D_SAFE_DELETE_ARRAY(m_pFrameStarts);
+    }
+
+    uint64_t Profiler::now()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Profiler::ThreadBuffer *Profiler::getThreadBuffer()
+    {
+        // 记下所属分析器的代数，不记指针，分析器销毁后在同一地址重建也能识别出来重新注册
+        static thread_local uint32_t s_unOwner = 0;
+        static thread_local ThreadBuffer *s_pBuffer = nullptr;
+
+        if (s_unOwner != m_unGeneration)
+        {
+            ThreadBuffer *buffer = new ThreadBuffer();
+            buffer->pZones = new ZoneSlot[m_unZonesPerThread];
+            buffer->unCapacity = m_unZonesPerThread;
+            buffer->ullWritten.store(0);
+            buffer->unDepth = 0;
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                buffer->unThreadID = (uint32_t)m_buffers.size();
+                m_buffers.push_back(buffer);
+            }
+
+            s_unOwner = m_unGeneration;
+            s_pBuffer = buffer;
+        }
+
+        return s_pBuffer;
+    }
+
+    uint64_t Profiler::endFrame()
+    {
+        uint64_t end = now();
+        uint32_t index = m_unFrameIndex.load(std::memory_order_relaxed);
+        size_t count = m_unMaxFrames + 1;
+        uint64_t begin = m_pFrameStarts[index % count].load(std::memory_order_relaxed);
+
+        // 整帧也作为一个区段记录在主线程上，方便在时间线上分帧
+        if (isEnabled())
+        {
+            ThreadBuffer *buffer = getThreadBuffer();
+            buffer->push("Frame", begin, end, 0);
+        }
+
+        m_pFrameStarts[(index + 1) % count].store(end, std::memory_order_relaxed);
+        m_unFrameIndex.store(index + 1, std::memory_order_release);
+
+        return end - begin;
+    }
+
+    void Profiler::collectZones(const ThreadBuffer *pBuffer, uint64_t ullSince, Zones &zones)
+    {
+        uint64_t written = pBuffer->ullWritten.load(std::memory_order_acquire);
+        uint64_t first = (written > pBuffer->unCapacity ? written - pBuffer->unCapacity : 0);
+        size_t start = zones.size();
+
+        uint64_t i = first;
+        while (i < written)
+        {
+            const ZoneSlot &slot = pBuffer->pZones[i % pBuffer->unCapacity];
+            Zone zone;
+            zone.szName = slot.szName.load(std::memory_order_relaxed);
+            zone.ullBegin = slot.ullBegin.load(std::memory_order_relaxed);
+            zone.ullEnd = slot.ullEnd.load(std::memory_order_relaxed);
+            zone.unDepth = slot.unDepth.load(std::memory_order_relaxed);
+            zones.push_back(zone);
+            ++i;
+        }
+
+        // 复制过程中所属线程可能覆盖了最前面的记录，丢弃这部分，
+        // 第latest条记录可能正在写入，它占用的是第latest - capacity条的位置，也要丢弃。
+        // acquire屏障和push里的release屏障配对，读到新字段的话这里一定读到更新后的写入数
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t latest = pBuffer->ullWritten.load(std::memory_order_relaxed);
+        if (latest + 1 > pBuffer->unCapacity + first)
+        {
+            uint64_t dropped = std::min(latest + 1 - pBuffer->unCapacity - first, written - first);
+            zones.erase(zones.begin() + start, zones.begin() + start + (size_t)dropped);
+        }
+
+        // 去掉导出范围之前结束的记录
+        size_t j = start;
+        i = start;
+        while (i < zones.size())
+        {
+            if (zones[i].ullEnd >= ullSince)
+            {
+                zones[j++] = zones[i];
+            }
+            ++i;
+        }
+
+        zones.resize(j);
+    }
+
+    void Profiler::exportChromeTrace(String &json, uint32_t unFrames) const
+    {
+        uint32_t index = getFrameIndex();
+        uint32_t frames = std::min(std::min(unFrames, index), m_unMaxFrames);
+        uint64_t since = m_pFrameStarts[(index - frames) % (m_unMaxFrames + 1)].load(std::memory_order_relaxed);
+
+        ThreadBuffers buffers;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            buffers = m_buffers;
+        }
+
+        char line[512];
+        Zones zones;
+
+        json = "{\"traceEvents\":[\n";
+        bool isFirst = true;
+
+        ThreadBuffersConstItr itr = buffers.begin();
+        while (itr != buffers.end())
+        {
+            const ThreadBuffer *buffer = *itr;
+
+            snprintf(line, sizeof(line),
+                "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}}",
+                isFirst ? "" : ",\n", buffer->unThreadID, buffer->unThreadID);
+            json += line;
+            isFirst = false;
+
+            zones.clear();
+            collectZones(buffer, since, zones);
+
+            ZonesConstItr i = zones.begin();
+            while (i != zones.end())
+            {
+                const Zone &zone = *i;
+
+                // 时间戳以导出的第一帧开始为0点，单位微秒
+                double ts = double(int64_t(zone.ullBegin - since)) / 1000.0;
+                double dur = double(zone.ullEnd - zone.ullBegin) / 1000.0;
+
+                snprintf(line, sizeof(line),
+                    ",\n{\"name\":\"%s\",\"cat\":\"Tiny3D\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+                    zone.szName, buffer->unThreadID, ts, dur, zone.unDepth);
+                json += line;
+                ++i;
+            }
+
+            ++itr;
+        }
+
+        json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    bool Profiler::dumpChromeTrace(const String &path, uint32_t unFrames) const
+    {
+        String json;
+        exportChromeTrace(json, unFrames);
+
+        FileDataStream fs;
+        if (!fs.open(path.c_str(), FileDataStream::E_MODE_WRITE_ONLY|FileDataStream::E_MODE_TRUNCATE|FileDataStream::E_MODE_TEXT))
+            return false;
+
+        size_t ret = fs.write((void *)json.c_str(), json.length());
+        fs.close();
+
+        return (ret == json.length());
+    }
+}
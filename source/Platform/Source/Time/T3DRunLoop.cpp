@@ -106,11 +106,11 @@ namespace Tiny3D
 
                     if (!info.bRepeat)
                     {
-                        /// ѭôɾ
+                        /// 不循环，那么就删掉咯
                         info.bAlive = false;
                     }
 
-                    /// ص
+                    /// 回调
                     info.pObserver->onExecute(unLoopID, dt);
                 }
             }
@@ -118,7 +118,7 @@ namespace Tiny3D
             ++itr;
         }
 
-        // ɾѾͣ
+        // 删除所有已经停掉的
         itr = m_infos.begin();
 
         while (itr != m_infos.end())
@@ -0,0 +1,44 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_RENDERER_COMMON_PREREQUISITES_H__
+#define __T3D_RENDERER_COMMON_PREREQUISITES_H__
+
+
+#include <T3DPlatform.h>
+#include <T3DLog.h>
+#include <Tiny3D.h>
+
+
+// 数据放在系统内存的渲染器共用的类，编译成静态库链接到各个渲染器插件里，不需要导出
+
+
+namespace Tiny3D
+{
+    class MemoryHardwareVertexBuffer;
+    class MemoryHardwareIndexBuffer;
+    class MemoryHardwarePixelBuffer;
+    class MemoryHardwareBufferManager;
+    class MemoryVertexDeclaration;
+    class EmptyWindowEventHandler;
+    class RendererPlugin;
+}
+
+
+#endif  /*__T3D_RENDERER_COMMON_PREREQUISITES_H__*/
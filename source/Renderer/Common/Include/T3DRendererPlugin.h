@@ -0,0 +1,59 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_RENDERER_PLUGIN_H__
+#define __T3D_RENDERER_PLUGIN_H__
+
+
+#include "T3DRendererCommonPrerequisites.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 渲染器插件基类，安装时创建渲染器，没有窗口事件处理时顺便装一个空的
+     * @note 子类只需要提供插件名称和创建渲染器，插件的导出函数还是各个插件自己实现
+     */
+    class RendererPlugin : public Plugin
+    {
+    public:
+        RendererPlugin(const String &name);
+        virtual ~RendererPlugin();
+
+        virtual const String &getName() const override;
+
+        virtual bool install() override;
+        virtual bool startup() override;
+        virtual void shutdown() override;
+        virtual void uninstall() override;
+
+    protected:
+        /**
+         * @brief 创建插件的渲染器
+         */
+        virtual Renderer *createRenderer() = 0;
+
+        String              mName;
+        Renderer            *mRenderer;
+        WindowEventHandler  *mWinEventHandler;
+    };
+}
+
+
+#endif  /*__T3D_RENDERER_PLUGIN_H__*/
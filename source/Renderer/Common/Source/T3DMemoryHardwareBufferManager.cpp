@@ -0,0 +1,91 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DMemoryHardwareBufferManager.h"
+#include "T3DMemoryHardwareVertexBuffer.h"
+#include "T3DMemoryHardwareIndexBuffer.h"
+#include "T3DMemoryHardwarePixelBuffer.h"
+#include "T3DMemoryVertexDeclaration.h"
+
+
+namespace Tiny3D
+{
+    MemoryHardwareBufferManager::MemoryHardwareBufferManager()
+        : HardwareBufferManagerBase()
+    {
+
+    }
+
+    MemoryHardwareBufferManager::~MemoryHardwareBufferManager()
+    {
+
+    }
+
+    HardwareVertexBufferPtr MemoryHardwareBufferManager::createVertexBuffer(
+        size_t vertexSize, size_t vertexCount, HardwareBuffer::Usage usage,
+        bool useShadowBuffer)
+    {
+        // 数据本来就在系统内存里，影子缓存没有意义
+        MemoryHardwareVertexBuffer *vertexBuffer = new MemoryHardwareVertexBuffer(
+            vertexSize, vertexCount, usage, true, false);
+
+        HardwareVertexBufferPtr ptr(vertexBuffer);
+        mVertexBuffers.insert(ptr);
+        vertexBuffer->release();
+
+        return ptr;
+    }
+
+    HardwareIndexBufferPtr MemoryHardwareBufferManager::createIndexBuffer(
+        HardwareIndexBuffer::Type indexType, size_t indexCount,
+        HardwareBuffer::Usage usage, bool useShadowBuffer)
+    {
+        MemoryHardwareIndexBuffer *indexBuffer = new MemoryHardwareIndexBuffer(
+            indexType, indexCount, usage, true, false);
+
+        HardwareIndexBufferPtr ptr(indexBuffer);
+        mIndexBuffers.insert(ptr);
+        indexBuffer->release();
+
+        return ptr;
+    }
+
+    HardwarePixelBufferPtr MemoryHardwareBufferManager::createPixelBuffer(
+        uint32_t width, uint32_t height, PixelFormat format,
+        HardwareBuffer::Usage usage, bool useShadowBuffer)
+    {
+        MemoryHardwarePixelBuffer *pixelBuffer = new MemoryHardwarePixelBuffer(
+            width, height, format, usage, true, false);
+
+        HardwarePixelBufferPtr ptr(pixelBuffer);
+        mPixelBuffers.insert(ptr);
+        pixelBuffer->release();
+
+        return ptr;
+    }
+
+    VertexDeclarationPtr MemoryHardwareBufferManager::createVertexDeclaration()
+    {
+        MemoryVertexDeclaration *decl = new MemoryVertexDeclaration();
+        VertexDeclarationPtr ptr(decl);
+        decl->release();
+
+        return ptr;
+    }
+}
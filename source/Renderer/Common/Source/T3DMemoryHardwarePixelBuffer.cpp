@@ -0,0 +1,253 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DMemoryHardwarePixelBuffer.h"
+
+
+namespace Tiny3D
+{
+    MemoryHardwarePixelBuffer::MemoryHardwarePixelBuffer(
+        uint32_t width, uint32_t height, PixelFormat format,
+        HardwareBuffer::Usage usage, bool useSystemMemory, bool useShadowBuffer)
+        : HardwarePixelBuffer(width, height, format, usage, useSystemMemory, useShadowBuffer)
+        , mData(nullptr)
+        , mBytesPerPixel(0)
+    {
+        mBytesPerPixel = Image::getBPP(mFormat) / 8;
+        mBufferSize = mPitch * mHeight;
+        mData = new uint8_t[mBufferSize];
+        memset(mData, 0, mBufferSize);
+    }
+
+    MemoryHardwarePixelBuffer::~MemoryHardwarePixelBuffer()
+    {
+        T3D_SAFE_DELETE_ARRAY(mData);
+    }
+
+    void *MemoryHardwarePixelBuffer::lockImpl(const Rect &rect, LockOptions options, int32_t &lockedPitch)
+    {
+        if (mData == nullptr)
+            return nullptr;
+
+        lockedPitch = (int32_t)mPitch;
+        return mData + rect.top * mPitch + rect.left * mBytesPerPixel;
+    }
+
+    void MemoryHardwarePixelBuffer::unlockImpl()
+    {
+
+    }
+
+    bool MemoryHardwarePixelBuffer::readImage(const Image &image, Rect *srcRect/* = nullptr*/, Rect *dstRect/* = nullptr*/)
+    {
+        bool ret = false;
+
+        uint8_t *dst = nullptr;
+
+        do 
+        {
+            int32_t bpp = Image::getBPP(mFormat);
+            Image temp;
+            int32_t dstPitch = 0;
+            Rect rtDst;
+
+            if (dstRect == nullptr)
+            {
+                rtDst = Rect(0, 0, mWidth - 1, mHeight - 1);
+            }
+            else
+            {
+                rtDst = *dstRect;
+            }
+
+            dst = (uint8_t *)lock(rtDst, E_HBL_WRITE_ONLY, dstPitch);
+            if (dst == nullptr)
+            {
+                break;
+            }
+
+            // 临时构造一个图像对象，直接引用像素缓冲的内存
+            if (!temp.load(dst, rtDst.width(), rtDst.height(), bpp, dstPitch, mFormat))
+            {
+                break;
+            }
+
+            // 复制图像数据到像素缓冲
+            if (!temp.copy(image, srcRect))
+            {
+                break;
+            }
+
+            ret = true;
+        } while (0);
+
+        if (dst != nullptr)
+        {
+            unlock();
+            dst = nullptr;
+        }
+
+        return ret;
+    }
+
+    bool MemoryHardwarePixelBuffer::writeImage(Image &image, Rect *dstRect/* = nullptr*/, Rect *srcRect/* = nullptr*/)
+    {
+        bool ret = false;
+
+        uint8_t *src = nullptr;
+
+        do 
+        {
+            int32_t bpp = Image::getBPP(mFormat);
+            Image temp;
+            int32_t srcPitch = 0;
+            Rect rtSrc;
+
+            if (srcRect == nullptr)
+            {
+                rtSrc = Rect(0, 0, mWidth - 1, mHeight - 1);
+            }
+            else
+            {
+                rtSrc = *srcRect;
+            }
+
+            src = (uint8_t *)lock(rtSrc, E_HBL_READ_ONLY, srcPitch);
+            if (src == nullptr)
+            {
+                break;
+            }
+
+            // 临时构造一个图像对象，直接引用像素缓冲的内存
+            if (!temp.load(src, rtSrc.width(), rtSrc.height(), bpp, srcPitch, mFormat))
+            {
+                break;
+            }
+
+            // 复制像素缓冲数据到图像
+            if (!image.copy(temp, nullptr, dstRect))
+            {
+                break;
+            }
+
+            ret = true;
+        } while (0);
+
+        if (src != nullptr)
+        {
+            unlock();
+            src = nullptr;
+        }
+
+        return ret;
+    }
+
+    uint32_t MemoryHardwarePixelBuffer::sample(float u, float v) const
+    {
+        if (mData == nullptr || mWidth == 0 || mHeight == 0)
+            return 0xFFFFFFFF;
+
+        u -= std::floor(u);
+        v -= std::floor(v);
+
+        uint32_t x = uint32_t(u * mWidth);
+        uint32_t y = uint32_t(v * mHeight);
+
+        if (x >= mWidth)
+            x = mWidth - 1;
+        if (y >= mHeight)
+            y = mHeight - 1;
+
+        return toA8R8G8B8(mData + y * mPitch + x * mBytesPerPixel, mFormat);
+    }
+
+    uint32_t MemoryHardwarePixelBuffer::toA8R8G8B8(const uint8_t *pixel, PixelFormat format)
+    {
+        uint32_t color = 0xFFFFFFFF;
+
+        switch (format)
+        {
+        case E_PF_A8R8G8B8:
+            {
+                color = *(const uint32_t *)pixel;
+            }
+            break;
+        case E_PF_X8R8G8B8:
+            {
+                color = *(const uint32_t *)pixel | 0xFF000000;
+            }
+            break;
+        case E_PF_B8G8R8A8:
+            {
+                color = (uint32_t(pixel[0]) << 24) | (uint32_t(pixel[1]) << 16)
+                    | (uint32_t(pixel[2]) << 8) | uint32_t(pixel[3]);
+            }
+            break;
+        case E_PF_B8G8R8X8:
+            {
+                color = 0xFF000000 | (uint32_t(pixel[1]) << 16)
+                    | (uint32_t(pixel[2]) << 8) | uint32_t(pixel[3]);
+            }
+            break;
+        case E_PF_R8G8B8:
+            {
+                // 和A8R8G8B8一样按小端存放，内存里依次是B、G、R
+                color = 0xFF000000 | (uint32_t(pixel[2]) << 16)
+                    | (uint32_t(pixel[1]) << 8) | uint32_t(pixel[0]);
+            }
+            break;
+        case E_PF_B8G8R8:
+            {
+                color = 0xFF000000 | (uint32_t(pixel[0]) << 16)
+                    | (uint32_t(pixel[1]) << 8) | uint32_t(pixel[2]);
+            }
+            break;
+        case E_PF_R5G6B5:
+            {
+                uint32_t c = *(const uint16_t *)pixel;
+                color = 0xFF000000 | (((c >> 11) & 0x1F) * 255 / 31) << 16
+                    | (((c >> 5) & 0x3F) * 255 / 63) << 8 | ((c & 0x1F) * 255 / 31);
+            }
+            break;
+        case E_PF_A1R5G5B5:
+            {
+                uint32_t c = *(const uint16_t *)pixel;
+                color = ((c & 0x8000) ? 0xFF000000 : 0) | (((c >> 10) & 0x1F) * 255 / 31) << 16
+                    | (((c >> 5) & 0x1F) * 255 / 31) << 8 | ((c & 0x1F) * 255 / 31);
+            }
+            break;
+        case E_PF_A4R4G4B4:
+            {
+                uint32_t c = *(const uint16_t *)pixel;
+                color = (((c >> 12) & 0xF) * 17) << 24 | (((c >> 8) & 0xF) * 17) << 16
+                    | (((c >> 4) & 0xF) * 17) << 8 | ((c & 0xF) * 17);
+            }
+            break;
+        case E_PF_PALETTE8:
+            {
+                color = 0xFF000000 | (uint32_t(pixel[0]) * 0x010101);
+            }
+            break;
+        default:
+            break;
+        }
+
+        return color;
+    }
+}
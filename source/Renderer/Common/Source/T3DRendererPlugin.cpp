@@ -0,0 +1,84 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DRendererPlugin.h"
+#include "T3DEmptyWindowEventHandler.h"
+
+
+namespace Tiny3D
+{
+    RendererPlugin::RendererPlugin(const String &name)
+        : mName(name)
+        , mRenderer(nullptr)
+        , mWinEventHandler(nullptr)
+    {
+
+    }
+
+    RendererPlugin::~RendererPlugin()
+    {
+
+    }
+
+    const String &RendererPlugin::getName() const
+    {
+        return mName;
+    }
+
+    bool RendererPlugin::install()
+    {
+        mRenderer = createRenderer();
+        Entrance::getInstance().addRenderer(mRenderer);
+
+        // 和其他渲染器插件一起加载时，保留其他插件的窗口事件处理
+        if (Entrance::getInstance().getWindowEventHandler() == nullptr)
+        {
+            mWinEventHandler = new EmptyWindowEventHandler();
+            Entrance::getInstance().setWindowEventHandler(mWinEventHandler);
+        }
+
+        return true;
+    }
+
+    bool RendererPlugin::startup()
+    {
+        return true;
+    }
+
+    void RendererPlugin::shutdown()
+    {
+
+    }
+
+    void RendererPlugin::uninstall()
+    {
+        Entrance::getInstance().removeRenderer(mRenderer);
+        T3D_SAFE_RELEASE(mRenderer);
+
+        if (mWinEventHandler != nullptr)
+        {
+            if (Entrance::getInstance().getWindowEventHandler() == mWinEventHandler)
+            {
+                Entrance::getInstance().setWindowEventHandler(nullptr);
+            }
+
+            T3D_SAFE_DELETE(mWinEventHandler);
+        }
+    }
+}
@@ -51,37 +51,38 @@ namespace Tiny3D
         virtual bool queryCapability(Capability cap) override;
         virtual void enableCapability(Capability cap, bool enabled = true) override;
 
-        virtual void setTransform(TransformState state, const Matrix4 &mat) override;
-
-        virtual const Matrix4 &getTransform(TransformState state) const override;
-
         virtual void setLightEnabled(bool enable) override;
         virtual void setAmbientLight(const Color4 &ambient) override;
         virtual void addDynamicLight(size_t index, const SGLightPtr light) override;
         virtual void removeDynamicLight(size_t index) override;
         virtual void removeAllDynamicLights() override;
 
-        virtual void setMaterial(const MaterialPtr &material) override;
+        virtual void setViewport(const ViewportPtr &viewport) override;
 
-        virtual void setCullingMode(CullingMode mode) override;
-        virtual void setRenderMode(RenderMode mode) override;
+        LPDIRECT3D9 getD3D()  { return mD3D; }
 
-        virtual void setViewport(const ViewportPtr &viewport) override;
+        LPDIRECT3DDEVICE9 getD3DDevice()    { return mD3DDevice; }
+        void setD3DDevice(LPDIRECT3DDEVICE9 d3dDevice) { mD3DDevice = d3dDevice; }
+
+    protected:
+        virtual void setTransformImpl(TransformState state, const Matrix4 &mat) override;
 
-        virtual void drawVertexList(PrimitiveType primitiveType, 
+        virtual void setMaterialImpl(const MaterialPtr &material) override;
+
+        virtual void setCullingModeImpl(CullingMode mode) override;
+        virtual void setRenderModeImpl(RenderMode mode) override;
+
+        virtual void bindVertexDataImpl(const VertexDataPtr &vertexData) override;
+        virtual void bindIndexDataImpl(const IndexDataPtr &indexData) override;
+
+        virtual void drawVertexListImpl(PrimitiveType primitiveType, 
             const VertexDataPtr &vertexData, uint32_t startIdx, 
             uint32_t primitiveCount) override;
 
-        virtual void drawIndexList(PrimitiveType primitiveType, 
+        virtual void drawIndexListImpl(PrimitiveType primitiveType, 
             const VertexDataPtr &vertexData, const IndexDataPtr &indexData, 
             uint32_t startIdx, uint32_t pritimitiveCount) override;
 
-        LPDIRECT3D9 getD3D()  { return mD3D; }
-
-        LPDIRECT3DDEVICE9 getD3DDevice()    { return mD3DDevice; }
-        void setD3DDevice(LPDIRECT3DDEVICE9 d3dDevice) { mD3DDevice = d3dDevice; }
-
-    protected:
         virtual void makeProjectionMatrix(const Radian &rkFovY, Real aspect, 
             Real nearDist, Real farDist, bool ortho, Matrix4 &mat) override;
 
@@ -89,9 +90,9 @@ namespace Tiny3D
 
         virtual void updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount) override;
 
-        /// תD3D
+        /// 转换成D3D矩阵
         D3DMATRIX toD3DMatrix(const Matrix4 &mat) const;
-        /// תT3D
+        /// 转换成T3D矩阵
         Matrix4 toT3DMatrix(const D3DMATRIX &mat) const;
 
     protected:
@@ -103,7 +104,7 @@ namespace Tiny3D
         HardwareBufferManager       *mHardwareBufferMgr;
         D3D9HardwareBufferManager   *mD3DHwBufferMgr;
 
-        Material            *mMaterial;     /// һȾĲ
+        Material            *mMaterial;     /// 最后一次渲染的材质
     };
 
     #define D3D9_RENDERER           (D3D9Renderer::getInstance())
@@ -137,7 +137,7 @@ namespace Tiny3D
 
     }
 
-    void D3D9Renderer::setTransform(TransformState state, const Matrix4 &mat)
+    void D3D9Renderer::setTransformImpl(TransformState state, const Matrix4 &mat)
     {
         HRESULT hr;
 
@@ -172,12 +172,6 @@ namespace Tiny3D
         }
     }
 
-    const Matrix4 &D3D9Renderer::getTransform(TransformState state) const
-    {
-//         mD3DDevice->GetTransform(D3DTS_WORLD, &d3dmat);
-        return Matrix4::IDENTITY;
-    }
-
     void D3D9Renderer::setLightEnabled(bool enable)
     {
         HRESULT hr = mD3DDevice->SetRenderState(D3DRS_LIGHTING, enable);
@@ -222,56 +216,49 @@ namespace Tiny3D
 
     }
 
-    void D3D9Renderer::setMaterial(const MaterialPtr &material)
+    void D3D9Renderer::setMaterialImpl(const MaterialPtr &material)
     {
-        if (mMaterial != material)
+        if (material != nullptr && mRenderMode == E_RM_SOLID)
         {
-            if (material != nullptr && mRenderMode == E_RM_SOLID)
+            const Color4 &ambient = material->getAmbientColor();
+            const Color4 &diffuse = material->getDiffuseColor();
+            const Color4 &specular = material->getSpecularColor();
+            const Color4 &emissive = material->getEmissiveColor();
+            Real shininess = material->getShininess();
+
+            D3DMATERIAL9 d3dmat;
+            d3dmat.Ambient = D3D9Mappings::get(ambient);
+            d3dmat.Diffuse = D3D9Mappings::get(diffuse);
+            d3dmat.Specular = D3D9Mappings::get(specular);
+            d3dmat.Emissive = D3D9Mappings::get(emissive);
+            d3dmat.Power = shininess;
+            HRESULT hr = mD3DDevice->SetMaterial(&d3dmat);
+
+            size_t i = 0;
+            for (i = 0; i < material->getNumTextureLayer(); ++i)
             {
-                const Color4 &ambient = material->getAmbientColor();
-                const Color4 &diffuse = material->getDiffuseColor();
-                const Color4 &specular = material->getSpecularColor();
-                const Color4 &emissive = material->getEmissiveColor();
-                Real shininess = material->getShininess();
-
-                D3DMATERIAL9 d3dmat;
-                d3dmat.Ambient = D3D9Mappings::get(ambient);
-                d3dmat.Diffuse = D3D9Mappings::get(diffuse);
-                d3dmat.Specular = D3D9Mappings::get(specular);
-                d3dmat.Emissive = D3D9Mappings::get(emissive);
-                d3dmat.Power = shininess;
-                HRESULT hr = mD3DDevice->SetMaterial(&d3dmat);
-
-                size_t i = 0;
-                for (i = 0; i < material->getNumTextureLayer(); ++i)
+                Texture *tex = material->getTexture(i);
+                if (tex != nullptr)
                 {
-                    Texture *tex = material->getTexture(i);
-                    if (tex != nullptr)
-                    {
-                        HardwarePixelBufferPtr pixelBuffer = tex->getPixelBuffer();
-                        D3D9HardwarePixelBuffer *pb = (D3D9HardwarePixelBuffer *)(HardwarePixelBuffer *)pixelBuffer;
-                        mD3DDevice->SetTexture(0, pb->getD3DTexture());
-                        mD3DDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
-                        mD3DDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
-                        mD3DDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, D3DTEXF_POINT);
-                    }
+                    HardwarePixelBufferPtr pixelBuffer = tex->getPixelBuffer();
+                    D3D9HardwarePixelBuffer *pb = (D3D9HardwarePixelBuffer *)(HardwarePixelBuffer *)pixelBuffer;
+                    mD3DDevice->SetTexture(0, pb->getD3DTexture());
+                    mD3DDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR);
+                    mD3DDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR);
+                    mD3DDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, D3DTEXF_POINT);
                 }
             }
-            else
-            {
-                mD3DDevice->SetTexture(0, nullptr);
-            }
-
-            mMaterial = material;
+        }
+        else
+        {
+            mD3DDevice->SetTexture(0, nullptr);
         }
     }
 
-    void D3D9Renderer::setCullingMode(CullingMode mode)
+    void D3D9Renderer::setCullingModeImpl(CullingMode mode)
     {
         DWORD d3dmode;
 
-        mCullingMode = mode;
-
         switch (mode)
         {
         case E_CULL_NONE:
@@ -298,18 +285,10 @@ namespace Tiny3D
         }
     }
 
-    void D3D9Renderer::setRenderMode(RenderMode mode)
+    void D3D9Renderer::setRenderModeImpl(RenderMode mode)
     {
         DWORD d3dmode = D3DFILL_SOLID;
 
-//         if (mRenderMode != mode)
-//         {
-//             mMaterial = nullptr;
-//             mD3DDevice->SetTexture(0, nullptr);
-//         }
-
-        mRenderMode = mode;
-
         HRESULT hr;
 
         switch (mode)
@@ -378,9 +357,7 @@ namespace Tiny3D
         }
     }
 
-    void D3D9Renderer::drawVertexList(PrimitiveType primitiveType, 
-        const VertexDataPtr &vertexData, uint32_t startIdx, 
-        uint32_t primitiveCount)
+    void D3D9Renderer::bindVertexDataImpl(const VertexDataPtr &vertexData)
     {
         HRESULT hr;
 
@@ -390,42 +367,44 @@ namespace Tiny3D
         for (i = 0; i < vertexData->getVertexBufferCount(); ++i)
         {
             HardwareVertexBufferPtr vb = vertexData->getVertexBuffer(i);
-            D3D9HardwareVertexBuffer *vertices = (D3D9HardwareVertexBuffer*)(HardwareVertexBuffer *)vb;
+            D3D9HardwareVertexBuffer *vertices = (D3D9HardwareVertexBuffer *)(HardwareVertexBuffer *)vb;
             hr = mD3DDevice->SetStreamSource(i, vertices->getD3DVertexBuffer(), 0, decl->getVertexSize(i));
         }
 
         D3D9VertexDeclaration *vertexDecl = (D3D9VertexDeclaration *)(VertexDeclaration *)decl;
         hr = mD3DDevice->SetVertexDeclaration(vertexDecl->getD3D9VertexDeclaration());
+    }
+
+    void D3D9Renderer::bindIndexDataImpl(const IndexDataPtr &indexData)
+    {
+        HRESULT hr;
+
+        HardwareIndexBufferPtr ib = indexData->getIndexBuffer();
+        D3D9HardwareIndexBuffer *indices = (D3D9HardwareIndexBuffer *)(HardwareIndexBuffer *)ib;
+        hr = mD3DDevice->SetIndices(indices->getD3DIndexBuffer());
+    }
 
-        hr = mD3DDevice->DrawPrimitive(D3D9Mappings::get(primitiveType), 0, primitiveCount);
+    void D3D9Renderer::drawVertexListImpl(PrimitiveType primitiveType, 
+        const VertexDataPtr &vertexData, uint32_t startIdx, 
+        uint32_t primitiveCount)
+    {
+        HRESULT hr;
+        hr = mD3DDevice->DrawPrimitive(D3D9Mappings::get(primitiveType), startIdx, primitiveCount);
     }
 
-    void D3D9Renderer::drawIndexList(PrimitiveType primitiveType, 
+    void D3D9Renderer::drawIndexListImpl(PrimitiveType primitiveType, 
         const VertexDataPtr &vertexData, const IndexDataPtr &indexData, 
         uint32_t startIdx, uint32_t pritimitiveCount)
     {
         HRESULT hr;
 
-        VertexDeclarationPtr decl = vertexData->getDeclaration();
-
         size_t vertexCount = 0;
-        size_t i = 0;
-        for (i = 0; i < vertexData->getVertexBufferCount(); ++i)
+        if (vertexData->getVertexBufferCount() > 0)
         {
-            HardwareVertexBufferPtr vb = vertexData->getVertexBuffer(i);
-            D3D9HardwareVertexBuffer *vertices = (D3D9HardwareVertexBuffer *)(HardwareVertexBuffer *)vb;
-            vertexCount = vertices->getVertexCount();
-            hr = mD3DDevice->SetStreamSource(i, vertices->getD3DVertexBuffer(), 0, decl->getVertexSize(i));
+            vertexCount = vertexData->getVertexBuffer(vertexData->getVertexBufferCount() - 1)->getVertexCount();
         }
 
-        HardwareIndexBufferPtr ib = indexData->getIndexBuffer();
-        D3D9HardwareIndexBuffer *indices = (D3D9HardwareIndexBuffer *)(HardwareIndexBuffer *)ib;
-        hr = mD3DDevice->SetIndices(indices->getD3DIndexBuffer());
-
-        D3D9VertexDeclaration *vertexDecl = (D3D9VertexDeclaration *)(VertexDeclaration *)decl;
-        hr = mD3DDevice->SetVertexDeclaration(vertexDecl->getD3D9VertexDeclaration());
-
-        hr = mD3DDevice->DrawIndexedPrimitive(D3D9Mappings::get(primitiveType), 0, 0, vertexCount, 0, pritimitiveCount);
+        hr = mD3DDevice->DrawIndexedPrimitive(D3D9Mappings::get(primitiveType), 0, 0, vertexCount, startIdx, pritimitiveCount);
     }
 
     void D3D9Renderer::makeProjectionMatrix(const Radian &rkFovY, Real aspect, 
@@ -433,7 +412,7 @@ namespace Tiny3D
     {
         if (ortho)
         {
-            // ͶӰ
+            // 正交投影
 //             Real tanThetaY = Math::Tan(rkFovY * Real(0.5));
 //             Real h = Real(1.0) / (nearDist * tanThetaY);
 //             Real w = h / aspect;
@@ -462,12 +441,12 @@ namespace Tiny3D
         }
         else
         {
-            // ͸ͶӰ
+            // 透视投影
             //          | w 0  0  0 |
             //          | 0 h  0  0 |
             //      M = | 0 0  q qn |
             //          | 0 0 -1  0 |
-            // 
+            // 其中
             //      w = 1.0 / tan(Y/2) / aspect_ratio
             //      h = 1.0 / tan(Y/2)
             //      q = f / (n - f)
@@ -502,11 +481,11 @@ namespace Tiny3D
 
     void D3D9Renderer::updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount)
     {
-        // ټ׶üƽԭ
+        // 快速计算视棱锥六个裁剪平面原理：
         //
-        //  V'ͶӰ任ĵ㣬VͶӰ任ǰϵĵ㣬MͶӰ任ɵã
+        //  假设点V'是投影变换后的点，V是投影变换前相机坐标系的点，M是投影变换矩阵，则可得：
         //      V' = M * V
-        //  
+        //  其中
         //      V' = (x' y' z' w')
         //
         //      V = (x y z w), (w = 1)
@@ -515,30 +494,30 @@ namespace Tiny3D
         //      M = | m10 m11 m12 m13 |
         //          | m20 m21 m22 m23 |
         //          | m30 m31 m32 m33 |
-        //  
+        //  则
         //      | m00 m01 m02 m03 |   | x |   | x*m00 + y*m01 + z*m02 + w*m03 |   | V * row0 |
         //      | m10 m11 m12 m13 |   | y |   | x*m10 + y*m11 + z*m12 + w*m13 |   | V * row1 |
         //      | m20 m21 m22 m23 | * | z | = | x*m20 + y*m21 + z*m22 + w*m23 | = | V * row2 |
         //      | m30 m31 m32 m33 |   | w |   | x*m30 + y*m31 + z*m32 + w*m33 |   | V * row3 |
         //
-        //  *rowi = (mi0 mi1 mi2 mi3)
+        //  这里的*代表点积，而rowi = (mi0 mi1 mi2 mi3)
         // 
-        //  תV'βüռռʵѾһĺӡ
-        //  V'ӿռ任ǰVҲûо任ĺӿռ
-        //  ҪһDXOpenGLΪͶӰռ䲻һ
+        //  经过转换后，V'在齐次裁剪空间里。这个空间实际上现在已经是一个轴对齐的盒子。
+        //  如果V'在这个盒子空间里，则变换前的V点也在这个没有经过变换的盒子空间里。
+        //  这里要分一下DX和OpenGL的区别，因为投影空间不一样：
         //
-        //      1DXV'ռĲʽ
+        //      1、在DX里，V'在这个空间里，则符合下面的不等式规则
         //              -w' < x' < w'
         //              -w' < y' < w'
         //               0 < z' < w'
-        //           -w' < x' Ƶ
+        //          用 -w' < x' 推导：
         //              -(V * row3) < (V * row0)
-        //          ƶã
+        //          移动项得：
         //              0 < (V * row3) + (V * row0)
-        //          ϲͬտɵã
+        //          合并同类项，最终可得：
         //              0 < V * (row3 + row0)
         //
-        //          ƿɵã
+        //          如此类推可得：
         //              left    :   0 < V * (row3 + row0)   a=m30+m00, b=m31+m01, c=m32+m02, d=m33+m03
         //              right   :   0 < V * (row3 - row0)   a=m30-m00, b=m31-m01, c=m32-m02, d=m33-m03
         //              bottom  :   0 < V * (row3 + row1)   a=m30+m10, b=m31+m11, c=m32+m12, d=m33+m13
@@ -594,9 +573,9 @@ namespace Tiny3D
 
     D3DMATRIX D3D9Renderer::toD3DMatrix(const Matrix4 &mat) const
     {
-        // תþ
-        // D3D9 ʹ i.e. V*M
-        // Tiny3D, OpenGL  i.e. M*V
+        // 转置矩阵
+        // D3D9 使用行向量 i.e. V*M
+        // Tiny3D, OpenGL 等用列向量 i.e. M*V
         D3DXMATRIX d3dMat;
         d3dMat.m[0][0] = mat[0][0];
         d3dMat.m[0][1] = mat[1][0];
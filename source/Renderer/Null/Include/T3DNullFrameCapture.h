@@ -0,0 +1,177 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_NULL_FRAME_CAPTURE_H__
+#define __T3D_NULL_FRAME_CAPTURE_H__
+
+
+#include "T3DNullPrerequisites.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 一帧里提交到空渲染器的所有状态设置和绘制调用记录
+     * @note 只有通过了Renderer基类状态缓存过滤的调用才会到达这里，
+     *      所以记录下来的就是真实渲染器会提交给设备的调用序列。
+     */
+    class T3D_NULLRENDERER_API NullFrameCapture
+    {
+    public:
+        enum CommandType
+        {
+            E_CMD_BEGIN_RENDER = 0,         /// 开始渲染，value是背景色A8R8G8B8
+            E_CMD_END_RENDER,               /// 结束渲染
+            E_CMD_SET_VIEWPORT,             /// 设置视口，start/count是宽高
+            E_CMD_SET_TRANSFORM,            /// 设置变换，value是TransformState，data是矩阵索引
+            E_CMD_SET_CULLING_MODE,         /// 设置裁剪模式，value是CullingMode
+            E_CMD_SET_RENDER_MODE,          /// 设置渲染模式，value是RenderMode
+            E_CMD_SET_MATERIAL,             /// 设置材质，data是材质名称索引
+            E_CMD_SET_LIGHT_ENABLED,        /// 开关光照，value是0或者1
+            E_CMD_SET_AMBIENT_LIGHT,        /// 设置环境光，value是A8R8G8B8
+            E_CMD_ADD_LIGHT,                /// 添加动态灯光，value是灯光索引
+            E_CMD_REMOVE_LIGHT,             /// 移除动态灯光，value是灯光索引
+            E_CMD_REMOVE_ALL_LIGHTS,        /// 移除所有动态灯光
+            E_CMD_BIND_VERTEX_DATA,         /// 绑定顶点数据，count是顶点数量
+            E_CMD_BIND_INDEX_DATA,          /// 绑定索引数据，count是索引数量
+            E_CMD_DRAW_VERTEX_LIST,         /// 绘制顶点列表，value是PrimitiveType
+            E_CMD_DRAW_INDEX_LIST,          /// 绘制索引列表，value是PrimitiveType
+            E_CMD_DRAW_INDEX_LIST_INSTANCED,/// 实例化绘制索引列表，count是实例数量
+            E_CMD_MAX
+        };
+
+        struct Command
+        {
+            CommandType type;           /// 命令类型
+            uint32_t    value;          /// 状态值，含义见CommandType
+            uint32_t    start;          /// 绘制的起始索引
+            uint32_t    primitives;     /// 绘制的图元数量
+            uint32_t    count;          /// 实例数量或者顶点、索引数量
+            int32_t     data;           /// 附加数据在矩阵表或者名称表里的索引，-1表示没有
+            const void  *object;        /// 绑定对象的地址，只用来判断是否同一个对象，不能解引用
+        };
+
+        typedef std::vector<Command>            Commands;
+        typedef Commands::iterator              CommandsItr;
+        typedef Commands::const_iterator        CommandsConstItr;
+
+        NullFrameCapture();
+        ~NullFrameCapture();
+
+        /**
+         * @brief 清空记录，开始记录新的一帧
+         * @param [in] frameIndex : 帧序号
+         * @note 只清空元素不释放容量，稳定运行后每帧记录不会再分配内存
+         */
+        void reset(uint32_t frameIndex);
+
+        /**
+         * @brief 交换两个记录的内容
+         */
+        void swap(NullFrameCapture &other);
+
+        /**
+         * @brief 记录一条命令
+         * @return 返回记录的命令，调用者可以继续填充命令参数
+         */
+        Command &record(CommandType type, uint32_t value = 0, const void *object = nullptr);
+
+        /**
+         * @brief 记录一次绘制调用，并累计本帧的图元和实例数量
+         * @param [in] type : 绘制命令类型
+         * @param [in] primitiveType : 图元类型
+         * @param [in] start : 起始索引
+         * @param [in] primitives : 每个实例的图元数量
+         * @param [in] instances : 实例数量
+         * @param [in] object : 绘制用的顶点数据
+         */
+        Command &recordDraw(CommandType type, uint32_t primitiveType,
+            uint32_t start, uint32_t primitives, uint32_t instances,
+            const void *object);
+
+        /**
+         * @brief 记录一个矩阵，返回矩阵在矩阵表里的索引
+         */
+        int32_t recordMatrix(const Matrix4 &mat);
+
+        /**
+         * @brief 记录一个名称，返回名称在名称表里的索引
+         */
+        int32_t recordName(const String &name);
+
+        uint32_t getFrameIndex() const      { return mFrameIndex; }
+
+        size_t getCommandCount() const      { return mCommands.size(); }
+        const Command &getCommand(size_t idx) const { return mCommands[idx]; }
+        const Commands &getCommands() const { return mCommands; }
+
+        const Matrix4 &getMatrix(int32_t idx) const { return mMatrices[idx]; }
+        const String &getName(int32_t idx) const    { return mNames[idx]; }
+
+        /**
+         * @brief 返回指定类型的命令数量
+         */
+        size_t getCommandCount(CommandType type) const  { return mCounts[type]; }
+
+        /**
+         * @brief 返回本帧绘制调用次数，实例化绘制算一次
+         */
+        size_t getDrawCount() const;
+
+        /**
+         * @brief 返回本帧提交的图元数量，实例化绘制按实例数量累计
+         */
+        uint64_t getPrimitiveCount() const  { return mPrimitiveCount; }
+
+        /**
+         * @brief 返回本帧绘制的实例数量，非实例化绘制算一个实例
+         */
+        uint64_t getInstanceCount() const   { return mInstanceCount; }
+
+        /**
+         * @brief 返回本帧状态设置的数量，不包括绘制和开始、结束渲染
+         */
+        size_t getStateCount() const;
+
+        /**
+         * @brief 把命令序列转换成可读文本，一行一条命令
+         */
+        void dump(String &text) const;
+
+        /**
+         * @brief 返回命令类型的名称
+         */
+        static const char *getCommandName(CommandType type);
+
+    protected:
+        typedef std::vector<Matrix4>            Matrices;
+        typedef std::vector<String>             Names;
+
+        Commands    mCommands;                  /// 命令序列
+        Matrices    mMatrices;                  /// 变换命令引用的矩阵
+        Names       mNames;                     /// 材质命令引用的名称
+        size_t      mCounts[E_CMD_MAX];         /// 各类型命令的数量
+        uint64_t    mPrimitiveCount;            /// 本帧图元数量
+        uint64_t    mInstanceCount;             /// 本帧实例数量
+        uint32_t    mFrameIndex;                /// 帧序号
+    };
+}
+
+
+#endif  /*__T3D_NULL_FRAME_CAPTURE_H__*/
@@ -0,0 +1,63 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_NULL_RENDER_WINDOW_H__
+#define __T3D_NULL_RENDER_WINDOW_H__
+
+
+#include "T3DNullPrerequisites.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 没有窗口系统的渲染窗口，只记录尺寸，交换缓冲时结束一帧的记录
+     * @note 配置文件Render里的MaxFrames大于0时，渲染了这么多帧后自动退出主循环
+     */
+    class NullRenderWindow : public RenderWindow
+    {
+    public:
+        NullRenderWindow();
+        virtual ~NullRenderWindow();
+
+        virtual bool create(
+            const String &name,
+            const RenderWindowCreateParam &rkCreateParams,
+            const RenderWindowCreateParamEx &rkCreateParamEx) override;
+
+        virtual void destroy() override;
+
+        virtual void swapBuffers() override;
+
+        virtual bool isFullScreen() const override;
+
+        /**
+         * @brief 返回已经交换缓冲的帧数
+         */
+        uint32_t getFrameCount() const  { return mFrameCount; }
+
+    protected:
+        uint32_t    mFrameCount;        /// 已经渲染的帧数
+        uint32_t    mMaxFrames;         /// 最多渲染的帧数，0表示不限制
+        bool        mIsFullScreen;
+    };
+}
+
+
+#endif  /*__T3D_NULL_RENDER_WINDOW_H__*/
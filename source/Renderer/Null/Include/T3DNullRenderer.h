@@ -0,0 +1,136 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_NULL_RENDERER_H__
+#define __T3D_NULL_RENDERER_H__
+
+
+#include "T3DNullPrerequisites.h"
+#include "T3DNullFrameCapture.h"
+#include "Render/T3DRenderer.h"
+#include "Render/T3DHardwareBufferManager.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 不依赖GPU和窗口系统的渲染器
+     * @remarks 场景更新、裁剪、渲染队列排序和命令录制等CPU端流程照常执行，
+     *      所有到达渲染器的状态设置和绘制调用都记录到帧记录里，
+     *      交换缓冲时当前帧记录变成上一帧记录，可以用来检查或者统计。
+     *      变换和投影采用和Direct3D9一样的约定。
+     */
+    class T3D_NULLRENDERER_API NullRenderer
+        : public Renderer
+        , public Singleton<NullRenderer>
+    {
+    public:
+        NullRenderer();
+        virtual ~NullRenderer();
+
+        virtual String getName() const override;
+
+        virtual RenderWindow *createRenderWindow(
+            const RenderWindowCreateParam &rkCreateParam,
+            const RenderWindowCreateParamEx &rkCreateParamEx) override;
+
+        virtual bool initialize() override;
+        virtual void uninitialize() override;
+
+        virtual bool beginRender(const Color4 &bkgndColor) override;
+        virtual bool endRender() override;
+
+        virtual bool queryCapability(Capability cap) override;
+        virtual void enableCapability(Capability cap, bool enabled = true) override;
+
+        virtual void setLightEnabled(bool enable) override;
+        virtual void setAmbientLight(const Color4 &ambient) override;
+        virtual void addDynamicLight(size_t index, const SGLightPtr light) override;
+        virtual void removeDynamicLight(size_t index) override;
+        virtual void removeAllDynamicLights() override;
+
+        virtual void setViewport(const ViewportPtr &viewport) override;
+
+        virtual bool isInstancingSupported() const override;
+
+        virtual void makeProjectionMatrix(const Radian &rkFovY, Real aspect,
+            Real nearDist, Real farDist, bool ortho, Matrix4 &mat) override;
+
+        virtual void makeViewportMatrix(ViewportPtr viewport, Matrix4 &mat) override;
+
+        virtual void updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount) override;
+
+        /**
+         * @brief 结束当前帧的记录，由渲染窗口交换缓冲时调用
+         */
+        void presentFrame();
+
+        /**
+         * @brief 返回正在记录的帧
+         */
+        const NullFrameCapture &getCurrentFrame() const { return mCurrentFrame; }
+
+        /**
+         * @brief 返回最近一个完整的帧记录
+         */
+        const NullFrameCapture &getLastFrame() const    { return mLastFrame; }
+
+        /**
+         * @brief 返回已经完成的帧数
+         */
+        uint32_t getFrameCount() const  { return mFrameCount; }
+
+    protected:
+        virtual void setTransformImpl(TransformState state, const Matrix4 &mat) override;
+
+        virtual void setMaterialImpl(const MaterialPtr &material) override;
+
+        virtual void setCullingModeImpl(CullingMode mode) override;
+        virtual void setRenderModeImpl(RenderMode mode) override;
+
+        virtual void bindVertexDataImpl(const VertexDataPtr &vertexData) override;
+        virtual void bindIndexDataImpl(const IndexDataPtr &indexData) override;
+
+        virtual void drawVertexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertexData, uint32_t startIdx,
+            uint32_t primitiveCount) override;
+
+        virtual void drawIndexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
+            uint32_t startIdx, uint32_t pritimitiveCount) override;
+
+        virtual void drawIndexListInstancedImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+            const HardwareVertexBufferPtr &instances, size_t instanceCount,
+            uint32_t startIdx, uint32_t primitiveCount) override;
+
+    protected:
+        HardwareBufferManager       *mHardwareBufferMgr;
+        MemoryHardwareBufferManager *mNullHwBufferMgr;
+
+        NullFrameCapture    mCurrentFrame;      /// 正在记录的帧
+        NullFrameCapture    mLastFrame;         /// 上一个完整的帧
+        uint32_t            mFrameCount;        /// 已经完成的帧数
+    };
+
+    #define NULL_RENDERER           (NullRenderer::getInstance())
+}
+
+
+#endif  /*__T3D_NULL_RENDERER_H__*/
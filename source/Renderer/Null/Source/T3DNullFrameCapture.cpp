@@ -0,0 +1,190 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DNullFrameCapture.h"
+
+
+namespace Tiny3D
+{
+    NullFrameCapture::NullFrameCapture()
+        : mPrimitiveCount(0)
+        , mInstanceCount(0)
+        , mFrameIndex(0)
+    {
+        memset(mCounts, 0, sizeof(mCounts));
+    }
+
+    NullFrameCapture::~NullFrameCapture()
+    {
+
+    }
+
+    void NullFrameCapture::reset(uint32_t frameIndex)
+    {
+        mCommands.clear();
+        mMatrices.clear();
+        mNames.clear();
+        memset(mCounts, 0, sizeof(mCounts));
+        mPrimitiveCount = 0;
+        mInstanceCount = 0;
+        mFrameIndex = frameIndex;
+    }
+
+    void NullFrameCapture::swap(NullFrameCapture &other)
+    {
+        mCommands.swap(other.mCommands);
+        mMatrices.swap(other.mMatrices);
+        mNames.swap(other.mNames);
+
+        size_t i = 0;
+        while (i < E_CMD_MAX)
+        {
+            std::swap(mCounts[i], other.mCounts[i]);
+            ++i;
+        }
+
+        std::swap(mPrimitiveCount, other.mPrimitiveCount);
+        std::swap(mInstanceCount, other.mInstanceCount);
+        std::swap(mFrameIndex, other.mFrameIndex);
+    }
+
+    NullFrameCapture::Command &NullFrameCapture::record(CommandType type,
+        uint32_t value /* = 0 */, const void *object /* = nullptr */)
+    {
+        Command cmd;
+        cmd.type = type;
+        cmd.value = value;
+        cmd.start = 0;
+        cmd.primitives = 0;
+        cmd.count = 0;
+        cmd.data = -1;
+        cmd.object = object;
+        mCommands.push_back(cmd);
+        ++mCounts[type];
+        return mCommands.back();
+    }
+
+    NullFrameCapture::Command &NullFrameCapture::recordDraw(CommandType type,
+        uint32_t primitiveType, uint32_t start, uint32_t primitives,
+        uint32_t instances, const void *object)
+    {
+        Command &cmd = record(type, primitiveType, object);
+        cmd.start = start;
+        cmd.primitives = primitives;
+        cmd.count = instances;
+        mPrimitiveCount += uint64_t(primitives) * instances;
+        mInstanceCount += instances;
+        return cmd;
+    }
+
+    int32_t NullFrameCapture::recordMatrix(const Matrix4 &mat)
+    {
+        mMatrices.push_back(mat);
+        return int32_t(mMatrices.size() - 1);
+    }
+
+    int32_t NullFrameCapture::recordName(const String &name)
+    {
+        mNames.push_back(name);
+        return int32_t(mNames.size() - 1);
+    }
+
+    size_t NullFrameCapture::getDrawCount() const
+    {
+        return mCounts[E_CMD_DRAW_VERTEX_LIST] + mCounts[E_CMD_DRAW_INDEX_LIST]
+            + mCounts[E_CMD_DRAW_INDEX_LIST_INSTANCED];
+    }
+
+    size_t NullFrameCapture::getStateCount() const
+    {
+        return mCommands.size() - getDrawCount()
+            - mCounts[E_CMD_BEGIN_RENDER] - mCounts[E_CMD_END_RENDER];
+    }
+
+    const char *NullFrameCapture::getCommandName(CommandType type)
+    {
+        static const char *names[E_CMD_MAX] =
+        {
+            "BeginRender",
+            "EndRender",
+            "SetViewport",
+            "SetTransform",
+            "SetCullingMode",
+            "SetRenderMode",
+            "SetMaterial",
+            "SetLightEnabled",
+            "SetAmbientLight",
+            "AddLight",
+            "RemoveLight",
+            "RemoveAllLights",
+            "BindVertexData",
+            "BindIndexData",
+            "DrawVertexList",
+            "DrawIndexList",
+            "DrawIndexListInstanced",
+        };
+
+        if (type < 0 || type >= E_CMD_MAX)
+            return "Unknown";
+
+        return names[type];
+    }
+
+    void NullFrameCapture::dump(String &text) const
+    {
+        char line[256];
+
+        snprintf(line, sizeof(line), "Frame %u : %u commands, %u draws, %u states, %llu primitives, %llu instances\n",
+            mFrameIndex, uint32_t(mCommands.size()), uint32_t(getDrawCount()),
+            uint32_t(getStateCount()), (unsigned long long)mPrimitiveCount,
+            (unsigned long long)mInstanceCount);
+        text += line;
+
+        size_t i = 0;
+        CommandsConstItr itr = mCommands.begin();
+        while (itr != mCommands.end())
+        {
+            const Command &cmd = *itr;
+            snprintf(line, sizeof(line), "%6u %-24s value=%u start=%u primitives=%u count=%u object=%p",
+                uint32_t(i), getCommandName(cmd.type), cmd.value, cmd.start,
+                cmd.primitives, cmd.count, cmd.object);
+            text += line;
+
+            if (cmd.data >= 0)
+            {
+                if (cmd.type == E_CMD_SET_TRANSFORM)
+                {
+                    const Matrix4 &m = mMatrices[cmd.data];
+                    snprintf(line, sizeof(line), " translate=(%g, %g, %g)",
+                        double(m[0][3]), double(m[1][3]), double(m[2][3]));
+                    text += line;
+                }
+                else if (cmd.type == E_CMD_SET_MATERIAL)
+                {
+                    text += " name=";
+                    text += mNames[cmd.data];
+                }
+            }
+
+            text += "\n";
+            ++itr;
+            ++i;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DNullRenderWindow.h"
+#include "T3DNullRenderer.h"
+
+
+namespace Tiny3D
+{
+    NullRenderWindow::NullRenderWindow()
+        : mFrameCount(0)
+        , mMaxFrames(0)
+        , mIsFullScreen(false)
+    {
+    }
+
+    NullRenderWindow::~NullRenderWindow()
+    {
+        destroy();
+    }
+
+    bool NullRenderWindow::create(const String &name, const RenderWindowCreateParam &rkCreateParams, const RenderWindowCreateParamEx &rkCreateParamEx)
+    {
+        mIsActive = true;
+        mIsFullScreen = rkCreateParams._fullscreen;
+        mWidth = rkCreateParams._windowWidth;
+        mHeight = rkCreateParams._windowHeight;
+        mColorDepth = rkCreateParams._colorDepth;
+        mName = name;
+
+        Settings renderSettings = Entrance::getInstance().getConfig()["Render"].mapValue();
+        String s("MaxFrames");
+        Variant key(s);
+        Settings::const_iterator itr = renderSettings.find(key);
+        if (itr != renderSettings.end())
+        {
+            mMaxFrames = itr->second.uint32Value();
+        }
+
+        T3D_LOG_INFO("Create null render window %s (%d x %d), max frames %u",
+            name.c_str(), mWidth, mHeight, mMaxFrames);
+
+        return true;
+    }
+
+    void NullRenderWindow::destroy()
+    {
+        if (mIsActive)
+        {
+            mIsActive = false;
+            Entrance::getInstance().shutdown();
+        }
+    }
+
+    void NullRenderWindow::swapBuffers()
+    {
+        NULL_RENDERER.presentFrame();
+
+        ++mFrameCount;
+
+        if (mMaxFrames > 0 && mFrameCount >= mMaxFrames)
+        {
+            Entrance::getInstance().shutdown();
+        }
+    }
+
+    bool NullRenderWindow::isFullScreen() const
+    {
+        return mIsFullScreen;
+    }
+}
@@ -0,0 +1,379 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DNullRenderer.h"
+#include "T3DNullRenderWindow.h"
+#include "T3DMemoryHardwareBufferManager.h"
+
+
+namespace Tiny3D
+{
+    T3D_INIT_SINGLETON(NullRenderer);
+
+    NullRenderer::NullRenderer()
+        : mHardwareBufferMgr(nullptr)
+        , mNullHwBufferMgr(nullptr)
+        , mFrameCount(0)
+    {
+    }
+
+    NullRenderer::~NullRenderer()
+    {
+        uninitialize();
+    }
+
+    String NullRenderer::getName() const
+    {
+        return NULLRENDERER;
+    }
+
+    RenderWindow *NullRenderer::createRenderWindow(
+        const RenderWindowCreateParam &rkCreateParam,
+        const RenderWindowCreateParamEx &rkCreateParamEx)
+    {
+        RenderWindow *window = new NullRenderWindow();
+        window->create("MainWindow", rkCreateParam, rkCreateParamEx);
+        attachRenderTarget(window);
+
+        return window;
+    }
+
+    bool NullRenderer::initialize()
+    {
+        // 硬件缓冲管理器是单例，和其他渲染器插件一起加载时只有激活的渲染器才能创建
+        if (mHardwareBufferMgr == nullptr)
+        {
+            mNullHwBufferMgr = new MemoryHardwareBufferManager();
+            mHardwareBufferMgr = new HardwareBufferManager(mNullHwBufferMgr);
+        }
+
+        mFrameCount = 0;
+        mCurrentFrame.reset(0);
+        mLastFrame.reset(0);
+
+        return true;
+    }
+
+    void NullRenderer::uninitialize()
+    {
+        T3D_SAFE_RELEASE(mNullHwBufferMgr);
+        T3D_SAFE_RELEASE(mHardwareBufferMgr);
+    }
+
+    bool NullRenderer::beginRender(const Color4 &bkgndColor)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_BEGIN_RENDER, bkgndColor.A8R8G8B8());
+        return true;
+    }
+
+    bool NullRenderer::endRender()
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_END_RENDER);
+        return true;
+    }
+
+    bool NullRenderer::queryCapability(Capability cap)
+    {
+        return false;
+    }
+
+    void NullRenderer::enableCapability(Capability cap, bool enabled /* = true */)
+    {
+
+    }
+
+    void NullRenderer::setTransformImpl(TransformState state, const Matrix4 &mat)
+    {
+        NullFrameCapture::Command &cmd = mCurrentFrame.record(NullFrameCapture::E_CMD_SET_TRANSFORM, state);
+        cmd.data = mCurrentFrame.recordMatrix(mat);
+    }
+
+    void NullRenderer::setLightEnabled(bool enable)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_SET_LIGHT_ENABLED, enable ? 1 : 0);
+    }
+
+    void NullRenderer::setAmbientLight(const Color4 &ambient)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_SET_AMBIENT_LIGHT, ambient.A8R8G8B8());
+    }
+
+    void NullRenderer::addDynamicLight(size_t index, const SGLightPtr light)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_ADD_LIGHT, (uint32_t)index, (SGLight *)light);
+    }
+
+    void NullRenderer::removeDynamicLight(size_t index)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_REMOVE_LIGHT, (uint32_t)index);
+    }
+
+    void NullRenderer::removeAllDynamicLights()
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_REMOVE_ALL_LIGHTS);
+    }
+
+    void NullRenderer::setMaterialImpl(const MaterialPtr &material)
+    {
+        NullFrameCapture::Command &cmd = mCurrentFrame.record(NullFrameCapture::E_CMD_SET_MATERIAL, 0, (Material *)material);
+
+        if (material != nullptr)
+        {
+            cmd.value = (uint32_t)material->getNumTextureLayer();
+            cmd.data = mCurrentFrame.recordName(material->getName());
+        }
+    }
+
+    void NullRenderer::setCullingModeImpl(CullingMode mode)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_SET_CULLING_MODE, mode);
+    }
+
+    void NullRenderer::setRenderModeImpl(RenderMode mode)
+    {
+        mCurrentFrame.record(NullFrameCapture::E_CMD_SET_RENDER_MODE, mode);
+    }
+
+    void NullRenderer::setViewport(const ViewportPtr &viewport)
+    {
+        if (viewport != mViewport)
+        {
+            mViewport = viewport;
+
+            NullFrameCapture::Command &cmd = mCurrentFrame.record(NullFrameCapture::E_CMD_SET_VIEWPORT, 0, (Viewport *)viewport);
+
+            if (viewport != nullptr)
+            {
+                cmd.start = (uint32_t)viewport->getActualWidth();
+                cmd.count = (uint32_t)viewport->getActualHeight();
+            }
+        }
+    }
+
+    void NullRenderer::bindVertexDataImpl(const VertexDataPtr &vertexData)
+    {
+        NullFrameCapture::Command &cmd = mCurrentFrame.record(NullFrameCapture::E_CMD_BIND_VERTEX_DATA, 0, (VertexData *)vertexData);
+
+        if (vertexData != nullptr && vertexData->getVertexBufferCount() > 0)
+        {
+            cmd.value = (uint32_t)vertexData->getVertexBufferCount();
+            cmd.count = (uint32_t)vertexData->getVertexBuffer(0)->getVertexCount();
+        }
+    }
+
+    void NullRenderer::bindIndexDataImpl(const IndexDataPtr &indexData)
+    {
+        NullFrameCapture::Command &cmd = mCurrentFrame.record(NullFrameCapture::E_CMD_BIND_INDEX_DATA, 0, (IndexData *)indexData);
+
+        if (indexData != nullptr && indexData->getIndexBuffer() != nullptr)
+        {
+            const HardwareIndexBufferPtr &indices = indexData->getIndexBuffer();
+            cmd.value = (uint32_t)indices->getIndexType();
+            cmd.count = (uint32_t)indices->getIndexCount();
+        }
+    }
+
+    void NullRenderer::drawVertexListImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertexData, uint32_t startIdx,
+        uint32_t primitiveCount)
+    {
+        mCurrentFrame.recordDraw(NullFrameCapture::E_CMD_DRAW_VERTEX_LIST,
+            primitiveType, startIdx, primitiveCount, 1, (VertexData *)vertexData);
+    }
+
+    void NullRenderer::drawIndexListImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
+        uint32_t startIdx, uint32_t pritimitiveCount)
+    {
+        mCurrentFrame.recordDraw(NullFrameCapture::E_CMD_DRAW_INDEX_LIST,
+            primitiveType, startIdx, pritimitiveCount, 1, (VertexData *)vertexData);
+    }
+
+    bool NullRenderer::isInstancingSupported() const
+    {
+        return true;
+    }
+
+    void NullRenderer::drawIndexListInstancedImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertices, const IndexDataPtr &indicies,
+        const HardwareVertexBufferPtr &instances, size_t instanceCount,
+        uint32_t startIdx, uint32_t primitiveCount)
+    {
+        mCurrentFrame.recordDraw(NullFrameCapture::E_CMD_DRAW_INDEX_LIST_INSTANCED,
+            primitiveType, startIdx, primitiveCount, (uint32_t)instanceCount,
+            (VertexData *)vertices);
+    }
+
+    void NullRenderer::presentFrame()
+    {
+        ++mFrameCount;
+        mLastFrame.swap(mCurrentFrame);
+        mCurrentFrame.reset(mFrameCount);
+    }
+
+    void NullRenderer::makeProjectionMatrix(const Radian &rkFovY, Real aspect,
+        Real nearDist, Real farDist, bool ortho, Matrix4 &mat)
+    {
+        if (ortho)
+        {
+            // 正交投影
+            Real h = Real(2.0);
+            Real w = h / aspect;
+            Real q = Real(1.0) / (nearDist - farDist);
+            Real qn = nearDist * q;
+
+            mat.makeZero();
+            mat[0][0] = w;
+            mat[1][1] = h;
+            mat[2][2] = q;
+            mat[2][3] = qn;
+            mat[3][3] = 1.0;
+        }
+        else
+        {
+            // 透视投影
+            //          | w 0  0  0 |
+            //          | 0 h  0  0 |
+            //      M = | 0 0  q qn |
+            //          | 0 0 -1  0 |
+            // 其中
+            //      w = 1.0 / tan(Y/2) / aspect_ratio
+            //      h = 1.0 / tan(Y/2)
+            //      q = f / (n - f)
+            //      qn = n * f / (n - f)
+
+            Real tanThetaY = Math::Tan(rkFovY * Real(0.5));
+            Real h = Real(1.0) / (tanThetaY);
+            Real w = h / aspect;
+            Real q = farDist / (nearDist - farDist);
+            Real qn = nearDist * q;
+
+            mat.makeZero();
+            mat[0][0] = w;
+            mat[1][1] = h;
+            mat[2][2] = q;
+            mat[2][3] = qn;
+            mat[3][2] = -1.0;
+        }
+    }
+
+    void NullRenderer::makeViewportMatrix(ViewportPtr viewport, Matrix4 &mat)
+    {
+        mat.makeZero();
+        mat[0][0] = viewport->getActualWidth() * Real(0.5);
+        mat[1][1] = -viewport->getActualHeight() * Real(0.5);
+        mat[2][2] = Real(1.0);
+        mat[3][3] = Real(1.0);
+        mat[0][3] = viewport->getActualLeft() + viewport->getActualWidth() * Real(0.5);
+        mat[1][3] = viewport->getActualTop() + viewport->getActualHeight() * Real(0.5);
+        mat[2][3] = Real(0.0);
+    }
+
+    void NullRenderer::updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount)
+    {
+        // 快速计算视棱锥六个裁剪平面原理：
+        //
+        //  假设点V'是投影变换后的点，V是投影变换前相机坐标系的点，M是投影变换矩阵，则可得：
+        //      V' = M * V
+        //  其中
+        //      V' = (x' y' z' w')
+        //
+        //      V = (x y z w), (w = 1)
+        //
+        //          | m00 m01 m02 m03 |
+        //      M = | m10 m11 m12 m13 |
+        //          | m20 m21 m22 m23 |
+        //          | m30 m31 m32 m33 |
+        //  则
+        //      | m00 m01 m02 m03 |   | x |   | x*m00 + y*m01 + z*m02 + w*m03 |   | V * row0 |
+        //      | m10 m11 m12 m13 |   | y |   | x*m10 + y*m11 + z*m12 + w*m13 |   | V * row1 |
+        //      | m20 m21 m22 m23 | * | z | = | x*m20 + y*m21 + z*m22 + w*m23 | = | V * row2 |
+        //      | m30 m31 m32 m33 |   | w |   | x*m30 + y*m31 + z*m32 + w*m33 |   | V * row3 |
+        //
+        //  这里的*代表点积，而rowi = (mi0 mi1 mi2 mi3)
+        //
+        //  经过转换后，V'在齐次裁剪空间里。这个空间实际上现在已经是一个轴对齐的盒子。
+        //  如果V'在这个盒子空间里，则变换前的V点也在这个没有经过变换的盒子空间里。
+        //  这里要分一下DX和OpenGL的区别，因为投影空间不一样：
+        //
+        //      1、在DX里，V'在这个空间里，则符合下面的不等式规则
+        //              -w' < x' < w'
+        //              -w' < y' < w'
+        //               0 < z' < w'
+        //          用 -w' < x' 推导：
+        //              -(V * row3) < (V * row0)
+        //          移动项得：
+        //              0 < (V * row3) + (V * row0)
+        //          合并同类项，最终可得：
+        //              0 < V * (row3 + row0)
+        //
+        //          如此类推可得：
+        //              left    :   0 < V * (row3 + row0)   a=m30+m00, b=m31+m01, c=m32+m02, d=m33+m03
+        //              right   :   0 < V * (row3 - row0)   a=m30-m00, b=m31-m01, c=m32-m02, d=m33-m03
+        //              bottom  :   0 < V * (row3 + row1)   a=m30+m10, b=m31+m11, c=m32+m12, d=m33+m13
+        //              top     :   0 < V * (row3 - row1)   a=m30-m10, b=m31-m11, c=m32-m12, d=m33-m13
+        //              near    :   0 < V * row2            a=m20,     b=m21,     c=m22,     d=m23
+        //              far     :   0 < V * (row3 - row2)   a=m30-m20, b=m31-m21, c=m32-m22, d=m33-m23
+        //
+
+        T3D_ASSERT(planeCount == Frustum::E_MAX_FACE);
+
+        // Left
+        plane[Frustum::E_FACE_LEFT][0] = m[3][0] + m[0][0];
+        plane[Frustum::E_FACE_LEFT][1] = m[3][1] + m[0][1];
+        plane[Frustum::E_FACE_LEFT][2] = m[3][2] + m[0][2];
+        plane[Frustum::E_FACE_LEFT][3] = m[3][3] + m[0][3];
+        plane[Frustum::E_FACE_LEFT].normalize();
+
+        // Right
+        plane[Frustum::E_FACE_RIGHT][0] = m[3][0] - m[0][0];
+        plane[Frustum::E_FACE_RIGHT][1] = m[3][1] - m[0][1];
+        plane[Frustum::E_FACE_RIGHT][2] = m[3][2] - m[0][2];
+        plane[Frustum::E_FACE_RIGHT][3] = m[3][3] - m[0][3];
+        plane[Frustum::E_FACE_RIGHT].normalize();
+
+        // Bottom
+        plane[Frustum::E_FACE_BOTTOM][0] = m[3][0] + m[1][0];
+        plane[Frustum::E_FACE_BOTTOM][1] = m[3][1] + m[1][1];
+        plane[Frustum::E_FACE_BOTTOM][2] = m[3][2] + m[1][2];
+        plane[Frustum::E_FACE_BOTTOM][3] = m[3][3] + m[1][3];
+        plane[Frustum::E_FACE_BOTTOM].normalize();
+
+        // Top
+        plane[Frustum::E_FACE_TOP][0] = m[3][0] - m[1][0];
+        plane[Frustum::E_FACE_TOP][1] = m[3][1] - m[1][1];
+        plane[Frustum::E_FACE_TOP][2] = m[3][2] - m[1][2];
+        plane[Frustum::E_FACE_TOP][3] = m[3][3] - m[1][3];
+        plane[Frustum::E_FACE_TOP].normalize();
+
+        // Near
+        plane[Frustum::E_FACE_NEAR][0] = m[2][0];
+        plane[Frustum::E_FACE_NEAR][1] = m[2][1];
+        plane[Frustum::E_FACE_NEAR][2] = m[2][2];
+        plane[Frustum::E_FACE_NEAR][3] = m[2][3];
+        plane[Frustum::E_FACE_NEAR].normalize();
+
+        // Far
+        plane[Frustum::E_FACE_FAR][0] = m[3][0] - m[2][0];
+        plane[Frustum::E_FACE_FAR][1] = m[3][1] - m[2][1];
+        plane[Frustum::E_FACE_FAR][2] = m[3][2] - m[2][2];
+        plane[Frustum::E_FACE_FAR][3] = m[3][3] - m[2][3];
+        plane[Frustum::E_FACE_FAR].normalize();
+    }
+}
\ No newline at end of file
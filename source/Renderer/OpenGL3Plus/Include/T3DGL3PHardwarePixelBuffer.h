@@ -36,37 +36,37 @@ namespace Tiny3D
         bool createTexture();
 
         /**
-        * @brief ȡӲͬȾʵֽӿ
-        * @param [in] rect : Ҫȡݵ
-        * @param [in] options : ȡѡ
-        * @param [out] lockedPitch : pitch
-        * @return Ӳݵַ
+        * @brief 获取锁定硬件缓冲区不同渲染器实现接口
+        * @param [in] rect : 要获取数据的区域
+        * @param [in] options : 获取数据选项
+        * @param [out] lockedPitch : 返回锁定区域的pitch
+        * @return 返回锁定的硬件数据地址
         * @see enum LockOptions
         */
         virtual void *lockImpl(const Rect &rect, LockOptions options, int32_t &lockedPitch) override;
 
         /**
-        * @brief Ӳ
+        * @brief 解锁硬件缓冲区
         */
         virtual void unlockImpl() override;
 
         /**
-        * @brief ԴimageȡݵĿ
-        * @param [in] image : Ҫȡͼ
-        * @param [in] srcRect : ԴĬΪnullptrʱ򣬱ʾԴĿ򣬻ԶƥĿ
-        * @param [in] dstRect : ĿĬΪnullptrʱ򣬱ʾĿ򣬻ԶƥԴ
-        * @return óɹtrue򷵻false
-        * @note dstRect  srcRect Ϊnullptrʱ򣬻ԶƥԴĿ
+        * @brief 按照源区域从image读取数据到目标区域
+        * @param [in] image : 要读取的图像对象
+        * @param [in] srcRect : 源数据区域，默认为nullptr的时候，表示整个源目标区域，会自动缩放匹配目标区域
+        * @param [in] dstRect : 目标数据区域，默认为nullptr的时候，表示整个目标区域，会自动缩放匹配源区域
+        * @return 调用成功返回true，否则返回false
+        * @note dstRect 和 srcRect 均为nullptr的时候，会自动缩放匹配源和目标区域
         */
         virtual bool readImage(const Image &image, Rect *srcRect = nullptr, Rect *dstRect = nullptr) override;
 
         /**
-        * @brief ָԴΧдimageĿ
-        * @param [in] image : Ҫдͼ
-        * @param [in] dstRect : ĿĬΪnullptrʱ򣬱ʾĿ򣬻ԶƥԴ
-        * @param [in] srcRect : ԴĬΪnullptrʱ򣬱ʾԴĿ򣬻ԶƥĿ
-        * @return óɹtrue򷵻false
-        * @note dstRect  srcRect Ϊnullptrʱ򣬻ԶƥԴĿ
+        * @brief 把指定源区域范围数据写到image的目标区域
+        * @param [in] image : 要写入的图像对象
+        * @param [in] dstRect : 目标区域，默认为nullptr的时候，表示整个目标区域，会自动缩放匹配源区域
+        * @param [in] srcRect : 源区域，默认为nullptr的时候，表示整个源目标区域，会自动缩放匹配目标区域
+        * @return 调用成功返回true，否则返回false
+        * @note dstRect 和 srcRect 均为nullptr的时候，会自动缩放匹配源和目标区域
         */
         virtual bool writeImage(Image &image, Rect *dstRect = nullptr, Rect *srcRect = nullptr) override;
 
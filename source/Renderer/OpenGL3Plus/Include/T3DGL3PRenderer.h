@@ -49,32 +49,33 @@ namespace Tiny3D
         virtual bool queryCapability(Capability cap) override;
         virtual void enableCapability(Capability cap, bool enabled = true) override;
 
-        virtual void setTransform(TransformState state, const Matrix4 &mat) override;
-
-        virtual const Matrix4 &getTransform(TransformState state) const override;
-
         virtual void setLightEnabled(bool enable) override;
         virtual void setAmbientLight(const Color4 &ambient) override;
         virtual void addDynamicLight(size_t index, const SGLightPtr light) override;
         virtual void removeDynamicLight(size_t index) override;
         virtual void removeAllDynamicLights() override;
 
-        virtual void setMaterial(const MaterialPtr &material) override;
+        virtual void setViewport(const ViewportPtr &viewport) override;
+
+    protected:
+        virtual void setTransformImpl(TransformState state, const Matrix4 &mat) override;
 
-        virtual void setCullingMode(CullingMode mode) override;
-        virtual void setRenderMode(RenderMode mode) override;
+        virtual void setMaterialImpl(const MaterialPtr &material) override;
 
-        virtual void setViewport(const ViewportPtr &viewport) override;
+        virtual void setCullingModeImpl(CullingMode mode) override;
+        virtual void setRenderModeImpl(RenderMode mode) override;
 
-        virtual void drawVertexList(PrimitiveType primitiveType,
+        virtual void bindVertexDataImpl(const VertexDataPtr &vertexData) override;
+        virtual void bindIndexDataImpl(const IndexDataPtr &indexData) override;
+
+        virtual void drawVertexListImpl(PrimitiveType primitiveType,
             const VertexDataPtr &vertexData, uint32_t startIdx,
             uint32_t primitiveCount) override;
 
-        virtual void drawIndexList(PrimitiveType primitiveType,
+        virtual void drawIndexListImpl(PrimitiveType primitiveType,
             const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
             uint32_t startIdx, uint32_t pritimitiveCount) override;
 
-    protected:
         virtual void makeProjectionMatrix(const Radian &rkFovY, Real aspect,
             Real nearDist, Real farDist, bool ortho, Matrix4 &mat) override;
 
@@ -79,13 +79,13 @@ namespace Tiny3D
                 dst = (uint8_t *)lock(rtDst, E_HBL_WRITE_ONLY, dstPitch);
             }
 
-            // ʱһͼڸ
+            // 临时构造一个图像对象，用于复制数据
             if (!temp.load(dst, rtDst.width(), rtDst.height(), bpp, dstPitch, mFormat))
             {
                 break;
             }
 
-            // ͼݵ
+            // 复制图像数据到纹理
             if (!temp.copy(image, srcRect))
             {
                 break;
@@ -126,13 +126,13 @@ namespace Tiny3D
                 rtSrc = Rect(0, 0, mWidth - 1, mHeight - 1);
             }
 
-            // ʱһͼڸ
+            // 临时构造一个图像对象，用于复制数据
             if (!temp.load(src, mWidth, mHeight, bpp, mPitch, mFormat))
             {
                 break;
             }
 
-            // ͼݵ
+            // 复制图像数据到纹理
             if (!image.copy(temp, dstRect))
             {
                 break;
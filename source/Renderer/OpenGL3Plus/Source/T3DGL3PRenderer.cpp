@@ -87,16 +87,11 @@ namespace Tiny3D
 
     }
 
-    void GL3PRenderer::setTransform(TransformState state, const Matrix4 &mat)
+    void GL3PRenderer::setTransformImpl(TransformState state, const Matrix4 &mat)
     {
         
     }
 
-    const Matrix4 &GL3PRenderer::getTransform(TransformState state) const
-    {
-        return Matrix4::IDENTITY;
-    }
-
     void GL3PRenderer::setLightEnabled(bool enable)
     {
         
@@ -122,17 +117,17 @@ namespace Tiny3D
 
     }
 
-    void GL3PRenderer::setMaterial(const MaterialPtr &material)
+    void GL3PRenderer::setMaterialImpl(const MaterialPtr &material)
     {
         
     }
 
-    void GL3PRenderer::setCullingMode(CullingMode mode)
+    void GL3PRenderer::setCullingModeImpl(CullingMode mode)
     {
         
     }
 
-    void GL3PRenderer::setRenderMode(RenderMode mode)
+    void GL3PRenderer::setRenderModeImpl(RenderMode mode)
     {
         
     }
@@ -142,14 +137,24 @@ namespace Tiny3D
         glViewport(viewport->getActualLeft(), viewport->getActualTop(), viewport->getActualWidth(), viewport->getActualHeight());
     }
 
-    void GL3PRenderer::drawVertexList(PrimitiveType primitiveType,
+    void GL3PRenderer::bindVertexDataImpl(const VertexDataPtr &vertexData)
+    {
+        
+    }
+
+    void GL3PRenderer::bindIndexDataImpl(const IndexDataPtr &indexData)
+    {
+        
+    }
+
+    void GL3PRenderer::drawVertexListImpl(PrimitiveType primitiveType,
         const VertexDataPtr &vertexData, uint32_t startIdx,
         uint32_t primitiveCount)
     {
         
     }
 
-    void GL3PRenderer::drawIndexList(PrimitiveType primitiveType,
+    void GL3PRenderer::drawIndexListImpl(PrimitiveType primitiveType,
         const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
         uint32_t startIdx, uint32_t pritimitiveCount)
     {
@@ -176,11 +181,11 @@ namespace Tiny3D
 
     void GL3PRenderer::updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount)
     {
-        // ټ׶üƽԭ
+        // 快速计算视棱锥六个裁剪平面原理：
         //
-        //  V'ͶӰ任ĵ㣬VͶӰ任ǰϵĵ㣬MͶӰ任ɵã
+        //  假设点V'是投影变换后的点，V是投影变换前相机坐标系的点，M是投影变换矩阵，则可得：
         //      V' = M * V
-        //  
+        //  其中
         //      V' = (x' y' z' w')
         //
         //      V = (x y z w), (w = 1)
@@ -189,30 +194,30 @@ namespace Tiny3D
         //      M = | m10 m11 m12 m13 |
         //          | m20 m21 m22 m23 |
         //          | m30 m31 m32 m33 |
-        //  
+        //  则
         //      | m00 m01 m02 m03 |   | x |   | x*m00 + y*m01 + z*m02 + w*m03 |   | V * row0 |
         //      | m10 m11 m12 m13 |   | y |   | x*m10 + y*m11 + z*m12 + w*m13 |   | V * row1 |
         //      | m20 m21 m22 m23 | * | z | = | x*m20 + y*m21 + z*m22 + w*m23 | = | V * row2 |
         //      | m30 m31 m32 m33 |   | w |   | x*m30 + y*m31 + z*m32 + w*m33 |   | V * row3 |
         //
-        //  *rowi = (mi0 mi1 mi2 mi3)
+        //  这里的*代表点积，而rowi = (mi0 mi1 mi2 mi3)
         // 
-        //  תV'βüռռʵѾһĺӡ
-        //  V'ӿռ任ǰVҲûо任ĺӿռ
-        //  ҪһDXOpenGLΪͶӰռ䲻һ
+        //  经过转换后，V'在齐次裁剪空间里。这个空间实际上现在已经是一个轴对齐的盒子。
+        //  如果V'在这个盒子空间里，则变换前的V点也在这个没有经过变换的盒子空间里。
+        //  这里要分一下DX和OpenGL的区别，因为投影空间不一样：
         //
-        //      1DXV'ռĲʽ
+        //      1、在DX里，V'在这个空间里，则符合下面的不等式规则
         //              -w' < x' < w'
         //              -w' < y' < w'
         //               0 < z' < w'
-        //           -w' < x' Ƶ
+        //          用 -w' < x' 推导：
         //              -(V * row3) < (V * row0)
-        //          ƶã
+        //          移动项得：
         //              0 < (V * row3) + (V * row0)
-        //          ϲͬտɵã
+        //          合并同类项，最终可得：
         //              0 < V * (row3 + row0)
         //
-        //          ƿɵã
+        //          如此类推可得：
         //              left    :   0 < V * (row3 + row0)   a=m30+m00, b=m31+m01, c=m32+m02, d=m33+m03
         //              right   :   0 < V * (row3 - row0)   a=m30-m00, b=m31-m01, c=m32-m02, d=m33-m03
         //              bottom  :   0 < V * (row3 + row1)   a=m30+m10, b=m31+m11, c=m32+m12, d=m33+m13
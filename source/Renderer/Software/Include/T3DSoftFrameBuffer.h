@@ -0,0 +1,80 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SOFT_FRAME_BUFFER_H__
+#define __T3D_SOFT_FRAME_BUFFER_H__
+
+
+#include "T3DSoftPrerequisites.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 软件渲染器的渲染目标，放在系统内存里的颜色缓冲和深度缓冲
+     * @note 颜色是A8R8G8B8格式，深度是[0, 1]之间的浮点数，都按行紧密排列
+     */
+    class T3D_SOFTRENDERER_API SoftFrameBuffer
+    {
+    public:
+        SoftFrameBuffer();
+        ~SoftFrameBuffer();
+
+        /**
+         * @brief 重新分配缓冲，原来的内容会丢失
+         */
+        void resize(int32_t width, int32_t height);
+
+        int32_t getWidth() const        { return mWidth; }
+        int32_t getHeight() const       { return mHeight; }
+
+        uint32_t *getColorBuffer()              { return mColor; }
+        const uint32_t *getColorBuffer() const  { return mColor; }
+
+        float *getDepthBuffer()                 { return mDepth; }
+        const float *getDepthBuffer() const     { return mDepth; }
+
+        /**
+         * @brief 返回指定像素的颜色，用于检查渲染结果
+         */
+        uint32_t getPixel(int32_t x, int32_t y) const
+        {
+            return mColor[y * mWidth + x];
+        }
+
+        /**
+         * @brief 把颜色缓冲保存成图像文件
+         * @param [in] path : 文件路径
+         * @param [in] fileType : 文件类型，见Image::FILETYPE_XXX
+         */
+        bool save(const String &path, const String &fileType = Image::FILETYPE_PNG) const;
+
+    protected:
+        SoftFrameBuffer(const SoftFrameBuffer &);
+        SoftFrameBuffer &operator =(const SoftFrameBuffer &);
+
+        uint32_t    *mColor;        /// 颜色缓冲
+        float       *mDepth;        /// 深度缓冲
+        int32_t     mWidth;         /// 宽度
+        int32_t     mHeight;        /// 高度
+    };
+}
+
+
+#endif  /*__T3D_SOFT_FRAME_BUFFER_H__*/
@@ -0,0 +1,162 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SOFT_RASTERIZER_H__
+#define __T3D_SOFT_RASTERIZER_H__
+
+
+#include "T3DSoftPrerequisites.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 基于屏幕分块的多线程三角形光栅化器
+     * @remarks 渲染线程提交的三角形先做建立（边函数和属性平面方程），
+     *      再按包围盒分到所覆盖的屏幕块里。flush时每个块作为一个任务交给任务调度器，
+     *      一个块只由一个线程处理，块内按提交顺序光栅化，所以不需要加锁，
+     *      混合顺序也和提交顺序一致。
+     *      像素内外测试和深度插值按4个像素一组计算，循环写成编译器能自动向量化的形式。
+     */
+    class T3D_SOFTRENDERER_API SoftRasterizer
+    {
+    public:
+        enum
+        {
+            TILE_SIZE = 64,         /// 屏幕块边长，单位像素
+        };
+
+        /**
+         * @brief 屏幕空间的顶点，已经做了透视除法和视口变换
+         */
+        struct Vertex
+        {
+            float   x, y;           /// 屏幕坐标，像素中心在0.5处
+            float   z;              /// 深度，[0, 1]
+            float   invW;           /// 裁剪空间w的倒数，用于透视校正
+            float   r, g, b, a;     /// 顶点颜色，[0, 1]
+            float   u, v;           /// 纹理坐标
+        };
+
+        SoftRasterizer();
+        ~SoftRasterizer();
+
+        /**
+         * @brief 开始往渲染目标的一个视口区域里绘制
+         * @param [in] target : 渲染目标
+         * @param [in] left, top, width, height : 视口区域，超出渲染目标的部分会被裁掉
+         * @param [in] clearColor : 清除颜色，A8R8G8B8格式，深度清成1
+         */
+        void begin(SoftFrameBuffer *target, int32_t left, int32_t top,
+            int32_t width, int32_t height, uint32_t clearColor);
+
+        /**
+         * @brief 提交一个三角形
+         * @param [in] v0, v1, v2 : 三角形顶点，顺序不限，背面剔除由调用者负责
+         * @param [in] texture : 纹理，没有纹理传nullptr
+         */
+        void drawTriangle(const Vertex &v0, const Vertex &v1, const Vertex &v2,
+            const MemoryHardwarePixelBuffer *texture);
+
+        /**
+         * @brief 光栅化所有提交的三角形，返回时结果已经写入渲染目标
+         */
+        void flush();
+
+        /**
+         * @brief 返回上一次flush光栅化的三角形数量
+         */
+        size_t getTriangleCount() const { return mLastTriangleCount; }
+
+    protected:
+        enum AttributeIndex
+        {
+            E_ATTR_Z = 0,           /// 深度
+            E_ATTR_INV_W,           /// 1/w
+            E_ATTR_R,               /// 下面都是除以w后的属性
+            E_ATTR_G,
+            E_ATTR_B,
+            E_ATTR_A,
+            E_ATTR_U,
+            E_ATTR_V,
+            E_ATTR_MAX
+        };
+
+        /**
+         * @brief 建立好的三角形
+         * @remarks 边函数 E(x, y) = a * x + b * y + c，三角形内部为正。
+         *      属性在屏幕空间是线性的，value(x, y) = dx * x + dy * y + c。
+         */
+        struct Triangle
+        {
+            float   edgeA[3];
+            float   edgeB[3];
+            float   edgeC[3];
+            bool    topLeft[3];             /// 是否左边或者上边，用于填充规则
+            float   attrDx[E_ATTR_MAX];
+            float   attrDy[E_ATTR_MAX];
+            float   attrC[E_ATTR_MAX];
+            int32_t minX, minY;             /// 包围盒，已经裁剪到视口
+            int32_t maxX, maxY;
+            const MemoryHardwarePixelBuffer *texture;
+        };
+
+        typedef std::vector<Triangle>           Triangles;
+        typedef std::vector<uint32_t>           TriangleIndices;
+        typedef std::vector<TriangleIndices>    Bins;
+        typedef std::vector<uint32_t>           Tiles;
+
+        SoftRasterizer(const SoftRasterizer &);
+        SoftRasterizer &operator =(const SoftRasterizer &);
+
+        /**
+         * @brief 清除并光栅化一个屏幕块
+         */
+        void rasterizeTile(uint32_t tile);
+
+        /**
+         * @brief 在屏幕块区域里光栅化一个三角形
+         */
+        void rasterizeTriangle(const Triangle &tri, int32_t x0, int32_t y0,
+            int32_t x1, int32_t y1);
+
+        /**
+         * @brief 光栅化一段屏幕块，在任务调度器的线程上调用
+         */
+        static void rasterizeProcedure(void *context, size_t begin, size_t end);
+
+        SoftFrameBuffer     *mTarget;       /// 当前渲染目标
+        int32_t             mLeft;          /// 当前视口区域，已经裁剪到渲染目标
+        int32_t             mTop;
+        int32_t             mRight;         /// 不包含
+        int32_t             mBottom;        /// 不包含
+        uint32_t            mClearColor;    /// 清除颜色
+        bool                mNeedClear;     /// 下一次flush是否先清除视口
+        int32_t             mTilesX;        /// 水平方向屏幕块数量
+        int32_t             mTilesY;        /// 垂直方向屏幕块数量
+
+        Triangles           mTriangles;     /// 本批提交的三角形
+        Bins                mBins;          /// 每个屏幕块覆盖的三角形，按提交顺序
+        Tiles               mTiles;         /// 本批要处理的屏幕块
+        size_t              mLastTriangleCount;
+    };
+}
+
+
+#endif  /*__T3D_SOFT_RASTERIZER_H__*/
@@ -0,0 +1,74 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SOFT_RENDER_WINDOW_H__
+#define __T3D_SOFT_RENDER_WINDOW_H__
+
+
+#include "T3DSoftPrerequisites.h"
+#include "T3DSoftFrameBuffer.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 没有窗口系统的渲染窗口，持有软件渲染器的渲染目标
+     * @note 配置文件Render里的选项：
+     *      MaxFrames大于0时，渲染了这么多帧后自动退出主循环；
+     *      CaptureFrame大于0时，把这一帧的渲染结果保存到CapturePath指定的PNG文件。
+     */
+    class SoftRenderWindow : public RenderWindow
+    {
+    public:
+        SoftRenderWindow();
+        virtual ~SoftRenderWindow();
+
+        virtual bool create(
+            const String &name,
+            const RenderWindowCreateParam &rkCreateParams,
+            const RenderWindowCreateParamEx &rkCreateParamEx) override;
+
+        virtual void destroy() override;
+
+        virtual void swapBuffers() override;
+
+        virtual bool isFullScreen() const override;
+
+        /**
+         * @brief 返回渲染目标
+         */
+        SoftFrameBuffer *getFrameBuffer()   { return &mFrameBuffer; }
+
+        /**
+         * @brief 返回已经交换缓冲的帧数
+         */
+        uint32_t getFrameCount() const  { return mFrameCount; }
+
+    protected:
+        SoftFrameBuffer mFrameBuffer;       /// 渲染目标
+        String          mCapturePath;       /// 保存渲染结果的文件路径
+        uint32_t        mCaptureFrame;      /// 保存第几帧的渲染结果，0表示不保存
+        uint32_t        mFrameCount;        /// 已经渲染的帧数
+        uint32_t        mMaxFrames;         /// 最多渲染的帧数，0表示不限制
+        bool            mIsFullScreen;
+    };
+}
+
+
+#endif  /*__T3D_SOFT_RENDER_WINDOW_H__*/
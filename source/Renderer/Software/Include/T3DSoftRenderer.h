@@ -0,0 +1,214 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#ifndef __T3D_SOFT_RENDERER_H__
+#define __T3D_SOFT_RENDERER_H__
+
+
+#include "T3DSoftPrerequisites.h"
+#include "T3DSoftRasterizer.h"
+#include "Render/T3DRenderer.h"
+#include "Render/T3DHardwareBufferManager.h"
+
+
+namespace Tiny3D
+{
+    /**
+     * @brief 在CPU上光栅化的软件渲染器
+     * @remarks 顶点在渲染线程上变换、图元装配、近平面裁剪和背面剔除，
+     *      然后交给SoftRasterizer按屏幕块多线程光栅化到系统内存里的渲染目标。
+     *      支持所有图元类型、深度测试、三种裁剪模式和三种渲染模式，
+     *      颜色取自顶点颜色或者材质漫反射颜色，实体模式下再乘以第一层纹理。
+     *      不支持光照，变换和投影采用和Direct3D9一样的约定。
+     */
+    class T3D_SOFTRENDERER_API SoftRenderer
+        : public Renderer
+        , public Singleton<SoftRenderer>
+    {
+    public:
+        SoftRenderer();
+        virtual ~SoftRenderer();
+
+        virtual String getName() const override;
+
+        virtual RenderWindow *createRenderWindow(
+            const RenderWindowCreateParam &rkCreateParam,
+            const RenderWindowCreateParamEx &rkCreateParamEx) override;
+
+        virtual bool initialize() override;
+        virtual void uninitialize() override;
+
+        virtual bool beginRender(const Color4 &bkgndColor) override;
+        virtual bool endRender() override;
+
+        virtual bool queryCapability(Capability cap) override;
+        virtual void enableCapability(Capability cap, bool enabled = true) override;
+
+        virtual void setLightEnabled(bool enable) override;
+        virtual void setAmbientLight(const Color4 &ambient) override;
+        virtual void addDynamicLight(size_t index, const SGLightPtr light) override;
+        virtual void removeDynamicLight(size_t index) override;
+        virtual void removeAllDynamicLights() override;
+
+        virtual void setViewport(const ViewportPtr &viewport) override;
+
+        virtual void makeProjectionMatrix(const Radian &rkFovY, Real aspect,
+            Real nearDist, Real farDist, bool ortho, Matrix4 &mat) override;
+
+        virtual void makeViewportMatrix(ViewportPtr viewport, Matrix4 &mat) override;
+
+        virtual void updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount) override;
+
+        /**
+         * @brief 设置渲染目标，由渲染窗口创建时调用
+         */
+        void setFrameBuffer(SoftFrameBuffer *frameBuffer)   { mFrameBuffer = frameBuffer; }
+
+        /**
+         * @brief 返回当前渲染目标
+         */
+        SoftFrameBuffer *getFrameBuffer() const { return mFrameBuffer; }
+
+        /**
+         * @brief 返回光栅化器，可以用来调整光栅化线程数量
+         */
+        SoftRasterizer &getRasterizer()         { return mRasterizer; }
+
+        /**
+         * @brief 结束一帧，由渲染窗口交换缓冲时调用
+         */
+        void presentFrame();
+
+        /**
+         * @brief 返回已经完成的帧数
+         */
+        uint32_t getFrameCount() const  { return mFrameCount; }
+
+        /**
+         * @brief 返回上一帧光栅化的三角形数量
+         */
+        size_t getTriangleCount() const { return mLastTriangleCount; }
+
+    protected:
+        /**
+         * @brief 裁剪空间的顶点
+         */
+        struct ClipVertex
+        {
+            float   x, y, z, w;     /// 裁剪空间坐标
+            float   r, g, b, a;     /// 顶点颜色
+            float   u, v;           /// 纹理坐标
+        };
+
+        typedef std::vector<ClipVertex>     ClipVertices;
+        typedef std::vector<uint32_t>       Indices;
+
+        virtual void setTransformImpl(TransformState state, const Matrix4 &mat) override;
+
+        virtual void setMaterialImpl(const MaterialPtr &material) override;
+
+        virtual void setCullingModeImpl(CullingMode mode) override;
+        virtual void setRenderModeImpl(RenderMode mode) override;
+
+        virtual void bindVertexDataImpl(const VertexDataPtr &vertexData) override;
+        virtual void bindIndexDataImpl(const IndexDataPtr &indexData) override;
+
+        virtual void drawVertexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertexData, uint32_t startIdx,
+            uint32_t primitiveCount) override;
+
+        virtual void drawIndexListImpl(PrimitiveType primitiveType,
+            const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
+            uint32_t startIdx, uint32_t pritimitiveCount) override;
+
+        /**
+         * @brief 返回绘制指定数量的图元需要的顶点数量
+         */
+        static size_t getVertexCount(PrimitiveType primitiveType, uint32_t primitiveCount);
+
+        /**
+         * @brief 把顶点数据变换到裁剪空间
+         * @return 没有位置数据或者顶点缓冲不是系统内存缓冲时返回false
+         */
+        bool transformVertices(const VertexDataPtr &vertexData);
+
+        /**
+         * @brief 按图元类型装配并绘制图元
+         * @param [in] indices : 顶点索引，数量和图元数量匹配
+         * @param [in] primitiveCount : 图元数量
+         */
+        void drawPrimitives(PrimitiveType primitiveType, const uint32_t *indices,
+            uint32_t primitiveCount);
+
+        /**
+         * @brief 裁剪、剔除并绘制一个三角形
+         */
+        void drawTriangle(uint32_t i0, uint32_t i1, uint32_t i2);
+
+        /**
+         * @brief 裁剪并绘制一条线段，线段展开成一个像素宽的四边形
+         */
+        void drawLine(const ClipVertex &c0, const ClipVertex &c1);
+
+        /**
+         * @brief 绘制一个点，点展开成一个像素大小的四边形
+         */
+        void drawPoint(const ClipVertex &c);
+
+        /**
+         * @brief 透视除法和视口变换
+         */
+        void project(const ClipVertex &c, SoftRasterizer::Vertex &v) const;
+
+        /**
+         * @brief 求两个裁剪空间顶点的插值
+         */
+        static void lerp(const ClipVertex &c0, const ClipVertex &c1, float t, ClipVertex &c);
+
+    protected:
+        HardwareBufferManager       *mHardwareBufferMgr;
+        MemoryHardwareBufferManager *mSoftHwBufferMgr;
+
+        SoftRasterizer      mRasterizer;        /// 光栅化器
+        SoftFrameBuffer     *mFrameBuffer;      /// 渲染目标，由渲染窗口持有
+
+        const MemoryHardwarePixelBuffer *mTexture;  /// 当前材质的第一层纹理
+        Color4              mDiffuse;           /// 当前材质的漫反射颜色
+
+        Matrix4             mMatrixWVP;         /// 世界、观察、投影矩阵的乘积
+        bool                mIsMatrixDirty;     /// 变换改变后需要重新计算mMatrixWVP
+
+        ClipVertices        mClipVertices;      /// 变换后的顶点
+        Indices             mIndices;           /// 读出来的索引
+
+        int32_t             mViewportLeft;      /// 当前视口区域
+        int32_t             mViewportTop;
+        int32_t             mViewportWidth;
+        int32_t             mViewportHeight;
+
+        uint32_t            mFrameCount;        /// 已经完成的帧数
+        size_t              mTriangleCount;     /// 本帧光栅化的三角形数量
+        size_t              mLastTriangleCount; /// 上一帧光栅化的三角形数量
+    };
+
+    #define SOFT_RENDERER           (SoftRenderer::getInstance())
+}
+
+
+#endif  /*__T3D_SOFT_RENDERER_H__*/
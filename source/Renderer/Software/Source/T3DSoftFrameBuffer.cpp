@@ -0,0 +1,82 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DSoftFrameBuffer.h"
+
+
+namespace Tiny3D
+{
+    SoftFrameBuffer::SoftFrameBuffer()
+        : mColor(nullptr)
+        , mDepth(nullptr)
+        , mWidth(0)
+        , mHeight(0)
+    {
+    }
+
+    SoftFrameBuffer::~SoftFrameBuffer()
+    {
+        T3D_SAFE_DELETE_ARRAY(mColor);
+        T3D_SAFE_DELETE_ARRAY(mDepth);
+    }
+
+    void SoftFrameBuffer::resize(int32_t width, int32_t height)
+    {
+        if (width == mWidth && height == mHeight)
+            return;
+
+        T3D_SAFE_DELETE_ARRAY(mColor);
+        T3D_SAFE_DELETE_ARRAY(mDepth);
+
+        mWidth = width;
+        mHeight = height;
+
+        if (width > 0 && height > 0)
+        {
+            size_t count = size_t(width) * size_t(height);
+            mColor = new uint32_t[count];
+            mDepth = new float[count];
+            memset(mColor, 0, count * sizeof(uint32_t));
+
+            size_t i = 0;
+            while (i < count)
+            {
+                mDepth[i] = 1.0f;
+                ++i;
+            }
+        }
+    }
+
+    bool SoftFrameBuffer::save(const String &path, const String &fileType /* = Image::FILETYPE_PNG */) const
+    {
+        if (mColor == nullptr)
+            return false;
+
+        Image image;
+        bool ret = image.load((uint8_t *)mColor, mWidth, mHeight, 32,
+            mWidth * sizeof(uint32_t), E_PF_A8R8G8B8, true);
+
+        if (ret)
+        {
+            ret = image.save(path, fileType);
+        }
+
+        return ret;
+    }
+}
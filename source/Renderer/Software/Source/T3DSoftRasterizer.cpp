@@ -0,0 +1,429 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DSoftRasterizer.h"
+#include "T3DSoftFrameBuffer.h"
+#include "T3DMemoryHardwarePixelBuffer.h"
+
+
+namespace Tiny3D
+{
+    SoftRasterizer::SoftRasterizer()
+        : mTarget(nullptr)
+        , mLeft(0)
+        , mTop(0)
+        , mRight(0)
+        , mBottom(0)
+        , mClearColor(0)
+        , mNeedClear(false)
+        , mTilesX(0)
+        , mTilesY(0)
+        , mLastTriangleCount(0)
+    {
+    }
+
+    SoftRasterizer::~SoftRasterizer()
+    {
+    }
+
+    void SoftRasterizer::rasterizeProcedure(void *context, size_t begin, size_t end)
+    {
+        SoftRasterizer *rasterizer = (SoftRasterizer *)context;
+
+        while (begin < end)
+        {
+            rasterizer->rasterizeTile(rasterizer->mTiles[begin]);
+            ++begin;
+        }
+    }
+
+    void SoftRasterizer::begin(SoftFrameBuffer *target, int32_t left, int32_t top,
+        int32_t width, int32_t height, uint32_t clearColor)
+    {
+        if (!mTriangles.empty())
+        {
+            flush();
+        }
+
+        mTarget = target;
+
+        if (mTarget == nullptr)
+            return;
+
+        mLeft = std::max(left, 0);
+        mTop = std::max(top, 0);
+        mRight = std::min(left + width, mTarget->getWidth());
+        mBottom = std::min(top + height, mTarget->getHeight());
+        mClearColor = clearColor;
+        mNeedClear = true;
+
+        mTilesX = (mTarget->getWidth() + TILE_SIZE - 1) / TILE_SIZE;
+        mTilesY = (mTarget->getHeight() + TILE_SIZE - 1) / TILE_SIZE;
+
+        size_t tileCount = size_t(mTilesX) * size_t(mTilesY);
+        if (mBins.size() != tileCount)
+        {
+            mBins.resize(tileCount);
+        }
+    }
+
+    void SoftRasterizer::drawTriangle(const Vertex &v0, const Vertex &v1,
+        const Vertex &v2, const MemoryHardwarePixelBuffer *texture)
+    {
+        if (mTarget == nullptr || mLeft >= mRight || mTop >= mBottom)
+            return;
+
+        // 边函数要求三角形内部为正，面积为负时交换两个顶点
+        const Vertex *p0 = &v0;
+        const Vertex *p1 = &v1;
+        const Vertex *p2 = &v2;
+
+        float area2 = (p1->x - p0->x) * (p2->y - p0->y) - (p2->x - p0->x) * (p1->y - p0->y);
+
+        if (area2 < 0.0f)
+        {
+            std::swap(p1, p2);
+            area2 = -area2;
+        }
+
+        if (area2 <= 1e-8f)
+            return;
+
+        float minX = std::min(std::min(p0->x, p1->x), p2->x);
+        float minY = std::min(std::min(p0->y, p1->y), p2->y);
+        float maxX = std::max(std::max(p0->x, p1->x), p2->x);
+        float maxY = std::max(std::max(p0->y, p1->y), p2->y);
+
+        // 像素中心在x + 0.5，只有中心落在三角形里的像素才会被覆盖
+        Triangle tri;
+        tri.minX = std::max(int32_t(std::floor(minX - 0.5f)), mLeft);
+        tri.minY = std::max(int32_t(std::floor(minY - 0.5f)), mTop);
+        tri.maxX = std::min(int32_t(std::ceil(maxX - 0.5f)), mRight - 1);
+        tri.maxY = std::min(int32_t(std::ceil(maxY - 0.5f)), mBottom - 1);
+
+        if (tri.minX > tri.maxX || tri.minY > tri.maxY)
+            return;
+
+        // 边函数 E(p) = (vj.x - vi.x) * (p.y - vi.y) - (vj.y - vi.y) * (p.x - vi.x)
+        // 屏幕坐标y轴向下，这时候上边是水平向右的边，左边是向上的边
+        const Vertex *verts[3] = { p0, p1, p2 };
+
+        size_t i = 0;
+        while (i < 3)
+        {
+            const Vertex *vi = verts[i];
+            const Vertex *vj = verts[(i + 1) % 3];
+            float dx = vj->x - vi->x;
+            float dy = vj->y - vi->y;
+            tri.edgeA[i] = -dy;
+            tri.edgeB[i] = dx;
+            tri.edgeC[i] = dy * vi->x - dx * vi->y;
+            tri.topLeft[i] = (dy == 0.0f && dx > 0.0f) || dy < 0.0f;
+            ++i;
+        }
+
+        // 属性平面方程，除了深度以外都先乘以1/w，插值后再除回来做透视校正
+        float f0[E_ATTR_MAX] =
+        {
+            p0->z, p0->invW, p0->r * p0->invW, p0->g * p0->invW, p0->b * p0->invW,
+            p0->a * p0->invW, p0->u * p0->invW, p0->v * p0->invW
+        };
+        float f1[E_ATTR_MAX] =
+        {
+            p1->z, p1->invW, p1->r * p1->invW, p1->g * p1->invW, p1->b * p1->invW,
+            p1->a * p1->invW, p1->u * p1->invW, p1->v * p1->invW
+        };
+        float f2[E_ATTR_MAX] =
+        {
+            p2->z, p2->invW, p2->r * p2->invW, p2->g * p2->invW, p2->b * p2->invW,
+            p2->a * p2->invW, p2->u * p2->invW, p2->v * p2->invW
+        };
+
+        float invArea = 1.0f / area2;
+        float x10 = p1->x - p0->x;
+        float y10 = p1->y - p0->y;
+        float x20 = p2->x - p0->x;
+        float y20 = p2->y - p0->y;
+
+        i = 0;
+        while (i < E_ATTR_MAX)
+        {
+            float d1 = f1[i] - f0[i];
+            float d2 = f2[i] - f0[i];
+            tri.attrDx[i] = (d1 * y20 - d2 * y10) * invArea;
+            tri.attrDy[i] = (d2 * x10 - d1 * x20) * invArea;
+            tri.attrC[i] = f0[i] - tri.attrDx[i] * p0->x - tri.attrDy[i] * p0->y;
+            ++i;
+        }
+
+        tri.texture = texture;
+
+        uint32_t index = uint32_t(mTriangles.size());
+        mTriangles.push_back(tri);
+
+        int32_t tx0 = tri.minX / TILE_SIZE;
+        int32_t ty0 = tri.minY / TILE_SIZE;
+        int32_t tx1 = tri.maxX / TILE_SIZE;
+        int32_t ty1 = tri.maxY / TILE_SIZE;
+
+        int32_t ty = ty0;
+        while (ty <= ty1)
+        {
+            int32_t tx = tx0;
+            while (tx <= tx1)
+            {
+                mBins[ty * mTilesX + tx].push_back(index);
+                ++tx;
+            }
+            ++ty;
+        }
+    }
+
+    void SoftRasterizer::flush()
+    {
+        if (mTarget == nullptr)
+            return;
+
+        mLastTriangleCount = mTriangles.size();
+
+        // 需要清除时视口里的块都要处理，否则只处理有三角形的块
+        mTiles.clear();
+
+        if (mLeft < mRight && mTop < mBottom)
+        {
+            int32_t ty = mTop / TILE_SIZE;
+            while (ty <= (mBottom - 1) / TILE_SIZE)
+            {
+                int32_t tx = mLeft / TILE_SIZE;
+                while (tx <= (mRight - 1) / TILE_SIZE)
+                {
+                    uint32_t tile = uint32_t(ty * mTilesX + tx);
+                    if (mNeedClear || !mBins[tile].empty())
+                    {
+                        mTiles.push_back(tile);
+                    }
+                    ++tx;
+                }
+                ++ty;
+            }
+        }
+
+        if (!mTiles.empty())
+        {
+            // 渲染线程也参与光栅化，所有块处理完才返回
+            TaskScheduler *scheduler = TaskScheduler::getInstancePtr();
+
+            if (scheduler != nullptr)
+            {
+                scheduler->parallelFor(mTiles.size(), 1, SoftRasterizer::rasterizeProcedure, this);
+            }
+            else
+            {
+                rasterizeProcedure(this, 0, mTiles.size());
+            }
+        }
+
+        // 只清空元素不释放容量，稳定运行后每帧不会再分配内存
+        Tiles::const_iterator itr = mTiles.begin();
+        while (itr != mTiles.end())
+        {
+            mBins[*itr].clear();
+            ++itr;
+        }
+
+        mTriangles.clear();
+        mNeedClear = false;
+    }
+
+    void SoftRasterizer::rasterizeTile(uint32_t tile)
+    {
+        int32_t tx = int32_t(tile) % mTilesX;
+        int32_t ty = int32_t(tile) / mTilesX;
+
+        int32_t x0 = std::max(tx * TILE_SIZE, mLeft);
+        int32_t y0 = std::max(ty * TILE_SIZE, mTop);
+        int32_t x1 = std::min(tx * TILE_SIZE + TILE_SIZE, mRight) - 1;
+        int32_t y1 = std::min(ty * TILE_SIZE + TILE_SIZE, mBottom) - 1;
+
+        if (mNeedClear)
+        {
+            int32_t width = mTarget->getWidth();
+            uint32_t *color = mTarget->getColorBuffer();
+            float *depth = mTarget->getDepthBuffer();
+
+            int32_t y = y0;
+            while (y <= y1)
+            {
+                int32_t x = x0;
+                while (x <= x1)
+                {
+                    color[y * width + x] = mClearColor;
+                    depth[y * width + x] = 1.0f;
+                    ++x;
+                }
+                ++y;
+            }
+        }
+
+        const TriangleIndices &bin = mBins[tile];
+        TriangleIndices::const_iterator itr = bin.begin();
+        while (itr != bin.end())
+        {
+            const Triangle &tri = mTriangles[*itr];
+            int32_t minX = std::max(x0, tri.minX);
+            int32_t minY = std::max(y0, tri.minY);
+            int32_t maxX = std::min(x1, tri.maxX);
+            int32_t maxY = std::min(y1, tri.maxY);
+
+            if (minX <= maxX && minY <= maxY)
+            {
+                rasterizeTriangle(tri, minX, minY, maxX, maxY);
+            }
+
+            ++itr;
+        }
+    }
+
+    void SoftRasterizer::rasterizeTriangle(const Triangle &tri, int32_t x0,
+        int32_t y0, int32_t x1, int32_t y1)
+    {
+        static const float lane[4] = { 0.5f, 1.5f, 2.5f, 3.5f };
+
+        int32_t width = mTarget->getWidth();
+        uint32_t *color = mTarget->getColorBuffer();
+        float *depth = mTarget->getDepthBuffer();
+
+        const int32_t tl0 = tri.topLeft[0] ? 1 : 0;
+        const int32_t tl1 = tri.topLeft[1] ? 1 : 0;
+        const int32_t tl2 = tri.topLeft[2] ? 1 : 0;
+
+        int32_t y = y0;
+        while (y <= y1)
+        {
+            float py = float(y) + 0.5f;
+            float row0 = tri.edgeB[0] * py + tri.edgeC[0];
+            float row1 = tri.edgeB[1] * py + tri.edgeC[1];
+            float row2 = tri.edgeB[2] * py + tri.edgeC[2];
+            float rowZ = tri.attrDy[E_ATTR_Z] * py + tri.attrC[E_ATTR_Z];
+
+            uint32_t *colorRow = color + y * width;
+            float *depthRow = depth + y * width;
+
+            int32_t x = x0;
+            while (x <= x1)
+            {
+                // 4个像素一组做内外测试和深度插值，下面的循环没有分支，可以自动向量化
+                float fx = float(x);
+                float w0[4], w1[4], w2[4], z[4];
+                int32_t inside[4];
+
+                int32_t k = 0;
+                for (k = 0; k < 4; ++k)
+                {
+                    float px = fx + lane[k];
+                    w0[k] = tri.edgeA[0] * px + row0;
+                    w1[k] = tri.edgeA[1] * px + row1;
+                    w2[k] = tri.edgeA[2] * px + row2;
+                    z[k] = tri.attrDx[E_ATTR_Z] * px + rowZ;
+                }
+
+                int32_t any = 0;
+                for (k = 0; k < 4; ++k)
+                {
+                    inside[k] = ((w0[k] > 0.0f) | ((w0[k] == 0.0f) & tl0))
+                        & ((w1[k] > 0.0f) | ((w1[k] == 0.0f) & tl1))
+                        & ((w2[k] > 0.0f) | ((w2[k] == 0.0f) & tl2));
+                    any |= inside[k];
+                }
+
+                if (any)
+                {
+                    int32_t count = std::min(4, x1 - x + 1);
+
+                    for (k = 0; k < count; ++k)
+                    {
+                        int32_t px = x + k;
+
+                        // 深度测试，小于等于通过
+                        if (!inside[k] || z[k] > depthRow[px])
+                            continue;
+
+                        float fpx = float(px) + 0.5f;
+                        float invW = tri.attrDx[E_ATTR_INV_W] * fpx
+                            + tri.attrDy[E_ATTR_INV_W] * py + tri.attrC[E_ATTR_INV_W];
+                        float w = 1.0f / invW;
+
+                        float attr[E_ATTR_MAX];
+                        int32_t i = E_ATTR_R;
+                        while (i < E_ATTR_MAX)
+                        {
+                            attr[i] = (tri.attrDx[i] * fpx + tri.attrDy[i] * py + tri.attrC[i]) * w;
+                            ++i;
+                        }
+
+                        float r = attr[E_ATTR_R];
+                        float g = attr[E_ATTR_G];
+                        float b = attr[E_ATTR_B];
+                        float a = attr[E_ATTR_A];
+
+                        if (tri.texture != nullptr)
+                        {
+                            uint32_t texel = tri.texture->sample(attr[E_ATTR_U], attr[E_ATTR_V]);
+                            const float inv255 = 1.0f / 255.0f;
+                            a *= float((texel >> 24) & 0xFF) * inv255;
+                            r *= float((texel >> 16) & 0xFF) * inv255;
+                            g *= float((texel >> 8) & 0xFF) * inv255;
+                            b *= float(texel & 0xFF) * inv255;
+                        }
+
+                        a = std::min(std::max(a, 0.0f), 1.0f);
+
+                        // 完全透明的像素丢弃，不写深度
+                        if (a <= 0.0f)
+                            continue;
+
+                        r = std::min(std::max(r, 0.0f), 1.0f);
+                        g = std::min(std::max(g, 0.0f), 1.0f);
+                        b = std::min(std::max(b, 0.0f), 1.0f);
+
+                        if (a < 1.0f)
+                        {
+                            const float inv255 = 1.0f / 255.0f;
+                            uint32_t dst = colorRow[px];
+                            float ia = 1.0f - a;
+                            r = r * a + float((dst >> 16) & 0xFF) * inv255 * ia;
+                            g = g * a + float((dst >> 8) & 0xFF) * inv255 * ia;
+                            b = b * a + float(dst & 0xFF) * inv255 * ia;
+                        }
+
+                        colorRow[px] = (uint32_t(a * 255.0f + 0.5f) << 24)
+                            | (uint32_t(r * 255.0f + 0.5f) << 16)
+                            | (uint32_t(g * 255.0f + 0.5f) << 8)
+                            | uint32_t(b * 255.0f + 0.5f);
+                        depthRow[px] = z[k];
+                    }
+                }
+
+                x += 4;
+            }
+
+            ++y;
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DSoftRenderWindow.h"
+#include "T3DSoftRenderer.h"
+
+
+namespace Tiny3D
+{
+    SoftRenderWindow::SoftRenderWindow()
+        : mCapturePath("capture.png")
+        , mCaptureFrame(0)
+        , mFrameCount(0)
+        , mMaxFrames(0)
+        , mIsFullScreen(false)
+    {
+    }
+
+    SoftRenderWindow::~SoftRenderWindow()
+    {
+        destroy();
+    }
+
+    bool SoftRenderWindow::create(const String &name, const RenderWindowCreateParam &rkCreateParams, const RenderWindowCreateParamEx &rkCreateParamEx)
+    {
+        mIsActive = true;
+        mIsFullScreen = rkCreateParams._fullscreen;
+        mWidth = rkCreateParams._windowWidth;
+        mHeight = rkCreateParams._windowHeight;
+        mColorDepth = rkCreateParams._colorDepth;
+        mName = name;
+
+        mFrameBuffer.resize(mWidth, mHeight);
+
+        Settings renderSettings = Entrance::getInstance().getConfig()["Render"].mapValue();
+        Settings::const_iterator itr = renderSettings.find(Variant(String("MaxFrames")));
+        if (itr != renderSettings.end())
+        {
+            mMaxFrames = itr->second.uint32Value();
+        }
+
+        itr = renderSettings.find(Variant(String("CaptureFrame")));
+        if (itr != renderSettings.end())
+        {
+            mCaptureFrame = itr->second.uint32Value();
+        }
+
+        itr = renderSettings.find(Variant(String("CapturePath")));
+        if (itr != renderSettings.end())
+        {
+            mCapturePath = itr->second.stringValue();
+        }
+
+        T3D_LOG_INFO("Create software render window %s (%d x %d), max frames %u",
+            name.c_str(), mWidth, mHeight, mMaxFrames);
+
+        return true;
+    }
+
+    void SoftRenderWindow::destroy()
+    {
+        if (mIsActive)
+        {
+            mIsActive = false;
+            Entrance::getInstance().shutdown();
+        }
+    }
+
+    void SoftRenderWindow::swapBuffers()
+    {
+        SOFT_RENDERER.presentFrame();
+
+        ++mFrameCount;
+
+        if (mCaptureFrame > 0 && mFrameCount == mCaptureFrame)
+        {
+            if (mFrameBuffer.save(mCapturePath))
+            {
+                T3D_LOG_INFO("Save frame %u to %s", mFrameCount, mCapturePath.c_str());
+            }
+            else
+            {
+                T3D_LOG_ERROR("Save frame %u to %s failed !", mFrameCount, mCapturePath.c_str());
+            }
+        }
+
+        if (mMaxFrames > 0 && mFrameCount >= mMaxFrames)
+        {
+            Entrance::getInstance().shutdown();
+        }
+    }
+
+    bool SoftRenderWindow::isFullScreen() const
+    {
+        return mIsFullScreen;
+    }
+}
@@ -0,0 +1,835 @@
+/***************************************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************************************/
+
+#include "T3DSoftRenderer.h"
+#include "T3DSoftRenderWindow.h"
+#include "T3DSoftFrameBuffer.h"
+#include "T3DMemoryHardwareBufferManager.h"
+#include "T3DMemoryHardwareVertexBuffer.h"
+#include "T3DMemoryHardwareIndexBuffer.h"
+#include "T3DMemoryHardwarePixelBuffer.h"
+
+
+namespace Tiny3D
+{
+    T3D_INIT_SINGLETON(SoftRenderer);
+
+    SoftRenderer::SoftRenderer()
+        : mHardwareBufferMgr(nullptr)
+        , mSoftHwBufferMgr(nullptr)
+        , mFrameBuffer(nullptr)
+        , mTexture(nullptr)
+        , mDiffuse(Color4::WHITE)
+        , mIsMatrixDirty(true)
+        , mViewportLeft(0)
+        , mViewportTop(0)
+        , mViewportWidth(0)
+        , mViewportHeight(0)
+        , mFrameCount(0)
+        , mTriangleCount(0)
+        , mLastTriangleCount(0)
+    {
+    }
+
+    SoftRenderer::~SoftRenderer()
+    {
+        uninitialize();
+    }
+
+    String SoftRenderer::getName() const
+    {
+        return SOFTWARE;
+    }
+
+    RenderWindow *SoftRenderer::createRenderWindow(
+        const RenderWindowCreateParam &rkCreateParam,
+        const RenderWindowCreateParamEx &rkCreateParamEx)
+    {
+        SoftRenderWindow *window = new SoftRenderWindow();
+        window->create("MainWindow", rkCreateParam, rkCreateParamEx);
+        attachRenderTarget(window);
+
+        mFrameBuffer = window->getFrameBuffer();
+
+        return window;
+    }
+
+    bool SoftRenderer::initialize()
+    {
+        // 硬件缓冲管理器是单例，和其他渲染器插件一起加载时只有激活的渲染器才能创建
+        if (mHardwareBufferMgr == nullptr)
+        {
+            mSoftHwBufferMgr = new MemoryHardwareBufferManager();
+            mHardwareBufferMgr = new HardwareBufferManager(mSoftHwBufferMgr);
+        }
+
+        mFrameCount = 0;
+        mTriangleCount = 0;
+        mLastTriangleCount = 0;
+
+        // 光栅化在任务调度器的线程上执行，渲染线程也参与
+        TaskScheduler *scheduler = TaskScheduler::getInstancePtr();
+        T3D_LOG_INFO("Software renderer initialized with %u raster threads",
+            (scheduler != nullptr ? scheduler->getThreadCount() : 1));
+
+        return true;
+    }
+
+    void SoftRenderer::uninitialize()
+    {
+        T3D_SAFE_RELEASE(mSoftHwBufferMgr);
+        T3D_SAFE_RELEASE(mHardwareBufferMgr);
+    }
+
+    bool SoftRenderer::beginRender(const Color4 &bkgndColor)
+    {
+        mRasterizer.begin(mFrameBuffer, mViewportLeft, mViewportTop,
+            mViewportWidth, mViewportHeight, bkgndColor.A8R8G8B8());
+        return true;
+    }
+
+    bool SoftRenderer::endRender()
+    {
+        mRasterizer.flush();
+        mTriangleCount += mRasterizer.getTriangleCount();
+        return true;
+    }
+
+    void SoftRenderer::presentFrame()
+    {
+        ++mFrameCount;
+        mLastTriangleCount = mTriangleCount;
+        mTriangleCount = 0;
+    }
+
+    bool SoftRenderer::queryCapability(Capability cap)
+    {
+        return false;
+    }
+
+    void SoftRenderer::enableCapability(Capability cap, bool enabled /* = true */)
+    {
+
+    }
+
+    void SoftRenderer::setTransformImpl(TransformState state, const Matrix4 &mat)
+    {
+        mIsMatrixDirty = true;
+    }
+
+    void SoftRenderer::setLightEnabled(bool enable)
+    {
+
+    }
+
+    void SoftRenderer::setAmbientLight(const Color4 &ambient)
+    {
+
+    }
+
+    void SoftRenderer::addDynamicLight(size_t index, const SGLightPtr light)
+    {
+
+    }
+
+    void SoftRenderer::removeDynamicLight(size_t index)
+    {
+
+    }
+
+    void SoftRenderer::removeAllDynamicLights()
+    {
+
+    }
+
+    void SoftRenderer::setMaterialImpl(const MaterialPtr &material)
+    {
+        mTexture = nullptr;
+        mDiffuse = Color4::WHITE;
+
+        if (material != nullptr)
+        {
+            mDiffuse = material->getDiffuseColor();
+
+            if (material->getNumTextureLayer() > 0)
+            {
+                TexturePtr texture = material->getTexture(0);
+                if (texture != nullptr && texture->getPixelBuffer() != nullptr)
+                {
+                    mTexture = (MemoryHardwarePixelBuffer *)smart_pointer_cast<MemoryHardwarePixelBuffer>(texture->getPixelBuffer());
+                }
+            }
+        }
+    }
+
+    void SoftRenderer::setCullingModeImpl(CullingMode mode)
+    {
+
+    }
+
+    void SoftRenderer::setRenderModeImpl(RenderMode mode)
+    {
+
+    }
+
+    void SoftRenderer::setViewport(const ViewportPtr &viewport)
+    {
+        mViewport = viewport;
+
+        if (viewport != nullptr)
+        {
+            mViewportLeft = viewport->getActualLeft();
+            mViewportTop = viewport->getActualTop();
+            mViewportWidth = viewport->getActualWidth();
+            mViewportHeight = viewport->getActualHeight();
+        }
+    }
+
+    void SoftRenderer::bindVertexDataImpl(const VertexDataPtr &vertexData)
+    {
+
+    }
+
+    void SoftRenderer::bindIndexDataImpl(const IndexDataPtr &indexData)
+    {
+
+    }
+
+    size_t SoftRenderer::getVertexCount(PrimitiveType primitiveType, uint32_t primitiveCount)
+    {
+        size_t count = 0;
+
+        switch (primitiveType)
+        {
+        case E_PT_POINT_LIST:
+            count = primitiveCount;
+            break;
+        case E_PT_LINE_LIST:
+            count = primitiveCount * 2;
+            break;
+        case E_PT_LINE_STRIP:
+            count = primitiveCount + 1;
+            break;
+        case E_PT_TRIANGLE_LIST:
+            count = primitiveCount * 3;
+            break;
+        case E_PT_TRIANGLE_STRIP:
+        case E_PT_TRIANGLE_FAN:
+            count = primitiveCount + 2;
+            break;
+        default:
+            break;
+        }
+
+        return count;
+    }
+
+    void SoftRenderer::drawVertexListImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertexData, uint32_t startIdx,
+        uint32_t primitiveCount)
+    {
+        if (!transformVertices(vertexData))
+            return;
+
+        size_t count = getVertexCount(primitiveType, primitiveCount);
+
+        if (count == 0 || startIdx + count > mClipVertices.size())
+            return;
+
+        mIndices.resize(count);
+
+        size_t i = 0;
+        while (i < count)
+        {
+            mIndices[i] = uint32_t(startIdx + i);
+            ++i;
+        }
+
+        drawPrimitives(primitiveType, &mIndices[0], primitiveCount);
+    }
+
+    void SoftRenderer::drawIndexListImpl(PrimitiveType primitiveType,
+        const VertexDataPtr &vertexData, const IndexDataPtr &indexData,
+        uint32_t startIdx, uint32_t pritimitiveCount)
+    {
+        if (indexData == nullptr || indexData->getIndexBuffer() == nullptr)
+            return;
+
+        if (!transformVertices(vertexData))
+            return;
+
+        MemoryHardwareIndexBuffer *indexBuffer = (MemoryHardwareIndexBuffer *)smart_pointer_cast<MemoryHardwareIndexBuffer>(indexData->getIndexBuffer());
+        size_t count = getVertexCount(primitiveType, pritimitiveCount);
+
+        if (count == 0 || indexBuffer->getData() == nullptr
+            || startIdx + count > indexBuffer->getIndexCount())
+            return;
+
+        mIndices.resize(count);
+
+        size_t i = 0;
+
+        if (indexBuffer->getIndexType() == HardwareIndexBuffer::E_IT_16BITS)
+        {
+            const uint16_t *src = (const uint16_t *)indexBuffer->getData() + startIdx;
+            while (i < count)
+            {
+                mIndices[i] = src[i];
+                ++i;
+            }
+        }
+        else
+        {
+            const uint32_t *src = (const uint32_t *)indexBuffer->getData() + startIdx;
+            while (i < count)
+            {
+                mIndices[i] = src[i];
+                ++i;
+            }
+        }
+
+        drawPrimitives(primitiveType, &mIndices[0], pritimitiveCount);
+    }
+
+    bool SoftRenderer::transformVertices(const VertexDataPtr &vertexData)
+    {
+        mClipVertices.clear();
+
+        if (vertexData == nullptr || vertexData->getDeclaration() == nullptr)
+            return false;
+
+        const VertexDeclarationPtr &decl = vertexData->getDeclaration();
+        const VertexElement *posElem = decl->findElementBySemantic(VertexElement::E_VES_POSITION);
+        const VertexElement *colorElem = decl->findElementBySemantic(VertexElement::E_VES_DIFFUSE);
+        const VertexElement *uvElem = decl->findElementBySemantic(VertexElement::E_VES_TEXCOORD);
+
+        if (posElem == nullptr || posElem->getStream() >= vertexData->getVertexBufferCount())
+            return false;
+
+        const MemoryHardwareVertexBuffer *posBuffer = (MemoryHardwareVertexBuffer *)smart_pointer_cast<MemoryHardwareVertexBuffer>(vertexData->getVertexBuffer(posElem->getStream()));
+        const MemoryHardwareVertexBuffer *colorBuffer = nullptr;
+        const MemoryHardwareVertexBuffer *uvBuffer = nullptr;
+
+        if (posBuffer == nullptr || posBuffer->getData() == nullptr)
+            return false;
+
+        if (colorElem != nullptr && colorElem->getType() == VertexElement::E_VET_COLOR
+            && colorElem->getStream() < vertexData->getVertexBufferCount())
+        {
+            colorBuffer = (MemoryHardwareVertexBuffer *)smart_pointer_cast<MemoryHardwareVertexBuffer>(vertexData->getVertexBuffer(colorElem->getStream()));
+        }
+
+        if (uvElem != nullptr && uvElem->getType() == VertexElement::E_VET_FLOAT2
+            && uvElem->getStream() < vertexData->getVertexBufferCount())
+        {
+            uvBuffer = (MemoryHardwareVertexBuffer *)smart_pointer_cast<MemoryHardwareVertexBuffer>(vertexData->getVertexBuffer(uvElem->getStream()));
+        }
+
+        if (mIsMatrixDirty)
+        {
+            mMatrixWVP = getTransform(E_TS_PROJECTION) * getTransform(E_TS_VIEW) * getTransform(E_TS_WORLD);
+            mIsMatrixDirty = false;
+        }
+
+        const Matrix4 &m = mMatrixWVP;
+        const float inv255 = 1.0f / 255.0f;
+
+        size_t count = posBuffer->getVertexCount();
+        mClipVertices.resize(count);
+
+        size_t i = 0;
+        while (i < count)
+        {
+            ClipVertex &c = mClipVertices[i];
+
+            const uint8_t *src = posBuffer->getData() + i * posBuffer->getVertexSize() + posElem->getOffset();
+            const float *pos = (const float *)src;
+            float x = pos[0];
+            float y = pos[1];
+            float z = posElem->getType() == VertexElement::E_VET_FLOAT2 ? 0.0f : pos[2];
+            float w = posElem->getType() == VertexElement::E_VET_FLOAT4 ? pos[3] : 1.0f;
+
+            c.x = float(m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3] * w);
+            c.y = float(m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3] * w);
+            c.z = float(m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3] * w);
+            c.w = float(m[3][0] * x + m[3][1] * y + m[3][2] * z + m[3][3] * w);
+
+            uint32_t color = mDiffuse.A8R8G8B8();
+
+            if (colorBuffer != nullptr && colorBuffer->getData() != nullptr)
+            {
+                src = colorBuffer->getData() + i * colorBuffer->getVertexSize() + colorElem->getOffset();
+                color = *(const uint32_t *)src;
+            }
+
+            c.a = float((color >> 24) & 0xFF) * inv255;
+            c.r = float((color >> 16) & 0xFF) * inv255;
+            c.g = float((color >> 8) & 0xFF) * inv255;
+            c.b = float(color & 0xFF) * inv255;
+
+            if (uvBuffer != nullptr && uvBuffer->getData() != nullptr)
+            {
+                src = uvBuffer->getData() + i * uvBuffer->getVertexSize() + uvElem->getOffset();
+                const float *uv = (const float *)src;
+                c.u = uv[0];
+                c.v = uv[1];
+            }
+            else
+            {
+                c.u = c.v = 0.0f;
+            }
+
+            ++i;
+        }
+
+        return true;
+    }
+
+    void SoftRenderer::drawPrimitives(PrimitiveType primitiveType,
+        const uint32_t *indices, uint32_t primitiveCount)
+    {
+        uint32_t vertexCount = uint32_t(mClipVertices.size());
+        uint32_t i = 0;
+
+        // 索引越界的图元直接丢弃
+        switch (primitiveType)
+        {
+        case E_PT_POINT_LIST:
+            {
+                while (i < primitiveCount)
+                {
+                    if (indices[i] < vertexCount)
+                    {
+                        drawPoint(mClipVertices[indices[i]]);
+                    }
+                    ++i;
+                }
+            }
+            break;
+        case E_PT_LINE_LIST:
+        case E_PT_LINE_STRIP:
+            {
+                uint32_t step = (primitiveType == E_PT_LINE_LIST ? 2 : 1);
+                while (i < primitiveCount)
+                {
+                    uint32_t i0 = indices[i * step];
+                    uint32_t i1 = indices[i * step + 1];
+                    if (i0 < vertexCount && i1 < vertexCount)
+                    {
+                        drawLine(mClipVertices[i0], mClipVertices[i1]);
+                    }
+                    ++i;
+                }
+            }
+            break;
+        case E_PT_TRIANGLE_LIST:
+            {
+                while (i < primitiveCount)
+                {
+                    drawTriangle(indices[i * 3], indices[i * 3 + 1], indices[i * 3 + 2]);
+                    ++i;
+                }
+            }
+            break;
+        case E_PT_TRIANGLE_STRIP:
+            {
+                // 奇数三角形交换前两个顶点，保持和第一个三角形一样的环绕顺序
+                while (i < primitiveCount)
+                {
+                    if (i & 1)
+                    {
+                        drawTriangle(indices[i + 1], indices[i], indices[i + 2]);
+                    }
+                    else
+                    {
+                        drawTriangle(indices[i], indices[i + 1], indices[i + 2]);
+                    }
+                    ++i;
+                }
+            }
+            break;
+        case E_PT_TRIANGLE_FAN:
+            {
+                while (i < primitiveCount)
+                {
+                    drawTriangle(indices[0], indices[i + 1], indices[i + 2]);
+                    ++i;
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    void SoftRenderer::drawTriangle(uint32_t i0, uint32_t i1, uint32_t i2)
+    {
+        uint32_t vertexCount = uint32_t(mClipVertices.size());
+
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+            return;
+
+        const ClipVertex *in[3] = { &mClipVertices[i0], &mClipVertices[i1], &mClipVertices[i2] };
+
+        // 用近平面 z = 0 裁剪，一个三角形最多裁剪成四边形
+        ClipVertex out[4];
+        size_t n = 0;
+
+        size_t i = 0;
+        while (i < 3)
+        {
+            const ClipVertex &cur = *in[i];
+            const ClipVertex &next = *in[(i + 1) % 3];
+            bool isCurIn = (cur.z >= 0.0f);
+            bool isNextIn = (next.z >= 0.0f);
+
+            if (isCurIn)
+            {
+                out[n++] = cur;
+            }
+
+            if (isCurIn != isNextIn)
+            {
+                lerp(cur, next, cur.z / (cur.z - next.z), out[n++]);
+            }
+
+            ++i;
+        }
+
+        if (n < 3)
+            return;
+
+        SoftRasterizer::Vertex verts[4];
+        float area2 = 0.0f;
+
+        i = 0;
+        while (i < n)
+        {
+            project(out[i], verts[i]);
+            ++i;
+        }
+
+        i = 0;
+        while (i < n)
+        {
+            const SoftRasterizer::Vertex &v0 = verts[i];
+            const SoftRasterizer::Vertex &v1 = verts[(i + 1) % n];
+            area2 += v0.x * v1.y - v1.x * v0.y;
+            ++i;
+        }
+
+        // 屏幕坐标y轴向下，面积为正的是看起来顺时针的三角形
+        if (mCullingMode == E_CULL_CLOCKWISE && area2 > 0.0f)
+            return;
+
+        if (mCullingMode == E_CULL_ANTICLOCKWISE && area2 < 0.0f)
+            return;
+
+        switch (mRenderMode)
+        {
+        case E_RM_POINT:
+            {
+                i = 0;
+                while (i < 3)
+                {
+                    drawPoint(*in[i]);
+                    ++i;
+                }
+            }
+            break;
+        case E_RM_WIREFRAME:
+            {
+                i = 0;
+                while (i < n)
+                {
+                    drawLine(out[i], out[(i + 1) % n]);
+                    ++i;
+                }
+            }
+            break;
+        default:
+            {
+                i = 1;
+                while (i + 1 < n)
+                {
+                    mRasterizer.drawTriangle(verts[0], verts[i], verts[i + 1], mTexture);
+                    ++i;
+                }
+            }
+            break;
+        }
+    }
+
+    void SoftRenderer::drawLine(const ClipVertex &c0, const ClipVertex &c1)
+    {
+        bool isIn0 = (c0.z >= 0.0f);
+        bool isIn1 = (c1.z >= 0.0f);
+
+        if (!isIn0 && !isIn1)
+            return;
+
+        ClipVertex p0 = c0;
+        ClipVertex p1 = c1;
+
+        if (!isIn0)
+        {
+            lerp(c0, c1, c0.z / (c0.z - c1.z), p0);
+        }
+        else if (!isIn1)
+        {
+            lerp(c0, c1, c0.z / (c0.z - c1.z), p1);
+        }
+
+        SoftRasterizer::Vertex v0, v1;
+        project(p0, v0);
+        project(p1, v1);
+
+        // 沿线段法线方向各扩展半个像素
+        float dx = v1.x - v0.x;
+        float dy = v1.y - v0.y;
+        float len = std::sqrt(dx * dx + dy * dy);
+
+        if (len < 1e-6f)
+        {
+            dx = 1.0f;
+            dy = 0.0f;
+            len = 1.0f;
+        }
+
+        float nx = -dy / len * 0.5f;
+        float ny = dx / len * 0.5f;
+
+        SoftRasterizer::Vertex quad[4] = { v0, v0, v1, v1 };
+        quad[0].x += nx;
+        quad[0].y += ny;
+        quad[1].x -= nx;
+        quad[1].y -= ny;
+        quad[2].x -= nx;
+        quad[2].y -= ny;
+        quad[3].x += nx;
+        quad[3].y += ny;
+
+        mRasterizer.drawTriangle(quad[0], quad[1], quad[2], nullptr);
+        mRasterizer.drawTriangle(quad[0], quad[2], quad[3], nullptr);
+    }
+
+    void SoftRenderer::drawPoint(const ClipVertex &c)
+    {
+        if (c.z < 0.0f || c.w <= 0.0f)
+            return;
+
+        SoftRasterizer::Vertex v;
+        project(c, v);
+
+        SoftRasterizer::Vertex quad[4] = { v, v, v, v };
+        quad[0].x -= 0.5f;
+        quad[0].y -= 0.5f;
+        quad[1].x += 0.5f;
+        quad[1].y -= 0.5f;
+        quad[2].x += 0.5f;
+        quad[2].y += 0.5f;
+        quad[3].x -= 0.5f;
+        quad[3].y += 0.5f;
+
+        mRasterizer.drawTriangle(quad[0], quad[1], quad[2], nullptr);
+        mRasterizer.drawTriangle(quad[0], quad[2], quad[3], nullptr);
+    }
+
+    void SoftRenderer::project(const ClipVertex &c, SoftRasterizer::Vertex &v) const
+    {
+        float invW = 1.0f / c.w;
+
+        // 和Direct3D9一样，NDC的y轴向上，屏幕的y轴向下
+        v.x = float(mViewportLeft) + (c.x * invW + 1.0f) * 0.5f * float(mViewportWidth);
+        v.y = float(mViewportTop) + (1.0f - c.y * invW) * 0.5f * float(mViewportHeight);
+        v.z = c.z * invW;
+        v.invW = invW;
+        v.r = c.r;
+        v.g = c.g;
+        v.b = c.b;
+        v.a = c.a;
+        v.u = c.u;
+        v.v = c.v;
+    }
+
+    void SoftRenderer::lerp(const ClipVertex &c0, const ClipVertex &c1, float t, ClipVertex &c)
+    {
+        c.x = c0.x + (c1.x - c0.x) * t;
+        c.y = c0.y + (c1.y - c0.y) * t;
+        c.z = c0.z + (c1.z - c0.z) * t;
+        c.w = c0.w + (c1.w - c0.w) * t;
+        c.r = c0.r + (c1.r - c0.r) * t;
+        c.g = c0.g + (c1.g - c0.g) * t;
+        c.b = c0.b + (c1.b - c0.b) * t;
+        c.a = c0.a + (c1.a - c0.a) * t;
+        c.u = c0.u + (c1.u - c0.u) * t;
+        c.v = c0.v + (c1.v - c0.v) * t;
+    }
+
+    void SoftRenderer::makeProjectionMatrix(const Radian &rkFovY, Real aspect,
+        Real nearDist, Real farDist, bool ortho, Matrix4 &mat)
+    {
+        if (ortho)
+        {
+            // 正交投影
+            Real h = Real(2.0);
+            Real w = h / aspect;
+            Real q = Real(1.0) / (nearDist - farDist);
+            Real qn = nearDist * q;
+
+            mat.makeZero();
+            mat[0][0] = w;
+            mat[1][1] = h;
+            mat[2][2] = q;
+            mat[2][3] = qn;
+            mat[3][3] = 1.0;
+        }
+        else
+        {
+            // 透视投影
+            //          | w 0  0  0 |
+            //          | 0 h  0  0 |
+            //      M = | 0 0  q qn |
+            //          | 0 0 -1  0 |
+            // 其中
+            //      w = 1.0 / tan(Y/2) / aspect_ratio
+            //      h = 1.0 / tan(Y/2)
+            //      q = f / (n - f)
+            //      qn = n * f / (n - f)
+
+            Real tanThetaY = Math::Tan(rkFovY * Real(0.5));
+            Real h = Real(1.0) / (tanThetaY);
+            Real w = h / aspect;
+            Real q = farDist / (nearDist - farDist);
+            Real qn = nearDist * q;
+
+            mat.makeZero();
+            mat[0][0] = w;
+            mat[1][1] = h;
+            mat[2][2] = q;
+            mat[2][3] = qn;
+            mat[3][2] = -1.0;
+        }
+    }
+
+    void SoftRenderer::makeViewportMatrix(ViewportPtr viewport, Matrix4 &mat)
+    {
+        mat.makeZero();
+        mat[0][0] = viewport->getActualWidth() * Real(0.5);
+        mat[1][1] = -viewport->getActualHeight() * Real(0.5);
+        mat[2][2] = Real(1.0);
+        mat[3][3] = Real(1.0);
+        mat[0][3] = viewport->getActualLeft() + viewport->getActualWidth() * Real(0.5);
+        mat[1][3] = viewport->getActualTop() + viewport->getActualHeight() * Real(0.5);
+        mat[2][3] = Real(0.0);
+    }
+
+    void SoftRenderer::updateFrustum(const Matrix4 &m, Plane *plane, size_t planeCount)
+    {
+        // 快速计算视棱锥六个裁剪平面原理：
+        //
+        //  假设点V'是投影变换后的点，V是投影变换前相机坐标系的点，M是投影变换矩阵，则可得：
+        //      V' = M * V
+        //  其中
+        //      V' = (x' y' z' w')
+        //
+        //      V = (x y z w), (w = 1)
+        //
+        //          | m00 m01 m02 m03 |
+        //      M = | m10 m11 m12 m13 |
+        //          | m20 m21 m22 m23 |
+        //          | m30 m31 m32 m33 |
+        //  则
+        //      | m00 m01 m02 m03 |   | x |   | x*m00 + y*m01 + z*m02 + w*m03 |   | V * row0 |
+        //      | m10 m11 m12 m13 |   | y |   | x*m10 + y*m11 + z*m12 + w*m13 |   | V * row1 |
+        //      | m20 m21 m22 m23 | * | z | = | x*m20 + y*m21 + z*m22 + w*m23 | = | V * row2 |
+        //      | m30 m31 m32 m33 |   | w |   | x*m30 + y*m31 + z*m32 + w*m33 |   | V * row3 |
+        //
+        //  这里的*代表点积，而rowi = (mi0 mi1 mi2 mi3)
+        //
+        //  经过转换后，V'在齐次裁剪空间里。这个空间实际上现在已经是一个轴对齐的盒子。
+        //  如果V'在这个盒子空间里，则变换前的V点也在这个没有经过变换的盒子空间里。
+        //  这里要分一下DX和OpenGL的区别，因为投影空间不一样：
+        //
+        //      1、在DX里，V'在这个空间里，则符合下面的不等式规则
+        //              -w' < x' < w'
+        //              -w' < y' < w'
+        //               0 < z' < w'
+        //          用 -w' < x' 推导：
+        //              -(V * row3) < (V * row0)
+        //          移动项得：
+        //              0 < (V * row3) + (V * row0)
+        //          合并同类项，最终可得：
+        //              0 < V * (row3 + row0)
+        //
+        //          如此类推可得：
+        //              left    :   0 < V * (row3 + row0)   a=m30+m00, b=m31+m01, c=m32+m02, d=m33+m03
+        //              right   :   0 < V * (row3 - row0)   a=m30-m00, b=m31-m01, c=m32-m02, d=m33-m03
+        //              bottom  :   0 < V * (row3 + row1)   a=m30+m10, b=m31+m11, c=m32+m12, d=m33+m13
+        //              top     :   0 < V * (row3 - row1)   a=m30-m10, b=m31-m11, c=m32-m12, d=m33-m13
+        //              near    :   0 < V * row2            a=m20,     b=m21,     c=m22,     d=m23
+        //              far     :   0 < V * (row3 - row2)   a=m30-m20, b=m31-m21, c=m32-m22, d=m33-m23
+        //
+
+        T3D_ASSERT(planeCount == Frustum::E_MAX_FACE);
+
+        // Left
+        plane[Frustum::E_FACE_LEFT][0] = m[3][0] + m[0][0];
+        plane[Frustum::E_FACE_LEFT][1] = m[3][1] + m[0][1];
+        plane[Frustum::E_FACE_LEFT][2] = m[3][2] + m[0][2];
+        plane[Frustum::E_FACE_LEFT][3] = m[3][3] + m[0][3];
+        plane[Frustum::E_FACE_LEFT].normalize();
+
+        // Right
+        plane[Frustum::E_FACE_RIGHT][0] = m[3][0] - m[0][0];
+        plane[Frustum::E_FACE_RIGHT][1] = m[3][1] - m[0][1];
+        plane[Frustum::E_FACE_RIGHT][2] = m[3][2] - m[0][2];
+        plane[Frustum::E_FACE_RIGHT][3] = m[3][3] - m[0][3];
+        plane[Frustum::E_FACE_RIGHT].normalize();
+
+        // Bottom
+        plane[Frustum::E_FACE_BOTTOM][0] = m[3][0] + m[1][0];
+        plane[Frustum::E_FACE_BOTTOM][1] = m[3][1] + m[1][1];
+        plane[Frustum::E_FACE_BOTTOM][2] = m[3][2] + m[1][2];
+        plane[Frustum::E_FACE_BOTTOM][3] = m[3][3] + m[1][3];
+        plane[Frustum::E_FACE_BOTTOM].normalize();
+
+        // Top
+        plane[Frustum::E_FACE_TOP][0] = m[3][0] - m[1][0];
+        plane[Frustum::E_FACE_TOP][1] = m[3][1] - m[1][1];
+        plane[Frustum::E_FACE_TOP][2] = m[3][2] - m[1][2];
+        plane[Frustum::E_FACE_TOP][3] = m[3][3] - m[1][3];
+        plane[Frustum::E_FACE_TOP].normalize();
+
+        // Near
+        plane[Frustum::E_FACE_NEAR][0] = m[2][0];
+        plane[Frustum::E_FACE_NEAR][1] = m[2][1];
+        plane[Frustum::E_FACE_NEAR][2] = m[2][2];
+        plane[Frustum::E_FACE_NEAR][3] = m[2][3];
+        plane[Frustum::E_FACE_NEAR].normalize();
+
+        // Far
+        plane[Frustum::E_FACE_FAR][0] = m[3][0] - m[2][0];
+        plane[Frustum::E_FACE_FAR][1] = m[3][1] - m[2][1];
+        plane[Frustum::E_FACE_FAR][2] = m[3][2] - m[2][2];
+        plane[Frustum::E_FACE_FAR][3] = m[3][3] - m[2][3];
+        plane[Frustum::E_FACE_FAR].normalize();
+    }
+
+}
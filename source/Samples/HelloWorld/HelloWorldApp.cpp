@@ -32,7 +32,7 @@ bool HelloWorldApp::applicationDidFinishLaunching()
 
     SGNodePtr root = T3D_SCENE_MGR.getRoot();
 
-    // 任
+    // 相机变换结点
     SGTransformNodePtr node = SGTransformNode::create();
     root->addChild(node);
     node->lookAt(Vector3(-1.0, 1.0, 2.0), Vector3::ZERO, Vector3::UNIT_Y);
@@ -41,7 +41,7 @@ bool HelloWorldApp::applicationDidFinishLaunching()
     Real height = mRenderWindow->getHeight();
 
     {
-        // 
+        // 相机结点
         SGCameraPtr camera = SGCamera::create();
         node->addChild(camera);
         camera->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
@@ -50,7 +50,7 @@ bool HelloWorldApp::applicationDidFinishLaunching()
         Real ratio = width / height;
         camera->setPerspective(fovY, ratio, 0.5, 1000.0);
 
-        // ӿ
+        // 视口
         ViewportPtr viewport = mRenderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
         viewport->setBackgroundColor(Color4::BLACK);
     }
@@ -45,14 +45,14 @@ bool CubeApp::applicationDidFinishLaunching()
 
     SGNodePtr root = T3D_SCENE_MGR.getRoot();
     
-    // 任
+    // 相机变换结点
     SGTransformNodePtr node = SGTransformNode::create();
     root->addChild(node);
 
     node->lookAt(Vector3(0.0, -200.0, 0.0), Vector3::ZERO, Vector3::UNIT_Z);
 //     node->lookAt(Vector3(0.0, 2.0, 10.0), Vector3::ZERO, Vector3::UNIT_Y);
 
-    // 
+    // 相机结点
     SGCameraPtr camera = SGCamera::create();
     node->addChild(camera);
     camera->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
@@ -61,18 +61,18 @@ bool CubeApp::applicationDidFinishLaunching()
     Real ratio = Real(960) / Real(640);
     camera->setPerspective(fovY, ratio, 0.5, 1000.0);
 
-    // ӿ
+    // 视口
     ViewportPtr viewport = mRenderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
     viewport->setBackgroundColor(Color4::BLACK);
 
-    // 任
+    // 变换结点
 //     node = SGTransformNode::create();
 //     root->addChild(node);
 //     node->setPosition(1.0, 0.0, 0.0);
 //     node->setOrientation(Radian(Math::PI * Real(0.5)), Vector3(0.0, 1.0, 0.0));
 // 
 //     {
-//         //  #1 任
+//         // 立方体 #1 变换结点
 //         SGTransformNodePtr node1 = SGTransformNode::create();
 //         node->addChild(node1);
 //         node1->setPosition(2.0, 0.0, 0.0);
@@ -80,70 +80,70 @@ bool CubeApp::applicationDidFinishLaunching()
 //         node1->setOrientation(Radian(Math::PI / Real(6.0)), Vector3(0.0, 1.0, 0.0));
 // 
 //         {
-//             //  #1 ɼ
+//             // 立方体 #1 可见物体结点
 //             SGShapePtr shape = SGShape::create();
 //             node1->addChild(shape);
 // 
 //             {
-//                 //  #1 Ⱦ
+//                 // 立方体 #1 可渲染物体结点
 //                 SGBoxPtr box = SGBox::create("");
 //                 shape->addChild(box);
 //             }
 //         }
 // 
-//         //  #2 任
+//         // 立方体 #2 变换结点
 //         SGTransformNodePtr node2 = SGTransformNode::create();
 //         node->addChild(node2);
 //         node2->setPosition(-1.0, 0.0, 0.0);
 // 
 //         {
-//             //  #2 ɼ
+//             // 立方体 #2 可见物体结点
 //             SGShapePtr shape = SGShape::create();
 //             node2->addChild(shape);
 // 
 //             {
-//                 //  #2 Ⱦ
+//                 // 立方体 #2 可渲染物体结点
 //                 SGBoxPtr box = SGBox::create("");
 //                 shape->addChild(box);
 //             }
 //         }
 // 
-//         //  #1 任
+//         // 球体 #1 变换结点
 //         SGTransformNodePtr node3 = SGTransformNode::create();
 //         node->addChild(node3);
 //         node3->setPosition(-4.0, 0.0, 0.0);
 // 
 //         {
-//             //  #1 ɼ
+//             // 球体 #1 可见物体结点
 //             SGShapePtr shape = SGShape::create();
 //             node3->addChild(shape);
 // 
 //             {
-//                 //  #1 Ⱦ
+//                 // 球体 #1 可渲染物体结点
 //                 SGSpherePtr sphere = SGSphere::create("");
 //                 shape->addChild(sphere);
 //             }
 //         }
 //     }
 // 
-//     //  #2 任
+//     // 球体 #2 变换结点
 //     node = SGTransformNode::create();
 //     root->addChild(node);
 //     node->setPosition(-10.0, 0.0, 0.0);
 // 
 //     {
-//         //  #2 ɼ
+//         // 球体 #2 可见物体结点
 //         SGShapePtr shape = SGShape::create();
 //         node->addChild(shape);
 // 
 //         {
-//             //  #2 Ⱦ
+//             // 球体 #2 可渲染物体结点
 //             SGSpherePtr sphere = SGSphere::create("");
 //             shape->addChild(sphere);
 //         }
 //     }
 
-    // ģ #1 任
+    // 模型 #1 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setPosition(0.0, 0.0, 0.0);
@@ -151,7 +151,7 @@ bool CubeApp::applicationDidFinishLaunching()
 //     node->setScale(10.0f, 10.0f, 10.0f);
 
     {
-        // ģ #1 ɼ
+        // 模型 #1 可见物体结点
 //         SGModelPtr model = SGModel::create("dahu01.tmt");
 //         SGModelPtr model = SGModel::create("knight.tmt");
         SGModelPtr model = SGModel::create("skeleton.tmt");
@@ -0,0 +1,682 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * You may use this sample code for anything you like, it is not covered by the
+ * same license as the rest of the engine.
+*******************************************************************************/
+
+// 相交检测的随机测试和性能测试。
+// 每一组随机生成的几何体都和暴力算法的结果比较，不一致的数量作为返回值，
+// 批量剔除和批量包围盒变换也逐个和暴力算法比较，
+// 然后对每个相交检测函数测量每次调用的耗时，对批量函数测量处理10万个包围体的耗时。
+// 用法：Demo_Intersection [随机测试次数]
+
+#include <T3DMath.h>
+#include <T3DAabb.h>
+#include <T3DObb.h>
+#include <T3DSphere.h>
+#include <T3DPlane.h>
+#include <T3DFrustum.h>
+#include <T3DBoundBatch.h>
+#include <T3DMatrix4.h>
+#include <T3DQuaternion.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <vector>
+
+
+using namespace Tiny3D;
+
+
+enum TestCase
+{
+    E_TEST_OBB_OBB = 0,
+    E_TEST_AABB_AABB,
+    E_TEST_AABB_OBB,
+    E_TEST_SPHERE_OBB,
+    E_TEST_AABB_PLANE,
+    E_TEST_OBB_PLANE,
+    E_TEST_SPHERE_PLANE,
+    E_TEST_OBB_FRUSTUM,
+    E_TEST_OBB_AABB_FRUSTUM,
+    E_TEST_MAX
+};
+
+static const char *TEST_NAMES[E_TEST_MAX] =
+{
+    "obb-obb",
+    "aabb-aabb",
+    "aabb-obb",
+    "sphere-obb",
+    "aabb-plane",
+    "obb-plane",
+    "sphere-plane",
+    "obb-frustum",
+    "obb=aabb-frustum",
+};
+
+static std::mt19937 sRandom(1234);
+
+static Real randomReal(Real minValue, Real maxValue)
+{
+    std::uniform_real_distribution<Real> dist(minValue, maxValue);
+    return dist(sRandom);
+}
+
+static Vector3 randomVector(Real range)
+{
+    return Vector3(randomReal(-range, range), randomReal(-range, range), randomReal(-range, range));
+}
+
+static Vector3 randomDirection()
+{
+    Vector3 dir = randomVector(Real(1.0));
+
+    while (dir.length() < Real(0.1))
+    {
+        dir = randomVector(Real(1.0));
+    }
+
+    dir.normalize();
+    return dir;
+}
+
+static Obb randomObb(Real range)
+{
+    // 随机的正交基
+    Vector3 axis0 = randomDirection();
+    Vector3 axis1 = axis0.cross(randomDirection());
+
+    while (axis1.length() < Real(0.1))
+    {
+        axis1 = axis0.cross(randomDirection());
+    }
+
+    axis1.normalize();
+    Vector3 axis2 = axis0.cross(axis1);
+
+    return Obb(randomVector(range), axis0, axis1, axis2,
+        randomReal(Real(0.1), Real(2.0)), randomReal(Real(0.1), Real(2.0)), randomReal(Real(0.1), Real(2.0)));
+}
+
+static Aabb randomAabb(Real range)
+{
+    Vector3 center = randomVector(range);
+    Real x = randomReal(Real(0.1), Real(2.0));
+    Real y = randomReal(Real(0.1), Real(2.0));
+    Real z = randomReal(Real(0.1), Real(2.0));
+    return Aabb(center.x() - x, center.x() + x, center.y() - y, center.y() + y, center.z() - z, center.z() + z);
+}
+
+static Plane randomPlane(Real range)
+{
+    return Plane(randomDirection(), randomVector(range));
+}
+
+static Sphere randomSphere(Real range)
+{
+    return Sphere(randomVector(range), randomReal(Real(0.1), Real(2.0)));
+}
+
+static Obb aabbToObb(const Aabb &box)
+{
+    Vector3 center((box.getMinX() + box.getMaxX()) * Real(0.5),
+        (box.getMinY() + box.getMaxY()) * Real(0.5),
+        (box.getMinZ() + box.getMaxZ()) * Real(0.5));
+    return Obb(center, Vector3::UNIT_X, Vector3::UNIT_Y, Vector3::UNIT_Z,
+        box.getWidth() * Real(0.5), box.getHeight() * Real(0.5), box.getDepth() * Real(0.5));
+}
+
+// 沿着-z（dir为1）或者+z（dir为-1）看的视景体，上下左右都是45度
+static Frustum makeFrustum(const Vector3 &eye, Real dir, Real nearDist, Real farDist)
+{
+    Frustum frustum;
+    const Real k = Real(0.70710678);
+    frustum.setFace(Frustum::E_FACE_NEAR, Plane(Vector3(0, 0, -dir), eye + Vector3(0, 0, -dir * nearDist)));
+    frustum.setFace(Frustum::E_FACE_FAR, Plane(Vector3(0, 0, dir), eye + Vector3(0, 0, -dir * farDist)));
+    frustum.setFace(Frustum::E_FACE_LEFT, Plane(Vector3(k, 0, -dir * k), eye));
+    frustum.setFace(Frustum::E_FACE_RIGHT, Plane(Vector3(-k, 0, -dir * k), eye));
+    frustum.setFace(Frustum::E_FACE_BOTTOM, Plane(Vector3(0, k, -dir * k), eye));
+    frustum.setFace(Frustum::E_FACE_TOP, Plane(Vector3(0, -k, -dir * k), eye));
+    return frustum;
+}
+
+//------------------------------------------------------------------------------
+// 暴力算法，只用顶点投影和逐点距离，不依赖被测函数
+
+// 两组顶点在轴上的投影区间不重叠就是分离的
+static bool isSeparatedOnAxis(const Vector3 *a, const Vector3 *b, const Vector3 &axis)
+{
+    Real minA = a[0].dot(axis), maxA = minA;
+    Real minB = b[0].dot(axis), maxB = minB;
+
+    for (int i = 1; i < 8; ++i)
+    {
+        Real p = a[i].dot(axis);
+        minA = std::min(minA, p);
+        maxA = std::max(maxA, p);
+        p = b[i].dot(axis);
+        minB = std::min(minB, p);
+        maxB = std::max(maxB, p);
+    }
+
+    return (maxA < minB || maxB < minA);
+}
+
+// 把两个盒子的15根候选分离轴都投影一遍
+static bool bruteObbObb(const Obb &box1, const Obb &box2)
+{
+    Vector3 a[8], b[8];
+    box1.computeVertices(a);
+    box2.computeVertices(b);
+
+    Vector3 axes[15];
+    int count = 0;
+    int i = 0, j = 0;
+
+    for (i = 0; i < 3; ++i)
+    {
+        axes[count++] = box1.getAxis(i);
+        axes[count++] = box2.getAxis(i);
+    }
+
+    for (i = 0; i < 3; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            axes[count++] = box1.getAxis(i).cross(box2.getAxis(j));
+        }
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        // 平行的两根轴叉积退化，跳过
+        if (axes[i].length() > Real(1e-4) && isSeparatedOnAxis(a, b, axes[i]))
+            return false;
+    }
+
+    return true;
+}
+
+static bool bruteAabbAabb(const Aabb &box1, const Aabb &box2)
+{
+    return box1.getMinX() <= box2.getMaxX() && box2.getMinX() <= box1.getMaxX()
+        && box1.getMinY() <= box2.getMaxY() && box2.getMinY() <= box1.getMaxY()
+        && box1.getMinZ() <= box2.getMaxZ() && box2.getMinZ() <= box1.getMaxZ();
+}
+
+// 球心变换到盒子的局部空间，逐轴累加到盒子的距离平方
+static bool bruteSphereObb(const Sphere &sphere, const Obb &box)
+{
+    Vector3 d = sphere.getCenter() - box.getCenter();
+    Real distSq = 0;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Real outside = std::max(Real(fabs(d.dot(box.getAxis(i)))) - box.getExtent(i), Real(0.0));
+        distSq += outside * outside;
+    }
+
+    return distSq <= sphere.getRadius() * sphere.getRadius();
+}
+
+// 顶点在平面两侧都有（包括在平面上）才相交
+static bool bruteBoxPlane(const Vector3 *vertices, const Plane &plane)
+{
+    bool hasFront = false, hasBack = false;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Real d = plane.distanceToPoint(vertices[i]);
+        hasFront = hasFront || d >= 0;
+        hasBack = hasBack || d <= 0;
+    }
+
+    return hasFront && hasBack;
+}
+
+// 所有顶点都在某个面外面才算不相交，和引擎的保守剔除约定一致
+static bool bruteBoxFrustum(const Vector3 *vertices, const Frustum &frustum)
+{
+    for (int f = 0; f < Frustum::E_MAX_FACE; ++f)
+    {
+        const Plane &plane = frustum.getFace((Frustum::Face)f);
+        bool isOutside = true;
+
+        for (int i = 0; i < 8 && isOutside; ++i)
+        {
+            isOutside = (plane.distanceToPoint(vertices[i]) <= 0);
+        }
+
+        if (isOutside)
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// 随机测试
+
+static int runPropertyTests(int iterations)
+{
+    int mismatches[E_TEST_MAX] = { 0 };
+    int hits[E_TEST_MAX] = { 0 };
+    const Frustum frustum = makeFrustum(Vector3(0, 0, 5), Real(1.0), Real(0.5), Real(12.0));
+
+    for (int n = 0; n < iterations; ++n)
+    {
+        Obb obb1 = randomObb(Real(4.0));
+        Obb obb2 = randomObb(Real(4.0));
+        Aabb aabb1 = randomAabb(Real(4.0));
+        Aabb aabb2 = randomAabb(Real(4.0));
+        Sphere sphere = randomSphere(Real(4.0));
+        Plane plane = randomPlane(Real(4.0));
+
+        Vector3 obbVertices[8], aabbVertices[8];
+        obb2.computeVertices(obbVertices);
+        aabbToObb(aabb1).computeVertices(aabbVertices);
+
+        bool result[E_TEST_MAX], expected[E_TEST_MAX];
+
+        result[E_TEST_OBB_OBB] = Math::intersects(obb1, obb2);
+        expected[E_TEST_OBB_OBB] = bruteObbObb(obb1, obb2);
+
+        result[E_TEST_AABB_AABB] = Math::intersects(aabb1, aabb2);
+        expected[E_TEST_AABB_AABB] = bruteAabbAabb(aabb1, aabb2);
+
+        result[E_TEST_AABB_OBB] = Math::intersects(aabb1, obb2);
+        expected[E_TEST_AABB_OBB] = bruteObbObb(aabbToObb(aabb1), obb2);
+
+        result[E_TEST_SPHERE_OBB] = Math::intersects(sphere, obb2);
+        expected[E_TEST_SPHERE_OBB] = bruteSphereObb(sphere, obb2);
+
+        result[E_TEST_AABB_PLANE] = Math::intersects(aabb1, plane);
+        expected[E_TEST_AABB_PLANE] = bruteBoxPlane(aabbVertices, plane);
+
+        result[E_TEST_OBB_PLANE] = Math::intersects(obb2, plane);
+        expected[E_TEST_OBB_PLANE] = bruteBoxPlane(obbVertices, plane);
+
+        result[E_TEST_SPHERE_PLANE] = Math::intersects(sphere, plane);
+        expected[E_TEST_SPHERE_PLANE] = (fabs(plane.distanceToPoint(sphere.getCenter())) <= sphere.getRadius());
+
+        result[E_TEST_OBB_FRUSTUM] = Math::intersects(obb2, frustum);
+        expected[E_TEST_OBB_FRUSTUM] = bruteBoxFrustum(obbVertices, frustum);
+
+        // 轴对齐的OBB和AABB的视景体测试结果要一致
+        result[E_TEST_OBB_AABB_FRUSTUM] = Math::intersects(aabbToObb(aabb1), frustum);
+        expected[E_TEST_OBB_AABB_FRUSTUM] = Math::intersects(aabb1, frustum);
+
+        for (int t = 0; t < E_TEST_MAX; ++t)
+        {
+            mismatches[t] += (result[t] != expected[t]);
+            hits[t] += result[t];
+        }
+    }
+
+    int total = 0;
+
+    printf("Property tests, %d random cases each:\n", iterations);
+
+    for (int t = 0; t < E_TEST_MAX; ++t)
+    {
+        printf("  %-18s mismatches %6d  intersecting %6d\n", TEST_NAMES[t], mismatches[t], hits[t]);
+        total += mismatches[t];
+    }
+
+    // 视景体之间没有简单的暴力算法，检查几种确定的摆放
+    Frustum frustum1 = makeFrustum(Vector3(0, 0, 0), Real(1.0), Real(0.5), Real(10.0));
+    Frustum overlapped = makeFrustum(Vector3(0, 0, -5), Real(1.0), Real(0.5), Real(10.0));
+    Frustum farAway = makeFrustum(Vector3(100, 0, 0), Real(1.0), Real(0.5), Real(10.0));
+    Frustum facingAway = makeFrustum(Vector3(0, 0, 30), Real(-1.0), Real(0.5), Real(10.0));
+
+    int frustumErrors = (Math::intersects(frustum1, overlapped) ? 0 : 1)
+        + (Math::intersects(frustum1, farAway) ? 1 : 0)
+        + (Math::intersects(frustum1, facingAway) ? 1 : 0);
+    printf("  %-18s mismatches %6d  (overlapped, far away, facing away)\n", "frustum-frustum", frustumErrors);
+    total += frustumErrors;
+
+    return total;
+}
+
+//------------------------------------------------------------------------------
+// 批量剔除和批量包围盒变换的随机测试
+
+enum
+{
+    E_BATCH_COUNT = 100000,     // 批量测试和性能测试的包围体数量
+    E_BATCH_ROUNDS = 8,         // 批量随机测试的轮数，每轮换一个视景体和面掩码
+};
+
+static const char *SIMD_NAMES[] = { "scalar", "SSE2", "AVX2" };
+
+// 随机的旋转、非均匀缩放和平移
+static Matrix4 randomTransform(Real range)
+{
+    Quaternion orientation;
+    orientation.fromAngleAxis(Radian(randomReal(Real(0.0), Math::TWO_PI)), randomDirection());
+    Vector3 scale(randomReal(Real(0.2), Real(3.0)), randomReal(Real(0.2), Real(3.0)), randomReal(Real(0.2), Real(3.0)));
+    Matrix4 m;
+    m.makeTransform(randomVector(range), scale, orientation);
+    return m;
+}
+
+// 只测面掩码里的面，所有顶点都在某个面外面才算不可见
+static bool bruteBoxFrustumMasked(const Vector3 *vertices, const Frustum &frustum, uint32_t planeMask)
+{
+    for (int f = 0; f < Frustum::E_MAX_FACE; ++f)
+    {
+        if ((planeMask & (1 << f)) == 0)
+            continue;
+
+        const Plane &plane = frustum.getFace((Frustum::Face)f);
+        bool isOutside = true;
+
+        for (int i = 0; i < 8 && isOutside; ++i)
+        {
+            isOutside = (plane.distanceToPoint(vertices[i]) <= 0);
+        }
+
+        if (isOutside)
+            return false;
+    }
+
+    return true;
+}
+
+static bool bruteSphereFrustumMasked(const Sphere &sphere, const Frustum &frustum, uint32_t planeMask)
+{
+    for (int f = 0; f < Frustum::E_MAX_FACE; ++f)
+    {
+        if ((planeMask & (1 << f)) == 0)
+            continue;
+
+        if (frustum.getFace((Frustum::Face)f).distanceToPoint(sphere.getCenter()) <= -sphere.getRadius())
+            return false;
+    }
+
+    return true;
+}
+
+// 把局部包围盒的8个顶点逐个变换后取最小最大值
+static void bruteTransformAabb(const Matrix4 &m, const Aabb &box, Vector3 &center, Vector3 &extent)
+{
+    Vector3 vertices[8];
+    aabbToObb(box).computeVertices(vertices);
+
+    Vector3 minV = m * vertices[0], maxV = minV;
+
+    for (int i = 1; i < 8; ++i)
+    {
+        Vector3 v = m * vertices[i];
+        minV = Vector3(std::min(minV.x(), v.x()), std::min(minV.y(), v.y()), std::min(minV.z(), v.z()));
+        maxV = Vector3(std::max(maxV.x(), v.x()), std::max(maxV.y(), v.y()), std::max(maxV.z(), v.z()));
+    }
+
+    center = (minV + maxV) * Real(0.5);
+    extent = (maxV - minV) * Real(0.5);
+}
+
+static bool isNearlyEqual(Real a, Real b)
+{
+    return fabs(a - b) <= Real(1e-4) * std::max(Real(1.0), Real(fabs(b)));
+}
+
+static bool isVisible(const std::vector<uint32_t> &visibility, size_t i)
+{
+    return (visibility[i >> 5] & (uint32_t(1) << (i & 31))) != 0;
+}
+
+static int runBatchTests()
+{
+    const size_t count = E_BATCH_COUNT;
+    AabbArray boxes, worldBoxes;
+    SphereArray spheres;
+    std::vector<Aabb> aabbList(count);
+    std::vector<Sphere> sphereList(count);
+    std::vector<Matrix4> matrices(count);
+    std::vector<uint32_t> visibility(BoundBatch::getMaskWordCount(count));
+
+    boxes.resize(count);
+    spheres.resize(count);
+
+    int aabbErrors = 0, sphereErrors = 0, transformErrors = 0;
+    int aabbHits = 0, sphereHits = 0;
+    size_t i = 0;
+
+    for (int round = 0; round < E_BATCH_ROUNDS; ++round)
+    {
+        for (i = 0; i < count; ++i)
+        {
+            aabbList[i] = randomAabb(Real(8.0));
+            sphereList[i] = randomSphere(Real(8.0));
+            matrices[i] = randomTransform(Real(8.0));
+            boxes.setAabb(i, aabbList[i]);
+            spheres.setSphere(i, sphereList[i]);
+        }
+
+        // 第一轮测全部六个面，其余各轮随机选一部分面
+        Frustum frustum = makeFrustum(randomVector(Real(2.0)), (round & 1) ? Real(-1.0) : Real(1.0), Real(0.5), Real(8.0));
+        uint32_t planeMask = (round == 0 ? (uint32_t)Frustum::E_FACE_MASK_ALL : (uint32_t)(sRandom() & Frustum::E_FACE_MASK_ALL));
+
+        BoundBatch::cullAabbs(frustum, boxes, &visibility[0], planeMask);
+
+        for (i = 0; i < count; ++i)
+        {
+            Vector3 vertices[8];
+            aabbToObb(aabbList[i]).computeVertices(vertices);
+            bool expected = bruteBoxFrustumMasked(vertices, frustum, planeMask);
+
+            // 全部面都测的时候还要和逐个调用的结果一致
+            if (planeMask == Frustum::E_FACE_MASK_ALL)
+            {
+                aabbErrors += (Math::intersects(aabbList[i], frustum) != expected);
+            }
+
+            aabbErrors += (isVisible(visibility, i) != expected);
+            aabbHits += expected;
+        }
+
+        BoundBatch::cullSpheres(frustum, spheres, &visibility[0], planeMask);
+
+        for (i = 0; i < count; ++i)
+        {
+            bool expected = bruteSphereFrustumMasked(sphereList[i], frustum, planeMask);
+
+            if (planeMask == Frustum::E_FACE_MASK_ALL)
+            {
+                sphereErrors += (Math::intersects(sphereList[i], frustum) != expected);
+            }
+
+            sphereErrors += (isVisible(visibility, i) != expected);
+            sphereHits += expected;
+        }
+
+        BoundBatch::transformAabbs(&matrices[0], boxes, worldBoxes);
+
+        for (i = 0; i < count; ++i)
+        {
+            Vector3 center, extent;
+            bruteTransformAabb(matrices[i], aabbList[i], center, extent);
+
+            bool isSame = true;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                isSame = isSame && isNearlyEqual(worldBoxes.getCenter(axis)[i], center[axis])
+                    && isNearlyEqual(worldBoxes.getExtent(axis)[i], extent[axis]);
+            }
+
+            transformErrors += !isSame;
+        }
+    }
+
+    printf("Batch tests (%s), %d rounds of %d bounds:\n", SIMD_NAMES[BoundBatch::getSimdLevel()], E_BATCH_ROUNDS, E_BATCH_COUNT);
+    printf("  %-18s mismatches %6d  visible %8d\n", "cullAabbs", aabbErrors, aabbHits);
+    printf("  %-18s mismatches %6d  visible %8d\n", "cullSpheres", sphereErrors, sphereHits);
+    printf("  %-18s mismatches %6d\n", "transformAabbs", transformErrors);
+
+    return aabbErrors + sphereErrors + transformErrors;
+}
+
+//------------------------------------------------------------------------------
+// 性能测试
+
+enum
+{
+    E_BENCH_SHAPES = 4096,      // 每种几何体的数量，2的幂
+    E_BENCH_ROUNDS = 250,
+};
+
+struct BenchShapes
+{
+    std::vector<Obb>    obbs;
+    std::vector<Aabb>   aabbs;
+    std::vector<Sphere> spheres;
+    std::vector<Plane>  planes;
+    Frustum             frustum;
+};
+
+typedef bool (*BenchProc)(const BenchShapes &shapes, size_t i, size_t j);
+
+static bool benchAabbAabb(const BenchShapes &s, size_t i, size_t j)     { return Math::intersects(s.aabbs[i], s.aabbs[j]); }
+static bool benchAabbObb(const BenchShapes &s, size_t i, size_t j)      { return Math::intersects(s.aabbs[i], s.obbs[j]); }
+static bool benchObbObb(const BenchShapes &s, size_t i, size_t j)       { return Math::intersects(s.obbs[i], s.obbs[j]); }
+static bool benchSphereObb(const BenchShapes &s, size_t i, size_t j)    { return Math::intersects(s.spheres[i], s.obbs[j]); }
+static bool benchAabbPlane(const BenchShapes &s, size_t i, size_t j)    { return Math::intersects(s.aabbs[i], s.planes[j]); }
+static bool benchObbPlane(const BenchShapes &s, size_t i, size_t j)     { return Math::intersects(s.obbs[i], s.planes[j]); }
+static bool benchSpherePlane(const BenchShapes &s, size_t i, size_t j)  { return Math::intersects(s.spheres[i], s.planes[j]); }
+static bool benchAabbFrustum(const BenchShapes &s, size_t i, size_t j)  { return Math::intersects(s.aabbs[i], s.frustum); }
+static bool benchObbFrustum(const BenchShapes &s, size_t i, size_t j)   { return Math::intersects(s.obbs[i], s.frustum); }
+
+static size_t runBenchmark(const char *name, BenchProc proc, const BenchShapes &shapes)
+{
+    size_t count = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t round = 0; round < E_BENCH_ROUNDS; ++round)
+    {
+        for (size_t i = 0; i < E_BENCH_SHAPES; ++i)
+        {
+            // 第二个参数打乱顺序，避免总是和相邻的几何体比较
+            size_t j = (i * 7 + round) & (E_BENCH_SHAPES - 1);
+            count += proc(shapes, i, j);
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    printf("  %-18s %8.2f ns/call\n", name, ns / (double(E_BENCH_ROUNDS) * E_BENCH_SHAPES));
+
+    // 返回相交数量，防止编译器把调用优化掉
+    return count;
+}
+
+static void runBenchmarks()
+{
+    BenchShapes shapes;
+    shapes.frustum = makeFrustum(Vector3(0, 0, 5), Real(1.0), Real(0.5), Real(12.0));
+
+    for (size_t i = 0; i < E_BENCH_SHAPES; ++i)
+    {
+        shapes.obbs.push_back(randomObb(Real(4.0)));
+        shapes.aabbs.push_back(randomAabb(Real(4.0)));
+        shapes.spheres.push_back(randomSphere(Real(4.0)));
+        shapes.planes.push_back(randomPlane(Real(4.0)));
+    }
+
+    size_t count = 0;
+
+    printf("Benchmarks, %d calls each:\n", E_BENCH_ROUNDS * E_BENCH_SHAPES);
+    count += runBenchmark("aabb-aabb", benchAabbAabb, shapes);
+    count += runBenchmark("aabb-obb", benchAabbObb, shapes);
+    count += runBenchmark("obb-obb", benchObbObb, shapes);
+    count += runBenchmark("sphere-obb", benchSphereObb, shapes);
+    count += runBenchmark("aabb-plane", benchAabbPlane, shapes);
+    count += runBenchmark("obb-plane", benchObbPlane, shapes);
+    count += runBenchmark("sphere-plane", benchSpherePlane, shapes);
+    count += runBenchmark("aabb-frustum", benchAabbFrustum, shapes);
+    count += runBenchmark("obb-frustum", benchObbFrustum, shapes);
+    printf("  (%u intersections)\n", (uint32_t)count);
+}
+
+// 批量函数每次处理E_BATCH_COUNT个包围体，报告每次调用的毫秒数
+static size_t runBatchBenchmarks()
+{
+    const size_t count = E_BATCH_COUNT;
+    const int rounds = 50;
+    AabbArray boxes, worldBoxes;
+    SphereArray spheres;
+    std::vector<Matrix4> matrices(count);
+    std::vector<uint32_t> visibility(BoundBatch::getMaskWordCount(count));
+    const Frustum frustum = makeFrustum(Vector3(0, 0, 5), Real(1.0), Real(0.5), Real(12.0));
+
+    boxes.resize(count);
+    spheres.resize(count);
+
+    size_t i = 0;
+    for (i = 0; i < count; ++i)
+    {
+        boxes.setAabb(i, randomAabb(Real(8.0)));
+        spheres.setSphere(i, randomSphere(Real(8.0)));
+        matrices[i] = randomTransform(Real(8.0));
+    }
+
+    size_t visible = 0;
+    int round = 0;
+
+    printf("Batch benchmarks (%s), %d bounds per call:\n", SIMD_NAMES[BoundBatch::getSimdLevel()], E_BATCH_COUNT);
+
+    auto start = std::chrono::steady_clock::now();
+    for (round = 0; round < rounds; ++round)
+    {
+        BoundBatch::cullAabbs(frustum, boxes, &visibility[0]);
+        visible += visibility[round];
+    }
+    auto end = std::chrono::steady_clock::now();
+    printf("  %-18s %8.3f ms/call\n", "cullAabbs", std::chrono::duration<double, std::milli>(end - start).count() / rounds);
+
+    start = std::chrono::steady_clock::now();
+    for (round = 0; round < rounds; ++round)
+    {
+        BoundBatch::cullSpheres(frustum, spheres, &visibility[0]);
+        visible += visibility[round];
+    }
+    end = std::chrono::steady_clock::now();
+    printf("  %-18s %8.3f ms/call\n", "cullSpheres", std::chrono::duration<double, std::milli>(end - start).count() / rounds);
+
+    start = std::chrono::steady_clock::now();
+    for (round = 0; round < rounds; ++round)
+    {
+        BoundBatch::transformAabbs(&matrices[0], boxes, worldBoxes);
+        visible += (worldBoxes.getExtent(0)[round] > 0);
+    }
+    end = std::chrono::steady_clock::now();
+    printf("  %-18s %8.3f ms/call\n", "transformAabbs", std::chrono::duration<double, std::milli>(end - start).count() / rounds);
+
+    // 返回累计值，防止编译器把调用优化掉
+    return visible;
+}
+
+int main(int argc, char *argv[])
+{
+    int iterations = 200000;
+
+    if (argc > 1)
+    {
+        iterations = atoi(argv[1]);
+    }
+
+    int mismatches = runPropertyTests(iterations);
+    mismatches += runBatchTests();
+    runBenchmarks();
+    runBatchBenchmarks();
+
+    printf("%s: %d mismatches\n", mismatches == 0 ? "PASSED" : "FAILED", mismatches);
+    return (mismatches == 0 ? 0 : 1);
+}
@@ -35,7 +35,7 @@ bool ModelApp::applicationDidFinishLaunching()
 
     SGNodePtr root = T3D_SCENE_MGR.getRoot();
     
-    // 任
+    // 相机变换结点
     SGTransformNodePtr node = SGTransformNode::create();
     root->addChild(node);
     node->lookAt(Vector3(-10.0f, 10.0f, 10.0f), Vector3(0.0f, 3.0f, 0.0f), Vector3::UNIT_Y);
@@ -44,7 +44,7 @@ bool ModelApp::applicationDidFinishLaunching()
     Real height = mRenderWindow->getHeight();
 
     {
-        // 
+        // 相机结点
         SGCameraPtr camera = SGCamera::create();
         node->addChild(camera);
         camera->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
@@ -53,17 +53,17 @@ bool ModelApp::applicationDidFinishLaunching()
         Real ratio = width / height;
         camera->setPerspective(fovY, ratio, 0.5, 10000.0);
 
-        // ӿ
+        // 视口
         ViewportPtr viewport = mRenderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
         viewport->setBackgroundColor(Color4::BLACK);
     }
 
-    // ģ #1 任
+    // 模型 #1 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setPosition(0.0, 0.0, 0.0);
     {
-        // ģ #1 ɼ
+        // 模型 #1 可见物体结点
         SGModelPtr model = SGModel::create("WarriorKnight.t3t");
         node->addChild(model);
     }
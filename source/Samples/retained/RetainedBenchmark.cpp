@@ -0,0 +1,195 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * You may use this sample code for anything you like, it is not covered by the
+ * same license as the rest of the engine.
+*******************************************************************************/
+
+// 常驻模式和逐帧提交的性能对比。
+// 使用空渲染器，不需要GPU和窗口，分别在1k、10k、100k个渲染对象的场景里
+// 测量逐帧提交和常驻模式下每帧的耗时，并比较两种模式提交到渲染器的状态设置次数是否一致。
+// 用法：Demo_Retained [每种情况测量的帧数]
+
+#include <Tiny3D.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+
+
+using namespace Tiny3D;
+
+
+enum
+{
+    E_WARMUP_FRAMES = 5,        /// 开始计时前先跑几帧，让渲染队列的内存分配稳定下来
+    E_DEFAULT_FRAMES = 100,     /// 默认每种情况测量的帧数
+};
+
+static const size_t BENCH_SIZES[] = { 1000, 10000, 100000 };
+static const size_t BENCH_SIZE_COUNT = sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]);
+static const Real BOX_SPACING = 2.0;
+
+/**
+ * @brief 一种情况的测量结果
+ */
+struct FrameStats
+{
+    double      msPerFrame;     /// 平均每帧耗时，毫秒
+    uint32_t    states;         /// 最后一帧提交到渲染器的状态设置次数
+};
+
+/**
+ * @brief 在场景里补足渲染对象，每个立方体挂在自己的变换结点下，
+ *      按最大数量排成立方体阵列，从离相机最近的一层开始填
+ */
+static void populateScene(const SGNodePtr &parent, size_t &current, size_t count, size_t maxCount)
+{
+    size_t side = (size_t)ceil(pow(double(maxCount), 1.0 / 3.0));
+    Real offset = Real(side - 1) * BOX_SPACING * Real(0.5);
+
+    while (current < count)
+    {
+        size_t x = current % side;
+        size_t y = (current / side) % side;
+        size_t z = current / (side * side);
+
+        SGTransformNodePtr node = SGTransformNode::create();
+        node->setPosition(Real(x) * BOX_SPACING - offset,
+            Real(y) * BOX_SPACING - offset, -Real(z) * BOX_SPACING);
+        parent->addChild(node);
+
+        SGBoxPtr box = SGBox::create("");
+        node->addChild(box);
+
+        ++current;
+    }
+}
+
+/**
+ * @brief 在当前模式下先预热，然后测量若干帧的平均耗时
+ */
+static bool measureFrames(Entrance *entrance, int frames, FrameStats &stats)
+{
+    int i = 0;
+
+    for (i = 0; i < E_WARMUP_FRAMES; ++i)
+    {
+        if (!entrance->renderOneFrame())
+            return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (i = 0; i < frames; ++i)
+    {
+        if (!entrance->renderOneFrame())
+            return false;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    stats.msPerFrame = std::chrono::duration<double, std::milli>(end - start).count() / double(frames);
+    stats.states = entrance->getActiveRenderer()->getSubmittedStateCount();
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int frames = E_DEFAULT_FRAMES;
+
+    if (argc > 1)
+    {
+        frames = atoi(argv[1]);
+
+        if (frames <= 0)
+        {
+            frames = E_DEFAULT_FRAMES;
+        }
+    }
+
+    Entrance *entrance = new Entrance(argv[0], false, "../media/config/Tiny3D.cfg");
+
+    // 不管配置文件指定了哪个渲染器，这里都用空渲染器
+    Renderer *renderer = entrance->getRenderer(Renderer::NULLRENDERER);
+    if (renderer == nullptr)
+    {
+        printf("T3DNullRenderer plugin is not loaded.\n");
+        delete entrance;
+        return 1;
+    }
+
+    entrance->setActiveRenderer(renderer);
+
+    RenderWindow *renderWindow = nullptr;
+    if (!entrance->initialize(true, renderWindow))
+    {
+        printf("Failed to create the null render window.\n");
+        delete entrance;
+        return 1;
+    }
+
+    SGNodePtr root = T3D_SCENE_MGR.getRoot();
+
+    // 相机在阵列正前方，远处的一部分立方体会被裁剪掉
+    SGTransformNodePtr node = SGTransformNode::create();
+    root->addChild(node);
+    node->lookAt(Vector3(0.0, 0.0, 40.0), Vector3::ZERO, Vector3::UNIT_Y);
+
+    {
+        SGCameraPtr camera = SGCamera::create();
+        node->addChild(camera);
+        camera->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
+
+        Radian fovY(Math::PI * Real(0.5));
+        Real ratio = Real(renderWindow->getWidth()) / Real(renderWindow->getHeight());
+        camera->setPerspective(fovY, ratio, 0.5, 1000.0);
+
+        ViewportPtr viewport = renderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
+        viewport->setBackgroundColor(Color4::BLACK);
+    }
+
+    SGTransformNodePtr scene = SGTransformNode::create();
+    root->addChild(scene);
+
+    int mismatches = 0;
+    size_t current = 0;
+    size_t i = 0;
+
+    printf("Frame time, %d frames each:\n", frames);
+    printf("  %10s %14s %14s %8s %s\n", "renderables", "per-frame ms", "retained ms", "speedup", "states");
+
+    for (i = 0; i < BENCH_SIZE_COUNT; ++i)
+    {
+        populateScene(scene, current, BENCH_SIZES[i], BENCH_SIZES[BENCH_SIZE_COUNT - 1]);
+
+        FrameStats immediate, retained;
+
+        T3D_SCENE_MGR.setRetainedMode(false);
+        if (!measureFrames(entrance, frames, immediate))
+            break;
+
+        T3D_SCENE_MGR.setRetainedMode(true);
+        if (!measureFrames(entrance, frames, retained))
+            break;
+
+        // 两种模式看到的是同一个场景，提交的状态设置次数应该一样
+        if (immediate.states != retained.states)
+        {
+            ++mismatches;
+        }
+
+        printf("  %10u %14.3f %14.3f %7.2fx %u/%u\n", (uint32_t)BENCH_SIZES[i],
+            immediate.msPerFrame, retained.msPerFrame,
+            immediate.msPerFrame / retained.msPerFrame,
+            immediate.states, retained.states);
+    }
+
+    T3D_SCENE_MGR.setRetainedMode(false);
+
+    delete entrance;
+
+    printf("%s: %d state count mismatches\n", mismatches == 0 ? "PASSED" : "FAILED", mismatches);
+    return (mismatches == 0 && i == BENCH_SIZE_COUNT ? 0 : 1);
+}
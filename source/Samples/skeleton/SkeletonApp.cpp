@@ -79,7 +79,7 @@ bool SkeletonApp::applicationDidFinishLaunching()
 
     SGNodePtr root = T3D_SCENE_MGR.getRoot();
 
-    // 任
+    // 相机变换结点
     SGTransformNodePtr node = SGTransformNode::create();
     root->addChild(node);
     node->setName("Camera Transform");
@@ -88,21 +88,21 @@ bool SkeletonApp::applicationDidFinishLaunching()
     node->lookAt(Vector3(150, 50, 150), Vector3::ZERO, Vector3::UNIT_Y);
 //     node->lookAt(Vector3(1509, 509, 1509), Vector3::ZERO, Vector3::UNIT_Y);
 
-    // 
+    // 坐标
     SGAxisPtr axis = SGAxis::create(50, 50, 50);
     root->addChild(axis);
 
 #elif TEST_MODEL_TORTOISE
     node->lookAt(Vector3(-2500, 2000, 2500), Vector3::ZERO, Vector3::UNIT_Y);
 
-    // 
+    // 坐标
     SGIndicatorPtr indicator = SGIndicator::create(1000, 1000, 1000);
     root->addChild(indicator);
 
 #elif TEST_MODEL_SKELETON
     node->lookAt(Vector3(400, 1000, 400), Vector3::ZERO, Vector3::UNIT_Y);
 
-    // 
+    // 坐标
     SGIndicatorPtr indicator = SGIndicator::create(50, 50, 50);
     root->addChild(indicator);
     indicator->setName("Indicator");
@@ -110,7 +110,7 @@ bool SkeletonApp::applicationDidFinishLaunching()
 #elif TEST_MODEL_KNIGHT
     node->lookAt(Vector3(0, 20, 20), Vector3::ZERO, Vector3::UNIT_Y);
 
-    // 
+    // 坐标
     SGIndicatorPtr indicator = SGIndicator::create(10, 10, 10);
     root->addChild(indicator);
 
@@ -120,7 +120,7 @@ bool SkeletonApp::applicationDidFinishLaunching()
     Real height = mRenderWindow->getHeight();
 
     {
-        // 
+        // 相机结点
         SGCameraPtr camera = SGCamera::create();
         node->addChild(camera);
         camera->setName("Main Camera");
@@ -131,29 +131,29 @@ bool SkeletonApp::applicationDidFinishLaunching()
         Real ratio = width / height;
         camera->setPerspective(fovY, ratio, 0.5, 10000);
 
-        // ӿ
+        // 视口
         ViewportPtr viewport = mRenderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
         viewport->setBackgroundColor(Color4::BLACK);
     }
 
 #if TEST_MODEL_CAMEL
-    // ģ #1 任
+    // 模型 #1 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setScale(0.2f, 0.2f, 0.2f);
     {
-        // ģ #1 ɼ
-        SGModelPtr model = SGModel::create(".t3t");
+        // 模型 #1 可见物体结点
+        SGModelPtr model = SGModel::create("白骆驼.t3t");
         node->addChild(model);
-        model->runAction("ܲ");
+        model->runAction("跑步");
     }
 #elif TEST_MODEL_SINBAD
-    // ģ #1 任
+    // 模型 #1 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setScale(8.0f, 8.0f, 8.0f);
     {
-        // ģ #1 ɼ
+        // 模型 #1 可见物体结点
         SGModelPtr model = SGModel::create("Sinbad.t3t");
         node->addChild(model);
         model->runAction("Dance");
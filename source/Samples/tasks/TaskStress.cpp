@@ -0,0 +1,545 @@
+/*******************************************************************************
+ * This file is part of Tiny3D (Tiny 3D Graphic Rendering Engine)
+ * Copyright (C) 2015-2017  Answer Wong
+ * For latest info, see https://github.com/asnwerear/Tiny3D
+ *
+ * You may use this sample code for anything you like, it is not covered by the
+ * same license as the rest of the engine.
+*******************************************************************************/
+
+// 任务调度器的压力测试。
+// 分别用0到7个工作线程启动调度器，反复运行并行循环、组之间的依赖、后续任务、
+// 主线程任务、任务里嵌套等待、非调度器线程等待和组的复用，检查每个任务都只执行一次、
+// 执行顺序满足依赖、主线程任务只在主线程上执行，错误的数量作为返回值。
+// 等待和唤醒有问题时测试会卡住，看门狗线程发现长时间没有进展就报告当前的场景并退出。
+// 用法：Demo_Tasks [每种线程数量运行的轮数]
+
+#include <T3DPlatform.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+
+using namespace Tiny3D;
+
+
+enum
+{
+    E_MAX_WORKERS = 7,          // 最多的工作线程数量
+    E_DEFAULT_ROUNDS = 100,     // 默认每种线程数量运行的轮数
+    E_FOR_COUNT = 10000,        // 并行循环的元素数量
+    E_FOR_GRAIN = 37,           // 手动指定的粒度，故意不能整除元素数量
+    E_GROUP_TASKS = 64,         // 每个组的任务数量
+    E_NEST_DEPTH = 3,           // 嵌套等待的层数
+    E_NEST_FANOUT = 4,          // 每层的子任务数量
+    E_WATCHDOG_SECONDS = 20,    // 超过这个时间没有进展就认为卡住了
+};
+
+static std::atomic<uint32_t> sErrors(0);
+static std::atomic<uint32_t> sProgress(0);
+static std::atomic<bool> sIsFinished(false);
+static std::atomic<const char *> sScenario("startup");
+static std::atomic<int> sWorkers(0);
+
+// 只打印前几个错误，避免刷屏
+static void check(bool isPassed, const char *what)
+{
+    if (!isPassed && sErrors.fetch_add(1) < 10)
+    {
+        printf("  failed: %s (%s, %d workers)\n", what, sScenario.load(), sWorkers.load());
+    }
+}
+
+// 一点点计算量，让任务之间有机会交错
+static uint32_t spin(uint32_t seed)
+{
+    uint32_t i = 0;
+    while (i < 64)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        ++i;
+    }
+
+    return seed;
+}
+
+static void watchdogProcedure()
+{
+    uint32_t last = sProgress.load();
+    int idle = 0;
+
+    while (!sIsFinished.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        uint32_t current = sProgress.load();
+        if (current != last)
+        {
+            last = current;
+            idle = 0;
+        }
+        else if (++idle >= E_WATCHDOG_SECONDS * 10)
+        {
+            printf("FAILED: stalled in %s with %d workers\n", sScenario.load(), sWorkers.load());
+            fflush(stdout);
+            abort();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// 并行循环，每个元素都只处理一次
+
+struct ForContext
+{
+    std::vector<uint32_t>   marks;
+};
+
+static void markRange(void *context, size_t begin, size_t end)
+{
+    ForContext *ctx = (ForContext *)context;
+
+    while (begin < end)
+    {
+        ++ctx->marks[begin];
+        ++begin;
+    }
+}
+
+static void testParallelFor()
+{
+    ForContext ctx;
+    ctx.marks.assign(E_FOR_COUNT, 0);
+
+    // 阻塞的版本，自动粒度
+    T3D_TASK_SCHEDULER.parallelFor(E_FOR_COUNT, 0, markRange, &ctx);
+
+    // 提交到组里再等待
+    TaskGroup group;
+    T3D_TASK_SCHEDULER.parallelFor(&group, E_FOR_COUNT, E_FOR_GRAIN, markRange, &ctx);
+    T3D_TASK_SCHEDULER.wait(&group);
+
+    size_t i = 0;
+    bool isPassed = true;
+    while (i < E_FOR_COUNT)
+    {
+        isPassed = isPassed && (ctx.marks[i] == 2);
+        ++i;
+    }
+
+    check(isPassed, "every element is processed once per parallelFor");
+}
+
+//------------------------------------------------------------------------------
+// 菱形依赖，first完成后left和right才能开始，两个都完成后last才能开始
+
+struct DependencyContext
+{
+    std::atomic<uint32_t>   first;
+    std::atomic<uint32_t>   left;
+    std::atomic<uint32_t>   right;
+    std::atomic<uint32_t>   last;
+};
+
+static void firstTask(void *context)
+{
+    DependencyContext *ctx = (DependencyContext *)context;
+    spin(ctx->first.load());
+    ctx->first.fetch_add(1);
+}
+
+static void leftTask(void *context)
+{
+    DependencyContext *ctx = (DependencyContext *)context;
+    check(ctx->first.load() == E_GROUP_TASKS, "left group starts after first group");
+    ctx->left.fetch_add(1);
+}
+
+static void rightRange(void *context, size_t begin, size_t end)
+{
+    DependencyContext *ctx = (DependencyContext *)context;
+    check(ctx->first.load() == E_GROUP_TASKS, "right group starts after first group");
+    ctx->right.fetch_add((uint32_t)(end - begin));
+}
+
+static void lastTask(void *context)
+{
+    DependencyContext *ctx = (DependencyContext *)context;
+    check(ctx->left.load() == E_GROUP_TASKS && ctx->right.load() == E_FOR_COUNT,
+        "last group starts after left and right groups");
+    ctx->last.fetch_add(1);
+}
+
+static void testDependencies()
+{
+    DependencyContext ctx;
+    ctx.first = 0;
+    ctx.left = 0;
+    ctx.right = 0;
+    ctx.last = 0;
+
+    TaskGroup first, left, right, last;
+    TaskScheduler &scheduler = T3D_TASK_SCHEDULER;
+
+    scheduler.addDependency(&left, &first);
+    scheduler.addDependency(&right, &first);
+    scheduler.addDependency(&last, &left);
+    scheduler.addDependency(&last, &right);
+
+    // 后继组的任务先提交，都暂存在组里
+    int i = 0;
+    for (i = 0; i < E_GROUP_TASKS; ++i)
+    {
+        scheduler.submit(lastTask, &ctx, &last);
+        scheduler.submit(leftTask, &ctx, &left);
+    }
+
+    scheduler.parallelFor(&right, E_FOR_COUNT, E_FOR_GRAIN, rightRange, &ctx);
+
+    for (i = 0; i < E_GROUP_TASKS; ++i)
+    {
+        scheduler.submit(firstTask, &ctx, &first);
+    }
+
+    scheduler.close(&first);
+    scheduler.close(&left);
+    scheduler.close(&right);
+    scheduler.wait(&last);
+
+    // last完成时first的complete()可能还在释放后继组，每个组都要等到完成才能销毁
+    scheduler.wait(&first);
+    scheduler.wait(&left);
+    scheduler.wait(&right);
+
+    check(ctx.last.load() == E_GROUP_TASKS, "every dependent task runs once");
+}
+
+//------------------------------------------------------------------------------
+// 后续任务，包括主线程上的后续任务和组完成后才添加的后续任务
+
+struct ContinuationContext
+{
+    std::atomic<uint32_t>   tasks;
+    std::atomic<uint32_t>   continuations;
+    std::atomic<uint32_t>   mainContinuations;
+};
+
+static void countTask(void *context)
+{
+    ContinuationContext *ctx = (ContinuationContext *)context;
+    spin(ctx->tasks.load());
+    ctx->tasks.fetch_add(1);
+}
+
+static void continuationTask(void *context)
+{
+    ContinuationContext *ctx = (ContinuationContext *)context;
+    check(ctx->tasks.load() == E_GROUP_TASKS, "continuation runs after its group");
+    ctx->continuations.fetch_add(1);
+}
+
+static void mainContinuationTask(void *context)
+{
+    ContinuationContext *ctx = (ContinuationContext *)context;
+    check(ctx->tasks.load() == E_GROUP_TASKS, "main continuation runs after its group");
+    check(T3D_TASK_SCHEDULER.isMainThread(), "main continuation runs on the main thread");
+    ctx->mainContinuations.fetch_add(1);
+}
+
+static void testContinuations()
+{
+    ContinuationContext ctx;
+    ctx.tasks = 0;
+    ctx.continuations = 0;
+    ctx.mainContinuations = 0;
+
+    TaskGroup group, target;
+    TaskScheduler &scheduler = T3D_TASK_SCHEDULER;
+
+    scheduler.continueWith(&group, continuationTask, &ctx, &target);
+    scheduler.continueWith(&group, mainContinuationTask, &ctx, &target, TaskScheduler::E_AFFINITY_MAIN);
+
+    int i = 0;
+    for (i = 0; i < E_GROUP_TASKS; ++i)
+    {
+        scheduler.submit(countTask, &ctx, &group);
+    }
+
+    // 不属于任何组的后续任务由组完成时提交，不等它
+    scheduler.continueWith(&group, continuationTask, &ctx);
+    scheduler.wait(&group);
+
+    // 组已经完成，直接提交
+    scheduler.continueWith(&group, continuationTask, &ctx, &target);
+    scheduler.continueWith(&group, mainContinuationTask, &ctx, &target, TaskScheduler::E_AFFINITY_MAIN);
+    scheduler.wait(&target);
+
+    // 没有组的后续任务可能还在别的线程上，等到计数齐了再检查
+    while (ctx.continuations.load() != 3)
+    {
+        scheduler.executeMainThreadTasks();
+        std::this_thread::yield();
+    }
+
+    check(ctx.mainContinuations.load() == 2, "every main continuation runs once");
+}
+
+//------------------------------------------------------------------------------
+// 任意线程提交的主线程任务
+
+struct MainContext
+{
+    TaskGroup               *group;
+    std::atomic<uint32_t>   count;
+};
+
+static void mainOnlyTask(void *context)
+{
+    MainContext *ctx = (MainContext *)context;
+    check(T3D_TASK_SCHEDULER.isMainThread(), "main affinity task runs on the main thread");
+    ctx->count.fetch_add(1);
+}
+
+static void submitMainTask(void *context)
+{
+    MainContext *ctx = (MainContext *)context;
+    T3D_TASK_SCHEDULER.submit(mainOnlyTask, ctx, ctx->group, TaskScheduler::E_AFFINITY_MAIN);
+}
+
+static void testMainAffinity()
+{
+    TaskGroup group;
+    MainContext ctx;
+    ctx.group = &group;
+    ctx.count = 0;
+
+    int i = 0;
+    for (i = 0; i < E_GROUP_TASKS; ++i)
+    {
+        T3D_TASK_SCHEDULER.submit(submitMainTask, &ctx, &group);
+    }
+
+    T3D_TASK_SCHEDULER.wait(&group);
+
+    check(ctx.count.load() == E_GROUP_TASKS, "every main affinity task runs once");
+}
+
+//------------------------------------------------------------------------------
+// 任务里嵌套等待，子任务的组在等待的任务栈上，返回后马上销毁
+
+struct NestContext
+{
+    uint32_t                depth;
+    std::atomic<uint32_t>   *leaves;
+    std::atomic<uint32_t>   *mainLeaves;
+};
+
+static void mainLeafTask(void *context)
+{
+    NestContext *ctx = (NestContext *)context;
+    check(T3D_TASK_SCHEDULER.isMainThread(), "nested main affinity task runs on the main thread");
+    ctx->mainLeaves->fetch_add(1);
+}
+
+static void nestTask(void *context)
+{
+    NestContext *ctx = (NestContext *)context;
+
+    if (ctx->depth == 0)
+    {
+        ctx->leaves->fetch_add(1);
+        return;
+    }
+
+    TaskGroup group;
+    NestContext children[E_NEST_FANOUT];
+
+    int i = 0;
+    for (i = 0; i < E_NEST_FANOUT; ++i)
+    {
+        children[i].depth = ctx->depth - 1;
+        children[i].leaves = ctx->leaves;
+        children[i].mainLeaves = ctx->mainLeaves;
+        T3D_TASK_SCHEDULER.submit(nestTask, &children[i], &group);
+    }
+
+    // 最底下一层的等待还依赖主线程，主线程这时也在等待
+    if (ctx->depth == 1)
+    {
+        T3D_TASK_SCHEDULER.submit(mainLeafTask, ctx, &group, TaskScheduler::E_AFFINITY_MAIN);
+    }
+
+    T3D_TASK_SCHEDULER.wait(&group);
+}
+
+static void testNestedWaits()
+{
+    std::atomic<uint32_t> leaves(0), mainLeaves(0);
+    NestContext root = { E_NEST_DEPTH, &leaves, &mainLeaves };
+
+    TaskGroup group;
+    T3D_TASK_SCHEDULER.submit(nestTask, &root, &group);
+    T3D_TASK_SCHEDULER.wait(&group);
+
+    uint32_t expected = 1;
+    int i = 0;
+    for (i = 0; i < E_NEST_DEPTH; ++i)
+    {
+        expected *= E_NEST_FANOUT;
+    }
+
+    check(leaves.load() == expected, "every nested leaf runs once");
+    check(mainLeaves.load() == expected / E_NEST_FANOUT, "every nested main leaf runs once");
+}
+
+//------------------------------------------------------------------------------
+// 不是调度器的线程提交任务并等待，主线程同时处理每帧的任务
+
+struct ExternalContext
+{
+    std::atomic<uint32_t>   count;
+    std::atomic<bool>       isDone;
+};
+
+static void externalTask(void *context)
+{
+    ExternalContext *ctx = (ExternalContext *)context;
+    ctx->count.fetch_add(1);
+}
+
+static void externalProcedure(ExternalContext *ctx)
+{
+    TaskGroup group;
+
+    int i = 0;
+    for (i = 0; i < E_GROUP_TASKS; ++i)
+    {
+        T3D_TASK_SCHEDULER.submit(externalTask, ctx, &group);
+    }
+
+    T3D_TASK_SCHEDULER.wait(&group);
+
+    check(ctx->count.load() == E_GROUP_TASKS, "external wait returns after its tasks");
+    ctx->isDone.store(true);
+}
+
+static void testExternalWait()
+{
+    ExternalContext ctx;
+    ctx.count = 0;
+    ctx.isDone = false;
+
+    std::thread external(externalProcedure, &ctx);
+
+    // 没有工作线程时，外部线程提交的任务由主线程在这里执行
+    while (!ctx.isDone.load())
+    {
+        T3D_TASK_SCHEDULER.executeMainThreadTasks();
+        std::this_thread::yield();
+    }
+
+    external.join();
+}
+
+//------------------------------------------------------------------------------
+// 跨轮复用同一个组
+
+static void testReuse(TaskGroup &group)
+{
+    ForContext ctx;
+    ctx.marks.assign(E_FOR_COUNT, 0);
+
+    group.reset();
+    T3D_TASK_SCHEDULER.parallelFor(&group, E_FOR_COUNT, 0, markRange, &ctx);
+    T3D_TASK_SCHEDULER.wait(&group);
+
+    size_t i = 0;
+    bool isPassed = true;
+    while (i < E_FOR_COUNT)
+    {
+        isPassed = isPassed && (ctx.marks[i] == 1);
+        ++i;
+    }
+
+    check(isPassed && group.isFinished(), "reused group finishes every round");
+}
+
+//------------------------------------------------------------------------------
+
+typedef void (*ScenarioProc)();
+
+static void runScenario(const char *name, ScenarioProc proc)
+{
+    sScenario.store(name);
+    proc();
+    sProgress.fetch_add(1);
+}
+
+int main(int argc, char *argv[])
+{
+    int rounds = E_DEFAULT_ROUNDS;
+
+    if (argc > 1)
+    {
+        rounds = atoi(argv[1]);
+
+        if (rounds <= 0)
+        {
+            rounds = E_DEFAULT_ROUNDS;
+        }
+    }
+
+    TaskScheduler *scheduler = new TaskScheduler();
+    std::thread watchdog(watchdogProcedure);
+
+    printf("Task scheduler stress, %d rounds each:\n", rounds);
+    printf("  %7s %12s %8s\n", "workers", "ms/round", "errors");
+
+    int workers = 0;
+    for (workers = 0; workers <= E_MAX_WORKERS; ++workers)
+    {
+        sWorkers.store(workers);
+        uint32_t errors = sErrors.load();
+
+        scheduler->startup(workers);
+
+        TaskGroup reused;
+        auto start = std::chrono::steady_clock::now();
+
+        int i = 0;
+        for (i = 0; i < rounds; ++i)
+        {
+            runScenario("parallelFor", testParallelFor);
+            runScenario("dependencies", testDependencies);
+            runScenario("continuations", testContinuations);
+            runScenario("main affinity", testMainAffinity);
+            runScenario("nested waits", testNestedWaits);
+            runScenario("external wait", testExternalWait);
+
+            sScenario.store("group reuse");
+            testReuse(reused);
+            sProgress.fetch_add(1);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+
+        sScenario.store("shutdown");
+        scheduler->shutdown();
+
+        printf("  %7d %12.3f %8u\n", workers,
+            std::chrono::duration<double, std::milli>(end - start).count() / double(rounds),
+            sErrors.load() - errors);
+    }
+
+    sIsFinished.store(true);
+    watchdog.join();
+
+    delete scheduler;
+
+    uint32_t errors = sErrors.load();
+    printf("%s: %u errors\n", errors == 0 ? "PASSED" : "FAILED", errors);
+    return (errors == 0 ? 0 : 1);
+}
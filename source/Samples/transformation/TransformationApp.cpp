@@ -32,7 +32,7 @@ bool TransformationApp::applicationDidFinishLaunching()
 
     SGNodePtr root = T3D_SCENE_MGR.getRoot();
     
-    // 任
+    // 相机变换结点
     SGTransformNodePtr node = SGTransformNode::create();
     root->addChild(node);
     node->lookAt(Vector3(0.0, 2.0, 10.0), Vector3::ZERO, Vector3::UNIT_Y);
@@ -41,7 +41,7 @@ bool TransformationApp::applicationDidFinishLaunching()
     Real height = mRenderWindow->getHeight();
 
     {
-        // 
+        // 相机结点
         SGCameraPtr camera = SGCamera::create();
         node->addChild(camera);
         camera->setProjectionType(SGCamera::E_PT_PERSPECTIVE);
@@ -50,18 +50,18 @@ bool TransformationApp::applicationDidFinishLaunching()
         Real ratio = width / height;
         camera->setPerspective(fovY, ratio, 0.5, 1000.0);
 
-        // ӿ
+        // 视口
         ViewportPtr viewport = mRenderWindow->addViewport(camera, 0, 0.0, 0.0, 1.0, 1.0);
         viewport->setBackgroundColor(Color4::BLACK);
     }
 
-    // 任
+    // 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setPosition(0.0, 0.0, 0.0);
 
     {
-        //  #1 任
+        // 立方体 #1 变换结点
         SGTransformNodePtr node1 = SGTransformNode::create();
         node->addChild(node1);
         node1->setPosition(2.0, 0.0, 0.0);
@@ -69,41 +69,41 @@ bool TransformationApp::applicationDidFinishLaunching()
         node1->setOrientation(Radian(Math::PI / Real(6.0)), Vector3(0.0, 1.0, 0.0));
 
         {
-            //  #1 Ⱦ
+            // 立方体 #1 可渲染物体结点
             SGBoxPtr box = SGBox::create("");
             node1->addChild(box);
         }
 
-        //  #2 任
+        // 立方体 #2 变换结点
         SGTransformNodePtr node2 = SGTransformNode::create();
         node->addChild(node2);
         node2->setPosition(-1.0, 0.0, 0.0);
 
         {
-            //  #2 Ⱦ
+            // 立方体 #2 可渲染物体结点
             SGBoxPtr box = SGBox::create("");
             node2->addChild(box);
         }
 
-        //  #1 任
+        // 球体 #1 变换结点
         SGTransformNodePtr node3 = SGTransformNode::create();
         node->addChild(node3);
         node3->setPosition(-4.0, 0.0, 0.0);
 
         {
-            //  #1 Ⱦ
+            // 球体 #1 可渲染物体结点
             SGSpherePtr sphere = SGSphere::create("");
             node3->addChild(sphere);
         }
     }
 
-    //  #2 任
+    // 球体 #2 变换结点
     node = SGTransformNode::create();
     root->addChild(node);
     node->setPosition(-10.0, 0.0, 0.0);
 
     {
-        //  #2 Ⱦ
+        // 球体 #2 可渲染物体结点
         SGSpherePtr sphere = SGSphere::create("");
         node->addChild(sphere);
     }
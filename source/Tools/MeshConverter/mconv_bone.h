@@ -55,7 +55,7 @@ namespace mconv
         Matrix4     mOffsetMatrix;
         uint16_t    mBoneIndex;
 
-        Matrix4     mKeyframeMatrix;    /// רŸogreؼ֡Աر任õ
+        Matrix4     mKeyframeMatrix;    /// 专门给ogre骨骼动画计算关键帧绝对本地变换用的
     };
 }
 
@@ -68,6 +68,10 @@ namespace mconv
                 {
                     settings.mFileMode = parseFileMode(argv[++i]);
                 }
+                else if (arg[1] == 'l')
+                {
+                    settings.mLodLevels = atoi(argv[++i]);
+                }
                 else if (arg[1] == 'f')
                 {
                     settings.mExtraPath = argv[++i];
@@ -126,9 +130,11 @@ namespace mconv
         printf("-b <type>: Set the type of the bounding box to <type>\n");
         printf("\t<type> : This type should be \"sphere\" or \"aabb\".\n");
         printf("-m <type>: This type should control file mode.\n");
-        printf("\t<type> : This type should be \"shared\" or \"original\".\n");
+        printf("\t<type> : This type should be \"shared\", \"original\" or \"static\".\n");
         printf("\t              shared - Merge different meshes in one *.fbx file into one model file and all meshes share one vertex buffer.\n");
         printf("\t              original - Maintain meshes original structure.\n");
+        printf("\t              static - Bake world transforms and merge meshes with the same material and vertex format, split at 16-bit index limit.\n");
+        printf("-l <count>: Generate up to <count> simplified LOD levels for each sub-mesh, 0 means no LOD.\n");
         printf("-f <filename>: This option is material file when input file type is OGRE.\n");
         printf("-v       : Verbose: print additional progress information\n");
         printf("\n");
@@ -180,6 +186,10 @@ namespace mconv
         {
             mode = E_FM_ORIGINAL;
         }
+        else if (stricmp(arg, "static") == 0)
+        {
+            mode = E_FM_STATIC_BATCH;
+        }
 
         return mode;
     }
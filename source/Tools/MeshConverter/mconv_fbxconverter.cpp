@@ -206,15 +206,45 @@ namespace mconv
             }
         }
 
+        if (result && E_FM_STATIC_BATCH == mSettings.mFileMode)
+        {
+            MCONV_LOG_INFO("Start static batching ......");
+            result = processStaticBatch(mCurModel);
+
+            if (!result)
+            {
+                MCONV_LOG_ERROR("Failed static batching !");
+            }
+            else
+            {
+                MCONV_LOG_INFO("Completed static batching !");
+            }
+        }
+
+        if (result && mSettings.mLodLevels > 0)
+        {
+            MCONV_LOG_INFO("Start generating LOD ......");
+            result = processLod(pRoot);
+
+            if (!result)
+            {
+                MCONV_LOG_ERROR("Failed generating LOD !");
+            }
+            else
+            {
+                MCONV_LOG_INFO("Completed generating LOD !");
+            }
+        }
+
         pRoot->addChild(mRootTransform);
 
-        // ǷָģļģʽͲݵ
+        // 如果不是分割模型文件模式，则调整骨骼、动画和材质数据到最后
         if (mCurSkeleton != nullptr)
         {
             mCurSkeleton->removeFromParent(false);
             mCurModel->addChild(mCurSkeleton);
 
-            // palletteйڹpallette
+            // 修正骨骼pallette，避免有骨骼不在骨骼pallette里面
             fixBoneIndex((Bone *)mCurSkeleton->getChild(0));
         }
 
@@ -307,7 +337,7 @@ namespace mconv
 
                         if (mCurModel == nullptr)
                         {
-                            // ûmodelڵ㣬ȴһںҽmeshڵ
+                            // 没有model节点，先创建一个，用于后续挂接所有mesh节点
                             Model *pModel = new Model(name);
 
                             if (E_FM_SHARE_VERTEX == mSettings.mFileMode)
@@ -502,7 +532,7 @@ namespace mconv
         int nVertexCount = 0;
         int i = 0, j = 0;
 
-        // ɶ
+        // 生成顶点属性
         if (!processVertexAttribute(pFbxMesh, pVB))
         {
             MCONV_LOG_ERROR("Failed processing vertex attribute !");
@@ -515,7 +545,7 @@ namespace mconv
 
         SubMeshMap  submeshes;
 
-        // 
+        // 构建顶点数据
         for (i = 0; i < nTriangleCount; ++i)
         {
             for (j = 0; j < 3; ++j)
@@ -525,14 +555,14 @@ namespace mconv
                 Vertex vertex;
                 vertex.mCtrlPointIdx = nControlPointIdx;
 
-                // ȡλϢ
+                // 读取顶点位置信息
                 readPosition(pFbxMesh, nControlPointIdx, vertex.mPosition);
                 Vector3 pos = m * vertex.mPosition;
                 vertex.mPosition[0] = pos[0];
                 vertex.mPosition[1] = pos[1];
                 vertex.mPosition[2] = pos[2];
 
-                // ȡɫϢ
+                // 读取顶点颜色信息
                 Vector4 color;
                 int k = 0;
                 bool ret = false;
@@ -545,7 +575,7 @@ namespace mconv
                     }
                 } while (ret);
 
-                // ȡUV
+                // 读取纹理UV坐标
                 Vector2 uv;
                 int nTexCount = pFbxMesh->GetElementUVCount();
                 for (k = 0; k < nTexCount; ++k)
@@ -556,7 +586,7 @@ namespace mconv
                     }
                 }
 
-                // ȡ㷨
+                // 读取顶点法线
                 Vector3 normal;
                 k = 0;
                 do 
@@ -568,7 +598,7 @@ namespace mconv
                     }
                 } while (ret);
 
-                // ȡ
+                // 读取副法线
                 Vector3 binormal;
                 k = 0;
                 do
@@ -580,7 +610,7 @@ namespace mconv
                     }
                 } while (ret);
 
-                // ȡ
+                // 读取切线
                 Vector3 tangent;
                 k = 0;
                 do 
@@ -604,7 +634,7 @@ namespace mconv
 
                 if (pCurSubMesh == nullptr)
                 {
-                    // ûһ
+                    // 没有子网格，生成一个
                     pCurSubMesh = new SubMesh(name);
                     pSubMeshes->addChild(pCurSubMesh);
                     submeshes.insert(SubMeshValue(nMaterialIdx, pCurSubMesh));
@@ -614,7 +644,7 @@ namespace mconv
                 }
                 else
                 {
-                    // 񣬿ǷǰĲͬͬһֳ ֳɵĶûУһµ
+                    // 有子网格，看看是否跟当前的材质相同，不相同则查找一个现成 ，如果现成的都没有，则生成一个新的
                     if (pCurSubMesh->mMaterialIdx != nMaterialIdx)
                     {
                         auto itr = submeshes.find(nMaterialIdx);
@@ -713,7 +743,7 @@ namespace mconv
         auto itr = pVertexBuffer->mAttributes.begin();
         VertexAttribute source;
 
-        // λ
+        // 位置
         VertexAttribute attribute;
         attribute.mVertexType = VertexAttribute::E_VT_POSITION;
         attribute.mSize = 3;
@@ -741,7 +771,7 @@ namespace mconv
             }
         }
 
-        // 
+        // 法线
         for (i = 0; i < pFbxMesh->GetElementNormalCount(); ++i)
         {
             attribute.mVertexType = VertexAttribute::E_VT_NORMAL;
@@ -753,7 +783,7 @@ namespace mconv
             }
         }
 
-        // 
+        // 副法线
         for (i = 0; i < pFbxMesh->GetElementBinormalCount(); ++i)
         {
             attribute.mVertexType = VertexAttribute::E_VT_BINORMAL;
@@ -765,7 +795,7 @@ namespace mconv
             }
         }
 
-        // 
+        // 切线
         for (i = 0; i < pFbxMesh->GetElementTangentCount(); ++i)
         {
             attribute.mVertexType = VertexAttribute::E_VT_TANGENT;
@@ -777,7 +807,7 @@ namespace mconv
             }
         }
 
-        // ɫ
+        // 颜色
         for (i = 0; i < pFbxMesh->GetElementVertexColorCount(); ++i)
         {
             attribute.mVertexType = VertexAttribute::E_VT_COLOR;
@@ -1707,7 +1737,7 @@ namespace mconv
                 }
             }
 
-            // ֪ΪιеĹƤĹƫƾһƤƫƾĩβһ
+            // 不知道为何骨骼层次中的骨骼数和蒙皮计算的骨骼偏移矩阵的数差一，这里在蒙皮计算的偏移矩阵末尾插入一个骨骼根结点
 //             if (nBoneCount == mBoneCount - 1)
 //             {
 //                 size_t i = 0;
@@ -1761,6 +1791,453 @@ namespace mconv
         return true;
     }
 
+    bool FBXConverter::collectStaticEntities(Node *pNode, const Matrix4 &m, StaticEntities &entities)
+    {
+        Matrix4 world = m;
+
+        if (pNode->getNodeType() == Node::E_TYPE_TRANSFORM)
+        {
+            Transform *pTransform = (Transform *)pNode;
+            world = m * pTransform->mMatrix;
+
+            auto itr = pTransform->mEntities.begin();
+            while (itr != pTransform->mEntities.end())
+            {
+                StaticEntity entity;
+                entity.mWorld = world;
+                entity.mMesh = itr->first;
+                entity.mSubMesh = itr->second;
+                entities.push_back(entity);
+                ++itr;
+            }
+        }
+
+        size_t i = 0;
+        for (i = 0; i < pNode->getChildrenCount(); ++i)
+        {
+            Node *pChild = pNode->getChild(i);
+            collectStaticEntities(pChild, world, entities);
+        }
+
+        return true;
+    }
+
+    FBXConverter::StaticBatch FBXConverter::createStaticBatch(Node *pModel, int nBatchIdx, VertexBuffer *pSrcVB, SubMesh *pSrcSubMesh)
+    {
+        std::stringstream ss;
+        ss << "StaticBatch#" << nBatchIdx;
+        String name = ss.str();
+
+        StaticBatch batch;
+
+        batch.mMesh = new Mesh(name);
+        pModel->addChild(batch.mMesh);
+
+        VertexBuffers *pVBS = new VertexBuffers(name);
+        batch.mMesh->addChild(pVBS);
+
+        batch.mVB = new VertexBuffer("0");
+        batch.mVB->mAttributes = pSrcVB->mAttributes;
+        batch.mVB->calcAttributesHash();
+        pVBS->addChild(batch.mVB);
+
+        SubMeshes *pSubMeshes = new SubMeshes(name);
+        batch.mMesh->addChild(pSubMeshes);
+
+        batch.mSubMesh = new SubMesh(name);
+        batch.mSubMesh->mMaterialIdx = pSrcSubMesh->mMaterialIdx;
+        batch.mSubMesh->mMaterialName = pSrcSubMesh->mMaterialName;
+        batch.mSubMesh->mVB->mAttributes = pSrcVB->mAttributes;
+        pSubMeshes->addChild(batch.mSubMesh);
+
+        return batch;
+    }
+
+    bool FBXConverter::processStaticBatch(Node *pModel)
+    {
+        if (pModel == nullptr)
+        {
+            return true;
+        }
+
+        if (mHasSkeleton || mHasVertexBlending)
+        {
+            MCONV_LOG_WARNING("Skinned mesh could not be static batched ! Keep original structure !");
+            return true;
+        }
+
+        // 先记下原来的网格，合并完后删除
+        std::list<Node *> oldMeshes;
+        size_t i = 0;
+        for (i = 0; i < pModel->getChildrenCount(); ++i)
+        {
+            Node *pChild = pModel->getChild(i);
+            if (pChild->getNodeType() == Node::E_TYPE_MESH)
+            {
+                oldMeshes.push_back(pChild);
+            }
+        }
+
+        StaticEntities entities;
+        collectStaticEntities(mRootTransform, Matrix4::IDENTITY, entities);
+
+        StaticBatches batches;
+        std::list<StaticBatch> results;
+        int nBatchIdx = 0;
+
+        auto itr = entities.begin();
+        while (itr != entities.end())
+        {
+            StaticEntity &entity = *itr;
+            ++itr;
+
+            VertexBuffer *pSrcVB = nullptr;
+            if (!searchVertexBuffer(entity.mMesh, pSrcVB))
+            {
+                continue;
+            }
+
+            std::stringstream ss;
+            ss << entity.mSubMesh->mMaterialName << "#" << pSrcVB->getAttributesHash();
+            String key = ss.str();
+
+            // 法线、副法线、切线用逆转置矩阵变换
+            Matrix3 rotation;
+            entity.mWorld.extractMatrix(rotation);
+            Matrix3 normalMatrix = rotation.inverse().transpose();
+
+            // 源顶点索引到合并后网格顶点索引的映射，换到新网格时清空
+            std::map<int, int> remap;
+
+            auto batchItr = batches.find(key);
+            StaticBatch *pBatch = (batchItr != batches.end() ? &batchItr->second : nullptr);
+
+            auto idx = entity.mSubMesh->mIndices.begin();
+            while (idx != entity.mSubMesh->mIndices.end())
+            {
+                int corners[3];
+                size_t k = 0;
+                size_t nNewVertices = 0;
+
+                for (k = 0; k < 3 && idx != entity.mSubMesh->mIndices.end(); ++k, ++idx)
+                {
+                    corners[k] = *idx;
+                    if (remap.find(corners[k]) == remap.end())
+                    {
+                        nNewVertices++;
+                    }
+                }
+
+                if (k < 3)
+                {
+                    MCONV_LOG_WARNING("Incomplete triangle in %s, dropped !", entity.mSubMesh->getID().c_str());
+                    break;
+                }
+
+                // 放不下这个三角形就开一个新的网格，保证索引在16位范围内
+                if (pBatch == nullptr || pBatch->mVB->mVertices.size() + nNewVertices > 0x10000)
+                {
+                    StaticBatch batch = createStaticBatch(pModel, nBatchIdx++, pSrcVB, entity.mSubMesh);
+                    batches[key] = batch;
+                    pBatch = &batches[key];
+                    results.push_back(batch);
+                    remap.clear();
+                }
+
+                for (k = 0; k < 3; ++k)
+                {
+                    auto r = remap.find(corners[k]);
+                    int nIndex = 0;
+
+                    if (r != remap.end())
+                    {
+                        nIndex = r->second;
+                    }
+                    else
+                    {
+                        Vertex vertex = pSrcVB->mVertices[corners[k]];
+                        vertex.mPosition = entity.mWorld.transformAffine(vertex.mPosition);
+
+                        auto n = vertex.mNormalElements.begin();
+                        while (n != vertex.mNormalElements.end())
+                        {
+                            *n = normalMatrix * (*n);
+                            n->normalize();
+                            ++n;
+                        }
+
+                        n = vertex.mBinormalElements.begin();
+                        while (n != vertex.mBinormalElements.end())
+                        {
+                            *n = normalMatrix * (*n);
+                            n->normalize();
+                            ++n;
+                        }
+
+                        n = vertex.mTangentElements.begin();
+                        while (n != vertex.mTangentElements.end())
+                        {
+                            *n = normalMatrix * (*n);
+                            n->normalize();
+                            ++n;
+                        }
+
+                        nIndex = (int)pBatch->mVB->mVertices.size();
+                        pBatch->mVB->mVertices.push_back(vertex);
+                        pBatch->mSubMesh->mVB->mVertices.push_back(vertex);
+                        remap.insert(std::pair<int, int>(corners[k], nIndex));
+                    }
+
+                    pBatch->mSubMesh->mIndices.push_back(nIndex);
+                }
+            }
+        }
+
+        // 删除原来的网格，合并后的网格已经挂在模型下
+        auto m = oldMeshes.begin();
+        while (m != oldMeshes.end())
+        {
+            pModel->removeChild(*m, true);
+            ++m;
+        }
+
+        // 变换已经烘焙到顶点里，层次结构只剩一个单位变换链接所有合并后的网格
+        mRootTransform->removeAllChildren();
+
+        Transform *pTransform = new Transform("StaticBatch");
+        pTransform->mMatrix = Matrix4::IDENTITY;
+        mRootTransform->addChild(pTransform);
+
+        auto b = results.begin();
+        while (b != results.end())
+        {
+            StaticBatch &batch = *b;
+            pTransform->mEntities.push_back(Transform::Entity(batch.mMesh, batch.mSubMesh));
+            processBoundingBox(batch.mMesh);
+            ++b;
+        }
+
+        MCONV_LOG_INFO("Static batching : %d meshes merged into %d meshes !", (int)oldMeshes.size(), (int)results.size());
+
+        return true;
+    }
+
+    bool FBXConverter::processLod(Node *pNode)
+    {
+        if (pNode->getNodeType() == Node::E_TYPE_MESH)
+        {
+            Mesh *pMesh = (Mesh *)pNode;
+            VertexBuffer *pVB = nullptr;
+
+            if (searchVertexBuffer(pMesh, pVB))
+            {
+                size_t i = 0;
+                for (i = 0; i < pMesh->getChildrenCount(); ++i)
+                {
+                    Node *pChild = pMesh->getChild(i);
+                    if (pChild->getNodeType() != Node::E_TYPE_SUBMESHES)
+                        continue;
+
+                    size_t j = 0;
+                    for (j = 0; j < pChild->getChildrenCount(); ++j)
+                    {
+                        SubMesh *pSubMesh = (SubMesh *)pChild->getChild(j);
+                        generateLod(pVB, pSubMesh);
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        size_t i = 0;
+        for (i = 0; i < pNode->getChildrenCount(); ++i)
+        {
+            Node *pChild = pNode->getChild(i);
+            processLod(pChild);
+        }
+
+        return true;
+    }
+
+    bool FBXConverter::generateLod(VertexBuffer *pVB, SubMesh *pSubMesh)
+    {
+        pSubMesh->mLods.clear();
+
+        const Indices &indices = pSubMesh->mIndices;
+        const int nVertexCount = (int)pVB->mVertices.size();
+
+        // 统计子网格用到的顶点和它们的包围盒
+        std::set<int> used;
+        Vector3 vMin, vMax;
+        auto itr = indices.begin();
+        while (itr != indices.end())
+        {
+            int idx = *itr;
+            ++itr;
+
+            if (idx < 0 || idx >= nVertexCount)
+            {
+                MCONV_LOG_WARNING("Index %d out of range in %s, LOD skipped !", idx, pSubMesh->getID().c_str());
+                return false;
+            }
+
+            const Vector3 &pos = pVB->mVertices[idx].mPosition;
+            if (used.empty())
+            {
+                vMin = vMax = pos;
+            }
+            else
+            {
+                int k = 0;
+                for (k = 0; k < 3; ++k)
+                {
+                    if (pos[k] < vMin[k]) vMin[k] = pos[k];
+                    if (pos[k] > vMax[k]) vMax[k] = pos[k];
+                }
+            }
+            used.insert(idx);
+        }
+
+        Vector3 size = vMax - vMin;
+        Real extent = std::max(size[0], std::max(size[1], size[2]));
+        size_t nTriangleCount = indices.size() / 3;
+
+        if (extent <= Real(0.0) || nTriangleCount < 4)
+        {
+            return true;
+        }
+
+        // 顶点聚类简化：按最长边划分网格，每个格子里的顶点合并到离格子质心最近的那个顶点上。
+        // 只从原始三角形简化，不会累积误差。格子每级减半，三角形减少不到一成的级别直接跳过。
+        int nGridSize = 64;
+        while (nGridSize >= 1 && (int)pSubMesh->mLods.size() < mSettings.mLodLevels)
+        {
+            Real fCellSize = extent / Real(nGridSize);
+            uint32_t nRow = (uint32_t)nGridSize + 1;
+
+            struct Cell
+            {
+                Vector3     mSum;
+                int         mCount;
+                int         mVertex;
+                Real        mDistance;
+            };
+
+            std::map<uint32_t, Cell> cells;
+            std::map<int, uint32_t> vertexCells;
+
+            auto v = used.begin();
+            while (v != used.end())
+            {
+                const Vector3 &pos = pVB->mVertices[*v].mPosition;
+                uint32_t key = 0;
+                int k = 0;
+                for (k = 0; k < 3; ++k)
+                {
+                    int c = (int)((pos[k] - vMin[k]) / fCellSize);
+                    c = std::min(std::max(c, 0), nGridSize - 1);
+                    key = key * nRow + (uint32_t)c;
+                }
+
+                vertexCells[*v] = key;
+
+                auto cell = cells.find(key);
+                if (cell == cells.end())
+                {
+                    Cell c;
+                    c.mSum = pos;
+                    c.mCount = 1;
+                    c.mVertex = -1;
+                    c.mDistance = Real(0.0);
+                    cells.insert(std::pair<uint32_t, Cell>(key, c));
+                }
+                else
+                {
+                    cell->second.mSum += pos;
+                    cell->second.mCount++;
+                }
+
+                ++v;
+            }
+
+            // 每个格子选离质心最近的原始顶点作代表，不生成新顶点，LOD可以和原网格共用顶点缓冲
+            v = used.begin();
+            while (v != used.end())
+            {
+                Cell &cell = cells[vertexCells[*v]];
+                Vector3 center = cell.mSum / Real(cell.mCount);
+                Real dist = (pVB->mVertices[*v].mPosition - center).squaredLength();
+                if (cell.mVertex < 0 || dist < cell.mDistance)
+                {
+                    cell.mVertex = *v;
+                    cell.mDistance = dist;
+                }
+                ++v;
+            }
+
+            SubMesh::LodLevel lod;
+            lod.mScreenSize = 0.0f;
+
+            std::set<std::vector<int>> triangles;
+            itr = indices.begin();
+            while (itr != indices.end())
+            {
+                int corners[3];
+                size_t k = 0;
+                for (k = 0; k < 3 && itr != indices.end(); ++k, ++itr)
+                {
+                    corners[k] = cells[vertexCells[*itr]].mVertex;
+                }
+
+                if (k < 3)
+                    break;
+
+                // 退化成线或者点的三角形去掉
+                if (corners[0] == corners[1] || corners[1] == corners[2] || corners[0] == corners[2])
+                    continue;
+
+                // 旋转到最小索引在前，保留环绕方向的同时去掉重复三角形
+                int first = 0;
+                if (corners[1] < corners[first]) first = 1;
+                if (corners[2] < corners[first]) first = 2;
+                std::vector<int> key(3);
+                key[0] = corners[first];
+                key[1] = corners[(first + 1) % 3];
+                key[2] = corners[(first + 2) % 3];
+
+                if (triangles.insert(key).second)
+                {
+                    lod.mIndices.push_back(corners[0]);
+                    lod.mIndices.push_back(corners[1]);
+                    lod.mIndices.push_back(corners[2]);
+                }
+            }
+
+            nGridSize >>= 1;
+
+            size_t nLodTriangles = lod.mIndices.size() / 3;
+            if (nLodTriangles == 0)
+            {
+                break;
+            }
+
+            if (nLodTriangles * 10 > nTriangleCount * 9)
+            {
+                continue;
+            }
+
+            // 每级在包围球投影高度减半时切换，和格子减半对应
+            lod.mScreenSize = std::pow(0.5f, (float)(pSubMesh->mLods.size() + 1));
+            MCONV_LOG_INFO("LOD %d of %s : %d -> %d triangles", (int)pSubMesh->mLods.size() + 1,
+                pSubMesh->getID().c_str(), (int)pSubMesh->mIndices.size() / 3, (int)nLodTriangles);
+            pSubMesh->mLods.push_back(lod);
+            nTriangleCount = nLodTriangles;
+        }
+
+        return true;
+    }
+
     bool FBXConverter::updateSkinInfo(FbxNode *pFbxNode, size_t boneIdx, const Matrix4 &m)
     {
         bool ret = false;
@@ -1939,7 +2416,7 @@ namespace mconv
             {
                 Vertex &vertex = *itr;
 
-                // ¹
+                // 更新骨骼索引
                 BlendInfo blend;
                 blend.mBlendIndex = nBlendIndex;
                 blend.mBlendWeight = fBlendWeight;
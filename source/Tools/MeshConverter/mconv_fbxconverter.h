@@ -88,29 +88,60 @@ namespace mconv
 
         bool optimizeMesh(Node *pNode);
 
+        // 静态合批，把所有网格烘焙到世界空间后按材质和顶点格式合并
+        struct StaticEntity
+        {
+            Matrix4     mWorld;
+            Mesh        *mMesh;
+            SubMesh     *mSubMesh;
+        };
+
+        typedef std::list<StaticEntity>             StaticEntities;
+        typedef StaticEntities::iterator            StaticEntitiesItr;
+        typedef StaticEntities::const_iterator      StaticEntitiesConstItr;
+
+        struct StaticBatch
+        {
+            Mesh            *mMesh;
+            VertexBuffer    *mVB;
+            SubMesh         *mSubMesh;
+        };
+
+        typedef std::map<String, StaticBatch>       StaticBatches;
+        typedef StaticBatches::iterator             StaticBatchesItr;
+        typedef StaticBatches::const_iterator       StaticBatchesConstItr;
+
+        bool processStaticBatch(Node *pModel);
+        bool collectStaticEntities(Node *pNode, const Matrix4 &m, StaticEntities &entities);
+        StaticBatch createStaticBatch(Node *pModel, int nBatchIdx, VertexBuffer *pSrcVB, SubMesh *pSrcSubMesh);
+
+        // 用顶点聚类给每个子网格生成简化的LOD索引
+        bool processLod(Node *pNode);
+        bool generateLod(VertexBuffer *pVB, SubMesh *pSubMesh);
+
         bool updateSkinInfo(FbxNode *pFbxNode, size_t boneIdx, const Matrix4 &m);
         bool updateBoneMatrix(FbxNode *pFbxNode, const Matrix4 &m, Node *pParent, Node *&pNode);
         bool fixBoneIndex(Bone *pBone);
 
-//         // ĳClusterlink nodeݻȡڵ
+//         // 根据某个Cluster的link node回溯获取骨骼根节点
 //         bool searchSkeletonRoot(FbxNode *pFbxNode, FbxNode *&pFbxRootNode);
-//         // ݹڵ㣬ǷѾɹӦĹ
+//         // 根据骨骼根节点，搜索看是否已经生成过对应的骨骼数据
 //         bool searchSkeleton(FbxNode *pFbxNode);
 
-        // ģǷڱmodel´ڵ
+        // 根据模型名称搜索是否曾经在本model下创建过动画节点
         bool searchAnimation(const String &name, Node *pNode, Animation *&pAnim);
-        // ݶƣǷѾڸö
+        // 根据动作名称，搜索是否已经存在该动作
         bool searchAction(const String &name, Animation *pAnim, Action *&pAction);
 
-        // ¶еĹ͹Ȩֵ
+        // 更新顶点中的骨骼索引和骨骼权重值
         bool updateVertexBlendIndexAndWeight(Mesh *pMesh, int nCtrlPointIdx, int nBlendIndex, double fBlendWeight);
         bool updateVertexBlendIndexAndWeight(VertexBuffer *pVB, int nCtrlPointIndex, int nBlendIndex, double fBlendWeight);
         void putVertexBlendAndWeightAttributes(VertexBuffer *pVB);
 
-        // ӹȨغ͹
+        // 添加骨骼权重和骨骼索引到顶点属性里
         void updateVertexBlendAttributes(Mesh *pMesh);
 
-        // FBXwrapģʽתַ
+        // 从FBX的纹理wrap模式转换成字符串
         String FbxWrapModeToString(FbxTexture::EWrapMode eWrapMode) const;
 
         bool searchMaterial(const String &name, Material *&pMaterial);
@@ -133,28 +164,28 @@ namespace mconv
         void        *mSrcData;
         void        *mDstData;
 
-        Node        *mCurScene;         // ǰڵ㣬split modeǻ仯ģmergeshared vertexԶֻһ
-        Node        *mCurModel;         // ǰģͽڵ
-        Node        *mCurMesh;          // ڹģʽĵǰڵ
-        Node        *mCurSubMeshes;     // ڹģʽĵǰ񼯺Ͻڵ
-        Node        *mCurSkeleton;      // ڵ
-        Node        *mCurAnimation;     // ڵ
-        Node        *mCurMaterials;     // ֻmergeshared vertexļʽ
-//         Node        *mCurBound;         // ǰײspliteģʽmergeģʽshared vertexģʽmodelֻһbound
-        Node        *mRootTransform;    // 任
-        Node        *mCurSkin;          // ǰƤϢ
+        Node        *mCurScene;         // 当前场景节点，对于split mode是会变化的，对于merge和shared vertex永远只有一个不变的
+        Node        *mCurModel;         // 当前模型节点
+        Node        *mCurMesh;          // 用于共享顶点模式的当前网格节点
+        Node        *mCurSubMeshes;     // 用于共享顶点模式的当前子网格集合节点
+        Node        *mCurSkeleton;      // 骨骼节点
+        Node        *mCurAnimation;     // 动画节点
+        Node        *mCurMaterials;     // 只用于merge和shared vertex文件格式下
+//         Node        *mCurBound;         // 当前的碰撞区，不管是splite模式、merge模式、还是shared vertex模式，整个model只有一个bound
+        Node        *mRootTransform;    // 场景变换根结点
+        Node        *mCurSkin;          // 当前蒙皮信息结点
 
         Bones       mBones;
 
-        uint16_t    mMaxBoneIdx;        // ֵ
-        uint16_t    mBoneIdx;           // ƤϢĹ
+        uint16_t    mMaxBoneIdx;        // 骨骼最大索引值
+        uint16_t    mBoneIdx;           // 蒙皮信息的骨骼索引
 
 //         Skeletons   mSkeletons;
         bool        mHasSkeleton;
         bool        mHasVertexBlending;
         bool        mHasAnimation;
 
-        int         mBoneCount;         // ¼Ҫڲ֪Ϊoffset matrixskeleton hiarachyĹв
+        int         mBoneCount;         // 用来记录骨骼数量，主要用于不知道为何offset matrix和skeleton hiarachy里面的骨骼数有差异
     };
 }
 
@@ -71,7 +71,7 @@ namespace mconv
         // Destroy the importer
         pFbxImporter->Destroy();
 
-        // ͳһлOpenGLϵΪλϵ
+        // 统一切换成OpenGL的右手坐标系和以米为单位的坐标系
         FbxAxisSystem SceneAxisSystem = mFbxScene->GetGlobalSettings().GetAxisSystem();
         FbxAxisSystem OurAxisSystem(FbxAxisSystem::eYAxis, FbxAxisSystem::eParityOdd, FbxAxisSystem::eRightHanded);
         if (SceneAxisSystem != OurAxisSystem)
@@ -92,10 +92,10 @@ namespace mconv
         }
         
 //         FbxAxisSystem::OpenGL.ConvertScene(mFbxScene);
-        // ͳһ1Ϊλ
+        // 统一以1米为单位
 //         FbxSystemUnit::m.ConvertScene(mFbxScene);
         MCONV_LOG_INFO("Start converting face to triangles ......");
-        // ΪmeshͳһתΪmesh
+        // 不是三角形为面的mesh，统一转换成三角形为面的mesh
         FbxGeometryConverter converter(mFbxManager);
         converter.Triangulate(mFbxScene, true);
         MCONV_LOG_INFO("Completed converting face to triangles !");
@@ -114,7 +114,7 @@ namespace mconv
 
     bool FbxSerializer::initFBXObjects()
     {
-        // FBX SDK Manager
+        // 创建FBX SDK Manager
         destroyFBXObjects();
 
         mFbxManager = FbxManager::Create();
@@ -124,7 +124,7 @@ namespace mconv
             return false;
         }
 
-        // IOSettings object
+        // 创建IOSettings object
         FbxIOSettings *pIOSettings = FbxIOSettings::Create(mFbxManager, IOSROOT);
         mFbxManager->SetIOSettings(pIOSettings);
 
@@ -46,7 +46,7 @@ namespace mconv
         }
 
         size_t  mMeshCount;
-        bool    mSharedVertex;      /// Ƿ㻺
+        bool    mSharedVertex;      /// 是否共享顶点缓存
     };
 }
 
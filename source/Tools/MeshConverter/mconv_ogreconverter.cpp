@@ -533,7 +533,7 @@ namespace mconv
                 {
                     bHasSharedVertices = submesh.hasSharedVertices;
 
-                    // һsubmeshڴŹĶ
+                    // 第一个submesh，用于存放共享的顶点数据
                     result = createMesh(pModel, pGlobalMesh, pGlobalSubMeshes, i);
                     result = result && processOgreGeometry(mesh.geometry, pGlobalMesh);
                 }
@@ -551,7 +551,7 @@ namespace mconv
             }
             else
             {
-                // submeshԼݣҪһmesh
+                // submesh自己独享顶点数据，需要创建一个mesh出来
                 pModel->mMeshCount++;
 
                 if (i == 0)
@@ -642,7 +642,7 @@ namespace mconv
 
                     if (pNode->getNodeType() == Node::E_TYPE_VERTEX_BUFFER)
                     {
-                        // Ҹpositionݷõvertex buffer
+                        // 查找跟position顶点数据放置的vertex buffer
                         VertexBuffer *pVB = (VertexBuffer *)pNode;
                         auto itr = pVB->mAttributes.begin();
 
@@ -714,7 +714,7 @@ namespace mconv
         {
             if (!searchVertexAttribute(pVB, VertexAttribute::E_VT_BLEND_INDEX))
             {
-                // ûԣӶ
+                // 没有这个顶点属性，先添加顶点属性
                 putVertexBlendAndWeightAttributes(pVB);
             }
 
@@ -753,7 +753,7 @@ namespace mconv
 
         if (result)
         {
-            // Ȳskeleton
+            // 先查找skeleton
             Skeleton *pSkel = nullptr;
             size_t i = 0;
             result = false;
@@ -811,7 +811,7 @@ namespace mconv
             pModel->addChild(pSkel);
             pSkel->mBoneCount = skeleton.bones.size();
 
-            // ȷй
+            // 先分配所有骨骼结点对象
             mBones.resize(skeleton.bones.size(), nullptr);
             size_t i = 0;
             for (i = 0; i < mBones.size(); ++i)
@@ -820,7 +820,7 @@ namespace mconv
                 mBones[i]->mBoneIndex = i;
             }
 
-            // ιϵͼ任
+            // 构建树形骨骼关系和计算变换矩阵
             auto itr = skeleton.bones.begin();
 
             while (itr != skeleton.bones.end())
@@ -841,7 +841,7 @@ namespace mconv
                     pParent->addChild(pBone);
                 }
 
-                // 任
+                // 计算变换矩阵
                 Matrix4 R(bone.orientation);
                 Matrix4 T(bone.position);
                 Matrix4 S;
@@ -869,7 +869,7 @@ namespace mconv
             pAnimation->addChild(pAction);
             pAction->mDuration = action.length;
 
-            // Ȱйؼ֡任Ϊذ󶨹Ժ֡֡㵱ǰ֡ľԱ任
+            // 先把所有骨骼关键帧变换矩阵重置为本地绑定骨骼矩阵，稍后按照帧来逐帧计算当前帧的绝对变换
             size_t idx = 0;
             for (idx = 0; idx < mBones.size(); ++idx)
             {
@@ -297,7 +297,7 @@ namespace mconv
 
         if (strings.size() == 1)
         {
-            // ֻһvertexcolourĿǰʱ֧֣
+            // 只有一个参数，是vertexcolour，目前暂时不支持，先跳过吧
         }
         else if (strings.size() == 3 || strings.size() == 4)
         {
@@ -324,7 +324,7 @@ namespace mconv
 
         if (strings.size() == 1)
         {
-            // ֻһvertexcolourĿǰʱ֧֣
+            // 只有一个参数，是vertexcolour，目前暂时不支持，先跳过吧
         }
         else if (strings.size() == 3 || strings.size() == 4)
         {
@@ -351,7 +351,7 @@ namespace mconv
 
         if (strings.size() == 2)
         {
-            // 2vertexcolourshininessĿǰshininess
+            // 2个参数，是vertexcolour和shininess，目前先用shininess
             pass.shininess = StringConverter::parseReal(strings[1]);
         }
         else if (strings.size() == 4 || strings.size() == 5)
@@ -380,7 +380,7 @@ namespace mconv
 
         if (strings.size() == 1)
         {
-            // ֻһvertexcolourĿǰʱ֧֣
+            // 只有一个参数，是vertexcolour，目前暂时不支持，先跳过吧
         }
         else if (strings.size() == 3 || strings.size() == 4)
         {
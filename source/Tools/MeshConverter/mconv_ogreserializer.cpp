@@ -135,7 +135,7 @@ namespace mconv
             size_t bytesOfRead = 0;
             uint16_t id;
 
-            // ȡǷС˽ʶ
+            // 读取是否大小端交换标识
             bytesOfRead = fs.read(&id, sizeof(id));
 
             if (id == OGRE_HEADER)
@@ -155,7 +155,7 @@ namespace mconv
 
             if (ret)
             {
-                // ȡ汾
+                // 读取版本号
                 OgreChunkData data;
                 String version = readString(fs, data);
 
@@ -308,7 +308,7 @@ namespace mconv
                 break;
             default:
                 {
-                    // Ҫchunk
+                    // 跳过不需要解析的chunk
                     size_t offset = data.header.length - data.read;
                     stream.seek(offset, true);
                     data.read += offset;
@@ -353,7 +353,7 @@ namespace mconv
                 break;
             default:
                 {
-                    // Ҫchunk
+                    // 跳过不需要解析的chunk
                     size_t offset = data.header.length - data.read;
                     stream.seek(offset, true);
                     data.read += offset;
@@ -401,7 +401,7 @@ namespace mconv
                 break;
             default:
                 {
-                    // Ҫchunk
+                    // 跳过不需要解析的chunk
                     size_t offset = data.header.length - data.read;
                     stream.seek(offset, true);
                     data.read += offset;
@@ -507,7 +507,7 @@ namespace mconv
                 break;
             default:
                 {
-                    // Լchunk
+                    // 不是自己负责解析的chunk，返回跳出，交给外面来解析处理
                     long_t read = data.read;
                     stream.seek(-read, true);
                     return true;
@@ -587,7 +587,7 @@ namespace mconv
                 break;
             default:
                 {
-                    // Լchunk
+                    // 不是自己负责解析的chunk，返回跳出，交给外面来解析处理
                     long_t read = data.read;
                     stream.seek(-read, true);
                     return true;
@@ -627,7 +627,7 @@ namespace mconv
             size_t bytesOfRead = 0;
             uint16_t id;
 
-            // ȡǷС˽ʶ
+            // 读取是否大小端交换标识
             bytesOfRead = fs.read(&id, sizeof(id));
 
             if (id == OGRE_HEADER)
@@ -647,7 +647,7 @@ namespace mconv
 
             if (ret)
             {
-                // ȡ汾
+                // 读取版本号
                 OgreChunkData data;
                 String version = readString(fs, data);
 
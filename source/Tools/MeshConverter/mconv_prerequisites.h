@@ -67,13 +67,13 @@ namespace mconv
 
     enum FileType
     {
-        E_FILETYPE_AUTO     = 0,        /// չԶжļʽ
-        E_FILETYPE_FBX      = 0x10,     /// FBXʽ
-        E_FILETYPE_DAE      = 0x20,     /// DAEʽ
-        E_FILETYPE_T3B      = 0x40,     /// T3DƸʽ
-        E_FILETYPE_T3T      = 0x41,     /// T3DıXMLʽ
-        E_FILETYPE_OGRE     = 0x50,     /// Ogreļʽ
-        E_FILETYPE_T3D      = E_FILETYPE_T3B|E_FILETYPE_T3T,  /// T3Dƺıʽ
+        E_FILETYPE_AUTO     = 0,        /// 根据扩展名自动判断文件格式
+        E_FILETYPE_FBX      = 0x10,     /// FBX格式
+        E_FILETYPE_DAE      = 0x20,     /// DAE格式
+        E_FILETYPE_T3B      = 0x40,     /// T3D二进制格式
+        E_FILETYPE_T3T      = 0x41,     /// T3D文本XML格式
+        E_FILETYPE_OGRE     = 0x50,     /// Ogre文件格式
+        E_FILETYPE_T3D      = E_FILETYPE_T3B|E_FILETYPE_T3T,  /// T3D二进制和文本格式
     };
 
     enum BoundType
@@ -84,8 +84,9 @@ namespace mconv
 
     enum FileMode
     {
-        E_FM_SHARE_VERTEX = 0,              /// fbxжmeshʱԶϲһmodelȫһļУҹ㻺
-        E_FM_ORIGINAL,                      /// άfbxеԭʼṹжmeshͶmeshֻһmeshһmesh
+        E_FM_SHARE_VERTEX = 0,              /// fbx中有多个mesh的时候会自动合并成一个model，全部都在一个文件中，并且共享顶点缓存
+        E_FM_ORIGINAL,                      /// 维持fbx中的原始结构，如果有多个mesh就多个mesh，只有一个mesh就一个mesh
+        E_FM_STATIC_BATCH,                  /// 静态合批，烘焙世界变换后按材质和顶点格式合并，每个mesh不超过16位索引范围
     };
 
     typedef std::list<Vector2>              VectorElements2;
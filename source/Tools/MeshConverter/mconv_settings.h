@@ -34,22 +34,25 @@ namespace mconv
             , mDstType(E_FILETYPE_T3D)
             , mBoundType(E_BT_AABB)
             , mFileMode(E_FM_SHARE_VERTEX)
+            , mLodLevels(0)
             , mVerbose(true)
         {
 
         }
 
-        String  mSrcPath;       /// ļ·ļǾ·ʱĬexeͬĿ¼ļ
-        String  mDstPath;       /// ļ·ļΪʱĬmSrcPath·ļ
+        String  mSrcPath;       /// 输入文件路径和文件名，当不是绝对路径时，默认是exe同级目录的文件
+        String  mDstPath;       /// 输出文件路径和文件名，当为空时，则默认用mSrcPath的路径和文件名
 
-        String  mExtraPath;     /// ·OGREmeshʱӦĲļ
+        String  mExtraPath;     /// 附加路径，在OGRE的mesh时，这个是相应的材质文件
 
-        FileType    mSrcType;   /// ļͣ
+        FileType    mSrcType;   /// 输入文件类型，
         FileType    mDstType;
 
         BoundType   mBoundType;
         FileMode    mFileMode;
 
+        int     mLodLevels;     /// 每个子网格生成的LOD级数，0表示不生成LOD
+
         bool    mVerbose;
     };
 }
@@ -56,10 +56,10 @@ namespace mconv
                 return false;
             }
 
-            // 
+            // 重新声明名字
             this->mID = name;
 
-            // ɶ
+            // 生成顶点索引
             auto itr = mVB->mVertices.begin();
 
             while (itr != mVB->mVertices.end())
@@ -89,10 +89,22 @@ namespace mconv
             return true;
         }
 
+        // 一级LOD，使用和原始索引相同的顶点，只是索引简化过
+        struct LodLevel
+        {
+            float       mScreenSize;    // 包围球投影到屏幕高度的比例低于这个值时切换到这一级
+            Indices     mIndices;
+        };
+
+        typedef std::list<LodLevel>         LodLevels;
+        typedef LodLevels::iterator         LodLevelsItr;
+        typedef LodLevels::const_iterator   LodLevelsConstItr;
+
         int             mMaterialIdx;
         String          mMaterialName;
         VertexBuffer    *mVB;
         Indices         mIndices;
+        LodLevels       mLods;          // 从精细到粗糙排列的LOD
     };
 
     class SubMeshes : public Node
@@ -73,6 +73,8 @@ namespace mconv
     const char * const T3DXMLSerializer::TAG_SUBMESHES = "submeshes";
     const char * const T3DXMLSerializer::TAG_SUBMESH = "submesh";
     const char * const T3DXMLSerializer::TAG_INDICES = "indices";
+    const char * const T3DXMLSerializer::TAG_LODS = "lods";
+    const char * const T3DXMLSerializer::TAG_LOD = "lod";
     const char * const T3DXMLSerializer::TAG_MATERIALS = "materials";
     const char * const T3DXMLSerializer::TAG_MATERIAL = "material";
     const char * const T3DXMLSerializer::TAG_MODE = "mode";
@@ -127,6 +129,7 @@ namespace mconv
     const char * const T3DXMLSerializer::ATTRIB_MESH = "mesh";
     const char * const T3DXMLSerializer::ATTRIB_SUBMESH = "submesh";
     const char * const T3DXMLSerializer::ATTRIB_INDEX = "index";
+    const char * const T3DXMLSerializer::ATTRIB_SCREEN = "screen";
 
     T3DXMLSerializer::T3DXMLSerializer()
     {
@@ -430,7 +433,7 @@ namespace mconv
         pBufferElement->SetAttribute(ATTRIB_ID, pVB->getID().c_str());
         pParentElem->LinkEndChild(pBufferElement);
 
-        // 
+        // 属性
         XMLElement *pAttribRootElement = pDoc->NewElement(TAG_ATTRIBUTES);
         pAttribRootElement->SetAttribute(ATTRIB_COUNT, pVB->mAttributes.size());
         pBufferElement->LinkEndChild(pAttribRootElement);
@@ -450,7 +453,7 @@ namespace mconv
             ++itrAttrib;
         }
 
-        // 
+        // 顶点数据
         XMLElement *pVertexElement = pDoc->NewElement(TAG_DATA);
         pBufferElement->LinkEndChild(pVertexElement);
         pVertexElement->SetAttribute(ATTRIB_COUNT, pVB->mVertices.size());
@@ -587,7 +590,7 @@ namespace mconv
                 }
                 else if (attribute.mVertexType == VertexAttribute::E_VT_BLEND_WEIGHT)
                 {
-                    // BLEND_WEIGHT ֻдȨ4
+                    // BLEND_WEIGHT 只写权重最大的4个顶点
                     if (vertex.mBlendInfo.size() > 0)
                     {
                         ss << " ";
@@ -622,7 +625,7 @@ namespace mconv
                 }
                 else if (attribute.mVertexType == VertexAttribute::E_VT_BLEND_INDEX)
                 {
-                    // BLEND_INDEX ֻдȨ4
+                    // BLEND_INDEX 只写权重最大的4个顶点
                     int i = 0;
                     auto itrBlend = vertex.mBlendInfo.rbegin();
                     while (itrBlend != vertex.mBlendInfo.rend())
@@ -769,7 +772,7 @@ namespace mconv
 //                 }
 //             }
 // 
-//             // BLEND_WEIGHT ֻдȨ4
+//             // BLEND_WEIGHT 只写权重最大的4个顶点
 //             if (vertex.mBlendInfo.size() > 0)
 //             {
 //                 ss << " ";
@@ -803,7 +806,7 @@ namespace mconv
 //                     ss << " ";
 //                 }
 // 
-//                 // BLEND_INDEX ֻдȨ4
+//                 // BLEND_INDEX 只写权重最大的4个顶点
 //                 i = 0;
 //                 itrBlend = vertex.mBlendInfo.rbegin();
 //                 while (itrBlend != vertex.mBlendInfo.rend())
@@ -901,26 +904,61 @@ namespace mconv
         pSubmeshElement->SetAttribute(ATTRIB_COUNT, nTriangleCount);
         pSubmeshElement->SetAttribute(ATTRIB_MATERIAL, pSubMesh->mMaterialName.c_str());
 
-        // 
+        // 顶点索引
+        buildXMLIndices(pDoc, pSubmeshElement, pSubMesh->mIndices, "\n\t\t\t\t\t\t");
+
+        // LOD索引，和子网格共用同一份顶点，只是三角形更少
+        if (!pSubMesh->mLods.empty())
+        {
+            XMLElement *pLodsElement = pDoc->NewElement(TAG_LODS);
+            pSubmeshElement->LinkEndChild(pLodsElement);
+            pLodsElement->SetAttribute(ATTRIB_COUNT, pSubMesh->mLods.size());
+
+            auto itr = pSubMesh->mLods.begin();
+            while (itr != pSubMesh->mLods.end())
+            {
+                const SubMesh::LodLevel &lod = *itr;
+                XMLElement *pLodElement = pDoc->NewElement(TAG_LOD);
+                pLodsElement->LinkEndChild(pLodElement);
+                pLodElement->SetAttribute(ATTRIB_SCREEN, lod.mScreenSize);
+                buildXMLIndices(pDoc, pLodElement, lod.mIndices, "\n\t\t\t\t\t\t\t\t");
+                ++itr;
+            }
+        }
+
+        return pSubmeshElement;
+    }
+
+    XMLElement *T3DXMLSerializer::buildXMLIndices(XMLDocument *pDoc, XMLElement *pParentElem, const Indices &indices, const String &indent)
+    {
         XMLElement *pIndicesElement = pDoc->NewElement(TAG_INDICES);
-        pSubmeshElement->LinkEndChild(pIndicesElement);
+        pParentElem->LinkEndChild(pIndicesElement);
 
-        pIndicesElement->SetAttribute(ATTRIB_COUNT, nIndexCount);
-        bool b16Bits = (nIndexCount > 0xFFFF ? false : true);
+        pIndicesElement->SetAttribute(ATTRIB_COUNT, indices.size());
+        // 是否16位索引取决于索引值的范围，而不是索引的数量
+        int nMaxIndex = 0;
+        auto it = indices.begin();
+        while (it != indices.end())
+        {
+            if (*it > nMaxIndex)
+                nMaxIndex = *it;
+            ++it;
+        }
+        bool b16Bits = (nMaxIndex > 0xFFFF ? false : true);
         pIndicesElement->SetAttribute(ATTRIB_16BITS, b16Bits);
 
         std::stringstream ss;
-        ss << "\n\t\t\t\t\t\t\t";
+        ss << indent << "\t";
         size_t i = 0;
-        auto itr = pSubMesh->mIndices.begin();
-        while (itr != pSubMesh->mIndices.end())
+        auto itr = indices.begin();
+        while (itr != indices.end())
         {
             int nIndex = *itr;
             ss << nIndex << " ";
 
             if (i == 32)
             {
-                ss << "\n\t\t\t\t\t\t\t";
+                ss << indent << "\t";
                 XMLText *pText = pDoc->NewText(ss.str().c_str());
                 pIndicesElement->LinkEndChild(pText);
                 ss.clear();
@@ -932,18 +970,11 @@ namespace mconv
             ++itr;
         }
 
-        //         if ((nIndexCount & 31) != 0)
-        //         {
-        //             /// жģҪдȥ
-        //             XMLText *pText = pDoc->NewText(ss.str().c_str());
-        //             pIndicesElement->LinkEndChild(pText);
-        //         }
-
-        ss << "\n\t\t\t\t\t\t";
+        ss << indent;
         XMLText *pText = pDoc->NewText(ss.str().c_str());
         pIndicesElement->LinkEndChild(pText);
 
-        return pSubmeshElement;
+        return pIndicesElement;
     }
 
     //     XMLElement *T3DXMLSerializer::buildXMLMaterials(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode)
@@ -986,7 +1017,7 @@ namespace mconv
         Material *pMaterial = (Material *)pNode;
         pMatElement->SetAttribute(ATTRIB_ID, pMaterial->getID().c_str());
 
-        // shader㷨
+        // shader算法
         XMLElement *pModeElement = pDoc->NewElement(TAG_MODE);
         pMatElement->LinkEndChild(pModeElement);
         XMLText *pText = pDoc->NewText(pMaterial->mMode.c_str());
@@ -1374,7 +1405,7 @@ namespace mconv
         pNodeElement->SetAttribute(ATTRIB_ID, pNode->getID().c_str());
 
 #if 0
-        // RTS
+        // 解出RTS
         Transform *pTransform = (Transform *)pNode;
         Vector3 pos, scale;
         Quaternion orientation;
@@ -19,7 +19,7 @@
 
 
 /**
- * ת*.t3db (xml) ʽ£
+ * 转换后的*.t3db (xml) 格式如下：
  *      <?xml version="1.0" encoding="utf-8"?>
  *      <TINY3D xmlns="xxx" version="0.0.1">
  *      <scene>
@@ -295,6 +295,8 @@ namespace mconv
         static const char * const TAG_SUBMESHES;
         static const char * const TAG_SUBMESH;
         static const char * const TAG_INDICES;
+        static const char * const TAG_LODS;
+        static const char * const TAG_LOD;
         static const char * const TAG_MATERIALS;
         static const char * const TAG_MATERIAL;
         static const char * const TAG_MODE;
@@ -350,6 +352,7 @@ namespace mconv
         static const char * const ATTRIB_MESH;
         static const char * const ATTRIB_SUBMESH;
         static const char * const ATTRIB_INDEX;
+        static const char * const ATTRIB_SCREEN;
 
         T3DXMLSerializer();
         virtual ~T3DXMLSerializer();
@@ -366,6 +369,7 @@ namespace mconv
         XMLElement *buildXMLVertexBuffer(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
         XMLElement *buildXMLSubMeshes(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
         XMLElement *buildXMLSubMesh(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
+        XMLElement *buildXMLIndices(XMLDocument *pDoc, XMLElement *pParentElem, const Indices &indices, const String &indent);
         XMLElement *buildXMLAnimation(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
         XMLElement *buildXMLAction(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
         XMLElement *buildXMLTextures(XMLDocument *pDoc, XMLElement *pParentElem, Node *pNode);
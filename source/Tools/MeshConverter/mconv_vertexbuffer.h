@@ -127,7 +127,7 @@ namespace mconv
 
             VerticesDict vertices;
 
-            // һɨ裬޳ͬĶ
+            // 第一遍扫描，剔除所有相同的顶点
             int count = 0;
             auto itr = mVertices.begin();
             while (itr != mVertices.end())
@@ -163,7 +163,7 @@ namespace mconv
                 ++itr;
             }
 
-//             // ڶɨ裬ɶ
+//             // 第二遍扫描，生成顶点索引
 //             itr = mVertices.begin();
 //             while (itr != mVertices.end())
 //             {
@@ -188,7 +188,7 @@ namespace mconv
 //                 ++itr;
 //             }
 
-            // ö㻺
+            // 重置顶点缓存
             mVertices.clear();
             auto i = vertices.begin();
             while (i != vertices.end())